@@ -29,14 +29,19 @@ More explicit license information at the end of file.
 
 /* Inclusion */
 	
-	// Inlcude glad for OpenGL loading
+	// Include muCOSA's header first (so that it can ask for the features that
+	// it needs before any system header is included)
+	#define MUCOSA_NAMES // For name functions
+	#define MU_SUPPORT_OPENGL
+	#include "muCOSA.h"
+
+	// Inlcude glad for OpenGL loading (before muCOSA's source code, which would
+	// otherwise include OpenGL itself)
 	#define GLAD_GL_IMPLEMENTATION
 	#include "glad.h"
 
-	// Include muCOSA
-	#define MUCOSA_NAMES // For name functions
-	#define MU_SUPPORT_OPENGL
-	#define MUCOSA_IMPLEMENTATION // For source code
+	// Include muCOSA's source code
+	#define MUCOSA_IMPLEMENTATION
 	#include "muCOSA.h"
 	
 	// Include stdio for print functions
@@ -87,7 +92,11 @@ More explicit license information at the end of file.
 		// Pixel format
 		&format,
 		// Callbacks (set later after OpenGL is binded)
-		0
+		0,
+		// Event capacity (none)
+		0,
+		// Coalescing (none)
+		MU_FALSE
 	};
 
 	// Window keyboard map
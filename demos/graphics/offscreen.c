@@ -0,0 +1,215 @@
+/*
+============================================================
+                        DEMO INFO
+
+DEMO NAME:          offscreen.c
+DEMO WRITTEN BY:
+CREATION DATE:
+LAST UPDATED:
+
+============================================================
+                        DEMO PURPOSE
+
+This demo shows how OpenGL contexts can be created without
+any window, and measures how many can be created per
+second.
+
+Program should repeatedly create an offscreen OpenGL
+context, bind it, clear it, and destroy it, and then print
+how many contexts were created per second. By default, this
+runs on the headless window system, so no display is
+needed; it works with software rasterizers such as Mesa's
+llvmpipe.
+
+============================================================
+                        LICENSE INFO
+
+All code is licensed under MIT License or public domain, 
+whichever you prefer.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+/* Inclusion */
+
+	// Include muCOSA
+	#define MUCOSA_NAMES // For name functions
+	#define MU_SUPPORT_OPENGL
+	#define MUCOSA_IMPLEMENTATION // For source code
+	#include "muCOSA.h"
+
+	// Include stdio for print functions
+	#include <stdio.h>
+
+	// Include time for measuring real time
+	// (The headless window system's clock is virtual)
+	#include <time.h>
+
+/* Variables */
+
+	// Global context
+	muCOSAContext muCOSA;
+
+	// The window system
+	muWindowSystem window_system = MU_WINDOW_HEADLESS;
+
+	// Graphics API of each context
+	muGraphicsAPI api = MU_OPENGL_3_3_CORE;
+
+	// Amount of contexts created
+	#define CONTEXT_COUNT 200
+
+	// Pixel format (no depth or stencil, as nothing is rendered in 3D)
+	muPixelFormat format = {
+		// RGBA bits
+		8, 8, 8, 8,
+		// Depth bits
+		0,
+		// Stencil bits
+		0,
+		// Samples
+		1,
+	};
+
+/* OpenGL functions */
+
+	// (Loaded by hand to avoid needing a loader for two functions)
+	#define COLOR_BUFFER_BIT 0x00004000
+	void (*clear)(unsigned int mask);
+	void (*finish)(void);
+
+	// Loads the OpenGL functions used with the currently bound context
+	muBool load_gl_funcs(void) {
+		void* clear_ptr = mu_gl_get_proc_address("glClear");
+		void* finish_ptr = mu_gl_get_proc_address("glFinish");
+		if (!clear_ptr || !finish_ptr) {
+			return MU_FALSE;
+		}
+		mu_memcpy(&clear, &clear_ptr, sizeof(void*));
+		mu_memcpy(&finish, &finish_ptr, sizeof(void*));
+		return MU_TRUE;
+	}
+
+int main(void)
+{
+
+/* Initiation */
+
+	// Initiate muCOSA
+	muCOSA_context_create(&muCOSA, window_system, MU_TRUE);
+
+	// Print currently running window system
+	printf("Running window system \"%s\"\n",
+		mu_window_system_get_nice_name(muCOSA_context_get_window_system(&muCOSA))
+	);
+
+	// Create the first context separately, as it also initializes OpenGL
+	// for the muCOSA context, and use it to load functions
+	clock_t start = clock();
+	muGLContext gl = mu_gl_context_create_offscreen(api, &format);
+	if (!gl) {
+		printf("Failed to create offscreen OpenGL context; result: %s\n",
+			muCOSA_result_get_name(muCOSA.result)
+		);
+		muCOSA_context_destroy(&muCOSA);
+		return -1;
+	}
+	mu_gl_bind(0, gl);
+	muBool loaded = load_gl_funcs();
+	mu_gl_bind(0, 0);
+	mu_gl_context_destroy(0, gl);
+	double init_time = (double)(clock() - start) / (double)CLOCKS_PER_SEC;
+
+	if (!loaded) {
+		printf("Failed to load OpenGL functions\n");
+		muCOSA_context_destroy(&muCOSA);
+		return -1;
+	}
+
+/* Benchmark */
+
+	// Create, bind, clear, and destroy a context each iteration
+	size_m created = 0;
+	start = clock();
+	for (size_m i = 0; i < CONTEXT_COUNT; ++i) {
+		gl = mu_gl_context_create_offscreen(api, &format);
+		if (!gl) {
+			break;
+		}
+		++created;
+
+		mu_gl_bind(0, gl);
+		clear(COLOR_BUFFER_BIT);
+		finish();
+		mu_gl_bind(0, 0);
+
+		mu_gl_context_destroy(0, gl);
+	}
+	double time = (double)(clock() - start) / (double)CLOCKS_PER_SEC;
+
+	// Print results
+	printf("First context (including initialization) took %f seconds\n", init_time);
+	printf("Created %i contexts in %f seconds (%f contexts per second)\n",
+		(int)created, time, (time > 0.0) ? (double)created / time : 0.0
+	);
+
+/* Termination */
+
+	// Terminate muCOSA (required)
+	muCOSA_context_destroy(&muCOSA);
+
+	// Print possible error
+	if (muCOSA.result != MUCOSA_SUCCESS) {
+		printf("Something went wrong during the program's lifespan; result: %s\n",
+			muCOSA_result_get_name(muCOSA.result)
+		);
+	} else {
+		printf("Successful\n");
+	}
+
+	return 0;
+}
+
+/*
+------------------------------------------------------------------------------
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2024 Hum
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+------------------------------------------------------------------------------
+*/
+
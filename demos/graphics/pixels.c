@@ -0,0 +1,193 @@
+/*
+============================================================
+                        DEMO INFO
+
+DEMO NAME:          pixels.c
+DEMO WRITTEN BY:
+CREATION DATE:
+LAST UPDATED:
+
+============================================================
+                        DEMO PURPOSE
+
+This demo shows how to present pixels rendered on the CPU
+to a window without using a graphics API.
+
+Program should pop up a window on screen named "Pixels"
+showing a scrolling color gradient that fills the window,
+even as it's resized. The two pixel buffers owned by the
+window are used alternately, so that one can be drawn to
+while the other is still being presented.
+
+============================================================
+                        LICENSE INFO
+
+All code is licensed under MIT License or public domain, 
+whichever you prefer.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+/* Inclusion */
+
+	// Include muCOSA
+	#define MUCOSA_NAMES // For name functions
+	#define MUCOSA_IMPLEMENTATION // For source code
+	#include "muCOSA.h"
+
+	// Include stdio for print functions
+	#include <stdio.h>
+
+/* Variables */
+	
+	// Global context
+	muCOSAContext muCOSA;
+
+	// The window system
+	muWindowSystem window_system = MU_WINDOW_NULL; // (Auto)
+
+	// Window handle
+	muWindow win;
+
+	// Window information
+	muWindowInfo wininfo = {
+		// Title
+		(char*)"Pixels",
+		// Resolution (width & height)
+		800, 600,
+		// Min/Max resolution (none)
+		0, 0, 0, 0,
+		// Coordinates (x and y)
+		50, 50,
+		// Pixel format (default)
+		0,
+		// Callbacks (none)
+		0,
+		// Event capacity (none)
+		0,
+		// Coalescing (none)
+		MU_FALSE
+	};
+
+	// Amount of frames presented
+	uint32_m frame = 0;
+
+int main(void)
+{
+
+/* Initiation */
+
+	// Initiate muCOSA
+	muCOSA_context_create(&muCOSA, window_system, MU_TRUE);
+
+	// Print currently running window system
+	printf("Running window system \"%s\"\n",
+		mu_window_system_get_nice_name(muCOSA_context_get_window_system(&muCOSA))
+	);
+
+	// Create window
+	win = mu_window_create(&wininfo);
+
+/* Main loop */
+
+	// Set up a loop that continues as long as the window isn't closed
+
+	while (!mu_window_get_closed(win))
+	{
+		// Get the current dimensions of the window
+		uint32_m dim[2];
+		mu_window_get(win, MU_WINDOW_DIMENSIONS, dim);
+
+		// Get a pixel buffer that isn't being presented
+		// (If both are still being presented, just try again next frame)
+		uint32_m stride;
+		muCOSAResult result = MUCOSA_SUCCESS;
+		uint32_m* pixels = mu_window_get_pixels_(&result, win, dim[0], dim[1], &stride);
+
+		if (pixels) {
+			// Draw a scrolling gradient
+			for (uint32_m y = 0; y < dim[1]; ++y) {
+				uint32_m* row = (uint32_m*)((uint8_m*)pixels + y*stride);
+				for (uint32_m x = 0; x < dim[0]; ++x) {
+					uint32_m r = ((x + frame) * 255) / (dim[0] + 1);
+					uint32_m g = (y * 255) / (dim[1] + 1);
+					uint32_m b = frame & 0xFF;
+					row[x] = ((r & 0xFF) << 16) | (g << 8) | b;
+				}
+			}
+
+			// Present the entire buffer
+			mu_window_present_pixels(win, pixels, stride, 0);
+			++frame;
+		}
+
+		// Update window (which refreshes input and such)
+		mu_window_update(win);
+
+		// Sleep for a bit to not hog the CPU
+		mu_sleep(1.0/60.0);
+	}
+
+/* Termination */
+
+	// Destroy window (required)
+	win = mu_window_destroy(win);
+
+	// Terminate muCOSA (required)
+	muCOSA_context_destroy(&muCOSA);
+
+	// Print possible error
+	if (muCOSA.result != MUCOSA_SUCCESS) {
+		printf("Something went wrong during the program's lifespan; result: %s\n", 
+			muCOSA_result_get_name(muCOSA.result)
+		);
+	} else {
+		printf("Successful\n");
+	}
+
+	return 0;
+}
+
+/*
+------------------------------------------------------------------------------
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2024 Hum
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+------------------------------------------------------------------------------
+*/
+
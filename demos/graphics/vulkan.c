@@ -0,0 +1,233 @@
+/*
+============================================================
+                        DEMO INFO
+
+DEMO NAME:          vulkan.c
+DEMO WRITTEN BY:
+CREATION DATE:
+LAST UPDATED:
+
+============================================================
+                        DEMO PURPOSE
+
+This demo shows how to create a Vulkan surface for a window
+in muCOSA.
+
+Program should pop up a window on screen named "Vulkan",
+and print the name of every physical device along with
+whether or not it can present to the window's surface.
+Nothing is rendered to the window, so its contents are
+undefined. This works on machines without a GPU using
+Mesa's lavapipe; for example, by running the program with
+the environment variable "VK_ICD_FILENAMES" set to the path
+of lavapipe's ICD file (usually
+"/usr/share/vulkan/icd.d/lvp_icd.x86_64.json").
+
+This demo requires the Vulkan headers, and to be linked to
+the Vulkan loader ("-lvulkan" on Linux).
+
+============================================================
+                        LICENSE INFO
+
+All code is licensed under MIT License or public domain, 
+whichever you prefer.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+/* Inclusion */
+
+	// Include Vulkan
+	#include <vulkan/vulkan.h>
+
+	// Include muCOSA
+	#define MU_SUPPORT_VULKAN // For Vulkan support
+	#define MUCOSA_NO_INCLUDE_VULKAN // (Already included)
+	#define MUCOSA_NAMES // For name functions
+	#define MUCOSA_IMPLEMENTATION // For source code
+	#include "muCOSA.h"
+
+	// Include stdio for print functions
+	#include <stdio.h>
+
+/* Variables */
+	
+	// Global context
+	muCOSAContext muCOSA;
+
+	// The window system
+	muWindowSystem window_system = MU_WINDOW_NULL; // (Auto)
+
+	// Window handle
+	muWindow win;
+
+	// Window information
+	muWindowInfo wininfo = {
+		// Title
+		(char*)"Vulkan",
+		// Resolution (width & height)
+		800, 600,
+		// Min/Max resolution (none)
+		0, 0, 0, 0,
+		// Coordinates (x and y)
+		50, 50,
+		// Pixel format (default)
+		0,
+		// Callbacks (none)
+		0
+	};
+
+	// Vulkan instance + surface
+	VkInstance instance = VK_NULL_HANDLE;
+	VkSurfaceKHR surface = VK_NULL_HANDLE;
+
+int main(void)
+{
+
+/* Initiation */
+
+	// Initiate muCOSA
+	muCOSA_context_create(&muCOSA, window_system, MU_TRUE);
+
+	// Print currently running window system
+	printf("Running window system \"%s\"\n",
+		mu_window_system_get_nice_name(muCOSA_context_get_window_system(&muCOSA))
+	);
+
+	// Create window
+	win = mu_window_create(&wininfo);
+
+/* Vulkan */
+
+	// Get the instance extensions needed for surfaces
+	size_m extension_count = 0;
+	const char** extensions = mu_vk_get_instance_extensions(&extension_count);
+
+	// Create instance with them
+	VkApplicationInfo app_info = MU_ZERO_STRUCT(VkApplicationInfo);
+	app_info.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+	app_info.pApplicationName = "muCOSA Vulkan demo";
+	app_info.apiVersion = VK_API_VERSION_1_0;
+
+	VkInstanceCreateInfo instance_info = MU_ZERO_STRUCT(VkInstanceCreateInfo);
+	instance_info.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+	instance_info.pApplicationInfo = &app_info;
+	instance_info.enabledExtensionCount = (uint32_t)extension_count;
+	instance_info.ppEnabledExtensionNames = extensions;
+
+	if (vkCreateInstance(&instance_info, 0, &instance) != VK_SUCCESS) {
+		printf("Failed to create Vulkan instance\n");
+		instance = VK_NULL_HANDLE;
+	}
+
+	// Create surface for the window
+	if (instance != VK_NULL_HANDLE) {
+		mu_vk_create_surface(win, instance, 0, &surface);
+	}
+
+	// Print each physical device + if it can present to the surface
+	if (surface != VK_NULL_HANDLE) {
+		VkPhysicalDevice devices[16];
+		uint32_t device_count = 16;
+		vkEnumeratePhysicalDevices(instance, &device_count, devices);
+
+		for (uint32_t d = 0; d < device_count; ++d) {
+			VkPhysicalDeviceProperties props;
+			vkGetPhysicalDeviceProperties(devices[d], &props);
+
+			// Check every queue family for presentation support
+			VkBool32 present = VK_FALSE;
+			uint32_t family_count = 0;
+			vkGetPhysicalDeviceQueueFamilyProperties(devices[d], &family_count, 0);
+			for (uint32_t f = 0; f < family_count && !present; ++f) {
+				vkGetPhysicalDeviceSurfaceSupportKHR(devices[d], f, surface, &present);
+			}
+
+			printf("Device \"%s\": %s\n", props.deviceName, (present) ? "can present" : "can't present");
+		}
+	}
+
+/* Main loop */
+
+	// Set up a loop that continues as long as the window isn't closed
+
+	while (!mu_window_get_closed(win))
+	{
+		// Update window (which refreshes input and such)
+		mu_window_update(win);
+
+		// Sleep for a bit to not hog the CPU
+		mu_sleep(1.0/60.0);
+	}
+
+/* Termination */
+
+	// Destroy surface + instance (surface must be destroyed before the window)
+	if (surface != VK_NULL_HANDLE) {
+		vkDestroySurfaceKHR(instance, surface, 0);
+	}
+	if (instance != VK_NULL_HANDLE) {
+		vkDestroyInstance(instance, 0);
+	}
+
+	// Destroy window (required)
+	win = mu_window_destroy(win);
+
+	// Terminate muCOSA (required)
+	muCOSA_context_destroy(&muCOSA);
+
+	// Print possible error
+	if (muCOSA.result != MUCOSA_SUCCESS) {
+		printf("Something went wrong during the program's lifespan; result: %s\n", 
+			muCOSA_result_get_name(muCOSA.result)
+		);
+	} else {
+		printf("Successful\n");
+	}
+
+	return 0;
+}
+
+/*
+------------------------------------------------------------------------------
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2024 Hum
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+------------------------------------------------------------------------------
+*/
+
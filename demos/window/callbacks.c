@@ -146,7 +146,9 @@ More explicit license information at the end of file.
 		keystate_callback,
 		mouse_key_callback,
 		cursor_callback,
-		scroll_callback
+		scroll_callback,
+		0, // (Frame)
+		0  // (Raw motion)
 	};
 
 	// Window information
@@ -162,7 +164,11 @@ More explicit license information at the end of file.
 		// Pixel format (default)
 		0,
 		// Callbacks
-		&callbacks
+		&callbacks,
+		// Event capacity (none)
+		0,
+		// Coalescing (none)
+		MU_FALSE
 	};
 
 int main(void)
@@ -0,0 +1,223 @@
+/*
+============================================================
+                        DEMO INFO
+
+DEMO NAME:          event_thread.c
+DEMO WRITTEN BY:
+CREATION DATE:
+LAST UPDATED:
+
+============================================================
+                        DEMO PURPOSE
+
+This demo tests the event thread of muCOSA, rendering on the
+main thread while muCOSA's own thread handles the window
+system's events and hands them off to it.
+
+Program should print every key press and release, and check
+that the keyboard keymap always matches the keyboard events
+read so far. Frames that take more than 100 milliseconds are
+printed as stalls; moving or resizing the window shouldn't
+cause any, as updating the window never blocks on the window
+system in this mode.
+
+============================================================
+                        LICENSE INFO
+
+All code is licensed under MIT License or public domain, 
+whichever you prefer.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+/* Inclusion */
+
+	// Include muCOSA
+	#define MUCOSA_EVENT_THREAD // For the event thread
+	#define MUCOSA_NAMES // For name functions
+	#define MUCOSA_IMPLEMENTATION // For source code
+	#include "muCOSA.h"
+
+	// Include stdio for print functions
+	#include <stdio.h>
+
+/* Variables */
+
+	// Global context
+	muCOSAContext muCOSA;
+
+	// The window system
+	muWindowSystem window_system = MU_WINDOW_NULL; // (Auto)
+
+	// Window handle
+	muWindow win;
+
+	// Window information
+	muWindowInfo wininfo = {
+		// Title
+		(char*)"Event thread",
+		// Resolution (width & height)
+		800, 600,
+		// Min/Max resolution (none)
+		0, 0, 0, 0,
+		// Coordinates (x and y)
+		50, 50,
+		// Pixel format (default)
+		0,
+		// Callbacks (none)
+		0,
+		// Event capacity
+		256,
+		// Coalescing (none)
+		MU_FALSE
+	};
+
+	// Event buffer
+	#define EVENT_BUFFER_LENGTH 32
+	muEvent events[EVENT_BUFFER_LENGTH];
+
+	// State of each key according to the keyboard events read so far
+	muBool keys[MU_KEYBOARD_LENGTH];
+
+	// Time a frame has to take to count as a stall
+	#define STALL_TIME 0.1
+
+int main(void)
+{
+
+/* Initiation */
+
+	// Initiate muCOSA (which starts the event thread)
+	muCOSA_context_create(&muCOSA, window_system, MU_TRUE);
+
+	// Print currently running window system
+	printf("Running window system \"%s\"\n",
+		mu_window_system_get_nice_name(muCOSA_context_get_window_system(&muCOSA))
+	);
+
+	// Create window
+	win = mu_window_create(&wininfo);
+
+	// Get the keyboard keymap (which follows the events read on this thread)
+	muBool* keyboard;
+	mu_window_get(win, MU_WINDOW_KEYBOARD_MAP, &keyboard);
+
+/* Main loop */
+
+	double last_frame = mu_fixed_time_get();
+	double longest_frame = 0.0;
+	size_m mismatches = 0;
+
+	// Loop while window isn't closed:
+	while (!mu_window_get_closed(win))
+	{
+		// Catch up with the events handed off by the event thread (this
+		// doesn't block on the window system)
+		mu_window_update(win);
+
+		// Drain all handed-off events, printing key presses
+		size_m count;
+		do {
+			count = mu_window_poll_events(win, events, EVENT_BUFFER_LENGTH);
+			for (size_m i = 0; i < count; ++i) {
+				if (events[i].type == MU_EVENT_KEYBOARD) {
+					muKeyboardKey key = events[i].data.keyboard.key;
+					keys[key] = events[i].data.keyboard.status;
+					printf("%s %s\n",
+						mu_keyboard_key_get_nice_name(key),
+						(keys[key]) ? ("pressed") : ("released")
+					);
+				}
+			}
+		} while (count == EVENT_BUFFER_LENGTH);
+
+		// Check keymap against the events read
+		for (muKeyboardKey k = 0; k < MU_KEYBOARD_LENGTH; ++k) {
+			if (keyboard[k] != keys[k]) {
+				printf("Keymap doesn't match events for %s\n", mu_keyboard_key_get_nice_name(k));
+				keys[k] = keyboard[k];
+				++mismatches;
+			}
+		}
+
+		// Measure frame
+		double now = mu_fixed_time_get();
+		double frame = now - last_frame;
+		last_frame = now;
+		if (frame > longest_frame) {
+			longest_frame = frame;
+		}
+		if (frame > STALL_TIME) {
+			printf("Frame stalled for %f seconds\n", frame);
+		}
+
+		// Wait a bit (like rendering would)
+		mu_sleep(1.0 / 60.0);
+	}
+
+	// Print results
+	printf("Longest frame: %f seconds; keymap mismatches: %u\n", longest_frame, (unsigned)mismatches);
+
+/* Termination */
+
+	// Destroy window (required)
+	win = mu_window_destroy(win);
+
+	// Terminate muCOSA (required, which stops the event thread)
+	muCOSA_context_destroy(&muCOSA);
+
+	// Print possible error
+	if (muCOSA.result != MUCOSA_SUCCESS) {
+		printf("Something went wrong during the program's lifespan; result: %s\n",
+			muCOSA_result_get_name(muCOSA.result)
+		);
+	} else {
+		printf("Successful\n");
+	}
+
+	return 0;
+}
+
+/*
+------------------------------------------------------------------------------
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2024 Hum
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+------------------------------------------------------------------------------
+*/
+
@@ -0,0 +1,240 @@
+/*
+============================================================
+                        DEMO INFO
+
+DEMO NAME:          events.c
+DEMO WRITTEN BY:
+CREATION DATE:
+LAST UPDATED:
+
+============================================================
+                        DEMO PURPOSE
+
+This demo tests the event queue of a window in muCOSA,
+draining all events received each frame in one loop instead
+of receiving them through callbacks.
+
+============================================================
+                        LICENSE INFO
+
+All code is licensed under MIT License or public domain, 
+whichever you prefer.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+/* Inclusion */
+
+	// Include muCOSA
+	#define MUCOSA_NAMES // For name functions
+	#define MUCOSA_IMPLEMENTATION // For source code
+	#include "muCOSA.h"
+
+	// Include stdio for print functions
+	#include <stdio.h>
+
+	// Include inttypes for printing certain types
+	#include <inttypes.h>
+
+/* Event printing */
+
+	void print_event(muEvent* event)
+	{
+		// Print event type
+		printf("[%s] ", mu_event_type_get_nice_name(event->type));
+
+		switch (event->type) {
+			default: printf("\n"); break;
+
+			// Dimensions
+			case MU_EVENT_DIMENSIONS: {
+				printf("(%" PRIu32 ", %" PRIu32 ")\n",
+					event->data.dimensions.width, event->data.dimensions.height
+				);
+			} break;
+
+			// Position
+			case MU_EVENT_POSITION: {
+				printf("(%" PRIi32 ", %" PRIi32 ")\n",
+					event->data.position.x, event->data.position.y
+				);
+			} break;
+
+			// Keyboard
+			case MU_EVENT_KEYBOARD: {
+				printf("%s %s\n",
+					mu_keyboard_key_get_nice_name(event->data.keyboard.key),
+					(event->data.keyboard.status) ? ("pressed") : ("released")
+				);
+			} break;
+
+			// Keystate
+			case MU_EVENT_KEYSTATE: {
+				printf("%s %s\n",
+					mu_keystate_get_nice_name(event->data.keystate.state),
+					(event->data.keystate.status) ? ("on") : ("off")
+				);
+			} break;
+
+			// Mouse key
+			case MU_EVENT_MOUSE_KEY: {
+				printf("%s %s\n",
+					mu_mouse_key_get_nice_name(event->data.mouse_key.key),
+					(event->data.mouse_key.status) ? ("pressed") : ("released")
+				);
+			} break;
+
+			// Cursor
+			case MU_EVENT_CURSOR: {
+				printf("(%" PRIi32 ", %" PRIi32 ")\n",
+					event->data.cursor.x, event->data.cursor.y
+				);
+			} break;
+
+			// Scroll
+			case MU_EVENT_SCROLL: {
+				printf("%" PRIi32 "\n", event->data.scroll);
+			} break;
+
+			// Text
+			case MU_EVENT_TEXT: {
+				printf("\"%s\"\n", (char*)event->data.text);
+			} break;
+		}
+	}
+
+/* Variables */
+
+	// Global context
+	muCOSAContext muCOSA;
+
+	// The window system
+	muWindowSystem window_system = MU_WINDOW_NULL; // (Auto)
+
+	// Window handle
+	muWindow win;
+
+	// Window information
+	muWindowInfo wininfo = {
+		// Title
+		(char*)"Events",
+		// Resolution (width & height)
+		800, 600,
+		// Min/Max resolution (none)
+		0, 0, 0, 0,
+		// Coordinates (x and y)
+		50, 50,
+		// Pixel format (default)
+		0,
+		// Callbacks (none)
+		0,
+		// Event capacity
+		256,
+		// Coalescing (none)
+		MU_FALSE
+	};
+
+	// Event buffer
+	#define EVENT_BUFFER_LENGTH 32
+	muEvent events[EVENT_BUFFER_LENGTH];
+
+int main(void)
+{
+
+/* Initiation */
+
+	// Initiate muCOSA
+	muCOSA_context_create(&muCOSA, window_system, MU_TRUE);
+
+	// Print currently running window system
+	printf("Running window system \"%s\"\n",
+		mu_window_system_get_nice_name(muCOSA_context_get_window_system(&muCOSA))
+	);
+
+	// Create window
+	win = mu_window_create(&wininfo);
+
+/* Main loop */
+
+	// Loop while window isn't closed:
+	while (!mu_window_get_closed(win))
+	{
+		// Update window (which refreshes input, queues events, etc.)
+		mu_window_update(win);
+
+		// Drain all queued events
+		size_m count;
+		do {
+			count = mu_window_poll_events(win, events, EVENT_BUFFER_LENGTH);
+			for (size_m i = 0; i < count; ++i) {
+				print_event(&events[i]);
+			}
+		} while (count == EVENT_BUFFER_LENGTH);
+
+		// Wait a bit
+		mu_sleep(1.0 / 60.0);
+	}
+
+/* Termination */
+
+	// Destroy window (required)
+	win = mu_window_destroy(win);
+
+	// Terminate muCOSA (required)
+	muCOSA_context_destroy(&muCOSA);
+
+	// Print possible error
+	if (muCOSA.result != MUCOSA_SUCCESS) {
+		printf("Something went wrong during the program's lifespan; result: %s\n",
+			muCOSA_result_get_name(muCOSA.result)
+		);
+	} else {
+		printf("Successful\n");
+	}
+
+	return 0;
+}
+
+/*
+------------------------------------------------------------------------------
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2024 Hum
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+------------------------------------------------------------------------------
+*/
+
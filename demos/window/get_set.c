@@ -74,7 +74,11 @@ More explicit license information at the end of file.
 		// Pixel format (default)
 		0,
 		// Callbacks (none)
-		0
+		0,
+		// Event capacity (none)
+		0,
+		// Coalescing (none)
+		MU_FALSE
 	};
 
 	// Window keyboard map
@@ -0,0 +1,235 @@
+/*
+============================================================
+                        DEMO INFO
+
+DEMO NAME:          headless.c
+DEMO WRITTEN BY:
+CREATION DATE:
+LAST UPDATED:
+
+============================================================
+                        DEMO PURPOSE
+
+This demo shows how the headless window system can be used
+to drive windows without any display, injecting input into
+them and measuring how long it takes to process.
+
+Program should create a number of headless windows, inject
+a batch of input into each one, and print how much time it
+took to process the input (via updating each window), along
+with the amount of callbacks that were called.
+
+============================================================
+                        LICENSE INFO
+
+All code is licensed under MIT License or public domain, 
+whichever you prefer.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+/* Inclusion */
+
+	// Include muCOSA
+	#define MUCOSA_NAMES // For name functions
+	#define MUCOSA_IMPLEMENTATION // For source code
+	#include "muCOSA.h"
+
+	// Include stdio for print functions
+	#include <stdio.h>
+
+	// Include time for measuring real time
+	// (The headless window system's clock is virtual)
+	#include <time.h>
+
+/* Callbacks */
+
+	// Amount of callbacks called
+	size_m callback_count = 0;
+
+	void keyboard_callback(muWindow win, muKeyboardKey key, muBool status) {
+		++callback_count;
+		return; if (win) {} if (key) {} if (status) {}
+	}
+
+	void mouse_key_callback(muWindow win, muMouseKey key, muBool status) {
+		++callback_count;
+		return; if (win) {} if (key) {} if (status) {}
+	}
+
+	void cursor_callback(muWindow win, int32_m x, int32_m y) {
+		++callback_count;
+		return; if (win) {} if (x) {} if (y) {}
+	}
+
+	void scroll_callback(muWindow win, int32_m add) {
+		++callback_count;
+		return; if (win) {} if (add) {}
+	}
+
+/* Variables */
+
+	// Global context
+	muCOSAContext muCOSA;
+
+	// The window system
+	muWindowSystem window_system = MU_WINDOW_HEADLESS;
+
+	// Amount of windows
+	#define WINDOW_COUNT 1000
+	// Amount of times each piece of input is injected per window
+	#define INPUT_COUNT 100
+
+	// Window handles
+	muWindow wins[WINDOW_COUNT];
+
+	// Callbacks
+	muWindowCallbacks callbacks = {
+		0, 0,
+		keyboard_callback,
+		0,
+		mouse_key_callback,
+		cursor_callback,
+		scroll_callback,
+		0, 0
+	};
+
+	// Window information
+	muWindowInfo wininfo = {
+		// Title
+		(char*)"Headless",
+		// Resolution (width & height)
+		800, 600,
+		// Min/Max resolution (none)
+		0, 0, 0, 0,
+		// Coordinates (x and y)
+		50, 50,
+		// Pixel format (default)
+		0,
+		// Callbacks
+		&callbacks,
+		// Event capacity (none)
+		0,
+		// Coalescing (none)
+		MU_FALSE
+	};
+
+int main(void)
+{
+
+/* Initiation */
+
+	// Initiate muCOSA
+	muCOSA_context_create(&muCOSA, window_system, MU_TRUE);
+
+	// Print currently running window system
+	printf("Running window system \"%s\"\n",
+		mu_window_system_get_nice_name(muCOSA_context_get_window_system(&muCOSA))
+	);
+
+	// Create windows
+	for (size_m w = 0; w < WINDOW_COUNT; ++w) {
+		wins[w] = mu_window_create(&wininfo);
+	}
+
+/* Injection */
+
+	// Inject a key press/release, a click, cursor movement, and scrolling into each window
+	for (size_m w = 0; w < WINDOW_COUNT; ++w) {
+		for (int32_m i = 0; i < INPUT_COUNT; ++i) {
+			mu_window_inject_key(wins[w], MU_KEYBOARD_A, MU_TRUE);
+			mu_window_inject_key(wins[w], MU_KEYBOARD_A, MU_FALSE);
+			mu_window_inject_mouse_key(wins[w], MU_MOUSE_LEFT, MU_TRUE);
+			mu_window_inject_mouse_key(wins[w], MU_MOUSE_LEFT, MU_FALSE);
+			mu_window_inject_cursor(wins[w], i, i);
+			mu_window_inject_scroll(wins[w], 120);
+		}
+	}
+
+/* Processing */
+
+	// Update each window, processing the injected input
+	clock_t start = clock();
+	for (size_m w = 0; w < WINDOW_COUNT; ++w) {
+		mu_window_update(wins[w]);
+	}
+	double input_time = (double)(clock() - start) / (double)CLOCKS_PER_SEC;
+
+	// Update each window again, this time with no input
+	start = clock();
+	for (size_m w = 0; w < WINDOW_COUNT; ++w) {
+		mu_window_update(wins[w]);
+	}
+	double idle_time = (double)(clock() - start) / (double)CLOCKS_PER_SEC;
+
+	// Print results
+	printf("Processed input for %i windows in %f seconds (%lu callbacks)\n",
+		(int)WINDOW_COUNT, input_time, (unsigned long)callback_count
+	);
+	printf("Updated %i idle windows in %f seconds\n", (int)WINDOW_COUNT, idle_time);
+
+/* Termination */
+
+	// Destroy windows (required)
+	for (size_m w = 0; w < WINDOW_COUNT; ++w) {
+		wins[w] = mu_window_destroy(wins[w]);
+	}
+
+	// Terminate muCOSA (required)
+	muCOSA_context_destroy(&muCOSA);
+
+	// Print possible error
+	if (muCOSA.result != MUCOSA_SUCCESS) {
+		printf("Something went wrong during the program's lifespan; result: %s\n",
+			muCOSA_result_get_name(muCOSA.result)
+		);
+	} else {
+		printf("Successful\n");
+	}
+
+	return 0;
+}
+
+/*
+------------------------------------------------------------------------------
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2024 Hum
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+------------------------------------------------------------------------------
+*/
+
@@ -0,0 +1,258 @@
+/*
+============================================================
+                        DEMO INFO
+
+DEMO NAME:          idle_bench.c
+DEMO WRITTEN BY:
+CREATION DATE:
+LAST UPDATED:
+
+============================================================
+                        DEMO PURPOSE
+
+This demo measures the cost of updating a window that isn't
+receiving any input, which is the cost paid every frame
+for things not given by events (such as keystates), and
+compares it to the cost of also polling the keystates
+every update, which is what updates used to do before
+keystates were tracked from change notifications.
+
+Program should print, for both strategies, the average
+elapsed time and the average processor time taken per
+update. Elapsed time isn't printed on the headless window
+system, as its clock is virtual; neither is polling any
+different there (or on Wayland), as keystates were never
+polled on them. Don't give the window any input while
+it's being measured.
+
+============================================================
+                        LICENSE INFO
+
+All code is licensed under MIT License or public domain, 
+whichever you prefer.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+/* Inclusion */
+
+	// Include muCOSA
+	#define MUCOSA_NAMES // For name functions
+	#define MUCOSA_IMPLEMENTATION // For source code
+	#include "muCOSA.h"
+
+	// Include stdio for print functions
+	#include <stdio.h>
+
+	// Include time for measuring processor time
+	#include <time.h>
+
+/* Variables */
+
+	// Global context
+	muCOSAContext muCOSA;
+
+	// The window system
+	muWindowSystem window_system = MU_WINDOW_NULL; // (Auto)
+
+	// Window handle
+	muWindow win;
+
+	// Updates measured per round + amount of rounds
+	#define UPDATE_COUNT 10000
+	#define ROUND_COUNT 5
+
+	// Separate connection to the X server for polling keystates
+	#ifdef MUCOSA_X11
+	Display* poll_display = 0;
+	#endif
+
+	// Window information
+	muWindowInfo wininfo = {
+		// Title
+		(char*)"Idle benchmark",
+		// Resolution (width & height)
+		320, 240,
+		// Min/Max resolution (none)
+		0, 0, 0, 0,
+		// Coordinates (x and y)
+		50, 50,
+		// Pixel format (default)
+		0,
+		// Callbacks (none)
+		0,
+		// Event capacity (none)
+		0,
+		// Coalescing (none)
+		MU_FALSE
+	};
+
+/* Functions */
+
+	// Checks the keystates the way that updates used to every update (one round
+	// trip to the X server on X11; a GetKeyState per lock key on Win32)
+	void poll_keystates(void) {
+		switch (muCOSA_context_get_window_system(&muCOSA)) {
+			default: break;
+
+			#ifdef MUCOSA_X11
+			case MU_WINDOW_X11: {
+				unsigned int state;
+				if (poll_display) {
+					XkbGetIndicatorState(poll_display, XkbUseCoreKbd, &state);
+				}
+			} break;
+			#endif
+
+			#ifdef MUCOSA_WIN32
+			case MU_WINDOW_WIN32: {
+				GetKeyState(VK_CAPITAL);
+				GetKeyState(VK_NUMLOCK);
+				GetKeyState(VK_SCROLL);
+			} break;
+			#endif
+		}
+	}
+
+	// Measures one round of updates, polling keystates every update or not,
+	// giving the average elapsed and processor time per update in microseconds
+	void measure(muBool poll, double* elapsed, double* processor) {
+		double start = mu_time_get();
+		clock_t cstart = clock();
+		for (size_m i = 0; i < UPDATE_COUNT; ++i) {
+			mu_window_update(win);
+			if (poll) {
+				poll_keystates();
+			}
+		}
+		*elapsed = (mu_time_get() - start) * 1.0e6 / (double)UPDATE_COUNT;
+		*processor = ((double)(clock() - cstart) / (double)CLOCKS_PER_SEC) * 1.0e6 / (double)UPDATE_COUNT;
+	}
+
+	// Prints a time, or a dash if it isn't meaningful
+	void print_time(double t, muBool meaningful) {
+		if (meaningful) {
+			printf(" | %9f", t);
+		} else {
+			printf(" | %9s", "-");
+		}
+	}
+
+int main(void)
+{
+
+/* Initiation */
+
+	// Initiate muCOSA
+	muCOSA_context_create(&muCOSA, window_system, MU_TRUE);
+
+	// Print currently running window system
+	printf("Running window system \"%s\"\n",
+		mu_window_system_get_nice_name(muCOSA_context_get_window_system(&muCOSA))
+	);
+
+	// Create window
+	win = mu_window_create(&wininfo);
+
+	// Open connection for polling keystates on X11
+	#ifdef MUCOSA_X11
+	if (muCOSA_context_get_window_system(&muCOSA) == MU_WINDOW_X11) {
+		poll_display = XOpenDisplay(0);
+	}
+	#endif
+
+	// Let the window process its creation before measuring
+	for (size_m i = 0; i < 100; ++i) {
+		mu_window_update(win);
+	}
+
+/* Benchmark */
+
+	// Elapsed time is virtual on the headless window system
+	muBool real = muCOSA_context_get_window_system(&muCOSA) != MU_WINDOW_HEADLESS;
+
+	// Alternate between strategies each round (times in us/update)
+	printf("      |  notified keystates   |   polled keystates\n");
+	printf("round |   elapsed | processor |   elapsed | processor\n");
+	for (size_m r = 0; r < ROUND_COUNT && !mu_window_get_closed(win); ++r) {
+		double notify_elapsed, notify_processor, poll_elapsed, poll_processor;
+		measure(MU_FALSE, &notify_elapsed, &notify_processor);
+		measure(MU_TRUE, &poll_elapsed, &poll_processor);
+
+		printf("%5i", (int)r);
+		print_time(notify_elapsed, real);
+		print_time(notify_processor, MU_TRUE);
+		print_time(poll_elapsed, real);
+		print_time(poll_processor, MU_TRUE);
+		printf("\n");
+	}
+
+/* Termination */
+
+	// Close connection for polling keystates
+	#ifdef MUCOSA_X11
+	if (poll_display) {
+		XCloseDisplay(poll_display);
+	}
+	#endif
+
+	// Destroy window (required)
+	win = mu_window_destroy(win);
+
+	// Terminate muCOSA (required)
+	muCOSA_context_destroy(&muCOSA);
+
+	// Print possible error
+	if (muCOSA.result != MUCOSA_SUCCESS) {
+		printf("Something went wrong during the program's lifespan; result: %s\n",
+			muCOSA_result_get_name(muCOSA.result)
+		);
+	} else {
+		printf("Successful\n");
+	}
+
+	return 0;
+}
+/*
+------------------------------------------------------------------------------
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2024 Hum
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+------------------------------------------------------------------------------
+*/
+
@@ -0,0 +1,217 @@
+/*
+============================================================
+                        DEMO INFO
+
+DEMO NAME:          inject_bench.c
+DEMO WRITTEN BY:
+CREATION DATE:
+LAST UPDATED:
+
+============================================================
+                        DEMO PURPOSE
+
+This demo measures how fast a window can process input by
+injecting keyboard keys and cursor movement into it as fast
+as possible, which is how a program built on muCOSA can be
+put under load.
+
+Program should print how many pieces of input were
+processed per second (of processor time) in each round. On
+X11, muCOSA needs to be compiled with MUCOSA_X11_XTEST
+defined, the window needs to keep keyboard focus, and the
+injected input also reaches the rest of the desktop.
+
+============================================================
+                        LICENSE INFO
+
+All code is licensed under MIT License or public domain, 
+whichever you prefer.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+/* Inclusion */
+
+	// Include muCOSA
+	#define MUCOSA_NAMES // For name functions
+	#define MUCOSA_IMPLEMENTATION // For source code
+	#include "muCOSA.h"
+
+	// Include stdio for print functions
+	#include <stdio.h>
+
+	// Include time for measuring processor time
+	#include <time.h>
+
+/* Callbacks */
+
+	// Amount of input processed
+	size_m processed;
+
+	void keyboard_callback(muWindow win, muKeyboardKey key, muBool status) {
+		++processed;
+		if (win) {} if (key) {} if (status) {}
+	}
+	void cursor_callback(muWindow win, int32_m x, int32_m y) {
+		++processed;
+		if (win) {} if (x) {} if (y) {}
+	}
+
+/* Variables */
+
+	// Global context
+	muCOSAContext muCOSA;
+
+	// The window system
+	muWindowSystem window_system = MU_WINDOW_NULL; // (Auto)
+
+	// Window handle
+	muWindow win;
+
+	// Key presses + releases and cursor movements injected per round +
+	// amount of rounds
+	#define INPUT_COUNT 1000
+	#define ROUND_COUNT 5
+
+	// Callbacks
+	muWindowCallbacks callbacks = {
+		0, 0,
+		keyboard_callback,
+		0, 0,
+		cursor_callback,
+		0, 0, 0
+	};
+
+	// Window information
+	muWindowInfo wininfo = {
+		// Title
+		(char*)"Injection benchmark",
+		// Resolution (width & height)
+		320, 240,
+		// Min/Max resolution (none)
+		0, 0, 0, 0,
+		// Coordinates (x and y)
+		50, 50,
+		// Pixel format (default)
+		0,
+		// Callbacks
+		&callbacks,
+		// Event capacity (none)
+		0,
+		// Coalescing (none)
+		MU_FALSE
+	};
+
+int main(void)
+{
+
+/* Initiation */
+
+	// Initiate muCOSA
+	muCOSA_context_create(&muCOSA, window_system, MU_TRUE);
+
+	// Print currently running window system
+	printf("Running window system \"%s\"\n",
+		mu_window_system_get_nice_name(muCOSA_context_get_window_system(&muCOSA))
+	);
+
+	// Create window
+	win = mu_window_create(&wininfo);
+
+	// Let the window process its creation before measuring
+	for (size_m i = 0; i < 100; ++i) {
+		mu_window_update(win);
+		mu_sleep(0.01);
+	}
+
+/* Benchmark */
+
+	printf("round | processed | input/second\n");
+	for (size_m r = 0; r < ROUND_COUNT && !mu_window_get_closed(win); ++r) {
+		processed = 0;
+		clock_t start = clock();
+
+		// Inject input
+		for (size_m i = 0; i < INPUT_COUNT; ++i) {
+			mu_window_inject_key(win, MU_KEYBOARD_A, MU_TRUE);
+			mu_window_inject_key(win, MU_KEYBOARD_A, MU_FALSE);
+			mu_window_inject_cursor(win, (int32_m)(1 + i % 300), (int32_m)(1 + i % 200));
+		}
+		if (muCOSA.result != MUCOSA_SUCCESS) {
+			break;
+		}
+
+		// Update until all of it is processed (or for at most a second on
+		// window systems where injected input takes a while to come back)
+		double deadline = mu_time_get() + 1.0;
+		while (processed < INPUT_COUNT * 3 && mu_time_get() < deadline) {
+			mu_window_update(win);
+			mu_window_wait(win, 0.001);
+		}
+
+		double processor = (double)(clock() - start) / (double)CLOCKS_PER_SEC;
+		printf("%5i | %9i | %12f\n", (int)r, (int)processed, (processor > 0.0) ? ((double)processed / processor) : 0.0);
+	}
+
+/* Termination */
+
+	// Destroy window (required)
+	win = mu_window_destroy(win);
+
+	// Terminate muCOSA (required)
+	muCOSA_context_destroy(&muCOSA);
+
+	// Print possible error
+	if (muCOSA.result != MUCOSA_SUCCESS) {
+		printf("Something went wrong during the program's lifespan; result: %s\n",
+			muCOSA_result_get_name(muCOSA.result)
+		);
+	} else {
+		printf("Successful\n");
+	}
+
+	return 0;
+}
+/*
+------------------------------------------------------------------------------
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2024 Hum
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+------------------------------------------------------------------------------
+*/
+
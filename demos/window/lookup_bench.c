@@ -0,0 +1,474 @@
+/*
+============================================================
+                        DEMO INFO
+
+DEMO NAME:          lookup_bench.c
+DEMO WRITTEN BY:
+CREATION DATE:
+LAST UPDATED:
+
+============================================================
+                        DEMO PURPOSE
+
+This demo measures how fast muCOSA looks up a window from
+its native handle, which it does for every event that the
+window system gives it, and how that scales.
+
+On Win32, each thread creates a window of its own, and then
+sends it a large amount of empty messages (WM_NULL), each
+of which is handled by muCOSA's window procedure, looking
+up the window. This is done once with a single thread and
+once with several; as lookups only lock for reading,
+threads shouldn't have to wait on each other.
+
+On X11, a window is sent a large amount of cursor movements
+(as synthetic MotionNotify events) over a separate
+connection, and the time that it takes muCOSA to handle
+them, looking up the window for each one, is measured. As
+X11 events are handled by one thread at a time (with the
+context locked), this is only done with a single thread.
+
+Both are then done again with a couple thousand other
+windows open; as windows are looked up in a hash table,
+this shouldn't make lookups any slower.
+
+Program should print the amount of messages/events handled
+per second, without and with the other windows (and on
+Win32, with several threads, and how that scales with the
+amount of threads; a scaling of 1.0 means that the lookups
+entirely serialize). Don't move the cursor over the window
+while it's being measured. Other window systems have no
+native handles to look up, so the demo only runs on Win32
+and X11.
+
+============================================================
+                        LICENSE INFO
+
+All code is licensed under MIT License or public domain, 
+whichever you prefer.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+/* Inclusion */
+
+	// Include muCOSA in thread-safe mode
+	#define MUCOSA_THREAD_SAFE // For creating windows on multiple threads
+	#define MUCOSA_NAMES // For name functions
+	#define MUCOSA_IMPLEMENTATION // For source code
+	#include "muCOSA.h"
+
+	// Include stdio for print functions
+	#include <stdio.h>
+
+	// Include string for comparing window titles
+	#include <string.h>
+
+	// Include windows for threads, messages, and time
+	// (Xlib, used on X11 for sending events, is already included by muCOSA)
+	#ifdef MUCOSA_WIN32
+		#include <windows.h>
+	#endif
+
+/* Variables */
+
+	// Global context
+	muCOSAContext muCOSA;
+
+	// The window system
+	muWindowSystem window_system = MU_WINDOW_NULL; // (Auto)
+
+	// Amount of threads + messages sent by each thread (Win32)
+	#define THREAD_COUNT 8
+	#define MESSAGE_COUNT 1000000
+
+	// Amount of events sent at once (X11)
+	#define BATCH_COUNT 1000
+
+	// Amount of other windows open during the second set of runs
+	#define OTHER_WINDOW_COUNT 2000
+	muWindow other_windows[OTHER_WINDOW_COUNT];
+
+	// Window information
+	muWindowInfo wininfo = {
+		// Title (set per window being measured)
+		(char*)"Lookup benchmark",
+		// Resolution (width & height)
+		320, 240,
+		// Min/Max resolution (none)
+		0, 0, 0, 0,
+		// Coordinates (x and y)
+		50, 50,
+		// Pixel format (default)
+		0,
+		// Callbacks (none)
+		0,
+		// Event capacity (none)
+		0,
+		// Coalescing (none)
+		MU_FALSE
+	};
+
+/* Win32 benchmark */
+
+#ifdef MUCOSA_WIN32
+
+	// Data of each thread
+	struct Worker {
+		HANDLE thread;
+		// Index of the thread
+		uint32_m index;
+		// Time at which the thread started and stopped sending messages
+		LARGE_INTEGER start, end;
+		// Result of creating the window
+		muCOSAResult result;
+	};
+	typedef struct Worker Worker;
+
+	Worker workers[THREAD_COUNT];
+
+	// Amount of threads that are ready to send messages
+	LONG volatile ready_count;
+	// Event signaled once every thread is ready
+	HANDLE start_event;
+
+	DWORD WINAPI send_messages(LPVOID data) {
+		Worker* worker = (Worker*)data;
+
+		// Create a window with a title unique to this thread (messages sent
+		// to a window created by the same thread are handled immediately,
+		// without going through a message queue)
+		char title[32];
+		sprintf(title, "Lookup benchmark %i", (int)worker->index);
+		muWindowInfo info = wininfo;
+		info.title = title;
+		worker->result = MUCOSA_SUCCESS;
+		muWindow win = mu_window_create_(&worker->result, &info);
+
+		// Find its handle by its title
+		HWND hwnd = win ? FindWindowA(0, title) : 0;
+
+		// Wait for every thread to be ready
+		InterlockedIncrement(&ready_count);
+		WaitForSingleObject(start_event, INFINITE);
+
+		// Send messages
+		QueryPerformanceCounter(&worker->start);
+		if (hwnd) {
+			for (size_m i = 0; i < MESSAGE_COUNT; ++i) {
+				SendMessageA(hwnd, WM_NULL, 0, 0);
+			}
+		}
+		QueryPerformanceCounter(&worker->end);
+
+		if (win) {
+			win = mu_window_destroy(win);
+		}
+		return 0;
+	}
+
+	// Runs the benchmark on the given amount of threads; returns the amount
+	// of messages handled per second, or a negative number if anything failed
+	double run(uint32_m thread_count) {
+		ready_count = 0;
+		ResetEvent(start_event);
+
+		for (uint32_m i = 0; i < thread_count; ++i) {
+			workers[i].index = i;
+			workers[i].thread = CreateThread(0, 0, send_messages, &workers[i], 0, 0);
+		}
+
+		// Start every thread at once
+		while (ready_count < (LONG)thread_count) {
+			Sleep(1);
+		}
+		SetEvent(start_event);
+
+		muBool failed = MU_FALSE;
+		LARGE_INTEGER start, end;
+		for (uint32_m i = 0; i < thread_count; ++i) {
+			WaitForSingleObject(workers[i].thread, INFINITE);
+			CloseHandle(workers[i].thread);
+
+			if (workers[i].result != MUCOSA_SUCCESS) {
+				printf("Thread %i failed; result: %s\n", (int)i, muCOSA_result_get_name(workers[i].result));
+				failed = MU_TRUE;
+			}
+
+			// Measure from the first thread to start to the last one to finish
+			if (i == 0 || workers[i].start.QuadPart < start.QuadPart) {
+				start = workers[i].start;
+			}
+			if (i == 0 || workers[i].end.QuadPart > end.QuadPart) {
+				end = workers[i].end;
+			}
+		}
+
+		LARGE_INTEGER frequency;
+		QueryPerformanceFrequency(&frequency);
+		double elapsed = (double)(end.QuadPart - start.QuadPart) / (double)frequency.QuadPart;
+		return failed ? -1.0 : ((double)MESSAGE_COUNT * (double)thread_count / elapsed);
+	}
+
+	// Prepares for measuring; returns if successful
+	muBool begin(void) {
+		// Create start event (manual-reset, so that it wakes every thread)
+		start_event = CreateEventA(0, TRUE, FALSE, 0);
+		if (!start_event) {
+			return MU_FALSE;
+		}
+
+		printf("other windows | 1 thread (msg/s) | %i threads (msg/s) | scaling\n", THREAD_COUNT);
+		return MU_TRUE;
+	}
+
+	// Runs the benchmark on one thread, then on every thread, and prints the results
+	void measure(uint32_m other_window_count) {
+		double single = run(1);
+		double multi = run(THREAD_COUNT);
+		printf("%13i | %16.0f | %18.0f | %7.2f\n", (int)other_window_count, single, multi, (single > 0.0) ? (multi / single) : 0.0);
+	}
+
+	void end(void) {
+		CloseHandle(start_event);
+	}
+
+#endif /* MUCOSA_WIN32 */
+
+/* X11 benchmark */
+
+#ifdef MUCOSA_X11
+
+	// Separate connection to the X server, for sending events
+	Display* display = 0;
+
+	// Window measured + its X11 handle
+	muWindow measured = 0;
+	Window target = 0;
+
+	// Amount of cursor callbacks called + the last x-coordinate sent
+	size_m cursor_count = 0;
+	int cursor_x = 0;
+
+	// Cursor callback; counts every cursor movement handled
+	void cursor_callback(muWindow win, int32_m x, int32_m y) {
+		++cursor_count;
+
+		// Reference parameters to avoid unused parameter warnings
+		return; if (win) {} if (x) {} if (y) {}
+	}
+
+	// Finds a window by its title among the descendants of the given window
+	// (searching them all, as window managers put windows within frames)
+	Window find_window(Window parent, const char* title) {
+		Window root, parent_ret, *children = 0;
+		unsigned int count = 0;
+		if (!XQueryTree(display, parent, &root, &parent_ret, &children, &count)) {
+			return 0;
+		}
+
+		Window found = 0;
+		for (unsigned int i = 0; i < count && !found; ++i) {
+			char* name = 0;
+			if (XFetchName(display, children[i], &name) && name) {
+				if (strcmp(name, title) == 0) {
+					found = children[i];
+				}
+				XFree(name);
+			}
+			if (!found) {
+				found = find_window(children[i], title);
+			}
+		}
+
+		if (children) {
+			XFree(children);
+		}
+		return found;
+	}
+
+	// Sends the window batches of cursor movements, and measures how long it
+	// takes muCOSA to handle them; returns the amount of events handled per
+	// second, or a negative number if anything failed
+	double run(void) {
+		double elapsed = 0.0;
+		for (size_m sent = 0; sent < MESSAGE_COUNT; sent += BATCH_COUNT) {
+			// Send a batch of movements, alternating between two positions so
+			// that every one is a change, and wait for the X server to get them
+			for (size_m i = 0; i < BATCH_COUNT; ++i) {
+				XEvent event = MU_ZERO_STRUCT(XEvent);
+				cursor_x = (cursor_x == 1) ? 2 : 1;
+				event.xmotion.type = MotionNotify;
+				event.xmotion.window = target;
+				event.xmotion.x = cursor_x;
+				// (Sent to the client that created the window with no event mask)
+				XSendEvent(display, target, False, 0, &event);
+			}
+			XSync(display, False);
+
+			// Handle them
+			size_m expected = cursor_count + BATCH_COUNT;
+			double start = mu_time_get();
+			while (cursor_count < expected) {
+				mu_window_update(measured);
+				// (Movements lost to the cursor moving over the window)
+				if (mu_time_get() - start > 5.0) {
+					printf("Timed out waiting on events\n");
+					return -1.0;
+				}
+			}
+			elapsed += mu_time_get() - start;
+		}
+		return (double)MESSAGE_COUNT / elapsed;
+	}
+
+	// Prepares for measuring; returns if successful
+	muBool begin(void) {
+		// Open connection
+		display = XOpenDisplay(0);
+		if (!display) {
+			printf("Couldn't connect to the X server\n");
+			return MU_FALSE;
+		}
+
+		// Create window measured, counting its cursor movements
+		muWindowCallbacks callbacks = MU_ZERO_STRUCT(muWindowCallbacks);
+		callbacks.cursor = cursor_callback;
+		muWindowInfo info = wininfo;
+		info.title = (char*)"Lookup benchmark (measured)";
+		info.callbacks = &callbacks;
+		measured = mu_window_create(&info);
+		if (!measured) {
+			return MU_FALSE;
+		}
+		// (Let it process its creation)
+		for (size_m i = 0; i < 10; ++i) {
+			mu_window_update(measured);
+		}
+
+		// Find its handle by its title
+		target = find_window(DefaultRootWindow(display), info.title);
+		if (!target) {
+			printf("Couldn't find the window\n");
+			return MU_FALSE;
+		}
+
+		printf("other windows | handled (events/s)\n");
+		return MU_TRUE;
+	}
+
+	// Runs the benchmark and prints the results
+	void measure(uint32_m other_window_count) {
+		printf("%13i | %18.0f\n", (int)other_window_count, run());
+	}
+
+	void end(void) {
+		if (measured) {
+			measured = mu_window_destroy(measured);
+		}
+		if (display) {
+			XCloseDisplay(display);
+		}
+	}
+
+#endif /* MUCOSA_X11 */
+
+int main(void)
+{
+
+/* Initiation */
+
+	// Initiate muCOSA
+	muCOSA_context_create(&muCOSA, window_system, MU_TRUE);
+
+	// Print currently running window system
+	muWindowSystem system = muCOSA_context_get_window_system(&muCOSA);
+	printf("Running window system \"%s\"\n",
+		mu_window_system_get_nice_name(system)
+	);
+
+/* Benchmark */
+
+	#if defined(MUCOSA_WIN32) || defined(MUCOSA_X11)
+	if ((system == MU_WINDOW_WIN32 || system == MU_WINDOW_X11) && begin()) {
+		measure(0);
+
+		// Open the other windows + measure again
+		uint32_m other_window_count = 0;
+		for (; other_window_count < OTHER_WINDOW_COUNT; ++other_window_count) {
+			other_windows[other_window_count] = mu_window_create(&wininfo);
+			if (!other_windows[other_window_count]) {
+				break;
+			}
+		}
+		measure(other_window_count);
+
+		// Destroy the other windows
+		for (uint32_m i = 0; i < other_window_count; ++i) {
+			other_windows[i] = mu_window_destroy(other_windows[i]);
+		}
+	}
+	end();
+	#else
+	printf("This demo only runs on Win32 and X11\n");
+	#endif
+
+/* Termination */
+
+	// Terminate muCOSA (required)
+	muCOSA_context_destroy(&muCOSA);
+
+	// Print possible error
+	if (muCOSA.result != MUCOSA_SUCCESS) {
+		printf("Something went wrong during the program's lifespan; result: %s\n",
+			muCOSA_result_get_name(muCOSA.result)
+		);
+	} else {
+		printf("Successful\n");
+	}
+
+	return 0;
+}
+/*
+------------------------------------------------------------------------------
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2024 Hum
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+------------------------------------------------------------------------------
+*/
+
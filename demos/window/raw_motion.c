@@ -0,0 +1,220 @@
+/*
+============================================================
+                        DEMO INFO
+
+DEMO NAME:          raw_motion.c
+DEMO WRITTEN BY:
+CREATION DATE:
+LAST UPDATED:
+
+============================================================
+                        DEMO PURPOSE
+
+This demo tests raw motion and pointer lock by turning a
+camera (printed as yaw/pitch) with the unaccelerated motion
+of the mouse. Clicking in the window locks the pointer, and
+pressing escape unlocks it.
+
+============================================================
+                        LICENSE INFO
+
+All code is licensed under MIT License or public domain, 
+whichever you prefer.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+/* Inclusion */
+
+	// Include muCOSA
+	#define MUCOSA_NAMES // For name functions
+	#define MUCOSA_IMPLEMENTATION // For source code
+	#include "muCOSA.h"
+
+	// Include stdio for print functions
+	#include <stdio.h>
+
+/* Variables */
+
+	// Global context
+	muCOSAContext muCOSA;
+
+	// The window system
+	muWindowSystem window_system = MU_WINDOW_NULL; // (Auto)
+
+	// Window handle
+	muWindow win;
+
+	// Camera angles (in degrees) + degrees turned per unit of raw motion
+	double yaw = 0.0;
+	double pitch = 0.0;
+	double sensitivity = 0.1;
+
+	// Window information
+	muWindowInfo wininfo = {
+		// Title
+		(char*)"Raw motion",
+		// Resolution (width & height)
+		800, 600,
+		// Min/Max resolution (none)
+		0, 0, 0, 0,
+		// Coordinates (x and y)
+		50, 50,
+		// Pixel format (default)
+		0,
+		// Callbacks (set in main)
+		0,
+		// Event capacity (none)
+		0,
+		// Coalescing (none)
+		MU_FALSE
+	};
+
+/* Callbacks */
+
+	// Raw motion callback; called every time the mouse moves
+	void raw_motion_callback(muWindow window, double dx, double dy) {
+		// Turn camera
+		yaw += dx * sensitivity;
+		pitch -= dy * sensitivity;
+		// - Don't let the camera flip over
+		if (pitch > 89.0) {
+			pitch = 89.0;
+		} else if (pitch < -89.0) {
+			pitch = -89.0;
+		}
+
+		// Print camera angles
+		printf("[Raw motion] (%+.2f, %+.2f) - yaw %.2f, pitch %.2f\n", dx, dy, yaw, pitch);
+
+		// Reference "window" to avoid unused parameter warnings
+		return; if (window) {}
+	}
+
+	// Mouse key callback; locks the pointer when the window is clicked
+	void mouse_key_callback(muWindow window, muMouseKey key, muBool status) {
+		if (key == MU_MOUSE_LEFT && status) {
+			muBool lock = MU_TRUE;
+			muCOSAResult res = MUCOSA_SUCCESS;
+			mu_window_set_(&res, window, MU_WINDOW_POINTER_LOCK, &lock);
+			if (res != MUCOSA_SUCCESS) {
+				printf("Failed to lock the pointer (%s)\n", muCOSA_result_get_name(res));
+			} else {
+				printf("Pointer locked; press escape to unlock\n");
+			}
+		}
+	}
+
+	// Keyboard callback; unlocks the pointer when escape is pressed
+	void keyboard_callback(muWindow window, muKeyboardKey key, muBool status) {
+		if (key == MU_KEYBOARD_ESCAPE && status) {
+			muBool lock = MU_FALSE;
+			mu_window_set(window, MU_WINDOW_POINTER_LOCK, &lock);
+			printf("Pointer unlocked\n");
+		}
+	}
+
+int main(void)
+{
+
+/* Initiation */
+
+	// Initiate muCOSA
+	muCOSA_context_create(&muCOSA, window_system, MU_TRUE);
+
+	// Print currently running window system
+	printf("Running window system \"%s\"\n",
+		mu_window_system_get_nice_name(muCOSA_context_get_window_system(&muCOSA))
+	);
+
+	// Set callbacks
+	muWindowCallbacks callbacks = MU_ZERO_STRUCT(muWindowCallbacks);
+	callbacks.keyboard = keyboard_callback;
+	callbacks.mouse_key = mouse_key_callback;
+	callbacks.raw_motion = raw_motion_callback;
+	wininfo.callbacks = &callbacks;
+
+	// Create window
+	win = mu_window_create(&wininfo);
+
+	// Receive raw motion
+	muBool raw_motion = MU_TRUE;
+	muCOSAResult res = MUCOSA_SUCCESS;
+	mu_window_set_(&res, win, MU_WINDOW_RAW_MOTION, &raw_motion);
+	if (res != MUCOSA_SUCCESS) {
+		printf("Raw motion is unavailable (%s)\n", muCOSA_result_get_name(res));
+	} else {
+		printf("Move the mouse to turn the camera; click to lock the pointer\n");
+	}
+
+/* Main loop */
+
+	// Loop while window isn't closed:
+	while (!mu_window_get_closed(win))
+	{
+		// Update window (which refreshes input, calls callbacks, etc.)
+		mu_window_update(win);
+	}
+
+/* Termination */
+
+	// Destroy window (required)
+	win = mu_window_destroy(win);
+
+	// Terminate muCOSA (required)
+	muCOSA_context_destroy(&muCOSA);
+
+	// Print possible error
+	if (muCOSA.result != MUCOSA_SUCCESS) {
+		printf("Something went wrong during the program's lifespan; result: %s\n",
+			muCOSA_result_get_name(muCOSA.result)
+		);
+	} else {
+		printf("Successful\n");
+	}
+
+	return 0;
+}
+/*
+------------------------------------------------------------------------------
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2024 Hum
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+------------------------------------------------------------------------------
+*/
+
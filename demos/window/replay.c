@@ -0,0 +1,269 @@
+/*
+============================================================
+                        DEMO INFO
+
+DEMO NAME:          replay.c
+DEMO WRITTEN BY:
+CREATION DATE:
+LAST UPDATED:
+
+============================================================
+                        DEMO PURPOSE
+
+This demo shows how input can be recorded and replayed, and
+how a replay can be used to drive a benchmark.
+
+The input given to the window that opens is recorded to the
+file "replay.mucosarc" until the window is closed. The
+recording is then replayed to a headless window as fast as
+possible, and the program should print how many times each
+callback was called and the processor time that the replay
+took. If the file already exists, recording is skipped and
+the existing recording is replayed.
+
+============================================================
+                        LICENSE INFO
+
+All code is licensed under MIT License or public domain, 
+whichever you prefer.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+/* Inclusion */
+
+	// Include muCOSA
+	#define MUCOSA_NAMES // For name functions
+	#define MUCOSA_IMPLEMENTATION // For source code
+	#include "muCOSA.h"
+
+	// Include stdio for print functions
+	#include <stdio.h>
+
+	// Include time for measuring processor time
+	#include <time.h>
+
+/* Callbacks */
+
+	// Amount of times each callback was called
+	size_m dimensions_count, position_count, keyboard_count, keystate_count,
+		mouse_key_count, cursor_count, scroll_count, frame_count;
+
+	void dimensions_callback(muWindow win, uint32_m width, uint32_m height) {
+		++dimensions_count;
+		if (win) {} if (width) {} if (height) {}
+	}
+	void position_callback(muWindow win, int32_m x, int32_m y) {
+		++position_count;
+		if (win) {} if (x) {} if (y) {}
+	}
+	void keyboard_callback(muWindow win, muKeyboardKey key, muBool status) {
+		++keyboard_count;
+		if (win) {} if (key) {} if (status) {}
+	}
+	void keystate_callback(muWindow win, muKeyboardState state, muBool status) {
+		++keystate_count;
+		if (win) {} if (state) {} if (status) {}
+	}
+	void mouse_key_callback(muWindow win, muMouseKey key, muBool status) {
+		++mouse_key_count;
+		if (win) {} if (key) {} if (status) {}
+	}
+	void cursor_callback(muWindow win, int32_m x, int32_m y) {
+		++cursor_count;
+		if (win) {} if (x) {} if (y) {}
+	}
+	void scroll_callback(muWindow win, int32_m add) {
+		++scroll_count;
+		if (win) {} if (add) {}
+	}
+	void frame_callback(muWindow win) {
+		++frame_count;
+		if (win) {}
+	}
+
+/* Variables */
+
+	// Global context
+	muCOSAContext muCOSA;
+
+	// The window system that input is recorded on
+	muWindowSystem window_system = MU_WINDOW_NULL; // (Auto)
+
+	// Window handle
+	muWindow win;
+
+	// File that input is recorded to
+	const char* path = "replay.mucosarc";
+
+	// Callbacks
+	muWindowCallbacks callbacks = {
+		dimensions_callback,
+		position_callback,
+		keyboard_callback,
+		keystate_callback,
+		mouse_key_callback,
+		cursor_callback,
+		scroll_callback,
+		frame_callback,
+		0
+	};
+
+	// Window information
+	muWindowInfo wininfo = {
+		// Title
+		(char*)"Replay (input is being recorded)",
+		// Resolution (width & height)
+		800, 600,
+		// Min/Max resolution (none)
+		0, 0, 0, 0,
+		// Coordinates (x and y)
+		50, 50,
+		// Pixel format (default)
+		0,
+		// Callbacks
+		&callbacks,
+		// Event capacity (none)
+		0,
+		// Coalescing (none)
+		MU_FALSE
+	};
+
+	// Prints how many times each callback was called
+	void print_counts(void) {
+		printf("dimensions: %i, position: %i, keyboard: %i, keystate: %i, mouse key: %i, cursor: %i, scroll: %i, frame: %i\n",
+			(int)dimensions_count, (int)position_count, (int)keyboard_count, (int)keystate_count,
+			(int)mouse_key_count, (int)cursor_count, (int)scroll_count, (int)frame_count
+		);
+		dimensions_count = position_count = keyboard_count = keystate_count = 0;
+		mouse_key_count = cursor_count = scroll_count = frame_count = 0;
+	}
+
+int main(void)
+{
+
+/* Recording */
+
+	// Only record if there isn't a recording already
+	FILE* existing = fopen(path, "rb");
+	if (existing) {
+		fclose(existing);
+		printf("Replaying existing recording \"%s\"\n", path);
+	} else {
+		// Initiate muCOSA
+		muCOSA_context_create(&muCOSA, window_system, MU_TRUE);
+		printf("Recording on window system \"%s\"\n",
+			mu_window_system_get_nice_name(muCOSA_context_get_window_system(&muCOSA))
+		);
+
+		// Create window and start recording
+		win = mu_window_create(&wininfo);
+		mu_window_record_start(win, path);
+
+		// Update until the window is closed
+		while (!mu_window_get_closed(win)) {
+			mu_window_update(win);
+			mu_sleep(1.0 / 60.0);
+		}
+
+		// Stop recording (done automatically when the window is destroyed,
+		// but this way, any error in writing the file is given)
+		mu_window_record_stop(win);
+		printf("Recorded: ");
+		print_counts();
+
+		// Destroy window + terminate muCOSA
+		win = mu_window_destroy(win);
+		muCOSA_context_destroy(&muCOSA);
+		if (muCOSA.result != MUCOSA_SUCCESS) {
+			printf("Recording failed; result: %s\n", muCOSA_result_get_name(muCOSA.result));
+			return 0;
+		}
+	}
+
+/* Replaying */
+
+	// Initiate muCOSA with the headless window system
+	muCOSA_context_create(&muCOSA, MU_WINDOW_HEADLESS, MU_TRUE);
+
+	// Create window and start replaying as fast as possible
+	win = mu_window_create(&wininfo);
+	mu_window_replay_start(win, path, MU_FALSE);
+
+	// Update until the replay is done
+	size_m updates = 0;
+	clock_t start = clock();
+	while (mu_window_get_replaying(win)) {
+		mu_window_update(win);
+		++updates;
+	}
+	double processor = (double)(clock() - start) / (double)CLOCKS_PER_SEC;
+
+	printf("Replayed: ");
+	print_counts();
+	printf("Replay took %f seconds of processor time over %i updates\n",
+		processor, (int)updates
+	);
+
+/* Termination */
+
+	// Destroy window (required)
+	win = mu_window_destroy(win);
+
+	// Terminate muCOSA (required)
+	muCOSA_context_destroy(&muCOSA);
+
+	// Print possible error
+	if (muCOSA.result != MUCOSA_SUCCESS) {
+		printf("Something went wrong during the program's lifespan; result: %s\n",
+			muCOSA_result_get_name(muCOSA.result)
+		);
+	} else {
+		printf("Successful\n");
+	}
+
+	return 0;
+}
+/*
+------------------------------------------------------------------------------
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2024 Hum
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+------------------------------------------------------------------------------
+*/
+
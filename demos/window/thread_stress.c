@@ -0,0 +1,313 @@
+/*
+============================================================
+                        DEMO INFO
+
+DEMO NAME:          thread_stress.c
+DEMO WRITTEN BY:
+CREATION DATE:
+LAST UPDATED:
+
+============================================================
+                        DEMO PURPOSE
+
+This demo stresses muCOSA's thread-safe mode by creating,
+destroying, getting, and setting windows from many threads
+at once, and measures how much the threads contend over
+the locks.
+
+Three scenarios are run, each once with a single thread
+and once with several:
+* "churn" - each thread repeatedly creates a window, sets
+  and gets some attributes of it, and destroys it.
+* "own window" - each thread gets and sets the attributes
+  of, and updates, a window of its own.
+* "shared window" - every thread gets and sets the
+  attributes of the same window.
+
+Program should print the amount of operations done per
+second in each scenario, and how that scales with the
+amount of threads (a scaling of 1.0 means that the threads
+entirely serialize on the locks). This demo uses pthreads,
+so it's only meant for Linux and other POSIX systems.
+
+============================================================
+                        LICENSE INFO
+
+All code is licensed under MIT License or public domain, 
+whichever you prefer.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+/* Inclusion */
+
+	// Include muCOSA in thread-safe mode
+	#define MUCOSA_THREAD_SAFE // For locking
+	#define MUCOSA_NAMES // For name functions
+	#define MUCOSA_IMPLEMENTATION // For source code
+	#include "muCOSA.h"
+
+	// Include stdio for print functions
+	#include <stdio.h>
+
+	// Include pthread for threads
+	#include <pthread.h>
+
+	// Include time for measuring elapsed time
+	#include <time.h>
+
+/* Variables */
+
+	// Global context
+	muCOSAContext muCOSA;
+
+	// The window system
+	muWindowSystem window_system = MU_WINDOW_NULL; // (Auto)
+
+	// Amount of threads + operations done by each thread per scenario
+	#define THREAD_COUNT 8
+	#define CHURN_COUNT 200
+	#define OPERATION_COUNT 20000
+
+	// Window shared between threads
+	muWindow shared_window;
+
+	// Window information
+	muWindowInfo wininfo = {
+		// Title
+		(char*)"Thread stress",
+		// Resolution (width & height)
+		320, 240,
+		// Min/Max resolution (none)
+		0, 0, 0, 0,
+		// Coordinates (x and y)
+		50, 50,
+		// Pixel format (default)
+		0,
+		// Callbacks (none)
+		0,
+		// Event capacity
+		64,
+		// Coalescing (none)
+		MU_FALSE
+	};
+
+	// Data of each thread
+	struct Worker {
+		pthread_t thread;
+		// Index of the thread
+		uint32_m index;
+		// Amount of operations done
+		size_m operations;
+		// First failed result (MUCOSA_SUCCESS if none)
+		muCOSAResult result;
+	};
+	typedef struct Worker Worker;
+
+	Worker workers[THREAD_COUNT];
+
+/* Scenarios */
+
+	// Records a result if it's the first failure of the thread
+	void check(Worker* worker, muCOSAResult result) {
+		if (result != MUCOSA_SUCCESS && worker->result == MUCOSA_SUCCESS) {
+			worker->result = result;
+		}
+	}
+
+	// Sets and gets attributes of a window, as one operation
+	void get_set(Worker* worker, muWindow win, size_m i) {
+		muCOSAResult result = MUCOSA_SUCCESS;
+
+		// Set dimensions + cursor position
+		uint32_m dim[2] = { 100 + worker->index, 100 + (uint32_m)(i % 100) };
+		mu_window_set_(&result, win, MU_WINDOW_DIMENSIONS, dim);
+		check(worker, result);
+		int32_m cursor[2] = { (int32_m)worker->index, (int32_m)(i % 100) };
+		mu_window_set_(&result, win, MU_WINDOW_CURSOR, cursor);
+		check(worker, result);
+
+		// Get them back (another thread may have changed them in the meantime
+		// on a shared window)
+		mu_window_get_(&result, win, MU_WINDOW_DIMENSIONS, dim);
+		check(worker, result);
+		mu_window_get_(&result, win, MU_WINDOW_CURSOR, cursor);
+		check(worker, result);
+
+		++worker->operations;
+	}
+
+	void* churn(void* data) {
+		Worker* worker = (Worker*)data;
+		for (size_m i = 0; i < CHURN_COUNT; ++i) {
+			muCOSAResult result = MUCOSA_SUCCESS;
+			muWindow win = mu_window_create_(&result, &wininfo);
+			check(worker, result);
+			if (!win) {
+				break;
+			}
+			get_set(worker, win, i);
+			mu_window_update_(&result, win);
+			check(worker, result);
+			win = mu_window_destroy(win);
+		}
+		return 0;
+	}
+
+	void* own_window(void* data) {
+		Worker* worker = (Worker*)data;
+		muCOSAResult result = MUCOSA_SUCCESS;
+		muWindow win = mu_window_create_(&result, &wininfo);
+		check(worker, result);
+		if (!win) {
+			return 0;
+		}
+
+		muEvent events[64];
+		for (size_m i = 0; i < OPERATION_COUNT; ++i) {
+			get_set(worker, win, i);
+			// Update every so often, reading the events it gives
+			if (i % 16 == 0) {
+				mu_window_update_(&result, win);
+				check(worker, result);
+				mu_window_poll_events(win, events, 64);
+			}
+		}
+
+		win = mu_window_destroy(win);
+		return 0;
+	}
+
+	void* shared(void* data) {
+		Worker* worker = (Worker*)data;
+		for (size_m i = 0; i < OPERATION_COUNT; ++i) {
+			get_set(worker, shared_window, i);
+		}
+		return 0;
+	}
+
+	// Current time in seconds
+	double now(void) {
+		struct timespec t;
+		clock_gettime(CLOCK_MONOTONIC, &t);
+		return (double)t.tv_sec + (double)t.tv_nsec / 1.0e9;
+	}
+
+	// Runs a scenario on the given amount of threads; returns the amount of
+	// operations done per second, or a negative number if anything failed
+	double run(void* (*scenario)(void*), uint32_m thread_count) {
+		double start = now();
+		for (uint32_m i = 0; i < thread_count; ++i) {
+			workers[i].index = i;
+			workers[i].operations = 0;
+			workers[i].result = MUCOSA_SUCCESS;
+			pthread_create(&workers[i].thread, 0, scenario, &workers[i]);
+		}
+
+		size_m operations = 0;
+		muBool failed = MU_FALSE;
+		for (uint32_m i = 0; i < thread_count; ++i) {
+			pthread_join(workers[i].thread, 0);
+			operations += workers[i].operations;
+			if (workers[i].result != MUCOSA_SUCCESS) {
+				printf("Thread %i failed; result: %s\n", (int)i, muCOSA_result_get_name(workers[i].result));
+				failed = MU_TRUE;
+			}
+		}
+
+		double elapsed = now() - start;
+		return failed ? -1.0 : ((double)operations / elapsed);
+	}
+
+	// Runs a scenario on one thread, then on every thread, and prints the results
+	void measure(const char* name, void* (*scenario)(void*)) {
+		double single = run(scenario, 1);
+		double multi = run(scenario, THREAD_COUNT);
+		printf("%-13s | %15.0f | %16.0f | %7.2f\n", name, single, multi, (single > 0.0) ? (multi / single) : 0.0);
+	}
+
+int main(void)
+{
+
+/* Initiation */
+
+	// Initiate muCOSA
+	muCOSA_context_create(&muCOSA, window_system, MU_TRUE);
+
+	// Print currently running window system
+	printf("Running window system \"%s\"\n",
+		mu_window_system_get_nice_name(muCOSA_context_get_window_system(&muCOSA))
+	);
+
+	// Create shared window
+	shared_window = mu_window_create(&wininfo);
+
+/* Stress */
+
+	printf("scenario      | 1 thread (op/s) | %i threads (op/s) | scaling\n", THREAD_COUNT);
+	measure("churn", churn);
+	measure("own window", own_window);
+	measure("shared window", shared);
+
+/* Termination */
+
+	// Destroy shared window (required)
+	shared_window = mu_window_destroy(shared_window);
+
+	// Terminate muCOSA (required)
+	muCOSA_context_destroy(&muCOSA);
+
+	// Print possible error
+	if (muCOSA.result != MUCOSA_SUCCESS) {
+		printf("Something went wrong during the program's lifespan; result: %s\n",
+			muCOSA_result_get_name(muCOSA.result)
+		);
+	} else {
+		printf("Successful\n");
+	}
+
+	return 0;
+}
+/*
+------------------------------------------------------------------------------
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2024 Hum
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+------------------------------------------------------------------------------
+*/
+
@@ -0,0 +1,215 @@
+/*
+============================================================
+                        DEMO INFO
+
+DEMO NAME:          update_bench.c
+DEMO WRITTEN BY:
+CREATION DATE:
+LAST UPDATED:
+
+============================================================
+                        DEMO PURPOSE
+
+This demo measures how the cost of updating windows grows
+with the amount of windows, comparing updating each window
+individually to updating all of them at once via
+muCOSA_context_update.
+
+Program should print, for several amounts of windows, the
+average processor time taken per frame by each method.
+Windows are shown while being measured.
+
+============================================================
+                        LICENSE INFO
+
+All code is licensed under MIT License or public domain, 
+whichever you prefer.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+/* Inclusion */
+
+	// Include muCOSA
+	#define MUCOSA_NAMES // For name functions
+	#define MUCOSA_IMPLEMENTATION // For source code
+	#include "muCOSA.h"
+
+	// Include stdio for print functions
+	#include <stdio.h>
+
+	// Include time for measuring processor time
+	// (The headless window system's clock is virtual)
+	#include <time.h>
+
+/* Variables */
+
+	// Global context
+	muCOSAContext muCOSA;
+
+	// The window system
+	muWindowSystem window_system = MU_WINDOW_NULL; // (Auto)
+
+	// Maximum amount of windows
+	#define MAX_WINDOWS 32
+
+	// Frames measured per method
+	#define FRAME_COUNT 1000
+
+	// Window handles
+	muWindow windows[MAX_WINDOWS];
+
+	// Window information
+	muWindowInfo wininfo = {
+		// Title
+		(char*)"Update benchmark",
+		// Resolution (width & height)
+		160, 120,
+		// Min/Max resolution (none)
+		0, 0, 0, 0,
+		// Coordinates (x and y; changed for each window)
+		0, 0,
+		// Pixel format (default)
+		0,
+		// Callbacks (none)
+		0,
+		// Event capacity (none)
+		0,
+		// Coalescing (none)
+		MU_FALSE
+	};
+
+/* Measuring */
+
+	// Returns the average amount of microseconds taken per frame by updating
+	// each window individually
+	double measure_window_update(size_m count) {
+		clock_t start = clock();
+		for (size_m f = 0; f < FRAME_COUNT; ++f) {
+			for (size_m w = 0; w < count; ++w) {
+				mu_window_update(windows[w]);
+			}
+		}
+		return ((double)(clock() - start) / (double)CLOCKS_PER_SEC) * 1.0e6 / (double)FRAME_COUNT;
+	}
+
+	// Returns the average amount of microseconds taken per frame by updating
+	// every window at once
+	double measure_context_update(void) {
+		clock_t start = clock();
+		for (size_m f = 0; f < FRAME_COUNT; ++f) {
+			mu_context_update();
+		}
+		return ((double)(clock() - start) / (double)CLOCKS_PER_SEC) * 1.0e6 / (double)FRAME_COUNT;
+	}
+
+int main(void)
+{
+
+/* Initiation */
+
+	// Initiate muCOSA
+	muCOSA_context_create(&muCOSA, window_system, MU_TRUE);
+
+	// Print currently running window system
+	printf("Running window system \"%s\"\n",
+		mu_window_system_get_nice_name(muCOSA_context_get_window_system(&muCOSA))
+	);
+
+/* Benchmark */
+
+	printf("windows | per-window update (us/frame) | context update (us/frame)\n");
+
+	// Double amount of windows each round
+	size_m created = 0;
+	for (size_m count = 1; count <= MAX_WINDOWS; count *= 2) {
+		// Create windows up to the amount, in a grid
+		for (; created < count; ++created) {
+			wininfo.x = 50 + (int32_m)(created % 8) * 170;
+			wininfo.y = 50 + (int32_m)(created / 8) * 150;
+			windows[created] = mu_window_create(&wininfo);
+			if (!windows[created]) {
+				break;
+			}
+		}
+		if (created < count) {
+			printf("Failed to create window; result: %s\n",
+				muCOSA_result_get_name(muCOSA.result)
+			);
+			break;
+		}
+
+		// Let every window process its creation before measuring
+		mu_context_update();
+
+		// Measure both methods
+		double window_us = measure_window_update(count);
+		double context_us = measure_context_update();
+		printf("%7i | %28f | %25f\n", (int)count, window_us, context_us);
+	}
+
+/* Termination */
+
+	// Destroy windows (required)
+	for (size_m w = 0; w < created; ++w) {
+		mu_window_destroy(windows[w]);
+	}
+
+	// Terminate muCOSA (required)
+	muCOSA_context_destroy(&muCOSA);
+
+	// Print possible error
+	if (muCOSA.result != MUCOSA_SUCCESS) {
+		printf("Something went wrong during the program's lifespan; result: %s\n",
+			muCOSA_result_get_name(muCOSA.result)
+		);
+	} else {
+		printf("Successful\n");
+	}
+
+	return 0;
+}
+
+/*
+------------------------------------------------------------------------------
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2024 Hum
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+------------------------------------------------------------------------------
+*/
+
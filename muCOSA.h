@@ -1,7 +1,7 @@
 /*
 muCOSA.h - Muukid
 Public domain single-file C library for interacting with operating systems using a cross-platform API.
-Currently only supports Windows.
+Currently supports Windows and Linux (X11 and Wayland).
 No warranty implied; use at your own risk.
 
 Licensed under MIT license or public domain, whichever you prefer.
@@ -48,7 +48,18 @@ Since the demos test the functionality of OpenGL, [glad](https://github.com/Dav1
 
 # System dependencies
 
-muCOSA is supported for Win32. This operating system requires the user to link to certain operating system files when compiling.
+muCOSA is supported for Win32, X11, and Wayland. These window systems require the user to link to certain files when compiling.
+
+Outside of Win32, muCOSA's source code uses POSIX functions that strict C modes (such as `-std=c99` or `-std=c11`) hide. In those modes, if no feature test macro (`_POSIX_C_SOURCE`, `_XOPEN_SOURCE`, `_GNU_SOURCE`, or `_DEFAULT_SOURCE`) has been defined by the user, muCOSA defines `_XOPEN_SOURCE` as 700 upon its first inclusion, before including anything. This only works if muCOSA is included before any other header, so in those modes, `muCOSA.h` must be the first header included in the file with its source code. If another header has to come before the source code (such as an OpenGL loader that can't be included after `GL/gl.h`), the header of muCOSA can be included first, and its source code afterwards:
+
+```c
+#include "muCOSA.h" // (Header; first)
+#include "glad.h"
+#define MUCOSA_IMPLEMENTATION
+#include "muCOSA.h" // (Source code)
+```
+
+Otherwise, the user needs to define a feature test macro themselves before any inclusion.
 
 ## Win32 dependencies
 
@@ -56,8 +67,57 @@ To compile with Windows, you need to link the following files under the given ci
 
 `user32.dll` and `imm32.dll` in any given circumstance.
 
+Windows Vista or later is required, as muCOSA uses slim reader/writer locks (`SRWLOCK`).
+
 `gdi32.dll` and `opengl32.dll` if `MU_SUPPORT_OPENGL` is defined by the user.
 
+`vulkan-1.dll` if `MU_SUPPORT_VULKAN` is defined by the user.
+
+## X11 dependencies
+
+To compile with X11, you need to link the following files under the given circumstances:
+
+`libX11` (`-lX11`) in any given circumstance.
+
+`libpthread` (`-lpthread`) if compiling with a version of glibc older than 2.34, as muCOSA uses pthread reader/writer locks.
+
+`libX11-xcb` (`-lX11-xcb`) and `libxcb` (`-lxcb`) if `MUCOSA_X11_XCB` is defined by the user. Defining this macro makes muCOSA query the X server through XCB, which lets it send several queries at once without waiting on each one's reply (see `muCOSA_window_get_batch`); it requires the header `X11/Xlib-xcb.h`. Xlib is still used for everything else, such as events and input methods.
+
+`libXtst` (`-lXtst`) if `MUCOSA_X11_XTEST` is defined by the user. Defining this macro makes muCOSA use the XTest extension for [input injection](#input-injection); it requires the header `X11/extensions/XTest.h`. Without it, input injection is mostly unsupported on X11.
+
+`libXi` (`-lXi`) if `MUCOSA_X11_XI2` is defined by the user. Defining this macro makes muCOSA use the XInput2 extension for [raw motion](#raw-motion); it requires the header `X11/extensions/XInput2.h`. Without it, raw motion is unsupported on X11.
+
+`libXext` (`-lXext`) if `MUCOSA_X11_SHM` is defined by the user. Defining this macro makes muCOSA use the MIT-SHM extension for [presenting pixels](#pixel-presentation), which shares the window's pixel buffers with the X server rather than copying them over the connection; it requires the header `X11/extensions/XShm.h`. If the X server doesn't support the extension (for example, if it's on another machine), muCOSA falls back on copying the pixels.
+
+`libEGL` (`-lEGL`) if `MU_SUPPORT_OPENGL` is defined by the user; OpenGL contexts are created with EGL. The headers `EGL/egl.h` and `GL/gl.h` also need to be available.
+
+`libGL` (`-lGL`) instead of `libEGL` if both `MU_SUPPORT_OPENGL` and `MUCOSA_X11_GLX` are defined by the user. Defining `MUCOSA_X11_GLX` makes muCOSA create OpenGL contexts with GLX (via `glXCreateContextAttribsARB`) rather than EGL on X11, which requires the header `GL/glx.h`.
+
+`libvulkan` (`-lvulkan`) if `MU_SUPPORT_VULKAN` is defined by the user. The header `vulkan/vulkan.h` also needs to be available.
+
+## Wayland dependencies
+
+To compile with Wayland (which requires `MUCOSA_WAYLAND` to be defined, see [manual window system support](#manual-window-system-support)), you need to link the following files under the given circumstances:
+
+`libwayland-client` (`-lwayland-client`) and `libxkbcommon` (`-lxkbcommon`) in any given circumstance.
+
+`librt` (`-lrt`) if compiling with a version of glibc older than 2.34, as `shm_open` is used to create the shared memory of [pixel buffers](#pixel-presentation).
+
+`libpthread` (`-lpthread`) if compiling with a version of glibc older than 2.34, as muCOSA uses pthread reader/writer locks.
+
+The headers `wayland-client.h`, `xkbcommon/xkbcommon.h`, and `X11/keysym.h` also need to be available; the xdg-shell, cursor-shape, relative-pointer, and pointer-constraints protocols are built into muCOSA, so no code needs to be generated with `wayland-scanner`.
+
+`libwayland-egl` (`-lwayland-egl`) and `libEGL` (`-lEGL`) if `MU_SUPPORT_OPENGL` is defined by the user; OpenGL contexts are created with EGL. The headers `wayland-egl.h`, `EGL/egl.h`, and `GL/gl.h` also need to be available.
+
+`libvulkan` (`-lvulkan`) if `MU_SUPPORT_VULKAN` is defined by the user. The header `vulkan/vulkan.h` also needs to be available.
+
+Wayland support can be tested without a display using Weston's headless backend, running the program under it like so:
+
+```
+weston --backend=headless --socket=wayland-muCOSA &
+WAYLAND_DISPLAY=wayland-muCOSA ./program
+```
+
 # Licensing
 
 muCOSA is licensed under public domain or MIT, whichever you prefer. More information is provided in the accompanying file `license.md` and at the bottom of `muCOSA.h`.
@@ -66,7 +126,40 @@ However, note that the demos that use OpenGL use glad, which is built from the K
 
 # Multi-threading
 
-muCOSA does not directly support thread safety, and must be implemented by the user themselves. Thread safety in muCOSA can be generally achieved by locking each object within a muCOSA context (ie `muWindow` for example), making sure that only one thread is interacting with the given object. There are a few known exceptions to this to achieve total thread safety, which are detailed below, but multi-threading with muCOSA is not thoroughly tested.
+By default, muCOSA does not directly support thread safety, and must be implemented by the user themselves. Thread safety in muCOSA can be generally achieved by locking each object within a muCOSA context (ie `muWindow` for example), making sure that only one thread is interacting with the given object. There are a few known exceptions to this to achieve total thread safety, which are detailed below, but multi-threading with muCOSA is not thoroughly tested.
+
+## Thread-safe mode
+
+If `MUCOSA_THREAD_SAFE` is defined by the user, muCOSA does this locking itself: each context and each window has its own lock, and every function locks what it uses for as long as it uses it, so that different windows can be driven from different threads. On Win32, the locks are critical sections; elsewhere, they're pthread mutexes (see the [X11](#x11-dependencies) and [Wayland](#wayland-dependencies) dependencies). The locks are recursive, so callbacks can call muCOSA functions, even on the window whose update called them.
+
+A function on a window locks the window, and on every window system besides the headless one, the context as well, since windows share the connection to the window system, and updating a window processes the events of every window. On the headless window system, windows share nothing but the context's clock, window list, and clipboard, so only the functions that use those (creating, destroying, updating, waiting on, and setting attributes of a window, injecting input, and starting to record or replay input) lock the context; the rest only lock the window, and can run in parallel with the same functions on other windows. The context is always locked before a window, so that two threads can't each hold a lock that the other is waiting on.
+
+Waiting (`muCOSA_window_wait`) and sleeping (`muCOSA_sleep`) don't hold any lock while blocking (besides on the headless window system, where they don't block), so one thread can wait on input while others use the context; on X11, `XInitThreads` is called before connecting to the X server so that this is safe. Creating and destroying a context, along with setting the global context (unless it's [thread-local](#thread-local-context)), still aren't thread-safe. A window can't be used by other threads while or after it's destroyed: the caller must make sure that every other thread is done with a window before destroying it, as destroying a window doesn't wait on other threads using it (on the headless window system, most functions on a window don't lock the context, so nothing keeps them from running during its destruction). The [non-result-checking macros](#nonresultcontext-checking-functions) all write to the result of the global context, so threads sharing a context should use the result-checking macros (or pass results themselves) to tell which call failed.
+
+A call that fails to create a lock gives the result `MUCOSA_FAILED_CREATE_LOCK`. The demo `demos/window/thread_stress.c` stresses creating, destroying, getting, and setting windows from many threads, and measures how much the threads contend over the locks.
+
+## Event thread
+
+If `MUCOSA_EVENT_THREAD` is defined by the user (which implies `MUCOSA_THREAD_SAFE`), each context owns an event thread, started when the context is created and stopped when it's destroyed, that handles the events of the window system by itself: it locks the context, processes every event available (calling callbacks, including the frame callback, on the event thread), unlocks the context, and then waits on the window system without anything locked. Events are handed off to other threads through each window's event queue, which in this mode is a single-producer/single-consumer ring buffer that neither side locks. A window created without an event queue gets one of `MUCOSA_EVENT_THREAD_CAPACITY` events anyway (256 by default, and overridable), which can't be polled, and is only used to hand off changes to its keymaps.
+
+In this mode, reading a window's input never blocks on the window system:
+
+* `muCOSA_window_update` catches up with the events handed off to the window without locking anything, and `muCOSA_context_update` does so for every window.
+* `muCOSA_window_poll_events` takes events out of the window's queue without locking anything.
+* `muCOSA_window_wait` waits for the event thread to hand off more events.
+* Retrieving `MU_WINDOW_KEYBOARD_MAP`, `MU_WINDOW_KEYSTATE_MAP`, or `MU_WINDOW_MOUSE_MAP` gives keymaps kept by the thread reading the window's events, which apply each keyboard, keystate, and mouse key event as it's read by updating or polling, so that they always match the events that the thread has seen. The event thread itself (such as from a callback) gets the keymaps as they change instead.
+
+A window's input should only be read (updated, polled, waited on, and its keymaps retrieved) by one thread at a time. When a window's queue is full, new events are dropped rather than the oldest, as the oldest may be being read at that moment; the keymaps only follow events that make it into the queue, so a window with a queue should be polled regularly.
+
+On Win32, a window's messages are delivered to the thread that created it, so every window is created by the event thread: calls to `muCOSA_window_create`, `muCOSA_window_destroy`, `muCOSA_window_set`, `muCOSA_window_get_text_input`, `muCOSA_window_let_text_input`, and `muCOSA_window_update_text_cursor` from other threads are sent to the event thread to be made there. While a window is being moved or resized, the event thread doesn't hold the context's lock during Win32's modal loop, and refreshes the window on a timer throughout it, so events keep being handed off as the window is dragged. On X11 and Wayland, the event thread waits on the connection, and is woken if another thread's call reads events from the connection for it. On the headless window system, the event thread is woken whenever input is injected, a replay is started, a window is updated, or the clock advances from waiting or sleeping; waiting on a window with injected input that hasn't been handled yet waits on the event thread to handle it. [Input recordings](#input-recording) mark the end of every round of events handled by the event thread, rather than every update.
+
+A context whose event thread couldn't be created gives the result `MUCOSA_FAILED_CREATE_THREAD`. The demo `demos/window/event_thread.c` renders on the main thread while the event thread handles events, checking that the keymaps match the events read, and printing any frame that stalls.
+
+## Thread-local context
+
+The [non-result-checking and result-checking macros](#nonresultcontext-checking-functions) (`mu_...` and `mu_..._`) all use the [global context](#global-context), which, by default, is one pointer shared by the whole process, so threads that each own a context can't use the macros without racing on `muCOSA_context_set`. If `MUCOSA_THREAD_LOCAL_CONTEXT` is defined by the user, the global context is thread-local instead: `muCOSA_context_set` (and `muCOSA_context_create` with `set_context` as `MU_TRUE`) only sets the calling thread's context, so each thread can use the macros with its own context. The non-result-checking macros then write to the result of the calling thread's context, and the result-checking macros never touch the result of any context.
+
+This option doesn't need `MUCOSA_THREAD_SAFE`, as long as no context is shared between threads. A thread starts with no current context, so it must set one before using the macros; in [event thread](#event-thread) mode, the event thread sets its context as its current one, so that callbacks can use the macros as well. Each use of a macro reads the thread-local pointer, which costs slightly more than reading a plain global on some platforms (namely through a dynamically-loaded library).
 
 ## Context creation
 
@@ -78,7 +171,7 @@ Due to limitations with the handling of messages on Win32, no more than one wind
 
 ## Window resizing/moving
 
-Due to the way that Win32 handles messages when the window is being resized or moved, a call to `muCOSA_window_update` will hang for the entire duration of the window being dragged/moved. Handling implemented by users of muCOSA should expect this, and handle vital functionality that needs to be executed over this time on a separate thread.
+Due to the way that Win32 handles messages when the window is being resized or moved, a call to `muCOSA_window_update` will hang for the entire duration of the window being dragged/moved. Handling implemented by users of muCOSA should expect this, and handle vital functionality that needs to be executed over this time on a separate thread, or use the [event thread](#event-thread), with which updating never blocks on the window system.
 
 # Known bugs and limitations
 
@@ -86,21 +179,23 @@ This section covers all of the known bugs and limitations with muCOSA.
 
 ## Limited support for most stuff
 
-This version of muCOSA is intended to be very basic, meaning that it only supports Windows and OpenGL, and is not thoroughly tested on other devices. Additionally, many features that might be needed on certain programs are absent. This, if not abandoned, will change in the future, as more support is added, but for now, this library's reach will be fairly limited.
+This version of muCOSA is intended to be very basic, meaning that it only supports Windows, X11, and Wayland for window systems and OpenGL for graphics, and is not thoroughly tested on other devices. Additionally, many features that might be needed on certain programs are absent. This, if not abandoned, will change in the future, as more support is added, but for now, this library's reach will be fairly limited.
 
-## Minimal overhead attribute management
+## Clipboard on X11
 
-Currently, muCOSA gets/sets attributes using a single function that requires at least one get/set call for every attribute being modified. Theoretically, more overhead could be abolished by allowing to get/set multiple attributes in one function call, perhaps using the `muWindowInfo` struct and a flag system. This has not been outruled as an option, and muCOSA may stand to gain via this being implemented at some point.
+On X11, the clipboard is owned by a client rather than stored by the system, so the data set by `muCOSA_clipboard_set` is only given to other programs while the muCOSA context is processing events (`muCOSA_window_update`, `muCOSA_clipboard_get`, and `muCOSA_clipboard_set`), and is lost once the context is destroyed. Additionally, incremental transfers (used by some programs for large amounts of data) are not supported when retrieving the clipboard data.
 
-## Unique class name generation
+## Wayland limitations
 
-Currently, a unique class name for every window is generated by using the manually-allocated pointer for each window, which, although making it highly likely that a unique name will be generated each time, doesn't make it entirely likely. More optimally, a system of generating valid unique names should be implemented, likely using an atomic counter and manual allocation per name, but this has yet to be implemented.
+On Wayland, windows cannot retrieve or modify their position, nor modify the position of the cursor, and attempting to do so gives the result `MUCOSA_WAYLAND_UNSUPPORTED_WINDOW_ATTRIB`. Windows are not shown until something is presented to them, keys being held down are not repeated, and text input only gives the characters of single key presses (no compose sequences or input methods). The clipboard can only be set after one of the context's windows has received input, and like X11, the data is only given to other programs while the context is processing events. Cursor styles require the compositor to support the cursor-shape protocol, and are otherwise left up to the compositor.
+
+## Minimal overhead attribute management
 
-## Inefficient window memory allocation on Win32
+Currently, muCOSA sets attributes using a single function that requires at least one set call for every attribute being modified. Multiple attributes can be retrieved in one function call via `muCOSA_window_get_batch`, but no equivalent exists for setting them yet; this has not been outruled as an option, and muCOSA may stand to gain via this being implemented at some point.
 
-Due to limitations with how a window is identified via its handle in the window procedure functions, the implementation for Win32 has a memory buffer that contains pointers to each window. The logic for this uses filling in empty slots to ensure that a fair amount of memory is allocated even in the event of a large amount of windows being destroyed and created. However, the logic of it currently does not decrease the amount of memory allocated for the window pointers, meaning that a peak in the amount of windows created (across all muCOSA contexts) will peak the memory usage for the buffer, and will not decrease until all muCOSA contexts are destroyed.
+## Unique class name generation
 
-This is generally okay, both because the maximum amount of memory allocated for this buffer is the size of a pointer multiplied by the closest power of 2 greater than the amount of windows. So, for example, if there were a maximum of 2718 windows reached at some point during the program's lifespan, and the device is using 64 bits per pointer, the memory usage by this buffer will peak at `64*4096`, or 262144 bytes, and will not decrease until all muCOSA contexts are destroyed. However, it is not only unlikely that a program will ever use this amount of windows, but it is even more unlikely that Windows itself will be able to run properly after this amount of windows have been created.
+Currently, a unique class name for every window is generated by using the manually-allocated pointer for each window, which, although making it highly likely that a unique name will be generated each time, doesn't make it entirely likely. More optimally, a system of generating valid unique names should be implemented, likely using an atomic counter and manual allocation per name, but this has yet to be implemented.
 
 ## Testing with multiple pixel formats
 
@@ -108,6 +203,19 @@ Uncommon pixel formats (such as no-alpha pixel formats) are not tested thoroughl
 
 @DOCEND */
 
+/* POSIX feature test */
+
+// Strict C modes (such as -std=c99) hide the POSIX functions and types that
+// the source code uses (pthread reader/writer locks, recursive mutexes,
+// clock_gettime, etc.) unless a feature test macro asks for them. This has to
+// be defined before any system header is included, so it's done upon the first
+// inclusion of this file, even if it's only the header (so that the header can
+// be included first, and the source code later).
+#if !defined(MUCOSA_H) && !defined(_WIN32) && defined(__STRICT_ANSI__) && \
+	!defined(_POSIX_C_SOURCE) && !defined(_XOPEN_SOURCE) && !defined(_GNU_SOURCE) && !defined(_DEFAULT_SOURCE)
+	#define _XOPEN_SOURCE 700
+#endif
+
 #ifndef MUCOSA_H
 	#define MUCOSA_H
 	
@@ -903,6 +1011,15 @@ Uncommon pixel formats (such as no-alpha pixel formats) are not tested thoroughl
 		// @DOCLINE * `MU_WINDOW_WIN32` - Win32; real value 1.
 		#define MU_WINDOW_WIN32 1
 
+		// @DOCLINE * `MU_WINDOW_X11` - X11; real value 2.
+		#define MU_WINDOW_X11 2
+
+		// @DOCLINE * `MU_WINDOW_WAYLAND` - Wayland; real value 3.
+		#define MU_WINDOW_WAYLAND 3
+
+		// @DOCLINE * `MU_WINDOW_HEADLESS` - Headless; real value 4. This window system has no display, with each window existing purely in memory; input is given to its windows by [injecting it](#input-injection). This is useful for testing and benchmarking, as updating a window costs no system calls. Its clock is virtual, only moving forward upon sleeping via `muCOSA_sleep` (which returns immediately), making runs deterministic. OpenGL is only supported for it via [offscreen OpenGL contexts](#create--destroy-opengl-context).
+		#define MU_WINDOW_HEADLESS 4
+
 		// @DOCLINE > Note that although on most operating systems, only one window system can exist (such as macOS or Windows), some operating systems can have more than one window system, such as Linux with X11 or Wayland. Just in case, muCOSA allows more than one window system to be defined at once in its API, tying each muCOSA context to a particular window system, theoretically allowing for multiple muCOSA contexts to exist at once with different window systems in one program.
 
 		// @DOCLINE ## Window system names
@@ -930,8 +1047,16 @@ Uncommon pixel formats (such as no-alpha pixel formats) are not tested thoroughl
 
 		// @DOCLINE * `MUCOSA_WIN32` is defined if `MU_WIN32` is defined (automatically provided by muUtility), which toggles support for Win32.
 
+		// @DOCLINE * `MUCOSA_X11` is defined if `MU_LINUX` is defined (automatically provided by muUtility), which toggles support for X11.
+
+		// @DOCLINE `MUCOSA_WAYLAND`, which toggles support for Wayland, is never defined automatically, since it requires linking to libraries that X11 programs don't (see [Wayland dependencies](#wayland-dependencies)); it needs to be defined by the user, and can be defined alongside `MUCOSA_X11`. When both are supported, creating a context with `MU_WINDOW_NULL` picks Wayland if the environment variable `WAYLAND_DISPLAY` is set, and X11 otherwise.
+
+		// @DOCLINE * `MUCOSA_HEADLESS` is always defined, which toggles support for the headless window system. It is never chosen automatically as the best window system, and must be requested explicitly.
+
 		// @DOCLINE All of this functionality can be overrided by defining the macro `MUCOSA_MANUAL_OS_SUPPORT`, in which case, none of this is performed, and it is up to the user to manually define that operating systems are supported by defining their respective muCOSA macros (ie, if you're compiling on Windows and disabled automatic operating system recognition, you would need to define `MUCOSA_WIN32` yourself).
 
+		// @DOCLINE If exactly one window system is supported (which, since `MUCOSA_HEADLESS` is always defined automatically, requires `MUCOSA_MANUAL_OS_SUPPORT`), the window system of every muCOSA context is known at compile-time, and every public function calls the window system's implementation directly instead of checking the context's window system first, allowing the compiler to inline it. This is useful for programs that call functions such as `muCOSA_window_get` many times per frame. In this case, creating a context with any other window system fails with the result `MUCOSA_FAILED_NULL_WINDOW_SYSTEM`, like it otherwise would for an unsupported window system.
+
 	// @DOCLINE # Global context
 
 		// @DOCLINE muCOSA operates in a context, encapsulated by the type `muCOSAContext`, which has the following members:
@@ -949,7 +1074,7 @@ Uncommon pixel formats (such as no-alpha pixel formats) are not tested thoroughl
 		// @DOCLINE To create the context, the function `muCOSA_context_create` is used, defined below: @NLNT
 		MUDEF void muCOSA_context_create(muCOSAContext* context, muWindowSystem system, muBool set_context);
 
-		// @DOCLINE The result of this function is stored within `context->result`. Upon success, this function automatically calls `muCOSA_context_set` on the created context unless `set_context` is equal to `MU_FALSE`.
+		// @DOCLINE The result of this function is stored within `context->result`. Upon success, this function automatically calls `muCOSA_context_set` on the created context unless `set_context` is equal to `MU_FALSE` (which, if `MUCOSA_THREAD_LOCAL_CONTEXT` is defined, only sets it for the calling thread).
 
 		// > It is valid for `system` to be `MU_WINDOW_NULL` for this function, in which case, the best currently available window system will be automatically chosen by muCOSA.
 
@@ -959,11 +1084,35 @@ Uncommon pixel formats (such as no-alpha pixel formats) are not tested thoroughl
 
 		// @DOCLINE ## Global context
 
-		MUDEF muCOSAContext* muCOSA_global_context;
+		// @DOCLINE If `MUCOSA_THREAD_LOCAL_CONTEXT` is defined by the user, the global context is thread-local, meaning that each thread has its own current context (see [thread-local context](#thread-local-context)). The storage class used for this is `MUCOSA_THREAD_LOCAL`, which is `__declspec(thread)` on MSVC, `thread_local` in C++11 and above, `_Thread_local` in C11 and above, and `__thread` on GCC and Clang, and can be overwritten by defining it.
+		#ifdef MUCOSA_THREAD_LOCAL_CONTEXT
+			#ifndef MUCOSA_THREAD_LOCAL
+				#if defined(_MSC_VER)
+					#define MUCOSA_THREAD_LOCAL __declspec(thread)
+				#elif defined(__cplusplus) && __cplusplus >= 201103L
+					#define MUCOSA_THREAD_LOCAL thread_local
+				#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+					#define MUCOSA_THREAD_LOCAL _Thread_local
+				#elif defined(__GNUC__) || defined(__clang__)
+					#define MUCOSA_THREAD_LOCAL __thread
+				#else
+					#error "[MUCOSA] No known thread-local storage class for this compiler; define MUCOSA_THREAD_LOCAL before the header to use MUCOSA_THREAD_LOCAL_CONTEXT."
+				#endif
+			#endif
+		#else
+			#ifdef MUCOSA_THREAD_LOCAL
+				#undef MUCOSA_THREAD_LOCAL
+			#endif
+			#define MUCOSA_THREAD_LOCAL
+		#endif
+
+		MUDEF MUCOSA_THREAD_LOCAL muCOSAContext* muCOSA_global_context;
 
 		// @DOCLINE muCOSA uses a global variable to reference the currently "set" context whenever a function is called that assumes a context (ie it doesn't take a parameter for context). This global variable can be changed to reference a certain context via the function `muCOSA_context_set`, defined below: @NLNT
 		MUDEF void muCOSA_context_set(muCOSAContext* context);
 
+		// @DOCLINE If `MUCOSA_THREAD_LOCAL_CONTEXT` is defined, this only changes the current context of the calling thread, and every other thread starts with no current context.
+
 		// @DOCLINE ## Get context information
 
 		// @DOCLINE The only information that can be retrieved about an active context is its window system, using the function `muCOSA_context_get_window_system`, defined below: @NLNT
@@ -1040,6 +1189,10 @@ Uncommon pixel formats (such as no-alpha pixel formats) are not tested thoroughl
 				muPixelFormat* pixel_format;
 				// @DOCLINE * `@NLFT* callbacks` - the [callback functions](#window-callbacks) for various attributes of the window. If this member is equal to 0, no callbacks are specified. If this member is not equal to 0, it should be a valid pointer to a `muWindowCallbacks` struct specifying callbacks for the window.
 				muWindowCallbacks* callbacks;
+				// @DOCLINE * `@NLFT event_capacity` - the amount of [events](#window-events) that the window's event queue can hold. If this member is equal to 0, the window has no event queue.
+				size_m event_capacity;
+				// @DOCLINE * `@NLFT coalesce` - whether or not changes to the window's dimensions, position, and cursor position are [coalesced](#coalescing).
+				muBool coalesce;
 			};
 			typedef struct muWindowInfo muWindowInfo;
 
@@ -1061,6 +1214,8 @@ Uncommon pixel formats (such as no-alpha pixel formats) are not tested thoroughl
 
 			// @DOCLINE The destruction function cannot fail if given a proper context and window, and thus, there is no `result` parameter.
 
+			// @DOCLINE In [thread-safe mode](#thread-safe-mode), no other thread can be using the window while it's destroyed; this function doesn't wait on them to be done with it.
+
 			// @DOCLINE > The macro `mu_window_destroy` is the non-result-checking equivalent.
 			#define mu_window_destroy(...) muCOSA_window_destroy(muCOSA_global_context, __VA_ARGS__)
 
@@ -1135,6 +1290,102 @@ Uncommon pixel formats (such as no-alpha pixel formats) are not tested thoroughl
 			#define mu_window_update(...) muCOSA_window_update(muCOSA_global_context, &muCOSA_global_context->result, __VA_ARGS__)
 			#define mu_window_update_(result, ...) muCOSA_window_update(muCOSA_global_context, result, __VA_ARGS__)
 
+			// @DOCLINE ### Update all windows
+
+			// @DOCLINE Updating a window reads everything the window system has sent to the context, even input meant for other windows, along with refreshing state shared by every window (such as keystates). Programs with several windows can instead update all of the windows in a context at once with the function `muCOSA_context_update`, which does this only once per call, defined below: @NLNT
+			MUDEF void muCOSA_context_update(muCOSAContext* context, muCOSAResult* result);
+
+			// @DOCLINE This has the same effect as calling `muCOSA_window_update` on every window in the context that hasn't been closed, in the order that they were created. A main loop for several windows using this generally looks like this:
+
+			/* @DOCBEGIN
+			```c
+			while (!mu_window_get_closed(window_a) || !mu_window_get_closed(window_b)) {
+
+				// ... (This is where the frame-by-frame logic would go) ...
+
+				mu_context_update();
+			}
+			```
+			@DOCEND */
+
+			// @DOCLINE > The macro `mu_context_update` is the non-result-checking equivalent, and the macro `mu_context_update_` is the result-checking equivalent.
+			#define mu_context_update() muCOSA_context_update(muCOSA_global_context, &muCOSA_global_context->result)
+			#define mu_context_update_(result) muCOSA_context_update(muCOSA_global_context, result)
+
+			// @DOCLINE ### Wait
+
+			// @DOCLINE Calling `muCOSA_window_update` in a loop as fast as possible keeps a processor core busy even while nothing is happening. For programs that only need to respond to input, the function `muCOSA_window_wait` sleeps until the window system has input for the context or a given timeout (in seconds) elapses, defined below: @NLNT
+			MUDEF void muCOSA_window_wait(muCOSAContext* context, muCOSAResult* result, muWindow win, double timeout);
+
+			// @DOCLINE A negative timeout waits indefinitely, and a timeout of 0 returns immediately. This function doesn't process any input itself; it should be followed by a call to `muCOSA_window_update`, which processes whatever woke it up. A main loop that only runs when necessary generally looks like this:
+
+			/* @DOCBEGIN
+			```c
+			while (!mu_window_get_closed(window)) {
+				// Wait for input (or at most one second)
+				mu_window_wait(window, 1.0);
+				// Process it
+				mu_window_update(window);
+
+				// ... (This is where the frame-by-frame logic would go) ...
+			}
+			```
+			@DOCEND */
+
+			// @DOCLINE Waiting is performed by the kernel, waiting on the display connection on X11 and Wayland, and on the thread's message queue on Win32. The headless window system has no connection to wait on; since its clock is virtual, waiting returns immediately, advancing the clock by the timeout if the window has no injected input waiting to be processed (and not at all for a negative timeout).
+
+			// @DOCLINE > The macro `mu_window_wait` is the non-result-checking equivalent, and the macro `mu_window_wait_` is the result-checking equivalent.
+			#define mu_window_wait(...) muCOSA_window_wait(muCOSA_global_context, &muCOSA_global_context->result, __VA_ARGS__)
+			#define mu_window_wait_(result, ...) muCOSA_window_wait(muCOSA_global_context, result, __VA_ARGS__)
+
+			// @DOCLINE ### Wake
+
+			// @DOCLINE The function `muCOSA_context_wake` interrupts a call to `muCOSA_window_wait` on a context, making it return before input has arrived or the timeout has elapsed, defined below: @NLNT
+			MUDEF void muCOSA_context_wake(muCOSAContext* context);
+
+			// @DOCLINE Unless `MUCOSA_THREAD_SAFE` is defined (see [thread-safe mode](#thread-safe-mode)), this is the only muCOSA function that is safe to call from a thread other than the one using the context. It's meant for other threads to get the thread waiting on input to handle something (such as work that they've finished). If no wait is in progress when it's called, the next wait on the context returns immediately.
+
+			// @DOCLINE > The macro `mu_context_wake` is the non-context-checking equivalent.
+			#define mu_context_wake() muCOSA_context_wake(muCOSA_global_context)
+
+			// @DOCLINE ### External event loops
+
+			// @DOCLINE Programs that already wait on several sources of input themselves (via `poll`, `epoll`, etc.) can wait on the context's connection to the window system along with them instead of calling `muCOSA_window_wait`. The function `muCOSA_context_get_fd` retrieves the file descriptor of this connection, defined below: @NLNT
+			MUDEF int muCOSA_context_get_fd(muCOSAContext* context, muCOSAResult* result);
+
+			// @DOCLINE The file descriptor becomes readable when the window system has sent something to the context, and is owned by muCOSA; it should only be waited on, and not be read from, written to, or closed by the user. This is supported by the X11 and Wayland window systems; on other window systems, this function returns -1 and gives the result `MUCOSA_FAILED_UNSUPPORTED_FEATURE`.
+
+			// @DOCLINE > The macro `mu_context_get_fd` is the non-result-checking equivalent, and the macro `mu_context_get_fd_` is the result-checking equivalent.
+			#define mu_context_get_fd() muCOSA_context_get_fd(muCOSA_global_context, &muCOSA_global_context->result)
+			#define mu_context_get_fd_(result) muCOSA_context_get_fd(muCOSA_global_context, result)
+
+			// @DOCLINE The function `muCOSA_context_dispatch_pending` processes everything that the window system has sent to the context without blocking, triggering the callbacks of each window it concerns, defined below: @NLNT
+			MUDEF void muCOSA_context_dispatch_pending(muCOSAContext* context, muCOSAResult* result);
+
+			// @DOCLINE This only reads what is already readable, and sends any requests made by muCOSA that haven't been sent yet. Because muCOSA can read from the connection during other function calls, input may already be waiting to be processed without the file descriptor being readable, so this function should be called before waiting on the file descriptor, and once it is readable. Keystate and frame callbacks still only occur when a window is updated. A loop using this generally looks like this:
+
+			/* @DOCBEGIN
+			```c
+			int fd = mu_context_get_fd();
+
+			while (!mu_window_get_closed(window)) {
+				// Process anything already read + send requests
+				mu_context_dispatch_pending();
+
+				// Wait on fd along with the program's other file descriptors here...
+
+				// Process input that arrived + do per-frame work
+				mu_window_update(window);
+			}
+			```
+			@DOCEND */
+
+			// @DOCLINE On Win32, this processes every message in the thread's message queue. On the headless window system, this does nothing, as injected input is processed by updating the window it was injected into.
+
+			// @DOCLINE > The macro `mu_context_dispatch_pending` is the non-result-checking equivalent, and the macro `mu_context_dispatch_pending_` is the result-checking equivalent.
+			#define mu_context_dispatch_pending() muCOSA_context_dispatch_pending(muCOSA_global_context, &muCOSA_global_context->result)
+			#define mu_context_dispatch_pending_(result) muCOSA_context_dispatch_pending(muCOSA_global_context, result)
+
 		// @DOCLINE ## Window attributes
 
 			typedef uint16_m muWindowAttrib;
@@ -1153,7 +1404,7 @@ Uncommon pixel formats (such as no-alpha pixel formats) are not tested thoroughl
 			#define MU_WINDOW_KEYBOARD_MAP 3
 			// @DOCLINE    > Note that when being read, the data is not expected to be the actual array, but instead a pointer that will be set to the internally-used keymap array, which remains consistent for an entire window's lifespan. More information about the keyboard keymap can be found in the [keymap](#keymaps) section.
 
-			// @DOCLINE * `MU_WINDOW_KEYSTATE_MAP` - the [keystate keymap](#keystate-keymap), represented by a pointer to an array of booleans (type `muBool`) representing the state of all keyboard states (such as caps lock, for example). This can be "get" but not "set".
+			// @DOCLINE * `MU_WINDOW_KEYSTATE_MAP` - the [keystate keymap](#keystate-keymap), represented by a pointer to an array of booleans (type `muBool`) representing the state of all keyboard states (such as caps lock, for example). This can be "get" but not "set". On Win32, keystates are only updated for the window with keyboard focus, so the keystate keymaps of other windows can be out of date (see [keystate keymap](#keystate-keymap)).
 			#define MU_WINDOW_KEYSTATE_MAP 4
 
 			// @DOCLINE * `MU_WINDOW_MOUSE_MAP` - the [mouse keymap](#mouse-keymap), represented by a pointer to an array of booleans (type `muBool`) representing the state of each readable mouse key. This can be "get", but not "set".
@@ -1184,8 +1435,23 @@ Uncommon pixel formats (such as no-alpha pixel formats) are not tested thoroughl
 			#define MU_WINDOW_CURSOR_CALLBACK 14
 			// @DOCLINE    * `MU_WINDOW_SCROLL_CALLBACK` - the scroll callback.
 			#define MU_WINDOW_SCROLL_CALLBACK 15
+			// @DOCLINE    * `MU_WINDOW_FRAME_CALLBACK` - the frame callback.
+			#define MU_WINDOW_FRAME_CALLBACK 16
 			// @DOCLINE    > When callbacks are being set via `muCOSA_window_set`, note that they are pointers *to* the function pointers; function "`fun`" would be set via `muCOSA_window_set(..., &fun)`. For more information about the callbacks, see the (callbacks section)(#window-callbacks). The types listed in the `muWindowCallbacks` struct match the types expected for the callback window attributes.
 
+			// @DOCLINE * `MU_WINDOW_EVENT_TIME` - the [time](#event-struct) of the most recent event delivered to the window, in seconds, on the context's clock, represented by a single `double`; 0 if no event has been delivered yet. This can be "get", but not "set".
+			#define MU_WINDOW_EVENT_TIME 17
+			// @DOCLINE    > When retrieved within a callback, this is the time of the event that the callback is being called for, which is useful for measuring input latency.
+
+			// @DOCLINE * `MU_WINDOW_RAW_MOTION_CALLBACK` - the raw motion callback. Like the other callback attributes, this cannot be "get", but can be "set".
+			#define MU_WINDOW_RAW_MOTION_CALLBACK 18
+
+			// @DOCLINE * `MU_WINDOW_RAW_MOTION` - whether or not the window receives [raw motion](#raw-motion), represented by a single `muBool`; `MU_FALSE` by default. This can be "get" and "set".
+			#define MU_WINDOW_RAW_MOTION 19
+
+			// @DOCLINE * `MU_WINDOW_POINTER_LOCK` - whether or not the window has the [pointer locked](#pointer-lock), represented by a single `muBool`; `MU_FALSE` by default. This can be "get" and "set".
+			#define MU_WINDOW_POINTER_LOCK 20
+
 			// @DOCLINE A value is "get" if calling `muCOSA_window_get` with it is valid, and a value is "set" if calling `muCOSA_window_set` with it is valid.
 
 			// @DOCLINE ### Names
@@ -1222,6 +1488,15 @@ Uncommon pixel formats (such as no-alpha pixel formats) are not tested thoroughl
 
 			// @DOCLINE > `mu_window_set` will only read from `data` and never modify it. Likewise, `mu_window_get` will only dereference `data` and never read from it.
 
+			// @DOCLINE The function `muCOSA_window_get_batch` retrieves several attributes of a window at once, defined below: @NLNT
+			MUDEF void muCOSA_window_get_batch(muCOSAContext* context, muCOSAResult* result, muWindow win, size_m count, muWindowAttrib* attribs, void** data);
+
+			// @DOCLINE This function is equivalent to calling `muCOSA_window_get` on each attribute in `attribs` (an array of `count` attributes), with the data of each attribute being the respective element in `data`. However, on some window systems, it can be much faster: on X11 with XCB (see [X11 dependencies](#x11-dependencies)), all of the attributes that need to be queried from the X server (dimensions, position, and cursor position) are requested at once, costing one round trip to the server in total. If retrieving any of the attributes fails, `result` is set to the failure value, but the rest of the attributes are still retrieved.
+
+			// @DOCLINE > The macro `mu_window_get_batch` is the non-result-checking equivalent, and the macro `mu_window_get_batch_` is the result-checking equivalent.
+			#define mu_window_get_batch(...) muCOSA_window_get_batch(muCOSA_global_context, &muCOSA_global_context->result, __VA_ARGS__)
+			#define mu_window_get_batch_(result, ...) muCOSA_window_get_batch(muCOSA_global_context, result, __VA_ARGS__)
+
 		// @DOCLINE ## Window callbacks
 
 			// @DOCLINE A window callback is a function that is called whenever the window registers that a certain attribute has changed. Every callback function is called while the window is being updated via the function `muCOSA_window_update`.
@@ -1243,8 +1518,14 @@ Uncommon pixel formats (such as no-alpha pixel formats) are not tested thoroughl
 				void (*cursor)(muWindow win, int32_m x, int32_m y);
 				// @DOCLINE * `void (*scroll)` - the scroll callback, called every time that the scroll level changes, defined below: @NLNT
 				void (*scroll)(muWindow win, int32_m add);
+				// @DOCLINE * `void (*frame)` - the frame callback, called when the window is ready for a new frame to be drawn and presented, defined below: @NLNT
+				void (*frame)(muWindow win);
+				// @DOCLINE * `void (*raw_motion)` - the raw motion callback, called every time that the mouse moves while the window receives [raw motion](#raw-motion), defined below: @NLNT
+				void (*raw_motion)(muWindow win, double dx, double dy);
 			};
 
+			// @DOCLINE On Wayland, the frame callback is paced by the compositor: it's called at most once per frame that the compositor displays, and not at all while the window is hidden, meaning that a program that draws in this callback doesn't draw frames that would never be seen. On other window systems, it is called once at the end of every window update.
+
 			// @DOCLINE Setting the value of any member to 0 dictates no callback function. Changes to an attribute made via the program (such as a `mu_window_set` call) are not guaranteed to generate corresponding callbacks.
 
 			// @DOCLINE Initial callbacks, AKA callbacks involving the window's attributes being set upon creation, are not guaranteed to be called. Additionally, duplicate callbacks (ie callbacks issuing the same value, such a keyboard callback issuing a key status that already matched the previous key status, AKA a key being pressed/released twice) can occur; in fact, duplicate key presses are used to represent a key being held down for a long time, and the rate of repetition varies between window systems and their settings.
@@ -1253,6 +1534,121 @@ Uncommon pixel formats (such as no-alpha pixel formats) are not tested thoroughl
 
 			// @DOCLINE Users should also avoid possible callback loops, such as a position callback that changes the position, which can theoretically trigger an infinite loop and cause a nasty crash.
 
+		// @DOCLINE ## Window events
+
+			// @DOCLINE Alongside callbacks, a window can store the input that it receives as events in a queue, which the user reads all at once after updating the window. This allows a frame's input to be processed in one loop, or handed to another thread, instead of being handled from within `muCOSA_window_update`. A window only has an event queue if it was created with a non-zero `event_capacity` in its `muWindowInfo`; otherwise, no events are stored, and nothing is done to store them.
+
+			// @DOCLINE Each event is stored at the same point that its respective callback is called (and before it's called), so events follow the same rules as callbacks regarding when they're generated; text events, for example, are only stored while the window has [text input](#text-input) focus. Events are stored regardless of whether or not a callback is set.
+
+			// @DOCLINE ### Event type
+
+			typedef uint8_m muEventType;
+			// @DOCLINE The type of an event is represented by the type `muEventType` (typedef for `uint8_m`). It has the following values:
+
+			// @DOCLINE * `MU_EVENT_DIMENSIONS` - the window's dimensions changed.
+			#define MU_EVENT_DIMENSIONS 0
+			// @DOCLINE * `MU_EVENT_POSITION` - the window's position changed.
+			#define MU_EVENT_POSITION 1
+			// @DOCLINE * `MU_EVENT_KEYBOARD` - a keyboard key was pressed or released.
+			#define MU_EVENT_KEYBOARD 2
+			// @DOCLINE * `MU_EVENT_KEYSTATE` - a keystate was turned on or off.
+			#define MU_EVENT_KEYSTATE 3
+			// @DOCLINE * `MU_EVENT_MOUSE_KEY` - a mouse key was pressed or released.
+			#define MU_EVENT_MOUSE_KEY 4
+			// @DOCLINE * `MU_EVENT_CURSOR` - the cursor moved.
+			#define MU_EVENT_CURSOR 5
+			// @DOCLINE * `MU_EVENT_SCROLL` - the cursor was scrolled.
+			#define MU_EVENT_SCROLL 6
+			// @DOCLINE * `MU_EVENT_TEXT` - a character was typed as text input.
+			#define MU_EVENT_TEXT 7
+			// @DOCLINE * `MU_EVENT_CLOSE` - the user closed the window.
+			#define MU_EVENT_CLOSE 8
+			// @DOCLINE * `MU_EVENT_RAW_MOTION` - the mouse moved while the window received [raw motion](#raw-motion).
+			#define MU_EVENT_RAW_MOTION 9
+
+			#ifdef MUCOSA_NAMES
+			// @DOCLINE #### Event type names
+
+			// @DOCLINE The name function for `muEventType` is `mu_event_type_get_name`, defined below: @NLNT
+			MUDEF const char* mu_event_type_get_name(muEventType type);
+
+			// @DOCLINE > This function returns "MU_UNKNOWN" if the value of `type` is unrecognized.
+
+			// @DOCLINE The nice name function for `muEventType` is `mu_event_type_get_nice_name`, defined below: @NLNT
+			MUDEF const char* mu_event_type_get_nice_name(muEventType type);
+
+			// @DOCLINE > This function returns "Unknown" if the value of `type` is unrecognized.
+			#endif
+
+			// @DOCLINE ### Event struct
+
+			// @DOCLINE An event is represented by the struct `muEvent`, which has the following members:
+
+			struct muEvent {
+				// @DOCLINE * `@NLFT type` - the type of the event.
+				muEventType type;
+				// @DOCLINE * `time` - the time that the event occurred, in seconds, on the [context's clock](#time) (the same one as `muCOSA_time_get`).
+				double time;
+				// @DOCLINE * `data` - a union of the event's data, whose member depends on the event's type:
+				union {
+					// @DOCLINE    * `dimensions.width` and `dimensions.height` - the window's new dimensions (`MU_EVENT_DIMENSIONS`).
+					struct { uint32_m width; uint32_m height; } dimensions;
+					// @DOCLINE    * `position.x` and `position.y` - the window's new position (`MU_EVENT_POSITION`).
+					struct { int32_m x; int32_m y; } position;
+					// @DOCLINE    * `keyboard.key` and `keyboard.status` - the keyboard key and its new status (`MU_EVENT_KEYBOARD`).
+					struct { muKeyboardKey key; muBool status; } keyboard;
+					// @DOCLINE    * `keystate.state` and `keystate.status` - the keystate and its new status (`MU_EVENT_KEYSTATE`).
+					struct { muKeyboardState state; muBool status; } keystate;
+					// @DOCLINE    * `mouse_key.key` and `mouse_key.status` - the mouse key and its new status (`MU_EVENT_MOUSE_KEY`).
+					struct { muMouseKey key; muBool status; } mouse_key;
+					// @DOCLINE    * `cursor.x` and `cursor.y` - the cursor's new position relative to the window's surface, and `cursor.dx` and `cursor.dy` - the motion of the cursor accumulated since the window's previous cursor event (`MU_EVENT_CURSOR`).
+					struct { int32_m x; int32_m y; int32_m dx; int32_m dy; } cursor;
+					// @DOCLINE    * `scroll` - the amount scrolled (`MU_EVENT_SCROLL`).
+					int32_m scroll;
+					// @DOCLINE    * `text` - the null-terminated UTF-8 character typed (`MU_EVENT_TEXT`).
+					uint8_m text[5];
+					// @DOCLINE    * `raw_motion.dx` and `raw_motion.dy` - the unaccelerated motion of the mouse (`MU_EVENT_RAW_MOTION`).
+					struct { double dx; double dy; } raw_motion;
+				} data;
+			};
+			typedef struct muEvent muEvent;
+
+			// @DOCLINE `MU_EVENT_CLOSE` has no data.
+
+			// @DOCLINE The time of an event is taken from the window system's own timestamp of the input when it gives one (X11's server time, Wayland's input event time, and Win32's message time), which is converted to the context's clock, so that it states when the input actually happened rather than when the window was updated. Input that isn't timestamped by the window system, such as changes found upon updating the window, is timestamped with when it was received. Injected input is timestamped with when it was injected. The time of the most recent event delivered to a window can be retrieved via the window attribute [`MU_WINDOW_EVENT_TIME`](#window-attributes).
+
+			// @DOCLINE ### Poll events
+
+			// @DOCLINE The function `muCOSA_window_poll_events` retrieves the events stored by a window, defined below: @NLNT
+			MUDEF size_m muCOSA_window_poll_events(muCOSAContext* context, muWindow win, muEvent* events, size_m max);
+
+			// @DOCLINE This function copies the oldest events in the window's queue into `events` (an array of at least `max` events), oldest first, removes them from the queue, and returns the amount of events copied; once it returns a value less than `max`, the queue is empty. It cannot fail, and returns 0 if the window has no event queue.
+
+			// @DOCLINE If more events are received than the queue can hold before it's polled, the oldest events are dropped to make room for the newest ones. If `MUCOSA_EVENT_THREAD` is defined, the newest events are dropped instead, as the queue is then filled by the [event thread](#event-thread) while other threads poll it, and the oldest events may be being read at that moment.
+
+			// @DOCLINE > The macro `mu_window_poll_events` is the non-result-checking equivalent.
+			#define mu_window_poll_events(...) muCOSA_window_poll_events(muCOSA_global_context, __VA_ARGS__)
+
+		// @DOCLINE ## Coalescing
+
+			// @DOCLINE Some input devices, such as high polling rate mice, can change the cursor position thousands of times per second, with each change triggering a callback and event. A window created with `coalesce` set to `MU_TRUE` in its `muWindowInfo` instead coalesces changes to its dimensions, position, and cursor position: only the latest of each is delivered (to its callback and event queue), once per update, while the intermediate ones are dropped. Attributes retrieved via "get" functions are always the latest, regardless of coalescing.
+
+			// @DOCLINE Other input, such as key and mouse key presses and releases, are never coalesced. Coalesced changes are delivered before any other input that comes after them, so the order of input stays the same; for example, the cursor callback is always called with the position the cursor moved to before a mouse button was pressed before the mouse key callback is called for it. Since the cursor event's `dx` and `dy` members accumulate all of the motion since the previous cursor event, none of the cursor's motion is lost by coalescing.
+
+			// @DOCLINE On Win32, the cursor position is only checked once per update, so it's always coalesced; additionally, changes to the dimensions and position of a window being dragged by the user are only delivered once the dragging stops, as Win32 doesn't return from updating the window until then.
+
+		// @DOCLINE ## Raw motion
+
+			// @DOCLINE The cursor position is affected by the pointer acceleration set by the user, is limited to whole pixels, and stops changing at the edges of the screen, which doesn't suit uses like mouse-controlled cameras. A window that receives raw motion (by setting the window attribute `MU_WINDOW_RAW_MOTION` to `MU_TRUE`) is instead given the motion of the mouse as it's reported by the device: unaccelerated, possibly fractional, and not limited by the screen. Each motion is delivered to the raw motion callback and as a `MU_EVENT_RAW_MOTION` event, with positive `dx` and `dy` values being motion to the right and down. Raw motion is delivered as soon as it's received, and is never coalesced.
+
+			// @DOCLINE Raw motion is sent to the window that the cursor is in, or to the window that has the pointer locked. It's read from XInput2 raw events on X11, which requires `MUCOSA_X11_XI2` to be defined; from `zwp_relative_pointer_v1` on Wayland; and from raw input (`WM_INPUT`) on Win32, where it's instead sent to the window with keyboard focus, and where the mouse stays registered for raw input once any window receives raw motion. If raw motion is unavailable, enabling it gives the result `MUCOSA_FAILED_UNSUPPORTED_FEATURE`. On the headless window system, raw motion can be [injected](#inject-raw-motion).
+
+			// @DOCLINE ### Pointer lock
+
+			// @DOCLINE A window can lock the pointer (by setting the window attribute `MU_WINDOW_POINTER_LOCK` to `MU_TRUE`), which hides the cursor and keeps it within the window, so that the mouse can be moved indefinitely without the cursor leaving; combined with raw motion, this is the usual way to implement mouse-controlled cameras. The cursor position is not meaningful while the pointer is locked, and on Wayland, it stops changing entirely. The lock is released while the window doesn't have focus, and is restored once it regains focus; only one window should have the pointer locked at a time.
+
+			// @DOCLINE The pointer is locked by grabbing it on X11, which gives the result `MUCOSA_X11_FAILED_GRAB_POINTER` if the window isn't visible or another program has the pointer grabbed; by `zwp_pointer_constraints_v1` on Wayland, where the compositor only locks the pointer once it's in the window, and which gives the result `MUCOSA_FAILED_UNSUPPORTED_FEATURE` if the compositor doesn't support it; and by clipping the cursor (`ClipCursor`) on Win32. On the headless window system, the lock is only stored.
+
 		// @DOCLINE ## Keymaps
 
 			// @DOCLINE In order to make input require as minimal overhead as possible, muCOSA allows the user to read key input using "keymaps". A keymap is an array of booleans (type `muBool`) that dictate the state of each key. Therefore, if a user wanted to check a particular key's state, they would retrieve the keymap, and index into it based on what key they want to check. This array is stored internally somewhere in the API, and, when retrieved (via a "get" function call), a pointer to this array is given. Since the keymap is stored as a pointer to inner memory used by muCOSA, it is automatically updated every call to `muCOSA_window_update`.
@@ -1458,6 +1854,8 @@ Uncommon pixel formats (such as no-alpha pixel formats) are not tested thoroughl
 
 			// @DOCLINE Once the pointer to the keystate keymap array has been retrieved via `muCOSA_window_get`, these values can be used as indexes to see the status of any mouse key, in which `MU_TRUE` indicates that the keystate is active, and `MU_FALSE` indicates that the keystate is inactive.
 
+			// @DOCLINE Keystates are tracked from the window system's notifications of them changing rather than being checked every update, so an update without any input costs nothing for keystates: on X11, they're given by XKB indicator events (and are unavailable if the X server doesn't support XKB); on Wayland, by the keyboard's modifiers; and on Win32, they're checked when the window receives a lock key or gains focus, meaning that they're only updated for the window with keyboard focus.
+
 			#ifdef MUCOSA_NAMES
 			// @DOCLINE #### Keystate names
 
@@ -1592,6 +1990,232 @@ Uncommon pixel formats (such as no-alpha pixel formats) are not tested thoroughl
 			#define mu_window_update_text_cursor(...) muCOSA_window_update_text_cursor(muCOSA_global_context, &muCOSA_global_context->result, __VA_ARGS__)
 			#define mu_window_update_text_cursor_(result, ...) muCOSA_window_update_text_cursor(muCOSA_global_context, result, __VA_ARGS__)
 
+		// @DOCLINE ## Input injection
+
+			// @DOCLINE muCOSA is able to inject input into a window, which is processed by the window the next time that it's updated, as if the input came from the user: the window's keymaps and attributes are updated, and the corresponding [callbacks](#window-callbacks) are called. This is primarily meant for testing and benchmarking programs built on muCOSA, and the input given is processed in the order it was injected in.
+
+			// @DOCLINE Input injection is supported by the headless window system (`MU_WINDOW_HEADLESS`), where the input is added directly to the window's input queue, and by X11 if `MUCOSA_X11_XTEST` is defined, where the input is faked through the XTest extension; on other window systems, these functions give the result `MUCOSA_FAILED_UNSUPPORTED_FEATURE`. Injecting a key or state outside of its respective range gives the result `MUCOSA_FAILED_UNKNOWN_INPUT`.
+
+			// @DOCLINE On X11, injected input is real input as far as the X server is concerned, so it's sent back as events and processed exactly like user input, once it arrives, which is usually by the next update. This means that it goes wherever the X server sends it: keyboard keys, keystates, and text go to the window with keyboard focus; mouse keys, scrolling, and raw motion go to the window under the cursor; and it affects every other program as well. Injected cursor positions are relative to the given window, and move the cursor there. Scrolling is faked as presses of the scroll wheel, each adding 120 or -120, so a scroll amount is rounded towards zero to a multiple of 120, and raw motion is faked as relative movement of the cursor, rounded to whole pixels. Text can only be injected if each character has a key on the current keyboard layout (possibly with shift); if not, `MUCOSA_FAILED_UNKNOWN_INPUT` is given. Dimensions and positions can't be injected on X11 (they can be set as [attributes](#window-attributes) instead), but closing can, and doesn't need XTest.
+
+			// @DOCLINE ### Inject keyboard key
+
+			// @DOCLINE The function `muCOSA_window_inject_key` injects a keyboard key being pressed (`status` equal to `MU_TRUE`) or released (`status` equal to `MU_FALSE`), defined below: @NLNT
+			MUDEF void muCOSA_window_inject_key(muCOSAContext* context, muCOSAResult* result, muWindow win, muKeyboardKey key, muBool status);
+
+			// @DOCLINE > The macro `mu_window_inject_key` is the non-result-checking equivalent, and the macro `mu_window_inject_key_` is the result-checking equivalent.
+			#define mu_window_inject_key(...) muCOSA_window_inject_key(muCOSA_global_context, &muCOSA_global_context->result, __VA_ARGS__)
+			#define mu_window_inject_key_(result, ...) muCOSA_window_inject_key(muCOSA_global_context, result, __VA_ARGS__)
+
+			// @DOCLINE ### Inject keystate
+
+			// @DOCLINE The function `muCOSA_window_inject_keystate` injects a keyboard state being turned on (`status` equal to `MU_TRUE`) or off (`status` equal to `MU_FALSE`), defined below: @NLNT
+			MUDEF void muCOSA_window_inject_keystate(muCOSAContext* context, muCOSAResult* result, muWindow win, muKeyboardState state, muBool status);
+
+			// @DOCLINE The keystate callback is only called if the keystate changes.
+
+			// @DOCLINE > The macro `mu_window_inject_keystate` is the non-result-checking equivalent, and the macro `mu_window_inject_keystate_` is the result-checking equivalent.
+			#define mu_window_inject_keystate(...) muCOSA_window_inject_keystate(muCOSA_global_context, &muCOSA_global_context->result, __VA_ARGS__)
+			#define mu_window_inject_keystate_(result, ...) muCOSA_window_inject_keystate(muCOSA_global_context, result, __VA_ARGS__)
+
+			// @DOCLINE ### Inject mouse key
+
+			// @DOCLINE The function `muCOSA_window_inject_mouse_key` injects a mouse key being pressed (`status` equal to `MU_TRUE`) or released (`status` equal to `MU_FALSE`), defined below: @NLNT
+			MUDEF void muCOSA_window_inject_mouse_key(muCOSAContext* context, muCOSAResult* result, muWindow win, muMouseKey key, muBool status);
+
+			// @DOCLINE > The macro `mu_window_inject_mouse_key` is the non-result-checking equivalent, and the macro `mu_window_inject_mouse_key_` is the result-checking equivalent.
+			#define mu_window_inject_mouse_key(...) muCOSA_window_inject_mouse_key(muCOSA_global_context, &muCOSA_global_context->result, __VA_ARGS__)
+			#define mu_window_inject_mouse_key_(result, ...) muCOSA_window_inject_mouse_key(muCOSA_global_context, result, __VA_ARGS__)
+
+			// @DOCLINE ### Inject cursor movement
+
+			// @DOCLINE The function `muCOSA_window_inject_cursor` injects the cursor moving to the given position relative to the window's surface, defined below: @NLNT
+			MUDEF void muCOSA_window_inject_cursor(muCOSAContext* context, muCOSAResult* result, muWindow win, int32_m x, int32_m y);
+
+			// @DOCLINE The cursor callback is only called if the cursor's position changes.
+
+			// @DOCLINE > The macro `mu_window_inject_cursor` is the non-result-checking equivalent, and the macro `mu_window_inject_cursor_` is the result-checking equivalent.
+			#define mu_window_inject_cursor(...) muCOSA_window_inject_cursor(muCOSA_global_context, &muCOSA_global_context->result, __VA_ARGS__)
+			#define mu_window_inject_cursor_(result, ...) muCOSA_window_inject_cursor(muCOSA_global_context, result, __VA_ARGS__)
+
+			// @DOCLINE ### Inject raw motion
+
+			// @DOCLINE The function `muCOSA_window_inject_raw_motion` injects the mouse moving by the given amount, defined below: @NLNT
+			MUDEF void muCOSA_window_inject_raw_motion(muCOSAContext* context, muCOSAResult* result, muWindow win, double dx, double dy);
+
+			// @DOCLINE The raw motion callback is only called if the window receives [raw motion](#raw-motion).
+
+			// @DOCLINE > The macro `mu_window_inject_raw_motion` is the non-result-checking equivalent, and the macro `mu_window_inject_raw_motion_` is the result-checking equivalent.
+			#define mu_window_inject_raw_motion(...) muCOSA_window_inject_raw_motion(muCOSA_global_context, &muCOSA_global_context->result, __VA_ARGS__)
+			#define mu_window_inject_raw_motion_(result, ...) muCOSA_window_inject_raw_motion(muCOSA_global_context, result, __VA_ARGS__)
+
+			// @DOCLINE ### Inject scroll
+
+			// @DOCLINE The function `muCOSA_window_inject_scroll` injects the given amount being scrolled, defined below: @NLNT
+			MUDEF void muCOSA_window_inject_scroll(muCOSAContext* context, muCOSAResult* result, muWindow win, int32_m add);
+
+			// @DOCLINE > The macro `mu_window_inject_scroll` is the non-result-checking equivalent, and the macro `mu_window_inject_scroll_` is the result-checking equivalent.
+			#define mu_window_inject_scroll(...) muCOSA_window_inject_scroll(muCOSA_global_context, &muCOSA_global_context->result, __VA_ARGS__)
+			#define mu_window_inject_scroll_(result, ...) muCOSA_window_inject_scroll(muCOSA_global_context, result, __VA_ARGS__)
+
+			// @DOCLINE ### Inject text
+
+			// @DOCLINE The function `muCOSA_window_inject_text` injects the given null-terminated UTF-8 text being typed, defined below: @NLNT
+			MUDEF void muCOSA_window_inject_text(muCOSAContext* context, muCOSAResult* result, muWindow win, uint8_m* text);
+
+			// @DOCLINE Each character is given to the window's [text input](#text-input) callback separately (if the window has text input focus when the input is processed). No keyboard input is generated for the text.
+
+			// @DOCLINE > The macro `mu_window_inject_text` is the non-result-checking equivalent, and the macro `mu_window_inject_text_` is the result-checking equivalent.
+			#define mu_window_inject_text(...) muCOSA_window_inject_text(muCOSA_global_context, &muCOSA_global_context->result, __VA_ARGS__)
+			#define mu_window_inject_text_(result, ...) muCOSA_window_inject_text(muCOSA_global_context, result, __VA_ARGS__)
+
+			// @DOCLINE ### Inject dimensions
+
+			// @DOCLINE The function `muCOSA_window_inject_dimensions` injects the window's surface being resized to the given dimensions, defined below: @NLNT
+			MUDEF void muCOSA_window_inject_dimensions(muCOSAContext* context, muCOSAResult* result, muWindow win, uint32_m width, uint32_m height);
+
+			// @DOCLINE The dimensions are kept within the window's minimum and maximum dimensions, and the dimensions callback is only called if the dimensions change.
+
+			// @DOCLINE > The macro `mu_window_inject_dimensions` is the non-result-checking equivalent, and the macro `mu_window_inject_dimensions_` is the result-checking equivalent.
+			#define mu_window_inject_dimensions(...) muCOSA_window_inject_dimensions(muCOSA_global_context, &muCOSA_global_context->result, __VA_ARGS__)
+			#define mu_window_inject_dimensions_(result, ...) muCOSA_window_inject_dimensions(muCOSA_global_context, result, __VA_ARGS__)
+
+			// @DOCLINE ### Inject position
+
+			// @DOCLINE The function `muCOSA_window_inject_position` injects the window being moved to the given position, defined below: @NLNT
+			MUDEF void muCOSA_window_inject_position(muCOSAContext* context, muCOSAResult* result, muWindow win, int32_m x, int32_m y);
+
+			// @DOCLINE The position callback is only called if the position changes.
+
+			// @DOCLINE > The macro `mu_window_inject_position` is the non-result-checking equivalent, and the macro `mu_window_inject_position_` is the result-checking equivalent.
+			#define mu_window_inject_position(...) muCOSA_window_inject_position(muCOSA_global_context, &muCOSA_global_context->result, __VA_ARGS__)
+			#define mu_window_inject_position_(result, ...) muCOSA_window_inject_position(muCOSA_global_context, result, __VA_ARGS__)
+
+			// @DOCLINE ### Inject close
+
+			// @DOCLINE The function `muCOSA_window_inject_close` injects the user closing the window, defined below: @NLNT
+			MUDEF void muCOSA_window_inject_close(muCOSAContext* context, muCOSAResult* result, muWindow win);
+
+			// @DOCLINE > The macro `mu_window_inject_close` is the non-result-checking equivalent, and the macro `mu_window_inject_close_` is the result-checking equivalent.
+			#define mu_window_inject_close(...) muCOSA_window_inject_close(muCOSA_global_context, &muCOSA_global_context->result, __VA_ARGS__)
+			#define mu_window_inject_close_(result, ...) muCOSA_window_inject_close(muCOSA_global_context, result, __VA_ARGS__)
+
+		// @DOCLINE ## Input recording
+
+			// @DOCLINE muCOSA is able to record the input that a window receives to a file, which can be replayed later, in order to reproduce the exact same input timeline; for example, to drive benchmarks with input recorded from a real user. A recording holds every [event](#window-events) delivered to the window (whether or not the window has an event queue) with the time that it occurred, along with the end of every update of the window, in a compact binary format.
+
+			// @DOCLINE Input can be recorded on any window system, but can only be replayed on the headless window system (`MU_WINDOW_HEADLESS`), where it's added to the window's input queue like [injected input](#input-injection); replaying on other window systems (including X11 with `MUCOSA_X11_XTEST` defined) gives the result `MUCOSA_FAILED_UNSUPPORTED_FEATURE`.
+
+			// @DOCLINE ### Record input
+
+			// @DOCLINE The function `muCOSA_window_record_start` starts recording the input received by a window to the file at the given path, overwriting it, defined below: @NLNT
+			MUDEF void muCOSA_window_record_start(muCOSAContext* context, muCOSAResult* result, muWindow win, const char* path);
+
+			// @DOCLINE If the window is already being recorded, the previous recording is stopped first.
+
+			// @DOCLINE > The macro `mu_window_record_start` is the non-result-checking equivalent, and the macro `mu_window_record_start_` is the result-checking equivalent.
+			#define mu_window_record_start(...) muCOSA_window_record_start(muCOSA_global_context, &muCOSA_global_context->result, __VA_ARGS__)
+			#define mu_window_record_start_(result, ...) muCOSA_window_record_start(muCOSA_global_context, result, __VA_ARGS__)
+
+			// @DOCLINE The function `muCOSA_window_record_stop` stops recording the input received by a window and closes the file, defined below: @NLNT
+			MUDEF void muCOSA_window_record_stop(muCOSAContext* context, muCOSAResult* result, muWindow win);
+
+			// @DOCLINE This function gives the result `MUCOSA_FAILED_WRITE_FILE` if any part of the recording couldn't be written. A window that is destroyed while being recorded has its recording stopped automatically.
+
+			// @DOCLINE > The macro `mu_window_record_stop` is the non-result-checking equivalent, and the macro `mu_window_record_stop_` is the result-checking equivalent.
+			#define mu_window_record_stop(...) muCOSA_window_record_stop(muCOSA_global_context, &muCOSA_global_context->result, __VA_ARGS__)
+			#define mu_window_record_stop_(result, ...) muCOSA_window_record_stop(muCOSA_global_context, result, __VA_ARGS__)
+
+			// @DOCLINE ### Replay input
+
+			// @DOCLINE The function `muCOSA_window_replay_start` starts replaying the input recording at the given path to a window, defined below: @NLNT
+			MUDEF void muCOSA_window_replay_start(muCOSAContext* context, muCOSAResult* result, muWindow win, const char* path, muBool realtime);
+
+			// @DOCLINE Replaying is only supported by the headless window system; on every other window system, this function does nothing and gives the result `MUCOSA_FAILED_UNSUPPORTED_FEATURE`. A recording made on another window system can be replayed to a headless window.
+
+			// @DOCLINE The recording is read entirely when this function is called, and is then injected into the window piece by piece as the window is updated. If `realtime` is `MU_TRUE`, the input is replayed at its original speed: each update injects the input that occurred up to the current time (relative to when replaying started), meaning that the input is spread out as the [time](#time) advances (on the headless window system, this is done by sleeping or waiting). If `realtime` is `MU_FALSE`, the input is replayed as fast as possible: each update injects the input received by one update of the recorded window, regardless of the current time, so the replay takes as many updates as the recording did.
+
+			// @DOCLINE Either way, replayed input is timestamped with the time that it originally occurred relative to when replaying started, so the [event time](#window-attributes) follows the original timeline. If the window is already replaying a recording, it's replaced by the new one.
+
+			// @DOCLINE > The macro `mu_window_replay_start` is the non-result-checking equivalent, and the macro `mu_window_replay_start_` is the result-checking equivalent.
+			#define mu_window_replay_start(...) muCOSA_window_replay_start(muCOSA_global_context, &muCOSA_global_context->result, __VA_ARGS__)
+			#define mu_window_replay_start_(result, ...) muCOSA_window_replay_start(muCOSA_global_context, result, __VA_ARGS__)
+
+			// @DOCLINE The function `muCOSA_window_replay_stop` stops replaying a recording to a window before it's finished, defined below: @NLNT
+			MUDEF void muCOSA_window_replay_stop(muCOSAContext* context, muCOSAResult* result, muWindow win);
+
+			// @DOCLINE > The macro `mu_window_replay_stop` is the non-result-checking equivalent, and the macro `mu_window_replay_stop_` is the result-checking equivalent.
+			#define mu_window_replay_stop(...) muCOSA_window_replay_stop(muCOSA_global_context, &muCOSA_global_context->result, __VA_ARGS__)
+			#define mu_window_replay_stop_(result, ...) muCOSA_window_replay_stop(muCOSA_global_context, result, __VA_ARGS__)
+
+			// @DOCLINE The function `muCOSA_window_get_replaying` returns whether or not a window is still replaying a recording, defined below: @NLNT
+			MUDEF muBool muCOSA_window_get_replaying(muCOSAContext* context, muCOSAResult* result, muWindow win);
+
+			// @DOCLINE This becomes `MU_FALSE` once the update that injects the last of the recording is done.
+
+			// @DOCLINE > The macro `mu_window_get_replaying` is the non-result-checking equivalent, and the macro `mu_window_get_replaying_` is the result-checking equivalent.
+			#define mu_window_get_replaying(...) muCOSA_window_get_replaying(muCOSA_global_context, &muCOSA_global_context->result, __VA_ARGS__)
+			#define mu_window_get_replaying_(result, ...) muCOSA_window_get_replaying(muCOSA_global_context, result, __VA_ARGS__)
+
+		// @DOCLINE ## Pixel presentation
+
+			// @DOCLINE muCOSA is able to present pixels rendered on the CPU directly to a window's surface, without the need for a graphics API. Pixels are represented as `uint32_m` values in the format 0xXXRRGGBB, where the top 8 bits are ignored; rows of pixels are stored top-to-bottom, separated by a "stride", which is the amount of bytes between the start of each row.
+
+			// @DOCLINE Each window owns a pair of pixel buffers that can be retrieved and presented directly; on X11 and Wayland, these buffers are backed by memory shared with the window system (MIT-SHM on X11, if `MUCOSA_X11_SHM` is defined, and `wl_shm` on Wayland), meaning that presenting them doesn't copy any pixels. Since the window system reads from a presented buffer after the present function returns, a presented buffer is "busy" until the window system is done reading from it, and shouldn't be written to in the meantime; using both buffers alternately (double-buffering) allows rendering the next frame while the last one is still being presented.
+
+			// @DOCLINE Currently, pixel presentation is supported by the X11, Wayland, and headless window systems; on other window systems, these functions give the result `MUCOSA_FAILED_UNSUPPORTED_FEATURE`.
+
+			// @DOCLINE ### Pixel rectangle
+
+			// @DOCLINE The struct `muPixelRect` represents a rectangle of pixels, used to specify which part of a buffer is presented. It has the following members:
+
+			struct muPixelRect {
+				// @DOCLINE * `@NLFT x` - the x-coordinate of the top-left corner of the rectangle, in pixels.
+				int32_m x;
+				// @DOCLINE * `@NLFT y` - the y-coordinate of the top-left corner of the rectangle, in pixels.
+				int32_m y;
+				// @DOCLINE * `@NLFT width` - the width of the rectangle, in pixels.
+				uint32_m width;
+				// @DOCLINE * `@NLFT height` - the height of the rectangle, in pixels.
+				uint32_m height;
+			};
+			typedef struct muPixelRect muPixelRect;
+
+			// @DOCLINE ### Get pixel buffer
+
+			// @DOCLINE The function `muCOSA_window_get_pixels` retrieves a pixel buffer owned by a window with the given dimensions that isn't busy, defined below: @NLNT
+			MUDEF uint32_m* muCOSA_window_get_pixels(muCOSAContext* context, muCOSAResult* result, muWindow win, uint32_m width, uint32_m height, uint32_m* stride);
+
+			// @DOCLINE The stride of the buffer, in bytes, is dereferenced into `stride`. If both of the window's buffers are busy, 0 is returned, and the result `MUCOSA_FAILED_PIXELS_BUSY` is given. A buffer is (re)allocated if its dimensions don't match the given ones, and the contents of the returned buffer are undefined; buffers are only valid until the window is destroyed, and the window frees them automatically.
+
+			// @DOCLINE > The macro `mu_window_get_pixels` is the non-result-checking equivalent, and the macro `mu_window_get_pixels_` is the result-checking equivalent.
+			#define mu_window_get_pixels(...) muCOSA_window_get_pixels(muCOSA_global_context, &muCOSA_global_context->result, __VA_ARGS__)
+			#define mu_window_get_pixels_(result, ...) muCOSA_window_get_pixels(muCOSA_global_context, result, __VA_ARGS__)
+
+			// @DOCLINE ### Pixel buffer busy
+
+			// @DOCLINE The function `muCOSA_window_pixels_busy` returns whether or not a pixel buffer owned by a window is busy, and therefore can't be written to or presented yet, defined below: @NLNT
+			MUDEF muBool muCOSA_window_pixels_busy(muCOSAContext* context, muCOSAResult* result, muWindow win, uint32_m* pixels);
+
+			// @DOCLINE This function checks for the window system being done with any buffers without needing to [updating the window](#update). Memory not owned by the window is never busy.
+
+			// @DOCLINE > The macro `mu_window_pixels_busy` is the non-result-checking equivalent, and the macro `mu_window_pixels_busy_` is the result-checking equivalent.
+			#define mu_window_pixels_busy(...) muCOSA_window_pixels_busy(muCOSA_global_context, &muCOSA_global_context->result, __VA_ARGS__)
+			#define mu_window_pixels_busy_(result, ...) muCOSA_window_pixels_busy(muCOSA_global_context, result, __VA_ARGS__)
+
+			// @DOCLINE ### Present pixels
+
+			// @DOCLINE The function `muCOSA_window_present_pixels` presents pixels to a window's surface, defined below: @NLNT
+			MUDEF void muCOSA_window_present_pixels(muCOSAContext* context, muCOSAResult* result, muWindow win, uint32_m* pixels, uint32_m stride, muPixelRect* rect);
+
+			// @DOCLINE `rect` specifies the part of the buffer that is presented, and is drawn to the same part of the window's surface (the top-left pixel of the buffer is drawn to the top-left pixel of the surface); if `rect` is 0, the entire buffer is presented. The rectangle is clipped to the dimensions of the buffer. On Wayland, the entire buffer becomes the contents of the surface, and `rect` only specifies the part of it that has changed.
+
+			// @DOCLINE If `pixels` is a buffer owned by the window (retrieved via `muCOSA_window_get_pixels`), it is presented without copying, and is busy until the window system is done reading from it; presenting a busy buffer gives the result `MUCOSA_FAILED_PIXELS_BUSY`. Otherwise, `pixels` is assumed to have the current dimensions of the window's surface and the given stride, and its pixels are copied before the function returns, meaning that the memory can be reused immediately.
+
+			// @DOCLINE > The macro `mu_window_present_pixels` is the non-result-checking equivalent, and the macro `mu_window_present_pixels_` is the result-checking equivalent.
+			#define mu_window_present_pixels(...) muCOSA_window_present_pixels(muCOSA_global_context, &muCOSA_global_context->result, __VA_ARGS__)
+			#define mu_window_present_pixels_(result, ...) muCOSA_window_present_pixels(muCOSA_global_context, result, __VA_ARGS__)
+
 		// @DOCLINE ## Pixel format
 
 			// @DOCLINE A window's pixel format is used to define what data will be used when representing the window's surface. Its respective type is `muPixelFormat`, and has the following members:
@@ -1687,11 +2311,16 @@ Uncommon pixel formats (such as no-alpha pixel formats) are not tested thoroughl
 			// @DOCLINE * `MU_OPENGL_4_6_COMPATIBILITY` - [OpenGL v4.6 Compatibility](https://registry.khronos.org/OpenGL/specs/gl/glspec46.compatibility.pdf).
 			#define MU_OPENGL_4_6_COMPATIBILITY 29
 
-			// @DOCLINE Note that OpenGL will only work if `MU_SUPPORT_OPENGL` is defined before `muCOSA.h` is first included.
+			// == Vulkan (257-512) ==
+
+			// @DOCLINE * `MU_VULKAN` - [Vulkan](https://registry.khronos.org/vulkan/), used via a [Vulkan surface](#vulkan-surface) rather than a context created by muCOSA.
+			#define MU_VULKAN 257
+
+			// @DOCLINE Note that OpenGL will only work if `MU_SUPPORT_OPENGL` is defined before `muCOSA.h` is first included, and Vulkan will only work if `MU_SUPPORT_VULKAN` is defined before `muCOSA.h` is first included.
 
 			// @DOCLINE ### Graphics API macro customization
 
-			// @DOCLINE Files necessary to define OpenGL features (such as `gl/gh.`/`gl/glu.h` on Win32) are automatically included if `MU_SUPPORT_OPENGL` is defined; the inclusion of these files can be manually turned off (in case they have already been included) via defining `MUCOSA_NO_INCLUDE_OPENGL`.
+			// @DOCLINE Files necessary to define OpenGL features (such as `gl/gh.`/`gl/glu.h` on Win32, and `GL/gl.h` on X11 and Wayland) are automatically included if `MU_SUPPORT_OPENGL` is defined; the inclusion of these files can be manually turned off (in case they have already been included) via defining `MUCOSA_NO_INCLUDE_OPENGL`.
 
 			#ifdef MUCOSA_NAMES
 			// @DOCLINE ### Graphics API names
@@ -1720,10 +2349,25 @@ Uncommon pixel formats (such as no-alpha pixel formats) are not tested thoroughl
 
 			// @DOCLINE Every successfully created OpenGL context must be destroyed before the window that created it is destroyed. This function does not modify any previously binded OpenGL context.
 
+			// @DOCLINE On X11 and Wayland, OpenGL contexts are created with EGL, which is only initialized once the first OpenGL context of the muCOSA context is created. The window's pixel format is chosen via `eglChooseConfig` (on X11, among the configs matching the window's visual), and the graphics API is requested via the major/minor version and profile attributes of `EGL_KHR_create_context`. This works with software rasterizers such as Mesa's llvmpipe (for example, by setting the environment variable `LIBGL_ALWAYS_SOFTWARE=1`), so OpenGL can be used on machines without a GPU.
+
+			// @DOCLINE On X11 with `MUCOSA_X11_GLX` defined (see [X11 dependencies](#x11-dependencies)), OpenGL contexts are instead created with GLX. The GLX framebuffer config of each pixel format is only chosen once per muCOSA context, and reused by every window created afterwards with the same pixel format, so creating many OpenGL windows doesn't enumerate the configs each time.
+
 			// @DOCLINE > The macro `mu_gl_context_create` is the non-result-checking equivalent, and the macro `mu_gl_context_create_` is the result-checking equivalent.
 			#define mu_gl_context_create(...) muCOSA_gl_context_create(muCOSA_global_context, &muCOSA_global_context->result, __VA_ARGS__)
 			#define mu_gl_context_create_(result, ...) muCOSA_gl_context_create(muCOSA_global_context, result, __VA_ARGS__)
 
+			// @DOCLINE The function `muCOSA_gl_context_create_offscreen` creates an OpenGL context that isn't linked to any window, defined below: @NLNT
+			MUDEF muGLContext muCOSA_gl_context_create_offscreen(muCOSAContext* context, muCOSAResult* result, muGraphicsAPI api, muPixelFormat* format);
+
+			// @DOCLINE `format` is the pixel format of the context, or 0 for the default pixel format. An offscreen OpenGL context has no usable default framebuffer, so rendering is expected to be done into framebuffer objects created by the user; for the same reason, `muCOSA_gl_swap_buffers` doesn't apply to it. It is destroyed and bound with `muCOSA_gl_context_destroy` and `muCOSA_gl_bind` like any other OpenGL context, with `win` given as 0.
+
+			// @DOCLINE With EGL, the context is bound without any surface if the display supports `EGL_KHR_surfaceless_context`, and to a 1x1 pbuffer otherwise; with GLX, it is always bound to a 1x1 pbuffer. The config chosen for a pixel format is reused, so creating many offscreen contexts with the same pixel format doesn't choose a config each time. On the headless window system, offscreen OpenGL contexts are created with EGL on Mesa's surfaceless platform (`EGL_MESA_platform_surfaceless`), falling back on the default EGL display, so they don't need any window system; this is only supported if EGL is used (see [X11 dependencies](#x11-dependencies)). This function is not supported on Win32, and gives the result `MUCOSA_FAILED_UNSUPPORTED_FEATURE`.
+
+			// @DOCLINE > The macro `mu_gl_context_create_offscreen` is the non-result-checking equivalent, and the macro `mu_gl_context_create_offscreen_` is the result-checking equivalent.
+			#define mu_gl_context_create_offscreen(...) muCOSA_gl_context_create_offscreen(muCOSA_global_context, &muCOSA_global_context->result, __VA_ARGS__)
+			#define mu_gl_context_create_offscreen_(result, ...) muCOSA_gl_context_create_offscreen(muCOSA_global_context, result, __VA_ARGS__)
+
 			// @DOCLINE The function `muCOSA_gl_context_destroy` destroys an OpenGL context, defined below: @NLNT
 			MUDEF muGLContext muCOSA_gl_context_destroy(muCOSAContext* context, muWindow win, muGLContext gl_context);
 
@@ -1768,22 +2412,50 @@ Uncommon pixel formats (such as no-alpha pixel formats) are not tested thoroughl
 
 			// @DOCLINE ### Swap interval
 
-			// @DOCLINE The function `muCOSA_gl_swap_interval` acts as a call to `wglSwapIntervalEXT`, defined below: @NLNT
+			// @DOCLINE The function `muCOSA_gl_swap_interval` acts as a call to `wglSwapIntervalEXT` on Win32, and `eglSwapInterval` on X11 and Wayland, defined below: @NLNT
 			MUDEF muBool muCOSA_gl_swap_interval(muCOSAContext* context, muCOSAResult* result, int interval);
 
-			// @DOCLINE On Win32, this function returns the return value of `wglSwapIntervalEXT` if `result` is set to a non-fatal value, and 0 if otherwise.
+			// @DOCLINE On Win32, this function returns the return value of `wglSwapIntervalEXT` if `result` is set to a non-fatal value, and 0 if otherwise. On X11 and Wayland, this function returns if `eglSwapInterval` succeeded, and the swap interval applies to the window of the OpenGL context currently binded.
 
 			// @DOCLINE > The macro `mu_gl_swap_interval` is the non-result-checking equivalent, and the macro `mu_gl_swap_interval_` is the result-checking equivalent.
 			#define mu_gl_swap_interval(...) muCOSA_gl_swap_interval(muCOSA_global_context, &muCOSA_global_context->result, __VA_ARGS__)
 			#define mu_gl_swap_interval_(result, ...) muCOSA_gl_swap_interval(muCOSA_global_context, result, __VA_ARGS__)
 
-	// @DOCLINE # Time
+		// @DOCLINE ## Vulkan surface
 
-		// @DOCLINE Every muCOSA context has a "fixed time", which refers to the amount of seconds it has been since the context was first created, stored internally as a double. The "fixed time" is different than the "time", which is usually equal to the fixed time, unless it is manually overwritten by the user, which is available in the muCOSA API.
+			// @DOCLINE A window can be used to create a Vulkan surface (`VkSurfaceKHR`), which can then be used to create a swapchain that presents to the window. Vulkan support requires `MU_SUPPORT_VULKAN` to be defined before `muCOSA.h` is first included, which makes muCOSA include `vulkan/vulkan.h`; the inclusion of this file can be manually turned off (in case it has already been included) via defining `MUCOSA_NO_INCLUDE_VULKAN`. None of the `VK_USE_PLATFORM_...` macros need to be defined, as muCOSA defines the structs of each window system's surface extension itself, and loads their functions via `vkGetInstanceProcAddr`.
 
-		// @DOCLINE ## Get fixed time
+			// @DOCLINE Vulkan surfaces are supported for Win32, X11 (via `VK_KHR_xlib_surface`), and Wayland (via `VK_KHR_wayland_surface`); these work with software implementations such as Mesa's lavapipe, so Vulkan can be used on machines without a GPU. On the headless window system, or if `MU_SUPPORT_VULKAN` isn't defined, these functions give the result `MUCOSA_FAILED_UNSUPPORTED_GRAPHICS_API`.
 
-		// @DOCLINE The function `muCOSA_fixed_time_get` retrieves the current amount of fixed time for a muCOSA context, defined below: @NLNT
+			// @DOCLINE ### Get instance extensions
+
+			// @DOCLINE The function `muCOSA_vk_get_instance_extensions` returns an array of the names of the instance extensions needed to create Vulkan surfaces for the context's window system, defined below: @NLNT
+			MUDEF const char** muCOSA_vk_get_instance_extensions(muCOSAContext* context, muCOSAResult* result, size_m* count);
+
+			// @DOCLINE The amount of extensions is dereferenced into `count`. These extensions must be enabled in the `VkInstance` given to `muCOSA_vk_create_surface`. The array returned is owned by muCOSA, and shouldn't be modified or freed. On failure, 0 is returned.
+
+			// @DOCLINE > The macro `mu_vk_get_instance_extensions` is the non-result-checking equivalent, and the macro `mu_vk_get_instance_extensions_` is the result-checking equivalent.
+			#define mu_vk_get_instance_extensions(...) muCOSA_vk_get_instance_extensions(muCOSA_global_context, &muCOSA_global_context->result, __VA_ARGS__)
+			#define mu_vk_get_instance_extensions_(result, ...) muCOSA_vk_get_instance_extensions(muCOSA_global_context, result, __VA_ARGS__)
+
+			// @DOCLINE ### Create surface
+
+			// @DOCLINE The function `muCOSA_vk_create_surface` creates a Vulkan surface for a window, defined below: @NLNT
+			MUDEF void muCOSA_vk_create_surface(muCOSAContext* context, muCOSAResult* result, muWindow win, void* instance, void* allocator, void* surface);
+
+			// @DOCLINE `instance` is the `VkInstance` to create the surface with, `allocator` is a pointer to the `VkAllocationCallbacks` used (0 for the default allocator), and `surface` is a pointer to the `VkSurfaceKHR` that the created surface is dereferenced into. The surface must be destroyed (via `vkDestroySurfaceKHR`) before the window is destroyed.
+
+			// @DOCLINE > The macro `mu_vk_create_surface` is the non-result-checking equivalent, and the macro `mu_vk_create_surface_` is the result-checking equivalent.
+			#define mu_vk_create_surface(...) muCOSA_vk_create_surface(muCOSA_global_context, &muCOSA_global_context->result, __VA_ARGS__)
+			#define mu_vk_create_surface_(result, ...) muCOSA_vk_create_surface(muCOSA_global_context, result, __VA_ARGS__)
+
+	// @DOCLINE # Time
+
+		// @DOCLINE Every muCOSA context has a "fixed time", which refers to the amount of seconds it has been since the context was first created, stored internally as a double. The "fixed time" is different than the "time", which is usually equal to the fixed time, unless it is manually overwritten by the user, which is available in the muCOSA API.
+
+		// @DOCLINE ## Get fixed time
+
+		// @DOCLINE The function `muCOSA_fixed_time_get` retrieves the current amount of fixed time for a muCOSA context, defined below: @NLNT
 		MUDEF double muCOSA_fixed_time_get(muCOSAContext* context);
 
 		// @DOCLINE This function cannot fail if the parameter(s) are valid.
@@ -1873,6 +2545,36 @@ Uncommon pixel formats (such as no-alpha pixel formats) are not tested thoroughl
 		// @DOCLINE * `MUCOSA_FAILED_UNSUPPORTED_GRAPHICS_API` - a function relating to a graphics API was called despite the fact that support for the graphics API was not enabled.
 		#define MUCOSA_FAILED_UNSUPPORTED_GRAPHICS_API 6
 
+		// @DOCLINE * `MUCOSA_FAILED_UNSUPPORTED_FEATURE` - the requested functionality is not supported by the context's window system.
+		#define MUCOSA_FAILED_UNSUPPORTED_FEATURE 7
+
+		// @DOCLINE * `MUCOSA_FAILED_UNKNOWN_INPUT` - an invalid key or keystate value was given by the user when [injecting input](#input-injection).
+		#define MUCOSA_FAILED_UNKNOWN_INPUT 8
+
+		// @DOCLINE * `MUCOSA_FAILED_PIXELS_BUSY` - a [pixel buffer](#pixel-presentation) owned by the window was presented while busy, or both of the window's pixel buffers were busy when retrieving one (`muCOSA_window_get_pixels`).
+		#define MUCOSA_FAILED_PIXELS_BUSY 9
+
+		// @DOCLINE * `MUCOSA_FAILED_FIND_VULKAN_FUNCTION` - the surface creation function of the window system couldn't be loaded via `vkGetInstanceProcAddr` when creating a Vulkan surface (`muCOSA_vk_create_surface`), usually because the instance extensions given by `muCOSA_vk_get_instance_extensions` weren't enabled.
+		#define MUCOSA_FAILED_FIND_VULKAN_FUNCTION 10
+
+		// @DOCLINE * `MUCOSA_FAILED_CREATE_VULKAN_SURFACE` - the surface creation function of the window system failed when creating a Vulkan surface (`muCOSA_vk_create_surface`).
+		#define MUCOSA_FAILED_CREATE_VULKAN_SURFACE 11
+
+		// @DOCLINE * `MUCOSA_FAILED_OPEN_FILE` - a file couldn't be opened when starting to [record or replay input](#input-recording).
+		#define MUCOSA_FAILED_OPEN_FILE 12
+
+		// @DOCLINE * `MUCOSA_FAILED_WRITE_FILE` - writing to the file of an [input recording](#input-recording) failed at some point while recording; the recording is incomplete.
+		#define MUCOSA_FAILED_WRITE_FILE 13
+
+		// @DOCLINE * `MUCOSA_FAILED_INVALID_RECORDING` - a file given to [replay](#replay-input) isn't a valid input recording.
+		#define MUCOSA_FAILED_INVALID_RECORDING 14
+
+		// @DOCLINE * `MUCOSA_FAILED_CREATE_LOCK` - a lock couldn't be created for a context or window in [thread-safe mode](#thread-safe-mode).
+		#define MUCOSA_FAILED_CREATE_LOCK 15
+
+		// @DOCLINE * `MUCOSA_FAILED_CREATE_THREAD` - the [event thread](#event-thread) of a context couldn't be created.
+		#define MUCOSA_FAILED_CREATE_THREAD 16
+
 		// == MUCOSA_WIN32_... 4096-8191 ==
 
 		// @DOCLINE * `MUCOSA_WIN32_FAILED_CONVERT_UTF8_TO_WCHAR` - a conversion from a UTF-8 string to a wide character string failed, rather due to the conversion itself failing or the allocation of memory required for the conversion; this is exclusive to Win32.
@@ -1969,6 +2671,111 @@ Uncommon pixel formats (such as no-alpha pixel formats) are not tested thoroughl
 		// @DOCLINE * `MUCOSA_WIN32_FAILED_SET_CLIPBOARD_DATA` - the function `SetClipboardData` failed when attempting to set the clipboard data; this is exclusive to Win32.
 		#define MUCOSA_WIN32_FAILED_SET_CLIPBOARD_DATA 4124
 
+		// @DOCLINE * `MUCOSA_WIN32_FAILED_REGISTER_RAW_INPUT` - the function `RegisterRawInputDevices` failed to register the mouse for raw input when enabling [raw motion](#raw-motion); this is exclusive to Win32.
+		#define MUCOSA_WIN32_FAILED_REGISTER_RAW_INPUT 4125
+
+		// == MUCOSA_X11_... 8192-12287 ==
+
+		// @DOCLINE * `MUCOSA_X11_FAILED_CONNECT_DISPLAY` - the function `XOpenDisplay` failed to connect to the X server when creating the muCOSA context (`muCOSA_context_create`); this is exclusive to X11.
+		#define MUCOSA_X11_FAILED_CONNECT_DISPLAY 8192
+
+		// @DOCLINE * `MUCOSA_X11_FAILED_CREATE_WINDOW` - the function `XCreateWindow` failed when creating a window (`muCOSA_window_create`); this is exclusive to X11.
+		#define MUCOSA_X11_FAILED_CREATE_WINDOW 8193
+
+		// @DOCLINE * `MUCOSA_X11_FAILED_GET_WINDOW_ATTRIB` - the X server failed to give the requested information when attempting to retrieve a window attribute (`muCOSA_window_get`); this is exclusive to X11.
+		#define MUCOSA_X11_FAILED_GET_WINDOW_ATTRIB 8194
+
+		// @DOCLINE * `MUCOSA_X11_FAILED_SET_WINDOW_ATTRIB` - an attribute could not be set to the given value (`muCOSA_window_set`), such as 0 dimensions, which X11 doesn't allow; this is exclusive to X11.
+		#define MUCOSA_X11_FAILED_SET_WINDOW_ATTRIB 8195
+
+		// @DOCLINE * `MUCOSA_X11_FAILED_SET_TEXT_CURSOR` - the input method failed to accept the text cursor position (`muCOSA_window_get_text_input` and `muCOSA_window_update_text_cursor`); this is exclusive to X11.
+		#define MUCOSA_X11_FAILED_SET_TEXT_CURSOR 8196
+
+		// @DOCLINE * `MUCOSA_X11_FAILED_GET_CLIPBOARD_DATA` - the owner of the clipboard didn't respond in time, responded with data in an unsupported format (such as incremental transfers), or the data couldn't be read when retrieving the clipboard data (`muCOSA_clipboard_get`); this is exclusive to X11.
+		#define MUCOSA_X11_FAILED_GET_CLIPBOARD_DATA 8197
+
+		// @DOCLINE * `MUCOSA_X11_FAILED_SET_CLIPBOARD_DATA` - ownership of the clipboard couldn't be acquired when setting the clipboard data (`muCOSA_clipboard_set`); this is exclusive to X11.
+		#define MUCOSA_X11_FAILED_SET_CLIPBOARD_DATA 8198
+
+		// @DOCLINE * `MUCOSA_X11_FAILED_LOAD_GLX` - GLX 1.3 or the function `glXCreateContextAttribsARB` isn't available when creating the first OpenGL context (`muCOSA_gl_context_create`); this is exclusive to X11 with `MUCOSA_X11_GLX` defined.
+		#define MUCOSA_X11_FAILED_LOAD_GLX 8199
+
+		// @DOCLINE * `MUCOSA_X11_FAILED_FIND_GLX_CONFIG` - no GLX framebuffer config matching the window's visual could be found when creating an OpenGL context (`muCOSA_gl_context_create`); this is exclusive to X11 with `MUCOSA_X11_GLX` defined.
+		#define MUCOSA_X11_FAILED_FIND_GLX_CONFIG 8200
+
+		// @DOCLINE * `MUCOSA_X11_FAILED_CHOOSE_GLX_CONFIG` - no GLX framebuffer config matches the window's pixel format when creating an OpenGL context (`muCOSA_gl_context_create`); this is exclusive to X11 with `MUCOSA_X11_GLX` defined. This result is non-fatal, and the OpenGL context will still be created, but the pixel format will likely not be what the user requested.
+		#define MUCOSA_X11_FAILED_CHOOSE_GLX_CONFIG 8201
+
+		// @DOCLINE * `MUCOSA_X11_FAILED_CREATE_GLX_CONTEXT` - the function `glXCreateContextAttribsARB` failed when creating an OpenGL context (`muCOSA_gl_context_create`), usually because the requested OpenGL version isn't supported; this is exclusive to X11 with `MUCOSA_X11_GLX` defined.
+		#define MUCOSA_X11_FAILED_CREATE_GLX_CONTEXT 8202
+
+		// @DOCLINE * `MUCOSA_X11_FAILED_MAKE_GLX_CURRENT` - the function `glXMakeCurrent` failed when binding an OpenGL context (`muCOSA_gl_bind`); this is exclusive to X11 with `MUCOSA_X11_GLX` defined.
+		#define MUCOSA_X11_FAILED_MAKE_GLX_CURRENT 8203
+
+		// @DOCLINE * `MUCOSA_X11_FAILED_FIND_GLX_FUNCTION` - neither `glXSwapIntervalEXT` nor `glXSwapIntervalMESA` could be used when setting the swap interval (`muCOSA_gl_swap_interval`); this is exclusive to X11 with `MUCOSA_X11_GLX` defined.
+		#define MUCOSA_X11_FAILED_FIND_GLX_FUNCTION 8204
+
+		// @DOCLINE * `MUCOSA_X11_FAILED_CREATE_IMAGE` - an image couldn't be created for presenting pixels (`muCOSA_window_get_pixels` and `muCOSA_window_present_pixels`), usually because the window's visual doesn't store pixels as 32-bit RGB values; this is exclusive to X11.
+		#define MUCOSA_X11_FAILED_CREATE_IMAGE 8205
+
+		// @DOCLINE * `MUCOSA_X11_FAILED_CREATE_GLX_PBUFFER` - the function `glXCreatePbuffer` failed when creating an offscreen OpenGL context (`muCOSA_gl_context_create_offscreen`); this is exclusive to X11 with `MUCOSA_X11_GLX` defined.
+		#define MUCOSA_X11_FAILED_CREATE_GLX_PBUFFER 8206
+
+		// @DOCLINE * `MUCOSA_X11_FAILED_GRAB_POINTER` - the function `XGrabPointer` failed when [locking the pointer](#pointer-lock), usually because the window isn't visible or another program has the pointer grabbed; this is exclusive to X11.
+		#define MUCOSA_X11_FAILED_GRAB_POINTER 8207
+
+		// == MUCOSA_WAYLAND_... 12288-16383 ==
+
+		// @DOCLINE * `MUCOSA_WAYLAND_FAILED_CONNECT_DISPLAY` - the function `wl_display_connect` failed to connect to the compositor when creating the muCOSA context (`muCOSA_context_create`); this is exclusive to Wayland.
+		#define MUCOSA_WAYLAND_FAILED_CONNECT_DISPLAY 12288
+
+		// @DOCLINE * `MUCOSA_WAYLAND_FAILED_FIND_GLOBALS` - the compositor doesn't provide the globals needed to create windows (`wl_compositor` and `xdg_wm_base`) when creating the muCOSA context (`muCOSA_context_create`); this is exclusive to Wayland.
+		#define MUCOSA_WAYLAND_FAILED_FIND_GLOBALS 12289
+
+		// @DOCLINE * `MUCOSA_WAYLAND_FAILED_CREATE_XKB_CONTEXT` - the function `xkb_context_new` failed when creating the muCOSA context (`muCOSA_context_create`); this is exclusive to Wayland.
+		#define MUCOSA_WAYLAND_FAILED_CREATE_XKB_CONTEXT 12290
+
+		// @DOCLINE * `MUCOSA_WAYLAND_FAILED_CREATE_WINDOW` - the surface or its xdg-shell roles couldn't be created when creating a window (`muCOSA_window_create`); this is exclusive to Wayland.
+		#define MUCOSA_WAYLAND_FAILED_CREATE_WINDOW 12291
+
+		// @DOCLINE * `MUCOSA_WAYLAND_UNSUPPORTED_WINDOW_ATTRIB` - the requested window attribute can't be retrieved or modified under Wayland (`muCOSA_window_get` and `muCOSA_window_set`), such as the window's position or the cursor's position, or was given an invalid value, such as 0 dimensions; this is exclusive to Wayland.
+		#define MUCOSA_WAYLAND_UNSUPPORTED_WINDOW_ATTRIB 12292
+
+		// @DOCLINE * `MUCOSA_WAYLAND_FAILED_GET_CLIPBOARD_DATA` - the owner of the clipboard didn't write its data in time, or the data couldn't be read when retrieving the clipboard data (`muCOSA_clipboard_get`); this is exclusive to Wayland.
+		#define MUCOSA_WAYLAND_FAILED_GET_CLIPBOARD_DATA 12293
+
+		// @DOCLINE * `MUCOSA_WAYLAND_FAILED_SET_CLIPBOARD_DATA` - the clipboard couldn't be set (`muCOSA_clipboard_set`), usually because none of the program's windows has received input yet, which Wayland requires before setting the clipboard; this is exclusive to Wayland.
+		#define MUCOSA_WAYLAND_FAILED_SET_CLIPBOARD_DATA 12294
+
+		// @DOCLINE * `MUCOSA_WAYLAND_FAILED_CREATE_BUFFER` - a shared memory buffer couldn't be created for presenting pixels (`muCOSA_window_get_pixels` and `muCOSA_window_present_pixels`), usually because the compositor doesn't provide `wl_shm` or the shared memory file couldn't be created; this is exclusive to Wayland.
+		#define MUCOSA_WAYLAND_FAILED_CREATE_BUFFER 12295
+
+		// == MUCOSA_EGL_... 16384-20479 ==
+
+		// @DOCLINE * `MUCOSA_EGL_FAILED_INITIALIZE` - EGL couldn't be initialized for desktop OpenGL on the window system's display when creating the first OpenGL context (`muCOSA_gl_context_create`); this is exclusive to window systems that use EGL (X11 and Wayland).
+		#define MUCOSA_EGL_FAILED_INITIALIZE 16384
+
+		// @DOCLINE * `MUCOSA_EGL_FAILED_FIND_CONFIG` - no EGL config renderable with OpenGL could be found for the window when creating an OpenGL context (`muCOSA_gl_context_create`); this is exclusive to window systems that use EGL (X11 and Wayland).
+		#define MUCOSA_EGL_FAILED_FIND_CONFIG 16385
+
+		// @DOCLINE * `MUCOSA_EGL_FAILED_CHOOSE_CONFIG` - no EGL config matches the window's pixel format when creating an OpenGL context (`muCOSA_gl_context_create`); this is exclusive to window systems that use EGL (X11 and Wayland). This result is non-fatal, and the OpenGL context will still be created, but the pixel format will likely not be what the user requested.
+		#define MUCOSA_EGL_FAILED_CHOOSE_CONFIG 16386
+
+		// @DOCLINE * `MUCOSA_EGL_FAILED_CREATE_SURFACE` - the function `eglCreateWindowSurface` failed when creating an OpenGL context (`muCOSA_gl_context_create`), or `eglCreatePbufferSurface` failed when creating an offscreen OpenGL context (`muCOSA_gl_context_create_offscreen`); this is exclusive to window systems that use EGL (X11, Wayland, and headless).
+		#define MUCOSA_EGL_FAILED_CREATE_SURFACE 16387
+
+		// @DOCLINE * `MUCOSA_EGL_FAILED_CREATE_CONTEXT` - the function `eglCreateContext` failed when creating an OpenGL context (`muCOSA_gl_context_create`), usually because the requested OpenGL version isn't supported; this is exclusive to window systems that use EGL (X11 and Wayland).
+		#define MUCOSA_EGL_FAILED_CREATE_CONTEXT 16388
+
+		// @DOCLINE * `MUCOSA_EGL_FAILED_MAKE_CURRENT` - the function `eglMakeCurrent` failed when binding an OpenGL context (`muCOSA_gl_bind`); this is exclusive to window systems that use EGL (X11 and Wayland).
+		#define MUCOSA_EGL_FAILED_MAKE_CURRENT 16389
+
+		// @DOCLINE * `MUCOSA_EGL_FAILED_SWAP_BUFFERS` - the function `eglSwapBuffers` failed, or the window has no OpenGL context, when swapping the buffers of a window (`muCOSA_gl_swap_buffers`); this is exclusive to window systems that use EGL (X11 and Wayland).
+		#define MUCOSA_EGL_FAILED_SWAP_BUFFERS 16390
+
+		// @DOCLINE * `MUCOSA_EGL_FAILED_SWAP_INTERVAL` - the function `eglSwapInterval` failed, or no OpenGL context has been created yet, when setting the swap interval (`muCOSA_gl_swap_interval`); this is exclusive to window systems that use EGL (X11 and Wayland).
+		#define MUCOSA_EGL_FAILED_SWAP_INTERVAL 16391
+
 		// @DOCLINE All non-success values (unless explicitly stated otherwise) mean that the function fully failed, AKA it was "fatal", and the library continues as if the function had never been called; so, for example, if something was supposed to be allocated, but the function fatally failed, nothing was allocated.
 
 		// @DOCLINE There are non-fatal failure values, which mean that the function still executed, but not fully to the extent that the user would expect from the function. The function `muCOSA_result_is_fatal` returns whether or not a given result function value is fatal, defined below: @NLNT
@@ -1994,7 +2801,8 @@ Uncommon pixel formats (such as no-alpha pixel formats) are not tested thoroughl
 
 		// @DOCLINE ## `string.h` dependencies
 		#if !defined(mu_memcpy) || \
-			!defined(mu_memset)
+			!defined(mu_memset) || \
+			!defined(mu_memcmp)
 
 			#include <string.h>
 
@@ -2008,6 +2816,11 @@ Uncommon pixel formats (such as no-alpha pixel formats) are not tested thoroughl
 				#define mu_memset memset
 			#endif
 
+			// @DOCLINE * `mu_memcmp` - equivalent to `memcmp`.
+			#ifndef mu_memcmp
+				#define mu_memcmp memcmp
+			#endif
+
 		#endif /* string.h */
 
 		// @DOCLINE ## `stdlib.h` dependencies
@@ -2034,6 +2847,38 @@ Uncommon pixel formats (such as no-alpha pixel formats) are not tested thoroughl
 
 		#endif /* stdlib.h */
 
+		// @DOCLINE ## `stdio.h` dependencies
+		#if !defined(mu_fopen) || \
+			!defined(mu_fclose) || \
+			!defined(mu_fread) || \
+			!defined(mu_fwrite)
+
+			#include <stdio.h>
+
+			// @DOCLINE * `mu_fopen` - equivalent to `fopen`.
+			#ifndef mu_fopen
+				#define mu_fopen fopen
+			#endif
+
+			// @DOCLINE * `mu_fclose` - equivalent to `fclose`.
+			#ifndef mu_fclose
+				#define mu_fclose fclose
+			#endif
+
+			// @DOCLINE * `mu_fread` - equivalent to `fread`.
+			#ifndef mu_fread
+				#define mu_fread fread
+			#endif
+
+			// @DOCLINE * `mu_fwrite` - equivalent to `fwrite`.
+			#ifndef mu_fwrite
+				#define mu_fwrite fwrite
+			#endif
+
+		#endif /* stdio.h */
+
+		// @DOCLINE These are only used for [input recording](#input-recording), where the file handles are of type `FILE*`.
+
 	MU_CPP_EXTERN_END
 
 #endif /* MUCOSA_H */
@@ -2051,531 +2896,1985 @@ Uncommon pixel formats (such as no-alpha pixel formats) are not tested thoroughl
 			// Win32
 			#ifdef MU_WIN32
 				#define MUCOSA_WIN32
-				#define MUCOSA_WIN32_CALL(...) __VA_ARGS__
-			#else
-				#define MUCOSA_WIN32_CALL(...)
 			#endif
 
+			// X11
+			#ifdef MU_LINUX
+				#define MUCOSA_X11
+			#endif
+
+			// Headless
+			#define MUCOSA_HEADLESS
+
 		#endif /* MUCOSA_MANUAL_OS_SUPPORT */
 
+		// Thread safety
+
+		// (The event thread relies on the locks of thread-safe mode)
+		#if defined(MUCOSA_EVENT_THREAD) && !defined(MUCOSA_THREAD_SAFE)
+			#define MUCOSA_THREAD_SAFE
+		#endif
+
+		// Window system calls
+
+		#ifdef MUCOSA_WIN32
+			#define MUCOSA_WIN32_CALL(...) __VA_ARGS__
+		#else
+			#define MUCOSA_WIN32_CALL(...)
+		#endif
+
+		#ifdef MUCOSA_X11
+			#define MUCOSA_X11_CALL(...) __VA_ARGS__
+			#define MUCOSA_POSIX
+			#define MUCOSA_XKEYSYM
+		#else
+			#define MUCOSA_X11_CALL(...)
+		#endif
+
+		#ifdef MUCOSA_WAYLAND
+			#define MUCOSA_WAYLAND_CALL(...) __VA_ARGS__
+			#ifndef MUCOSA_POSIX
+				#define MUCOSA_POSIX
+			#endif
+			#ifndef MUCOSA_XKEYSYM
+				#define MUCOSA_XKEYSYM
+			#endif
+		#else
+			#define MUCOSA_WAYLAND_CALL(...)
+		#endif
+
+		#ifdef MUCOSA_HEADLESS
+			#define MUCOSA_HEADLESS_CALL(...) __VA_ARGS__
+		#else
+			#define MUCOSA_HEADLESS_CALL(...)
+		#endif
+
+		// Code only for event-thread mode (usable within the calls above, which
+		// can't contain directives)
+		#ifdef MUCOSA_EVENT_THREAD
+			#define MUCOSA_EVENT_THREAD_CALL(...) __VA_ARGS__
+		#else
+			#define MUCOSA_EVENT_THREAD_CALL(...)
+		#endif
+
+		// Window system of a context's inner struct; if only one window system
+		// is supported, it's known at compile-time, so the switch in every public
+		// function folds away and the call goes straight to the window system's
+		// function. (Inner is still referenced to avoid unused variable warnings.)
+
+		#if (defined(MUCOSA_WIN32) + defined(MUCOSA_X11) + defined(MUCOSA_WAYLAND) + defined(MUCOSA_HEADLESS)) == 1
+			#define MUCOSA_SINGLE_SYSTEM
+		#endif
+
+		#if defined(MUCOSA_SINGLE_SYSTEM) && defined(MUCOSA_WIN32)
+			#define MUCOSA_SYSTEM(inner) ((void)(inner), MU_WINDOW_WIN32)
+		#elif defined(MUCOSA_SINGLE_SYSTEM) && defined(MUCOSA_X11)
+			#define MUCOSA_SYSTEM(inner) ((void)(inner), MU_WINDOW_X11)
+		#elif defined(MUCOSA_SINGLE_SYSTEM) && defined(MUCOSA_WAYLAND)
+			#define MUCOSA_SYSTEM(inner) ((void)(inner), MU_WINDOW_WAYLAND)
+		#elif defined(MUCOSA_SINGLE_SYSTEM) && defined(MUCOSA_HEADLESS)
+			#define MUCOSA_SYSTEM(inner) ((void)(inner), MU_WINDOW_HEADLESS)
+		#else
+			#define MUCOSA_SYSTEM(inner) ((inner)->system)
+		#endif
+
+		// (Input injection on X11 goes through XTest, if requested)
+		#if defined(MUCOSA_X11) && defined(MUCOSA_X11_XTEST)
+			#define MUCOSA_XTEST_CALL(...) __VA_ARGS__
+		#else
+			#define MUCOSA_XTEST_CALL(...)
+		#endif
+
 		// Graphics API support
 
 		#ifdef MU_SUPPORT_OPENGL
 			#define MUCOSA_OPENGL_CALL(...) __VA_ARGS__
+			// (OpenGL goes through EGL on X11 and Wayland, or GLX on X11 if requested)
+			#if defined(MUCOSA_WAYLAND) || (defined(MUCOSA_X11) && !defined(MUCOSA_X11_GLX))
+				#define MUCOSA_EGL
+			#endif
+			#if defined(MUCOSA_X11) && defined(MUCOSA_X11_GLX)
+				#define MUCOSA_GLX
+			#endif
 		#else
 			#define MUCOSA_OPENGL_CALL(...)
 		#endif
 
-	/* Win32 */
+	/* Locks */
 
-	#ifdef MUCOSA_WIN32
+	// Recursive locks used in thread-safe mode, shared by every window system.
 
-		// For all of the stuff that can't be included directly (CURSE YOU BILL)
-		#include <windows.h>
+	#ifdef MUCOSA_THREAD_SAFE
 
-		/* Useful functions */
+		#ifdef _WIN32
+			#include <windows.h>
+		#else
+			#include <pthread.h>
+		#endif
 
-			// Hinstance retriever (thank you Raymond Chen)
-			EXTERN_C IMAGE_DOS_HEADER __ImageBase;
-			HINSTANCE muCOSAW32_get_hinstance(void) {
-				return ((HINSTANCE)&__ImageBase);
+		struct muCOSA_Lock {
+			#ifdef _WIN32
+			CRITICAL_SECTION section;
+			#else
+			pthread_mutex_t mutex;
+			#endif
+		};
+		typedef struct muCOSA_Lock muCOSA_Lock;
+
+		// Creates a lock; returns if it was successful
+		muBool muCOSA_lock_init(muCOSA_Lock* lock) {
+			#ifdef _WIN32
+			// (Critical sections are already recursive)
+			InitializeCriticalSection(&lock->section);
+			return MU_TRUE;
+			#else
+			pthread_mutexattr_t attr;
+			if (pthread_mutexattr_init(&attr) != 0) {
+				return MU_FALSE;
 			}
+			pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+			int res = pthread_mutex_init(&lock->mutex, &attr);
+			pthread_mutexattr_destroy(&attr);
+			return res == 0;
+			#endif
+		}
 
-			// UTF-8 -> wchar_t (UTF-16)
-			wchar_t* muCOSAW32_utf8_to_wchar(char* str) {
-				// Get length needed for conversion
-				// Note: we can use -1 here, since it's expected for it to be null-terminated
-				int len = MultiByteToWideChar(CP_UTF8, 0, str, -1, NULL, 0);
-				if (len == 0) {
-					return 0;
-				}
+		void muCOSA_lock_term(muCOSA_Lock* lock) {
+			#ifdef _WIN32
+			DeleteCriticalSection(&lock->section);
+			#else
+			pthread_mutex_destroy(&lock->mutex);
+			#endif
+		}
 
-				// Allocate data
-				wchar_t* wstr = (wchar_t*)mu_malloc(len * sizeof(wchar_t));
-				if (wstr == 0) {
-					return 0;
-				}
+		void muCOSA_lock(muCOSA_Lock* lock) {
+			#ifdef _WIN32
+			EnterCriticalSection(&lock->section);
+			#else
+			pthread_mutex_lock(&lock->mutex);
+			#endif
+		}
 
-				// Perform conversion
-				if (MultiByteToWideChar(CP_UTF8, 0, str, -1, (LPWSTR)wstr, len) == 0) {
-					mu_free(wstr);
-					return 0;
-				}
+		void muCOSA_unlock(muCOSA_Lock* lock) {
+			#ifdef _WIN32
+			LeaveCriticalSection(&lock->section);
+			#else
+			pthread_mutex_unlock(&lock->mutex);
+			#endif
+		}
 
-				// Return converted data
-				return wstr;
+	#endif /* MUCOSA_THREAD_SAFE */
+
+	/* Reader/writer locks */
+
+	// Sleeping reader/writer locks, shared by every window system. Any amount
+	// of threads can hold one for reading at once, and threads that can't get
+	// it wait in the kernel rather than spinning. They can be initialized
+	// statically with MUCOSA_RWLOCK_INIT, and aren't recursive.
+
+	#ifdef _WIN32
+		#include <windows.h>
+		typedef SRWLOCK muCOSA_RWLock;
+		#define MUCOSA_RWLOCK_INIT SRWLOCK_INIT
+	#else
+		#include <pthread.h>
+		typedef pthread_rwlock_t muCOSA_RWLock;
+		#define MUCOSA_RWLOCK_INIT PTHREAD_RWLOCK_INITIALIZER
+	#endif
+
+	// Initiates a lock that wasn't initialized statically
+	void muCOSA_rwlock_init(muCOSA_RWLock* lock) {
+		#ifdef _WIN32
+		InitializeSRWLock(lock);
+		#else
+		pthread_rwlock_init(lock, 0);
+		#endif
+	}
+
+	void muCOSA_rwlock_term(muCOSA_RWLock* lock) {
+		#ifdef _WIN32
+		// (Slim reader/writer locks don't need to be destroyed)
+		if (lock) {}
+		#else
+		pthread_rwlock_destroy(lock);
+		#endif
+	}
+
+	// Locks for reading, alongside any other readers
+	void muCOSA_rwlock_read(muCOSA_RWLock* lock) {
+		#ifdef _WIN32
+		AcquireSRWLockShared(lock);
+		#else
+		pthread_rwlock_rdlock(lock);
+		#endif
+	}
+
+	void muCOSA_rwlock_read_unlock(muCOSA_RWLock* lock) {
+		#ifdef _WIN32
+		ReleaseSRWLockShared(lock);
+		#else
+		pthread_rwlock_unlock(lock);
+		#endif
+	}
+
+	// Locks for writing, excluding every other thread
+	void muCOSA_rwlock_write(muCOSA_RWLock* lock) {
+		#ifdef _WIN32
+		AcquireSRWLockExclusive(lock);
+		#else
+		pthread_rwlock_wrlock(lock);
+		#endif
+	}
+
+	void muCOSA_rwlock_write_unlock(muCOSA_RWLock* lock) {
+		#ifdef _WIN32
+		ReleaseSRWLockExclusive(lock);
+		#else
+		pthread_rwlock_unlock(lock);
+		#endif
+	}
+
+	#ifdef MUCOSA_EVENT_THREAD
+
+	/* Signals */
+
+	// Counts that threads can sleep on until they're raised, used in
+	// event-thread mode to wake threads waiting on the event thread (and the
+	// event thread itself on the headless window system). A waiter reads the
+	// count first, then waits for it to change, so that a raise between the
+	// two isn't missed.
+
+		#ifndef _WIN32
+			#include <time.h>
+		#endif
+
+		struct muCOSA_Signal {
+			#ifdef _WIN32
+			CRITICAL_SECTION section;
+			CONDITION_VARIABLE cond;
+			#else
+			pthread_mutex_t mutex;
+			pthread_cond_t cond;
+			#endif
+			// Amount of times raised
+			size_m count;
+		};
+		typedef struct muCOSA_Signal muCOSA_Signal;
+
+		// Creates a signal; returns if it was successful
+		muBool muCOSA_signal_init(muCOSA_Signal* sig) {
+			sig->count = 0;
+			#ifdef _WIN32
+			InitializeCriticalSection(&sig->section);
+			InitializeConditionVariable(&sig->cond);
+			return MU_TRUE;
+			#else
+			if (pthread_mutex_init(&sig->mutex, 0) != 0) {
+				return MU_FALSE;
+			}
+			if (pthread_cond_init(&sig->cond, 0) != 0) {
+				pthread_mutex_destroy(&sig->mutex);
+				return MU_FALSE;
 			}
+			return MU_TRUE;
+			#endif
+		}
 
-			// wchar_t (UTF-16) -> UTF-8
-			uint8_m* muCOSAW32_wchar_to_utf8(wchar_t* wstr) {
-				// Get length needed
-				int len = WideCharToMultiByte(CP_UTF8, 0, wstr, -1, NULL, 0, NULL, NULL);
-				if (!len) {
-					return 0;
-				}
+		void muCOSA_signal_term(muCOSA_Signal* sig) {
+			#ifdef _WIN32
+			DeleteCriticalSection(&sig->section);
+			#else
+			pthread_cond_destroy(&sig->cond);
+			pthread_mutex_destroy(&sig->mutex);
+			#endif
+		}
 
-				// Allocate data needed for conversion
-				uint8_m* str = (uint8_m*)mu_malloc(len);
-				if (!str) {
-					return 0;
-				}
+		// Raises a signal, waking every thread waiting on it
+		void muCOSA_signal_raise(muCOSA_Signal* sig) {
+			#ifdef _WIN32
+			EnterCriticalSection(&sig->section);
+			++sig->count;
+			LeaveCriticalSection(&sig->section);
+			WakeAllConditionVariable(&sig->cond);
+			#else
+			pthread_mutex_lock(&sig->mutex);
+			++sig->count;
+			pthread_cond_broadcast(&sig->cond);
+			pthread_mutex_unlock(&sig->mutex);
+			#endif
+		}
 
-				// Perform conversion
-				if (!WideCharToMultiByte(CP_UTF8, 0, wstr, -1, (LPSTR)str, len, NULL, NULL)) {
-					mu_free(str);
-					return 0;
+		// Gets the amount of times a signal has been raised
+		size_m muCOSA_signal_count(muCOSA_Signal* sig) {
+			size_m count;
+			#ifdef _WIN32
+			EnterCriticalSection(&sig->section);
+			count = sig->count;
+			LeaveCriticalSection(&sig->section);
+			#else
+			pthread_mutex_lock(&sig->mutex);
+			count = sig->count;
+			pthread_mutex_unlock(&sig->mutex);
+			#endif
+			return count;
+		}
+
+		// Waits until a signal has been raised since its count was the given
+		// count, or until the timeout (in seconds) passes; a negative timeout
+		// waits forever
+		void muCOSA_signal_wait(muCOSA_Signal* sig, size_m seen, double timeout) {
+			#ifdef _WIN32
+			// Convert timeout to milliseconds, rounding up
+			DWORD ms = INFINITE;
+			if (timeout >= 0.0) {
+				ms = (timeout == 0.0) ? 0 : (DWORD)(timeout * 1000.0) + 1;
+			}
+			// Wait (a timed wait can end early from a spurious wakeup, which
+			// callers treat like any other early return)
+			EnterCriticalSection(&sig->section);
+			while (sig->count == seen) {
+				if (!SleepConditionVariableCS(&sig->cond, &sig->section, ms) || ms != INFINITE) {
+					break;
+				}
+			}
+			LeaveCriticalSection(&sig->section);
+			#else
+			// Calculate deadline
+			struct timespec deadline;
+			if (timeout >= 0.0) {
+				clock_gettime(CLOCK_REALTIME, &deadline);
+				deadline.tv_sec += (time_t)timeout;
+				deadline.tv_nsec += (long)((timeout - (double)(time_t)timeout) * 1000000000.0);
+				if (deadline.tv_nsec >= 1000000000) {
+					++deadline.tv_sec;
+					deadline.tv_nsec -= 1000000000;
 				}
+			}
+			// Wait
+			pthread_mutex_lock(&sig->mutex);
+			while (sig->count == seen) {
+				if (timeout < 0.0) {
+					pthread_cond_wait(&sig->cond, &sig->mutex);
+				} else if (pthread_cond_timedwait(&sig->cond, &sig->mutex, &deadline) != 0) {
+					break;
+				}
+			}
+			pthread_mutex_unlock(&sig->mutex);
+			#endif
+		}
 
-				return str;
+	/* Atomics */
+
+	// Loads and stores of values shared between threads without a lock. A
+	// load that sees a stored value also sees everything written by the
+	// storing thread before the store.
+
+		size_m muCOSA_atomic_load(size_m* p) {
+			#if defined(__GNUC__) || defined(__clang__)
+			return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+			#elif defined(_WIN32)
+			size_m v = *(volatile size_m*)p;
+			MemoryBarrier();
+			return v;
+			#else
+			#error "muCOSA: MUCOSA_EVENT_THREAD needs GCC/Clang atomics or Win32 memory barriers"
+			#endif
+		}
+
+		void muCOSA_atomic_store(size_m* p, size_m v) {
+			#if defined(__GNUC__) || defined(__clang__)
+			__atomic_store_n(p, v, __ATOMIC_RELEASE);
+			#else
+			MemoryBarrier();
+			*(volatile size_m*)p = v;
+			#endif
+		}
+
+	#endif /* MUCOSA_EVENT_THREAD */
+
+	/* Event queue */
+
+	// Ring buffer of the events received by a window, shared by every window
+	// system. Events are pushed wherever their callback is called, and are only
+	// stored if the window was given a capacity, so windows without a queue
+	// only pay for a null check.
+
+	// The head (oldest event) is only moved by the thread reading events, and
+	// the tail (after the newest event) only by the thread delivering them, so
+	// in event-thread mode, the event thread can hand events off to another
+	// thread without either taking a lock: a slot is filled before the tail is
+	// stored past it, and only reused after the head is stored past it. This
+	// is why a full queue drops the newest event rather than the oldest in
+	// event-thread mode, as the oldest belongs to the reading thread. One more
+	// slot than the capacity is allocated, so that a full queue can be told
+	// apart from an empty one.
+
+		#ifdef MUCOSA_EVENT_THREAD
+			#define MUCOSA_QUEUE_LOAD(x) muCOSA_atomic_load(&(x))
+			#define MUCOSA_QUEUE_STORE(x, v) muCOSA_atomic_store(&(x), v)
+		#else
+			#define MUCOSA_QUEUE_LOAD(x) (x)
+			#define MUCOSA_QUEUE_STORE(x, v) (x) = (v)
+		#endif
+
+		// Capacity of the queue that a window without one gets in event-thread
+		// mode, used to hand off changes to its keymaps
+		#ifndef MUCOSA_EVENT_THREAD_CAPACITY
+			#define MUCOSA_EVENT_THREAD_CAPACITY 256
+		#endif
+
+		// A recording of the events delivered to a window
+		struct muCOSA_Recording {
+			// File being recorded to (0 if not recording)
+			FILE* file;
+			// Time that recording started
+			double start;
+			// If writing to the file has failed
+			muBool failed;
+		};
+		typedef struct muCOSA_Recording muCOSA_Recording;
+
+		struct muCOSA_EventQueue {
+			// Events (0 if the window has no queue)
+			muEvent* events;
+			// Amount of events that can be stored
+			size_m capacity;
+			// Index of the oldest event + index after the newest event
+			size_m head;
+			size_m tail;
+			// Cursor position of the latest cursor event, used to calculate motion
+			int32_m cursor_x;
+			int32_m cursor_y;
+			// Time of the event currently being delivered (set by the window
+			// system before delivering it, even if the window has no queue)
+			double time;
+			// Recording of the delivered events
+			muCOSA_Recording recording;
+			// Event filled in when an event is recorded but the window has no
+			// queue to store it in
+			muEvent scratch;
+			#ifdef MUCOSA_EVENT_THREAD
+			// If the window wasn't given a queue; one is made anyway to hand off
+			// changes to the keymaps, but it can't be polled
+			muBool hidden;
+			// Amount of events, starting from the oldest, already applied to the
+			// keymaps below
+			size_m applied;
+			// Keymaps as of the latest event read, used by the thread reading
+			// events
+			muBool keyboard[MU_KEYBOARD_LENGTH];
+			muBool keystates[MU_KEYSTATE_LENGTH];
+			muBool mouse[MU_MOUSE_LENGTH];
+			#endif
+		};
+		typedef struct muCOSA_EventQueue muCOSA_EventQueue;
+
+		muCOSAResult muCOSA_event_queue_create(muCOSA_EventQueue* queue, size_m capacity) {
+			mu_memset(queue, 0, sizeof(muCOSA_EventQueue));
+			if (!capacity) {
+				// (Keymap changes are still handed off in event-thread mode)
+				#ifdef MUCOSA_EVENT_THREAD
+				capacity = MUCOSA_EVENT_THREAD_CAPACITY;
+				queue->hidden = MU_TRUE;
+				#else
+				return MUCOSA_SUCCESS;
+				#endif
 			}
 
-			// Win32 virtual key code to muCOSA key code
-			muKeyboardKey muCOSAW32_VK_to_muCOSA(WPARAM vk) {
-				switch (vk) {
-					default: return MU_KEYBOARD_UNKNOWN; break;
-					case VK_BACK: return MU_KEYBOARD_BACKSPACE; break;
-					case VK_TAB: return MU_KEYBOARD_TAB; break;
-					case VK_CLEAR: return MU_KEYBOARD_CLEAR; break;
-					case VK_RETURN: return MU_KEYBOARD_RETURN; break;
-					case VK_PAUSE: return MU_KEYBOARD_PAUSE; break;
-					case VK_ESCAPE: return MU_KEYBOARD_ESCAPE; break;
-					case VK_MODECHANGE: return MU_KEYBOARD_MODECHANGE; break;
-					case VK_SPACE: return MU_KEYBOARD_SPACE; break;
-					case VK_PRIOR: return MU_KEYBOARD_PRIOR; break;
-					case VK_NEXT: return MU_KEYBOARD_NEXT; break;
-					case VK_END: return MU_KEYBOARD_END; break;
-					case VK_HOME: return MU_KEYBOARD_HOME; break;
-					case VK_LEFT: return MU_KEYBOARD_LEFT; break;
-					case VK_UP: return MU_KEYBOARD_UP; break;
-					case VK_RIGHT: return MU_KEYBOARD_RIGHT; break;
-					case VK_DOWN: return MU_KEYBOARD_DOWN; break;
-					case VK_SELECT: return MU_KEYBOARD_SELECT; break;
-					case VK_PRINT: return MU_KEYBOARD_PRINT; break;
-					case VK_EXECUTE: return MU_KEYBOARD_EXECUTE; break;
-					case VK_INSERT: return MU_KEYBOARD_INSERT; break;
-					case VK_DELETE: return MU_KEYBOARD_DELETE; break;
-					case VK_HELP: return MU_KEYBOARD_HELP; break;
-					case 0x30: return MU_KEYBOARD_0; break;
-					case 0x31: return MU_KEYBOARD_1; break;
-					case 0x32: return MU_KEYBOARD_2; break;
-					case 0x33: return MU_KEYBOARD_3; break;
-					case 0x34: return MU_KEYBOARD_4; break;
-					case 0x35: return MU_KEYBOARD_5; break;
-					case 0x36: return MU_KEYBOARD_6; break;
-					case 0x37: return MU_KEYBOARD_7; break;
-					case 0x38: return MU_KEYBOARD_8; break;
-					case 0x39: return MU_KEYBOARD_9; break;
-					case 0x41: return MU_KEYBOARD_A; break;
-					case 0x42: return MU_KEYBOARD_B; break;
-					case 0x43: return MU_KEYBOARD_C; break;
-					case 0x44: return MU_KEYBOARD_D; break;
-					case 0x45: return MU_KEYBOARD_E; break;
-					case 0x46: return MU_KEYBOARD_F; break;
-					case 0x47: return MU_KEYBOARD_G; break;
-					case 0x48: return MU_KEYBOARD_H; break;
-					case 0x49: return MU_KEYBOARD_I; break;
-					case 0x4A: return MU_KEYBOARD_J; break;
-					case 0x4B: return MU_KEYBOARD_K; break;
-					case 0x4C: return MU_KEYBOARD_L; break;
-					case 0x4D: return MU_KEYBOARD_M; break;
-					case 0x4E: return MU_KEYBOARD_N; break;
-					case 0x4F: return MU_KEYBOARD_O; break;
-					case 0x50: return MU_KEYBOARD_P; break;
-					case 0x51: return MU_KEYBOARD_Q; break;
-					case 0x52: return MU_KEYBOARD_R; break;
-					case 0x53: return MU_KEYBOARD_S; break;
-					case 0x54: return MU_KEYBOARD_T; break;
-					case 0x55: return MU_KEYBOARD_U; break;
-					case 0x56: return MU_KEYBOARD_V; break;
-					case 0x57: return MU_KEYBOARD_W; break;
-					case 0x58: return MU_KEYBOARD_X; break;
-					case 0x59: return MU_KEYBOARD_Y; break;
-					case 0x5A: return MU_KEYBOARD_Z; break;
-					case VK_LWIN: return MU_KEYBOARD_LEFT_WINDOWS; break;
-					case VK_RWIN: return MU_KEYBOARD_RIGHT_WINDOWS; break;
-					case VK_NUMPAD0: return MU_KEYBOARD_NUMPAD_0; break;
-					case VK_NUMPAD1: return MU_KEYBOARD_NUMPAD_1; break;
-					case VK_NUMPAD2: return MU_KEYBOARD_NUMPAD_2; break;
-					case VK_NUMPAD3: return MU_KEYBOARD_NUMPAD_3; break;
-					case VK_NUMPAD4: return MU_KEYBOARD_NUMPAD_4; break;
-					case VK_NUMPAD5: return MU_KEYBOARD_NUMPAD_5; break;
-					case VK_NUMPAD6: return MU_KEYBOARD_NUMPAD_6; break;
-					case VK_NUMPAD7: return MU_KEYBOARD_NUMPAD_7; break;
-					case VK_NUMPAD8: return MU_KEYBOARD_NUMPAD_8; break;
-					case VK_NUMPAD9: return MU_KEYBOARD_NUMPAD_9; break;
-					case VK_MULTIPLY: return MU_KEYBOARD_MULTIPLY; break;
-					case VK_ADD: return MU_KEYBOARD_ADD; break;
-					case VK_SEPARATOR: return MU_KEYBOARD_SEPARATOR; break;
-					case VK_SUBTRACT: return MU_KEYBOARD_SUBTRACT; break;
-					case VK_DECIMAL: return MU_KEYBOARD_DECIMAL; break;
-					case VK_DIVIDE: return MU_KEYBOARD_DIVIDE; break;
-					case VK_F1: return MU_KEYBOARD_F1; break;
-					case VK_F2: return MU_KEYBOARD_F2; break;
-					case VK_F3: return MU_KEYBOARD_F3; break;
-					case VK_F4: return MU_KEYBOARD_F4; break;
-					case VK_F5: return MU_KEYBOARD_F5; break;
-					case VK_F6: return MU_KEYBOARD_F6; break;
-					case VK_F7: return MU_KEYBOARD_F7; break;
-					case VK_F8: return MU_KEYBOARD_F8; break;
-					case VK_F9: return MU_KEYBOARD_F9; break;
-					case VK_F10: return MU_KEYBOARD_F10; break;
-					case VK_F11: return MU_KEYBOARD_F11; break;
-					case VK_F12: return MU_KEYBOARD_F12; break;
-					case VK_F13: return MU_KEYBOARD_F13; break;
-					case VK_F14: return MU_KEYBOARD_F14; break;
-					case VK_F15: return MU_KEYBOARD_F15; break;
-					case VK_F16: return MU_KEYBOARD_F16; break;
-					case VK_F17: return MU_KEYBOARD_F17; break;
-					case VK_F18: return MU_KEYBOARD_F18; break;
-					case VK_F19: return MU_KEYBOARD_F19; break;
-					case VK_F20: return MU_KEYBOARD_F20; break;
-					case VK_F21: return MU_KEYBOARD_F21; break;
-					case VK_F22: return MU_KEYBOARD_F22; break;
-					case VK_F23: return MU_KEYBOARD_F23; break;
-					case VK_F24: return MU_KEYBOARD_F24; break;
-					case VK_NUMLOCK: return MU_KEYBOARD_NUMLOCK; break;
-					case VK_SCROLL: return MU_KEYBOARD_SCROLL; break;
-					case VK_LSHIFT: return MU_KEYBOARD_LEFT_SHIFT; break;
-					case VK_RSHIFT: return MU_KEYBOARD_RIGHT_SHIFT; break;
-					case VK_LCONTROL: return MU_KEYBOARD_LEFT_CONTROL; break;
-					case VK_RCONTROL: return MU_KEYBOARD_RIGHT_CONTROL; break;
-					case VK_LMENU: return MU_KEYBOARD_LEFT_MENU; break;
-					case VK_RMENU: return MU_KEYBOARD_RIGHT_MENU; break;
-					case VK_ATTN: return MU_KEYBOARD_ATTN; break;
-					case VK_CRSEL: return MU_KEYBOARD_CRSEL; break;
-					case VK_EXSEL: return MU_KEYBOARD_EXSEL; break;
-					case VK_EREOF: return MU_KEYBOARD_EREOF; break;
-					case VK_PLAY: return MU_KEYBOARD_PLAY; break;
-					case VK_PA1: return MU_KEYBOARD_PA1; break;
-				}
+			// Allocate events
+			queue->events = (muEvent*)mu_malloc((capacity + 1) * sizeof(muEvent));
+			if (!queue->events) {
+				return MUCOSA_FAILED_MALLOC;
 			}
+			queue->capacity = capacity;
+			return MUCOSA_SUCCESS;
+		}
 
-			// muCOSA cursor style to Win32 cursor
-			void* muCOSAW32_muCOSA_cursor_to_W32(muCursorStyle style) {
-				switch (style) {
-					default: return IDC_ARROW; break;
-					case MU_CURSOR_ARROW: return IDC_ARROW; break;
-					case MU_CURSOR_IBEAM: return IDC_IBEAM; break;
-					case MU_CURSOR_WAIT: return IDC_WAIT; break;
-					case MU_CURSOR_WAIT_ARROW: return IDC_APPSTARTING; break;
-					case MU_CURSOR_CROSSHAIR: return IDC_CROSS; break;
-					case MU_CURSOR_HAND: return IDC_HAND; break;
-					case MU_CURSOR_SIZE_LR: return IDC_SIZEWE; break;
-					case MU_CURSOR_SIZE_TB: return IDC_SIZENS; break;
-					case MU_CURSOR_SIZE_TL_BR: return IDC_SIZENWSE; break;
-					case MU_CURSOR_SIZE_TR_BL: return IDC_SIZENESW; break;
-					case MU_CURSOR_SIZE_ALL: return IDC_SIZEALL; break;
-					case MU_CURSOR_NO: return IDC_NO; break;
+		void muCOSA_event_queue_destroy(muCOSA_EventQueue* queue) {
+			if (queue->events) {
+				mu_free(queue->events);
+			}
+			if (queue->recording.file) {
+				mu_fclose(queue->recording.file);
+			}
+			mu_memset(queue, 0, sizeof(muCOSA_EventQueue));
+		}
+
+		// Gets the index after the given index in a queue
+		size_m muCOSA_event_queue_next(muCOSA_EventQueue* queue, size_m i) {
+			return (i == queue->capacity) ? 0 : i + 1;
+		}
+
+		// Gets the amount of events in a queue between the given head and tail
+		size_m muCOSA_event_queue_count(muCOSA_EventQueue* queue, size_m head, size_m tail) {
+			return (tail >= head) ? tail - head : tail + queue->capacity + 1 - head;
+		}
+
+		// Gets a slot for an event of the given type in a queue that has events,
+		// so that its data can be filled in; it's only stored once committed. If
+		// the queue is full, the oldest event is dropped (or, in event-thread
+		// mode, this one is). If the queue has no events (but is being recorded),
+		// the scratch event is given instead.
+		muEvent* muCOSA_event_queue_push(muCOSA_EventQueue* queue, muEventType type) {
+			muEvent* event = &queue->scratch;
+			if (queue->events) {
+				event = &queue->events[queue->tail];
+				// Drop oldest event if full (or this one in event-thread mode,
+				// filling in the scratch event instead)
+				if (muCOSA_event_queue_next(queue, queue->tail) == MUCOSA_QUEUE_LOAD(queue->head)) {
+					#ifdef MUCOSA_EVENT_THREAD
+					event = &queue->scratch;
+					#else
+					queue->head = muCOSA_event_queue_next(queue, queue->head);
+					#endif
 				}
 			}
 
-			// muCOSA keystate to Win32
-			int muCOSAW32_keystate_to_W32(muKeyboardState state) {
-				switch (state) {
-					default: return VK_NONAME; break;
-					case MU_KEYSTATE_CAPS_LOCK: return VK_CAPITAL; break;
-					case MU_KEYSTATE_SCROLL_LOCK: return VK_SCROLL; break;
-					case MU_KEYSTATE_NUM_LOCK: return VK_NUMLOCK; break;
+			event->type = type;
+			event->time = queue->time;
+			return event;
+		}
+
+		// Stores an event given by muCOSA_event_queue_push once it's filled in
+		void muCOSA_event_queue_commit(muCOSA_EventQueue* queue, muEvent* event) {
+			if (event != &queue->scratch) {
+				MUCOSA_QUEUE_STORE(queue->tail, muCOSA_event_queue_next(queue, queue->tail));
+			}
+		}
+
+		#ifdef MUCOSA_EVENT_THREAD
+
+		// Applies an event to the keymaps of the thread reading events
+		void muCOSA_event_queue_apply(muCOSA_EventQueue* queue, muEvent* event) {
+			switch (event->type) {
+				default: break;
+				case MU_EVENT_KEYBOARD: queue->keyboard[event->data.keyboard.key] = event->data.keyboard.status; break;
+				case MU_EVENT_KEYSTATE: queue->keystates[event->data.keystate.state] = event->data.keystate.status; break;
+				case MU_EVENT_MOUSE_KEY: queue->mouse[event->data.mouse_key.key] = event->data.mouse_key.status; break;
+			}
+		}
+
+		// Applies every event not yet applied to the keymaps of the thread
+		// reading events, leaving them in the queue to be polled; a queue that
+		// can't be polled is emptied instead
+		void muCOSA_event_queue_catch_up(muCOSA_EventQueue* queue) {
+			size_m head = queue->head;
+			size_m tail = MUCOSA_QUEUE_LOAD(queue->tail);
+			size_m count = muCOSA_event_queue_count(queue, head, tail);
+
+			// Apply new events
+			size_m i = head;
+			for (size_m n = 0; n < count; ++n) {
+				if (n >= queue->applied) {
+					muCOSA_event_queue_apply(queue, &queue->events[i]);
 				}
+				i = muCOSA_event_queue_next(queue, i);
 			}
+			queue->applied = count;
 
-		/* OpenGL */
+			// Empty a queue that can't be polled
+			if (queue->hidden) {
+				queue->applied = 0;
+				MUCOSA_QUEUE_STORE(queue->head, tail);
+			}
+		}
 
-		#ifdef MU_SUPPORT_OPENGL
+		// Checks if a queue has events not yet applied to the keymaps of the
+		// thread reading events
+		muBool muCOSA_event_queue_has_new(muCOSA_EventQueue* queue) {
+			return muCOSA_event_queue_count(queue, queue->head, MUCOSA_QUEUE_LOAD(queue->tail)) > queue->applied;
+		}
 
-			/* Inclusion and common definition */
+		#endif /* MUCOSA_EVENT_THREAD */
 
-				// Common OpenGL definitions
-				#ifndef MUCOSA_NO_INCLUDE_OPENGL
-					// Only include if "glClearColor" isn't defined; this is to avoid
-					// accidental double definition in many circumstances.
-					#ifndef glClearColor
-						#include <gl/gl.h>
-						#include <gl/glu.h>
-					#endif
-				#endif
+		// Copies up to max of the oldest events and removes them from the queue
+		size_m muCOSA_event_queue_poll(muCOSA_EventQueue* queue, muEvent* events, size_m max) {
+			// (Windows without a queue only have one to hand off changes)
+			#ifdef MUCOSA_EVENT_THREAD
+			if (queue->hidden) {
+				return 0;
+			}
+			#endif
 
-				// Device context -> valid OpenGL context
-				#include <wingdi.h>
+			if (!queue->events) {
+				return 0;
+			}
+			size_m head = queue->head;
+			size_m count = muCOSA_event_queue_count(queue, head, MUCOSA_QUEUE_LOAD(queue->tail));
+			if (count > max) {
+				count = max;
+			}
+			if (!count) {
+				return 0;
+			}
 
-				// Typedefs for functions we need
-				// - wglCreateContextAttribs; needed for specifying exact version when creating context
-				typedef HGLRC WINAPI muCOSAW32_wglCreateContextAttribsARB_type(HDC hdc, HGLRC hShareContext, const int* attribList);
-				// - wglChoosePixelFormat; needed for choosing a more thorough pixel format when creating context
-				typedef BOOL WINAPI muCOSAW32_wglChoosePixelFormatARB_type(HDC hdc, const int* piAttribIList, const FLOAT* pfAttribFList, UINT uMaxFormats, int* piFormats, UINT* nNumFormats);
-				// - wglSwapInterval; not needed in context creation, but used for swap interval later
-				typedef BOOL WINAPI muCOSAW32_wglSwapIntervalEXT_type(int interval);
+			// Copy events in up to two parts, as they can wrap around the end
+			size_m first = queue->capacity + 1 - head;
+			if (first > count) {
+				first = count;
+			}
+			mu_memcpy(events, &queue->events[head], first * sizeof(muEvent));
+			if (count > first) {
+				mu_memcpy(&events[first], queue->events, (count - first) * sizeof(muEvent));
+			}
 
-				// Struct to hold WGL functions needed for context creation
-				struct muCOSAW32_WGL {
-					muCOSAW32_wglCreateContextAttribsARB_type* CreateContextAttribs;
-					muCOSAW32_wglChoosePixelFormatARB_type* ChoosePixelFormat;
-					muCOSAW32_wglSwapIntervalEXT_type* SwapInterval;
-				};
-				typedef struct muCOSAW32_WGL muCOSAW32_WGL;
+			// Apply the ones not yet applied
+			#ifdef MUCOSA_EVENT_THREAD
+			for (size_m i = queue->applied; i < count; ++i) {
+				muCOSA_event_queue_apply(queue, &events[i]);
+			}
+			queue->applied = (queue->applied > count) ? queue->applied - count : 0;
+			#endif
 
-			/* WGL tokens */
+			// Remove them
+			head += count;
+			if (head > queue->capacity) {
+				head -= queue->capacity + 1;
+			}
+			MUCOSA_QUEUE_STORE(queue->head, head);
+			return count;
+		}
 
-				// https://registry.khronos.org/OpenGL/extensions/ARB/WGL_ARB_create_context.txt
+		/* Recording */
 
-				#define MUCOSAWGL_CONTEXT_MAJOR_VERSION_ARB             0x2091
-				#define MUCOSAWGL_CONTEXT_MINOR_VERSION_ARB             0x2092
-				#define MUCOSAWGL_CONTEXT_LAYER_PLANE_ARB               0x2093
-				#define MUCOSAWGL_CONTEXT_FLAGS_ARB                     0x2094
-				#define MUCOSAWGL_CONTEXT_PROFILE_MASK_ARB              0x9126
+			// A recording starts with the signature "muCOSArc" and a version byte,
+			// followed by a record for every event delivered and for the end of
+			// every update. Each record is its type (a muEventType, or
+			// MUCOSA_RECORD_UPDATE), its time relative to the start of the recording
+			// (an IEEE 754 double), and then the event's data. Everything is stored
+			// little-endian.
 
-				#define MUCOSAWGL_CONTEXT_DEBUG_BIT_ARB                 0x0001
-				#define MUCOSAWGL_CONTEXT_FORWARD_COMPATIBLE_BIT_ARB    0x0002
+			#define MUCOSA_RECORD_VERSION 1
+			#define MUCOSA_RECORD_UPDATE 255
 
-				#define MUCOSAWGL_CONTEXT_CORE_PROFILE_BIT_ARB          0x00000001
-				#define MUCOSAWGL_CONTEXT_COMPATIBILITY_PROFILE_BIT_ARB 0x00000002
+			// Little-endian encoding
+			void muCOSA_record_put_u16(uint8_m* b, uint16_m v) {
+				b[0] = (uint8_m)(v);
+				b[1] = (uint8_m)(v >> 8);
+			}
+			void muCOSA_record_put_u32(uint8_m* b, uint32_m v) {
+				b[0] = (uint8_m)(v);
+				b[1] = (uint8_m)(v >> 8);
+				b[2] = (uint8_m)(v >> 16);
+				b[3] = (uint8_m)(v >> 24);
+			}
+			void muCOSA_record_put_f64(uint8_m* b, double v) {
+				uint64_m u;
+				mu_memcpy(&u, &v, 8);
+				muCOSA_record_put_u32(b, (uint32_m)u);
+				muCOSA_record_put_u32(b + 4, (uint32_m)(u >> 32));
+			}
+			uint16_m muCOSA_record_get_u16(const uint8_m* b) {
+				return (uint16_m)(b[0] | (b[1] << 8));
+			}
+			uint32_m muCOSA_record_get_u32(const uint8_m* b) {
+				return (uint32_m)b[0] | ((uint32_m)b[1] << 8) | ((uint32_m)b[2] << 16) | ((uint32_m)b[3] << 24);
+			}
+			double muCOSA_record_get_f64(const uint8_m* b) {
+				uint64_m u = (uint64_m)muCOSA_record_get_u32(b) | ((uint64_m)muCOSA_record_get_u32(b + 4) << 32);
+				double v;
+				mu_memcpy(&v, &u, 8);
+				return v;
+			}
 
-				#define MUCOSAWGL_ERROR_INVALID_VERSION_ARB                 0x2095
-				#define MUCOSAWGL_ERROR_INVALID_PROFILE_ARB                 0x2096
+			// Writes bytes to a recording, remembering if it failed
+			void muCOSA_recording_write(muCOSA_Recording* rec, const uint8_m* data, size_m len) {
+				if (!rec->failed && mu_fwrite(data, 1, len, rec->file) != len) {
+					rec->failed = MU_TRUE;
+				}
+			}
 
-				// https://registry.khronos.org/OpenGL/extensions/ARB/WGL_ARB_pixel_format.txt
+			// Starts a recording to the file at the given path
+			muCOSAResult muCOSA_recording_start(muCOSA_Recording* rec, const char* path, double now) {
+				rec->file = mu_fopen(path, "wb");
+				if (!rec->file) {
+					return MUCOSA_FAILED_OPEN_FILE;
+				}
+				rec->start = now;
+				rec->failed = MU_FALSE;
 
-				#define MUCOSAWGL_NUMBER_PIXEL_FORMATS_ARB    0x2000
-				#define MUCOSAWGL_DRAW_TO_WINDOW_ARB          0x2001
-				#define MUCOSAWGL_DRAW_TO_BITMAP_ARB          0x2002
-				#define MUCOSAWGL_ACCELERATION_ARB            0x2003
-				#define MUCOSAWGL_NEED_PALETTE_ARB            0x2004
-				#define MUCOSAWGL_NEED_SYSTEM_PALETTE_ARB     0x2005
-				#define MUCOSAWGL_SWAP_LAYER_BUFFERS_ARB      0x2006
-				#define MUCOSAWGL_SWAP_METHOD_ARB             0x2007
-				#define MUCOSAWGL_NUMBER_OVERLAYS_ARB         0x2008
-				#define MUCOSAWGL_NUMBER_UNDERLAYS_ARB        0x2009
-				#define MUCOSAWGL_TRANSPARENT_ARB             0x200A
-				#define MUCOSAWGL_TRANSPARENT_RED_VALUE_ARB   0x2037
-				#define MUCOSAWGL_TRANSPARENT_GREEN_VALUE_ARB 0x2038
-				#define MUCOSAWGL_TRANSPARENT_BLUE_VALUE_ARB  0x2039
-				#define MUCOSAWGL_TRANSPARENT_ALPHA_VALUE_ARB 0x203A
-				#define MUCOSAWGL_TRANSPARENT_INDEX_VALUE_ARB 0x203B
-				#define MUCOSAWGL_SHARE_DEPTH_ARB             0x200C
-				#define MUCOSAWGL_SHARE_STENCIL_ARB           0x200D
-				#define MUCOSAWGL_SHARE_ACCUM_ARB             0x200E
-				#define MUCOSAWGL_SUPPORT_GDI_ARB             0x200F
-				#define MUCOSAWGL_SUPPORT_OPENGL_ARB          0x2010
-				#define MUCOSAWGL_DOUBLE_BUFFER_ARB           0x2011
-				#define MUCOSAWGL_STEREO_ARB                  0x2012
-				#define MUCOSAWGL_PIXEL_TYPE_ARB              0x2013
-				#define MUCOSAWGL_COLOR_BITS_ARB              0x2014
-				#define MUCOSAWGL_RED_BITS_ARB                0x2015
-				#define MUCOSAWGL_RED_SHIFT_ARB               0x2016
-				#define MUCOSAWGL_GREEN_BITS_ARB              0x2017
-				#define MUCOSAWGL_GREEN_SHIFT_ARB             0x2018
-				#define MUCOSAWGL_BLUE_BITS_ARB               0x2019
-				#define MUCOSAWGL_BLUE_SHIFT_ARB              0x201A
-				#define MUCOSAWGL_ALPHA_BITS_ARB              0x201B
-				#define MUCOSAWGL_ALPHA_SHIFT_ARB             0x201C
-				#define MUCOSAWGL_ACCUM_BITS_ARB              0x201D
-				#define MUCOSAWGL_ACCUM_RED_BITS_ARB          0x201E
-				#define MUCOSAWGL_ACCUM_GREEN_BITS_ARB        0x201F
-				#define MUCOSAWGL_ACCUM_BLUE_BITS_ARB         0x2020
-				#define MUCOSAWGL_ACCUM_ALPHA_BITS_ARB        0x2021
-				#define MUCOSAWGL_DEPTH_BITS_ARB              0x2022
-				#define MUCOSAWGL_STENCIL_BITS_ARB            0x2023
-				#define MUCOSAWGL_AUX_BUFFERS_ARB             0x2024
+				// Signature + version
+				const uint8_m header[9] = { 'm', 'u', 'C', 'O', 'S', 'A', 'r', 'c', MUCOSA_RECORD_VERSION };
+				muCOSA_recording_write(rec, header, sizeof(header));
+				return MUCOSA_SUCCESS;
+			}
 
-				#define MUCOSAWGL_NO_ACCELERATION_ARB         0x2025
-				#define MUCOSAWGL_GENERIC_ACCELERATION_ARB    0x2026
-				#define MUCOSAWGL_FULL_ACCELERATION_ARB       0x2027
+			// Stops a recording, giving if it was written successfully
+			muCOSAResult muCOSA_recording_stop(muCOSA_Recording* rec) {
+				if (!rec->file) {
+					return MUCOSA_SUCCESS;
+				}
+				// (Closing flushes the rest of the recording)
+				muBool failed = rec->failed || mu_fclose(rec->file) != 0;
+				rec->file = 0;
+				return failed ? MUCOSA_FAILED_WRITE_FILE : MUCOSA_SUCCESS;
+			}
 
-				#define MUCOSAWGL_SWAP_EXCHANGE_ARB           0x2028
-				#define MUCOSAWGL_SWAP_COPY_ARB               0x2029
-				#define MUCOSAWGL_SWAP_UNDEFINED_ARB          0x202A
+			// Writes an event delivered to a recording
+			void muCOSA_recording_write_event(muCOSA_Recording* rec, muEvent* event) {
+				if (!rec->file) {
+					return;
+				}
 
-				#define MUCOSAWGL_TYPE_RGBA_ARB               0x202B
-				#define MUCOSAWGL_TYPE_COLORINDEX_ARB         0x202C
+				// Type + time
+				uint8_m b[32];
+				b[0] = (uint8_m)event->type;
+				muCOSA_record_put_f64(&b[1], event->time - rec->start);
+				size_m len = 9;
 
-				// https://nehe.gamedev.net/tutorial/fullscreen_antialiasing/16008/
+				// Data
+				switch (event->type) {
+					default: break;
+					case MU_EVENT_DIMENSIONS: {
+						muCOSA_record_put_u32(&b[len], event->data.dimensions.width);
+						muCOSA_record_put_u32(&b[len+4], event->data.dimensions.height);
+						len += 8;
+					} break;
+					case MU_EVENT_POSITION: {
+						muCOSA_record_put_u32(&b[len], (uint32_m)event->data.position.x);
+						muCOSA_record_put_u32(&b[len+4], (uint32_m)event->data.position.y);
+						len += 8;
+					} break;
+					case MU_EVENT_KEYBOARD: {
+						muCOSA_record_put_u16(&b[len], (uint16_m)event->data.keyboard.key);
+						b[len+2] = (uint8_m)event->data.keyboard.status;
+						len += 3;
+					} break;
+					case MU_EVENT_KEYSTATE: {
+						muCOSA_record_put_u16(&b[len], (uint16_m)event->data.keystate.state);
+						b[len+2] = (uint8_m)event->data.keystate.status;
+						len += 3;
+					} break;
+					case MU_EVENT_MOUSE_KEY: {
+						muCOSA_record_put_u16(&b[len], (uint16_m)event->data.mouse_key.key);
+						b[len+2] = (uint8_m)event->data.mouse_key.status;
+						len += 3;
+					} break;
+					case MU_EVENT_CURSOR: {
+						muCOSA_record_put_u32(&b[len], (uint32_m)event->data.cursor.x);
+						muCOSA_record_put_u32(&b[len+4], (uint32_m)event->data.cursor.y);
+						len += 8;
+					} break;
+					case MU_EVENT_SCROLL: {
+						muCOSA_record_put_u32(&b[len], (uint32_m)event->data.scroll);
+						len += 4;
+					} break;
+					case MU_EVENT_TEXT: {
+						// Length-prefixed character
+						uint8_m n = 0;
+						while (n < 4 && event->data.text[n]) {
+							b[len+1+n] = event->data.text[n];
+							++n;
+						}
+						b[len] = n;
+						len += 1 + n;
+					} break;
+					case MU_EVENT_RAW_MOTION: {
+						muCOSA_record_put_f64(&b[len], event->data.raw_motion.dx);
+						muCOSA_record_put_f64(&b[len+8], event->data.raw_motion.dy);
+						len += 16;
+					} break;
+				}
+				muCOSA_recording_write(rec, b, len);
+			}
 
-				#define MUCOSAWGL_SAMPLE_BUFFERS_ARB  0x2041
-				#define MUCOSAWGL_SAMPLES_ARB     0x2042
+			// Writes the end of an update to a recording
+			void muCOSA_recording_write_update(muCOSA_Recording* rec, double time) {
+				if (!rec->file) {
+					return;
+				}
+				uint8_m b[9];
+				b[0] = MUCOSA_RECORD_UPDATE;
+				muCOSA_record_put_f64(&b[1], time - rec->start);
+				muCOSA_recording_write(rec, b, sizeof(b));
+			}
 
-			/* Functions */
+			// Reads an entire file into memory
+			muCOSAResult muCOSA_recording_read_file(const char* path, uint8_m** data, size_m* len) {
+				FILE* file = mu_fopen(path, "rb");
+				if (!file) {
+					return MUCOSA_FAILED_OPEN_FILE;
+				}
 
-				// Retrieves OpenGL extensions needed for context creation
-				muCOSAResult muCOSAW32_get_opengl_extensions(muCOSAW32_WGL* wgl) {
-					// Create temp window class
-					WNDCLASSA wclass = MU_ZERO_STRUCT(WNDCLASSA);
-					wclass.style = CS_HREDRAW | CS_VREDRAW | CS_OWNDC;
-					wclass.lpfnWndProc = DefWindowProcA;
-					wclass.hInstance = muCOSAW32_get_hinstance();
-					wclass.lpszClassName = "Dummy WGL window class";
-					if (!RegisterClassA(&wclass)) {
-						return MUCOSA_WIN32_FAILED_REGISTER_DUMMY_WGL_WINDOW_CLASS;
+				// Read in chunks, growing the buffer as needed
+				uint8_m* buf = 0;
+				size_m size = 0, cap = 0;
+				for (;;) {
+					if (size == cap) {
+						size_m new_cap = cap ? cap * 2 : 4096;
+						uint8_m* new_buf = (uint8_m*)mu_realloc(buf, new_cap);
+						if (!new_buf) {
+							if (buf) {
+								mu_free(buf);
+							}
+							mu_fclose(file);
+							return buf ? MUCOSA_FAILED_REALLOC : MUCOSA_FAILED_MALLOC;
+						}
+						buf = new_buf;
+						cap = new_cap;
 					}
-
-					// Create temp window
-					HWND win = CreateWindowExA(
-						0, wclass.lpszClassName, "Dummy WGL window", 0,
-						CW_USEDEFAULT, CW_USEDEFAULT, CW_USEDEFAULT, CW_USEDEFAULT, 0, 0,
-						wclass.hInstance, 0
-					);
-					if (win == NULL) {
-						UnregisterClassA(wclass.lpszClassName, wclass.hInstance);
-						return MUCOSA_WIN32_FAILED_CREATE_DUMMY_WGL_WINDOW;
+					size_m got = mu_fread(buf + size, 1, cap - size, file);
+					size += got;
+					if (got == 0) {
+						break;
 					}
+				}
+				mu_fclose(file);
 
-					// Get device context from this window
-					HDC dc = GetDC(win);
+				*data = buf;
+				*len = size;
+				return MUCOSA_SUCCESS;
+			}
 
-					// Use pixel format number 1
-					// This is a HACK and a half, but works
-					int pixel_format = 1;
-					PIXELFORMATDESCRIPTOR format_desc;
-					if (!DescribePixelFormat(dc, pixel_format, sizeof(format_desc), &format_desc)) {
-						ReleaseDC(win, dc);
-						DestroyWindow(win);
-						UnregisterClassA(wclass.lpszClassName, wclass.hInstance);
-						return MUCOSA_WIN32_FAILED_DESCRIBE_DUMMY_WGL_PIXEL_FORMAT;
-					}
+			// Reads the record at the given position of a recording's data into an
+			// event (with its time relative to the start of the recording), moving
+			// the position past it; returns 0 if the record is invalid or cut off,
+			// and the type of the record otherwise
+			muBool muCOSA_recording_read(const uint8_m* data, size_m len, size_m* pos, uint8_m* type, muEvent* event) {
+				size_m p = *pos;
+				if (len - p < 9) {
+					return MU_FALSE;
+				}
+				*type = data[p];
+				event->type = (muEventType)data[p];
+				event->time = muCOSA_record_get_f64(&data[p+1]);
+				p += 9;
+
+				// Size of the data
+				size_m need = 0;
+				switch (*type) {
+					default: return MU_FALSE; break;
+					case MUCOSA_RECORD_UPDATE: case MU_EVENT_CLOSE: need = 0; break;
+					case MU_EVENT_DIMENSIONS: case MU_EVENT_POSITION: case MU_EVENT_CURSOR: need = 8; break;
+					case MU_EVENT_KEYBOARD: case MU_EVENT_KEYSTATE: case MU_EVENT_MOUSE_KEY: need = 3; break;
+					case MU_EVENT_SCROLL: need = 4; break;
+					case MU_EVENT_TEXT: need = (p < len) ? (size_m)data[p] + 1 : 1; break;
+					case MU_EVENT_RAW_MOTION: need = 16; break;
+				}
+				if (len - p < need) {
+					return MU_FALSE;
+				}
 
-					// Set pixel format. This doesn't make much sense, this is already definitionally
-					// the pixel format of the device, but it doesn't work if I don't do this, so, :L
-					// Note: this might not be okay, and we may need to specify SOME pixel format,
-					// but I don't know.
-					if (!SetPixelFormat(dc, pixel_format, &format_desc)) {
-						ReleaseDC(win, dc);
-						DestroyWindow(win);
-						UnregisterClassA(wclass.lpszClassName, wclass.hInstance);
-						return MUCOSA_WIN32_FAILED_SET_DUMMY_WGL_PIXEL_FORMAT;
-					}
+				// Data
+				const uint8_m* b = &data[p];
+				switch (*type) {
+					default: break;
+					case MU_EVENT_DIMENSIONS: {
+						event->data.dimensions.width = muCOSA_record_get_u32(b);
+						event->data.dimensions.height = muCOSA_record_get_u32(b+4);
+					} break;
+					case MU_EVENT_POSITION: {
+						event->data.position.x = (int32_m)muCOSA_record_get_u32(b);
+						event->data.position.y = (int32_m)muCOSA_record_get_u32(b+4);
+					} break;
+					case MU_EVENT_KEYBOARD: {
+						event->data.keyboard.key = (muKeyboardKey)muCOSA_record_get_u16(b);
+						event->data.keyboard.status = (muBool)b[2];
+					} break;
+					case MU_EVENT_KEYSTATE: {
+						event->data.keystate.state = (muKeyboardState)muCOSA_record_get_u16(b);
+						event->data.keystate.status = (muBool)b[2];
+					} break;
+					case MU_EVENT_MOUSE_KEY: {
+						event->data.mouse_key.key = (muMouseKey)muCOSA_record_get_u16(b);
+						event->data.mouse_key.status = (muBool)b[2];
+					} break;
+					case MU_EVENT_CURSOR: {
+						event->data.cursor.x = (int32_m)muCOSA_record_get_u32(b);
+						event->data.cursor.y = (int32_m)muCOSA_record_get_u32(b+4);
+					} break;
+					case MU_EVENT_SCROLL: {
+						event->data.scroll = (int32_m)muCOSA_record_get_u32(b);
+					} break;
+					case MU_EVENT_TEXT: {
+						if (b[0] > 4) {
+							return MU_FALSE;
+						}
+						mu_memcpy(event->data.text, &b[1], b[0]);
+						event->data.text[b[0]] = 0;
+					} break;
+					case MU_EVENT_RAW_MOTION: {
+						event->data.raw_motion.dx = muCOSA_record_get_f64(b);
+						event->data.raw_motion.dy = muCOSA_record_get_f64(b+8);
+					} break;
+				}
 
-					// Create dummy context
-					HGLRC context = wglCreateContext(dc);
-					if (!context) {
-						ReleaseDC(win, dc);
-						DestroyWindow(win);
-						UnregisterClassA(wclass.lpszClassName, wclass.hInstance);
-						return MUCOSA_WIN32_FAILED_CREATE_DUMMY_WGL_CONTEXT;
-					}
-					// Bind dummy context
-					if (!wglMakeCurrent(dc, context)) {
-						wglDeleteContext(context);
-						ReleaseDC(win, dc);
-						DestroyWindow(win);
-						UnregisterClassA(wclass.lpszClassName, wclass.hInstance);
-						return MUCOSA_WIN32_FAILED_BIND_DUMMY_WGL_CONTEXT;
-					}
+				*pos = p + need;
+				return MU_TRUE;
+			}
 
-					// Find necessary functions
-					PROC wglCreateContextAttribsARB_proc = wglGetProcAddress("wglCreateContextAttribsARB");
-					PROC wglChoosePixelFormatARB_proc    = wglGetProcAddress("wglChoosePixelFormatARB");
-					// Find helpful functions
-					PROC wglSwapIntervalEXT_proc         = wglGetProcAddress("wglSwapIntervalEXT");
+		/* Pushing events */
 
-					// Destroy resources
-					wglMakeCurrent(dc, 0);
-					wglDeleteContext(context);
-					ReleaseDC(win, dc);
-					DestroyWindow(win);
-					UnregisterClassA(wclass.lpszClassName, wclass.hInstance);
+			void muCOSA_event_push_dimensions(muCOSA_EventQueue* queue, uint32_m width, uint32_m height) {
+				if (queue->events || queue->recording.file) {
+					muEvent* event = muCOSA_event_queue_push(queue, MU_EVENT_DIMENSIONS);
+					event->data.dimensions.width = width;
+					event->data.dimensions.height = height;
+					muCOSA_recording_write_event(&queue->recording, event);
+					muCOSA_event_queue_commit(queue, event);
+				}
+			}
 
-					// Detect if any required functions went unfound
-					if (!wglCreateContextAttribsARB_proc) {
-						return MUCOSA_WIN32_FAILED_FIND_WGL_CREATE_CONTEXT_ATTRIBS;
-					}
-					if (!wglChoosePixelFormatARB_proc) {
-						return MUCOSA_WIN32_FAILED_FIND_WGL_CHOOSE_PIXEL_FORMAT;
-					}
+			void muCOSA_event_push_position(muCOSA_EventQueue* queue, int32_m x, int32_m y) {
+				if (queue->events || queue->recording.file) {
+					muEvent* event = muCOSA_event_queue_push(queue, MU_EVENT_POSITION);
+					event->data.position.x = x;
+					event->data.position.y = y;
+					muCOSA_recording_write_event(&queue->recording, event);
+					muCOSA_event_queue_commit(queue, event);
+				}
+			}
 
-					// Copy over functions
-					mu_memcpy(&wgl->CreateContextAttribs, &wglCreateContextAttribsARB_proc, sizeof(PROC));
-					mu_memcpy(&wgl->ChoosePixelFormat,    &wglChoosePixelFormatARB_proc,    sizeof(PROC));
-					mu_memcpy(&wgl->SwapInterval,         &wglSwapIntervalEXT_proc,         sizeof(PROC));
-					return MUCOSA_SUCCESS;
+			void muCOSA_event_push_keyboard(muCOSA_EventQueue* queue, muKeyboardKey key, muBool status) {
+				if (queue->events || queue->recording.file) {
+					muEvent* event = muCOSA_event_queue_push(queue, MU_EVENT_KEYBOARD);
+					event->data.keyboard.key = key;
+					event->data.keyboard.status = status;
+					muCOSA_recording_write_event(&queue->recording, event);
+					muCOSA_event_queue_commit(queue, event);
 				}
+			}
 
-				// Creates an OpenGL context
-				muCOSAResult muCOSAW32_create_opengl_context(HDC dc, int win_pixel_format, muCOSAW32_WGL* wgl, muPixelFormat* format, HGLRC* context, muGraphicsAPI api, muBool* set) {
-					muCOSAResult res = MUCOSA_SUCCESS;
-					// Choose pixel format
-					int pixel_format;
+			void muCOSA_event_push_keystate(muCOSA_EventQueue* queue, muKeyboardState state, muBool status) {
+				if (queue->events || queue->recording.file) {
+					muEvent* event = muCOSA_event_queue_push(queue, MU_EVENT_KEYSTATE);
+					event->data.keystate.state = state;
+					event->data.keystate.status = status;
+					muCOSA_recording_write_event(&queue->recording, event);
+					muCOSA_event_queue_commit(queue, event);
+				}
+			}
 
-					// - If a pixel format is supplied by the user:
-					if (format) {
-						// Set up an attribute field based on pixel format
-						int pixel_format_attributes[] = {
-							MUCOSAWGL_DRAW_TO_WINDOW_ARB, MU_TRUE,
-							MUCOSAWGL_SUPPORT_OPENGL_ARB, MU_TRUE,
-							MUCOSAWGL_DOUBLE_BUFFER_ARB,  MU_TRUE,
-							MUCOSAWGL_SAMPLE_BUFFERS_ARB, MU_TRUE, // (?)
-							MUCOSAWGL_ACCELERATION_ARB,   MUCOSAWGL_FULL_ACCELERATION_ARB, // (?)
-							MUCOSAWGL_PIXEL_TYPE_ARB,     MUCOSAWGL_TYPE_RGBA_ARB, // (?)
-							MUCOSAWGL_RED_BITS_ARB,       format->red_bits,
-							MUCOSAWGL_GREEN_BITS_ARB,     format->green_bits,
-							MUCOSAWGL_BLUE_BITS_ARB,      format->blue_bits,
-							MUCOSAWGL_ALPHA_BITS_ARB,     format->alpha_bits,
-							MUCOSAWGL_DEPTH_BITS_ARB,     format->depth_bits,
-							MUCOSAWGL_STENCIL_BITS_ARB,   format->stencil_bits,
-							MUCOSAWGL_SAMPLES_ARB,        format->samples,
-							0
-						};
-						// Find corresponding format using WGL
-						UINT format_count = 0;
-						// - Does the return value of this indicate error? Can't find documentation
-						wgl->ChoosePixelFormat(dc, pixel_format_attributes, 0, 1, &pixel_format, &format_count);
-						if (!format_count) {
-							res = MUCOSA_WIN32_FAILED_CHOOSE_WGL_PIXEL_FORMAT;
-						}
-					}
+			void muCOSA_event_push_mouse_key(muCOSA_EventQueue* queue, muMouseKey key, muBool status) {
+				if (queue->events || queue->recording.file) {
+					muEvent* event = muCOSA_event_queue_push(queue, MU_EVENT_MOUSE_KEY);
+					event->data.mouse_key.key = key;
+					event->data.mouse_key.status = status;
+					muCOSA_recording_write_event(&queue->recording, event);
+					muCOSA_event_queue_commit(queue, event);
+				}
+			}
 
-					// - If a pixel format isn't supplied by the user (or it failed)
-					if ((!format) || (res != MUCOSA_SUCCESS)) {
-						// Get default pixel format from window
-						pixel_format = win_pixel_format;
-					}
+			void muCOSA_event_push_cursor(muCOSA_EventQueue* queue, int32_m x, int32_m y) {
+				if (queue->events || queue->recording.file) {
+					muEvent* event = muCOSA_event_queue_push(queue, MU_EVENT_CURSOR);
+					event->data.cursor.x = x;
+					event->data.cursor.y = y;
+					event->data.cursor.dx = x - queue->cursor_x;
+					event->data.cursor.dy = y - queue->cursor_y;
+					queue->cursor_x = x;
+					queue->cursor_y = y;
+					muCOSA_recording_write_event(&queue->recording, event);
+					muCOSA_event_queue_commit(queue, event);
+				}
+			}
 
-					// Describe pixel format
-					PIXELFORMATDESCRIPTOR format_desc;
-					if (!DescribePixelFormat(dc, pixel_format, sizeof(format_desc), &format_desc)) {
-						return MUCOSA_WIN32_FAILED_DESCRIBE_WGL_PIXEL_FORMAT;
-					}
-					// Set pixel format @TODO Figure this out in window creation
-					if (!*set) {
-						if (!SetPixelFormat(dc, pixel_format, &format_desc)) {
-							return MUCOSA_WIN32_FAILED_SET_WGL_PIXEL_FORMAT;
-						}
-						*set = MU_TRUE;
+			void muCOSA_event_push_scroll(muCOSA_EventQueue* queue, int32_m add) {
+				if (queue->events || queue->recording.file) {
+					muEvent* event = muCOSA_event_queue_push(queue, MU_EVENT_SCROLL);
+					event->data.scroll = add;
+					muCOSA_recording_write_event(&queue->recording, event);
+					muCOSA_event_queue_commit(queue, event);
+				}
+			}
+
+			// Pushes a single null-terminated UTF-8 character
+			void muCOSA_event_push_text(muCOSA_EventQueue* queue, uint8_m* text) {
+				if (queue->events || queue->recording.file) {
+					muEvent* event = muCOSA_event_queue_push(queue, MU_EVENT_TEXT);
+					size_m i = 0;
+					for (; i < 4 && text[i]; ++i) {
+						event->data.text[i] = text[i];
 					}
+					event->data.text[i] = 0;
+					muCOSA_recording_write_event(&queue->recording, event);
+					muCOSA_event_queue_commit(queue, event);
+				}
+			}
 
-					// OpenGL version info
-					int opengl_attributes[] = {
-						MUCOSAWGL_CONTEXT_MAJOR_VERSION_ARB, 0,
-						MUCOSAWGL_CONTEXT_MINOR_VERSION_ARB, 0,
-						MUCOSAWGL_CONTEXT_PROFILE_MASK_ARB, MUCOSAWGL_CONTEXT_CORE_PROFILE_BIT_ARB,
-						0
-					};
+			void muCOSA_event_push_close(muCOSA_EventQueue* queue) {
+				if (queue->events || queue->recording.file) {
+					muEvent* event = muCOSA_event_queue_push(queue, MU_EVENT_CLOSE);
+					muCOSA_recording_write_event(&queue->recording, event);
+					muCOSA_event_queue_commit(queue, event);
+				}
+			}
 
-					// - Fill in OpenGL version info based on graphics API value
-					switch (api) {
-						default: return MUCOSA_FAILED_UNKNOWN_GRAPHICS_API; break;
-						case MU_OPENGL_1_0: {
-							opengl_attributes[1] = 1;
-							opengl_attributes[3] = 0;
-							opengl_attributes[4] = 0;
-						} break;
-						case MU_OPENGL_1_1: {
-							opengl_attributes[1] = 1;
-							opengl_attributes[3] = 1;
-							opengl_attributes[4] = 0;
-						} break;
-						case MU_OPENGL_1_2: {
-							opengl_attributes[1] = 1;
-							opengl_attributes[3] = 2;
-							opengl_attributes[4] = 0;
-						} break;
-						// Don't know what to do, setting to 1.3
-						case MU_OPENGL_1_2_1: {
-							opengl_attributes[1] = 1;
-							opengl_attributes[3] = 3;
-							opengl_attributes[4] = 0;
-						} break;
-						case MU_OPENGL_1_3: {
-							opengl_attributes[1] = 1;
-							opengl_attributes[3] = 3;
+			void muCOSA_event_push_raw_motion(muCOSA_EventQueue* queue, double dx, double dy) {
+				if (queue->events || queue->recording.file) {
+					muEvent* event = muCOSA_event_queue_push(queue, MU_EVENT_RAW_MOTION);
+					event->data.raw_motion.dx = dx;
+					event->data.raw_motion.dy = dy;
+					muCOSA_recording_write_event(&queue->recording, event);
+					muCOSA_event_queue_commit(queue, event);
+				}
+			}
+
+	/* Event time */
+
+	// Converts the millisecond timestamps given by window systems to times on
+	// a system clock, shared by every window system that needs it. The window
+	// system's clock is unknown (and wraps around every ~49 days), so its offset
+	// from the system clock is estimated as the smallest difference seen
+	// between when an event was received and its timestamp, as an event can't
+	// be received before it happens.
+
+		struct muCOSA_EventClock {
+			// If a timestamp has been converted yet
+			muBool init;
+			// Latest timestamp converted
+			uint32_m last;
+			// Latest timestamp converted, in seconds, without wrapping around
+			double seconds;
+			// Estimated offset from the timestamps to the system clock
+			double offset;
+		};
+		typedef struct muCOSA_EventClock muCOSA_EventClock;
+
+		// Converts a timestamp received at the given system time
+		double muCOSA_event_clock_convert(muCOSA_EventClock* clock, uint32_m ms, double now) {
+			if (!clock->init) {
+				clock->init = MU_TRUE;
+				clock->seconds = (double)ms / 1000.0;
+				clock->offset = now - clock->seconds;
+			} else {
+				// (Signed difference so that wrapping and slightly out-of-order
+				// timestamps are handled)
+				clock->seconds += (double)((int32_m)(ms - clock->last)) / 1000.0;
+			}
+			clock->last = ms;
+
+			// Keep smallest offset
+			double offset = now - clock->seconds;
+			if (offset < clock->offset) {
+				clock->offset = offset;
+			}
+			return clock->seconds + clock->offset;
+		}
+
+	/* Coalescing */
+
+	// Changes to a window's dimensions, position, and cursor position, shared by
+	// every window system. If the window coalesces them, only the latest of each
+	// is stored until the window is refreshed, or until other input is delivered
+	// (so that the order of input stays the same).
+
+		// Changes that can be pending
+		#define MUCOSA_COALESCE_DIMENSIONS 1
+		#define MUCOSA_COALESCE_POSITION 2
+		#define MUCOSA_COALESCE_CURSOR 4
+
+		struct muCOSA_Coalesce {
+			// If changes are coalesced
+			muBool enabled;
+			// Changes that haven't been delivered yet
+			uint8_m pending;
+			// Latest dimensions
+			uint32_m width;
+			uint32_m height;
+			// Latest position
+			int32_m x;
+			int32_m y;
+			// Latest cursor position
+			int32_m cursor_x;
+			int32_m cursor_y;
+			// Time of each latest change
+			double dimensions_time;
+			double position_time;
+			double cursor_time;
+		};
+		typedef struct muCOSA_Coalesce muCOSA_Coalesce;
+
+		void muCOSA_coalesce_init(muCOSA_Coalesce* coalesce, muBool enabled) {
+			mu_memset(coalesce, 0, sizeof(muCOSA_Coalesce));
+			coalesce->enabled = enabled;
+		}
+
+		/* Storing changes */
+
+		// Each of these stores a change (and the time it happened) if the window
+		// coalesces changes, returning if it did; otherwise, the change should be
+		// delivered immediately.
+
+			muBool muCOSA_coalesce_dimensions(muCOSA_Coalesce* coalesce, double time, uint32_m width, uint32_m height) {
+				if (!coalesce->enabled) {
+					return MU_FALSE;
+				}
+				coalesce->width = width;
+				coalesce->height = height;
+				coalesce->dimensions_time = time;
+				coalesce->pending |= MUCOSA_COALESCE_DIMENSIONS;
+				return MU_TRUE;
+			}
+
+			muBool muCOSA_coalesce_position(muCOSA_Coalesce* coalesce, double time, int32_m x, int32_m y) {
+				if (!coalesce->enabled) {
+					return MU_FALSE;
+				}
+				coalesce->x = x;
+				coalesce->y = y;
+				coalesce->position_time = time;
+				coalesce->pending |= MUCOSA_COALESCE_POSITION;
+				return MU_TRUE;
+			}
+
+			muBool muCOSA_coalesce_cursor(muCOSA_Coalesce* coalesce, double time, int32_m x, int32_m y) {
+				if (!coalesce->enabled) {
+					return MU_FALSE;
+				}
+				coalesce->cursor_x = x;
+				coalesce->cursor_y = y;
+				coalesce->cursor_time = time;
+				coalesce->pending |= MUCOSA_COALESCE_CURSOR;
+				return MU_TRUE;
+			}
+
+		/* Delivering changes */
+
+			// Delivers every pending change to the window's event queue + callbacks
+			void muCOSA_coalesce_flush(muCOSA_Coalesce* coalesce, muWindow win, muWindowCallbacks* callbacks, muCOSA_EventQueue* events) {
+				if (!coalesce->pending) {
+					return;
+				}
+				// (Cleared first in case a callback leads to another flush)
+				uint8_m pending = coalesce->pending;
+				coalesce->pending = 0;
+				// Each change is delivered with the time it happened; the time of
+				// the event being delivered is restored afterwards
+				double time = events->time;
+
+				// Dimensions
+				if (pending & MUCOSA_COALESCE_DIMENSIONS) {
+					events->time = coalesce->dimensions_time;
+					muCOSA_event_push_dimensions(events, coalesce->width, coalesce->height);
+					if (callbacks->dimensions) {
+						callbacks->dimensions(win, coalesce->width, coalesce->height);
+					}
+				}
+				// Position
+				if (pending & MUCOSA_COALESCE_POSITION) {
+					events->time = coalesce->position_time;
+					muCOSA_event_push_position(events, coalesce->x, coalesce->y);
+					if (callbacks->position) {
+						callbacks->position(win, coalesce->x, coalesce->y);
+					}
+				}
+				// Cursor position
+				if (pending & MUCOSA_COALESCE_CURSOR) {
+					events->time = coalesce->cursor_time;
+					muCOSA_event_push_cursor(events, coalesce->cursor_x, coalesce->cursor_y);
+					if (callbacks->cursor) {
+						callbacks->cursor(win, coalesce->cursor_x, coalesce->cursor_y);
+					}
+				}
+				events->time = time;
+			}
+
+	/* Window list */
+
+	// List of the windows in a context, shared by every window system; used to
+	// update every window at once, and by some window systems to find a window
+	// from its handle. Each element is a pointer to a window or 0; when a window
+	// is removed, its slot is set to 0, marking it for overwriting, which will be
+	// done if a new window needs to be added and there is an empty slot.
+
+		struct muCOSA_WindowList {
+			// Pointer to each window's memory
+			void** windows;
+			// Amount of windows
+			size_m wincount;
+			// Amount of window array memory allocated; unit is amount of windows
+			size_m winlen;
+		};
+		typedef struct muCOSA_WindowList muCOSA_WindowList;
+
+		// Adds a window to a window list
+		muCOSAResult muCOSA_window_list_add(muCOSA_WindowList* list, void* win) {
+			// Try and find an empty slot to fill
+			for (size_m s = 0; s < list->wincount; ++s) {
+				if (!list->windows[s]) {
+					list->windows[s] = win;
+					return MUCOSA_SUCCESS;
+				}
+			}
+
+			// Expand memory if needed
+			if (list->wincount >= list->winlen) {
+				// Double length (or start at 1)
+				size_m new_len = list->winlen ? list->winlen * 2 : 1;
+				void** new_windows = (void**)mu_realloc(list->windows, sizeof(void*) * new_len);
+				if (!new_windows) {
+					return list->windows ? MUCOSA_FAILED_REALLOC : MUCOSA_FAILED_MALLOC;
+				}
+				list->windows = new_windows;
+				list->winlen = new_len;
+			}
+
+			// Add window at the end
+			list->windows[list->wincount++] = win;
+			return MUCOSA_SUCCESS;
+		}
+
+		// Removes a window from a window list
+		void muCOSA_window_list_remove(muCOSA_WindowList* list, void* win) {
+			for (size_m p = 0; p < list->wincount; ++p) {
+				if (list->windows[p] == win) {
+					list->windows[p] = 0;
+					break;
+				}
+			}
+		}
+
+		// Frees a window list's memory
+		void muCOSA_window_list_term(muCOSA_WindowList* list) {
+			if (list->windows) {
+				mu_free(list->windows);
+			}
+		}
+
+	/* Window map */
+
+	// Hash table from the native handle of a window (the HWND on Win32, the
+	// Window on X11, and the wl_surface on Wayland) to the window, shared by
+	// every window system; used to find the window that a message or event is
+	// for. Windows are placed by linear probing, and removing a window shifts
+	// the windows after it back rather than leaving a marker behind, so finding
+	// a window costs the same no matter how many windows there are or have been.
+	// The table doubles once it's half full, halves once it's an eighth full,
+	// and is freed once it's empty. Finding a window locks it for reading, so
+	// several threads can do so at once; adding and removing windows locks it
+	// for writing.
+
+		// A slot in a window map; empty if win is 0
+		struct muCOSA_WindowMapSlot {
+			uint64_m handle;
+			void* win;
+		};
+		typedef struct muCOSA_WindowMapSlot muCOSA_WindowMapSlot;
+
+		struct muCOSA_WindowMap {
+			// Slots (0 if there are no windows)
+			muCOSA_WindowMapSlot* slots;
+			// Amount of windows
+			size_m count;
+			// Amount of slots (0 or a power of 2)
+			size_m capacity;
+			muCOSA_RWLock lock;
+		};
+		typedef struct muCOSA_WindowMap muCOSA_WindowMap;
+
+		// Static initializer of a window map
+		#define MUCOSA_WINDOW_MAP_INIT { 0, 0, 0, MUCOSA_RWLOCK_INIT }
+
+		// Smallest amount of slots allocated
+		#define MUCOSA_WINDOW_MAP_MIN 8
+
+		// Initiates a window map that wasn't initialized statically
+		void muCOSA_window_map_init(muCOSA_WindowMap* map) {
+			map->slots = 0;
+			map->count = 0;
+			map->capacity = 0;
+			muCOSA_rwlock_init(&map->lock);
+		}
+
+		void muCOSA_window_map_term(muCOSA_WindowMap* map) {
+			if (map->slots) {
+				mu_free(map->slots);
+			}
+			map->slots = 0;
+			map->count = 0;
+			map->capacity = 0;
+			muCOSA_rwlock_term(&map->lock);
+		}
+
+		// Slot that a handle is placed at if it isn't taken
+		size_m muCOSA_window_map_home(size_m capacity, uint64_m handle) {
+			// Multiply by 2^64 divided by the golden ratio + fold the high bits
+			// down, since handles are often sequential or aligned
+			uint64_m hash = handle * 0x9E3779B97F4A7C15ULL;
+			return (size_m)(hash ^ (hash >> 32)) & (capacity - 1);
+		}
+
+		// Places a window in the first free slot from its home (or replaces
+		// the window with the same handle); returns if a slot was taken
+		muBool muCOSA_window_map_place(muCOSA_WindowMapSlot* slots, size_m capacity, uint64_m handle, void* win) {
+			size_m s = muCOSA_window_map_home(capacity, handle);
+			while (slots[s].win) {
+				if (slots[s].handle == handle) {
+					slots[s].win = win;
+					return MU_FALSE;
+				}
+				s = (s + 1) & (capacity - 1);
+			}
+			slots[s].handle = handle;
+			slots[s].win = win;
+			return MU_TRUE;
+		}
+
+		// Moves every window to a new amount of slots; returns if successful
+		muBool muCOSA_window_map_resize(muCOSA_WindowMap* map, size_m capacity) {
+			muCOSA_WindowMapSlot* slots = 0;
+			if (capacity) {
+				// Allocate empty slots
+				slots = (muCOSA_WindowMapSlot*)mu_malloc(sizeof(muCOSA_WindowMapSlot) * capacity);
+				if (!slots) {
+					return MU_FALSE;
+				}
+				mu_memset(slots, 0, sizeof(muCOSA_WindowMapSlot) * capacity);
+
+				// Place every window in them
+				for (size_m s = 0; s < map->capacity; ++s) {
+					if (map->slots[s].win) {
+						muCOSA_window_map_place(slots, capacity, map->slots[s].handle, map->slots[s].win);
+					}
+				}
+			}
+
+			if (map->slots) {
+				mu_free(map->slots);
+			}
+			map->slots = slots;
+			map->capacity = capacity;
+			return MU_TRUE;
+		}
+
+		// Adds a window to a window map
+		muCOSAResult muCOSA_window_map_add(muCOSA_WindowMap* map, uint64_m handle, void* win) {
+			muCOSA_rwlock_write(&map->lock);
+
+			// Double the amount of slots if this would fill over half of them
+			if ((map->count + 1) * 2 > map->capacity) {
+				size_m capacity = map->capacity ? map->capacity * 2 : MUCOSA_WINDOW_MAP_MIN;
+				if (!muCOSA_window_map_resize(map, capacity)) {
+					muCOSA_rwlock_write_unlock(&map->lock);
+					return MUCOSA_FAILED_MALLOC;
+				}
+			}
+
+			if (muCOSA_window_map_place(map->slots, map->capacity, handle, win)) {
+				++map->count;
+			}
+
+			muCOSA_rwlock_write_unlock(&map->lock);
+			return MUCOSA_SUCCESS;
+		}
+
+		// Removes a window from a window map by its handle
+		void muCOSA_window_map_remove(muCOSA_WindowMap* map, uint64_m handle) {
+			muCOSA_rwlock_write(&map->lock);
+			if (!map->slots) {
+				muCOSA_rwlock_write_unlock(&map->lock);
+				return;
+			}
+
+			// Find the window's slot
+			size_m mask = map->capacity - 1;
+			size_m gap = muCOSA_window_map_home(map->capacity, handle);
+			while (map->slots[gap].win && map->slots[gap].handle != handle) {
+				gap = (gap + 1) & mask;
+			}
+			if (!map->slots[gap].win) {
+				muCOSA_rwlock_write_unlock(&map->lock);
+				return;
+			}
+
+			// Move each window after it back into the gap, unless its home is
+			// between the gap and where it is (in which case moving it would
+			// put it before its home, making it impossible to find)
+			for (size_m s = (gap + 1) & mask; map->slots[s].win; s = (s + 1) & mask) {
+				size_m home = muCOSA_window_map_home(map->capacity, map->slots[s].handle);
+				muBool stays = (gap <= s) ? (gap < home && home <= s) : (gap < home || home <= s);
+				if (!stays) {
+					map->slots[gap] = map->slots[s];
+					gap = s;
+				}
+			}
+			map->slots[gap].handle = 0;
+			map->slots[gap].win = 0;
+			--map->count;
+
+			// Free the slots once empty, or halve them once an eighth full
+			// (if that fails, the slots are simply kept)
+			if (map->count == 0) {
+				muCOSA_window_map_resize(map, 0);
+			} else if (map->capacity > MUCOSA_WINDOW_MAP_MIN && map->count * 8 <= map->capacity) {
+				muCOSA_window_map_resize(map, map->capacity / 2);
+			}
+
+			muCOSA_rwlock_write_unlock(&map->lock);
+		}
+
+		// Finds a window in a window map by its handle (0 if it isn't in it)
+		void* muCOSA_window_map_find(muCOSA_WindowMap* map, uint64_m handle) {
+			muCOSA_rwlock_read(&map->lock);
+
+			void* win = 0;
+			if (map->slots) {
+				// (There's always an empty slot to stop at, as the map is never
+				// over half full)
+				size_m s = muCOSA_window_map_home(map->capacity, handle);
+				while (map->slots[s].win) {
+					if (map->slots[s].handle == handle) {
+						win = map->slots[s].win;
+						break;
+					}
+					s = (s + 1) & (map->capacity - 1);
+				}
+			}
+
+			muCOSA_rwlock_read_unlock(&map->lock);
+			return win;
+		}
+
+	/* Vulkan */
+
+	// Vulkan surface creation shared by every window system. Only the core
+	// Vulkan header is needed: each window system's create-info struct is
+	// defined by muCOSA, and its surface creation function is loaded through
+	// vkGetInstanceProcAddr, so the user doesn't need to define any of the
+	// VK_USE_PLATFORM_... macros.
+
+	#ifdef MU_SUPPORT_VULKAN
+
+		#ifndef MUCOSA_NO_INCLUDE_VULKAN
+			#include <vulkan/vulkan.h>
+		#endif
+
+		// Structure types of each window system's surface create-info struct
+		#define MUCOSAVK_STRUCTURE_TYPE_XLIB_SURFACE_CREATE_INFO_KHR    1000004000
+		#define MUCOSAVK_STRUCTURE_TYPE_WAYLAND_SURFACE_CREATE_INFO_KHR 1000006000
+		#define MUCOSAVK_STRUCTURE_TYPE_WIN32_SURFACE_CREATE_INFO_KHR   1000009000
+
+		// Signature shared by every vkCreate...SurfaceKHR function
+		typedef VkResult (VKAPI_PTR *muCOSAVK_CreateSurface)(VkInstance instance, const void* create_info, const VkAllocationCallbacks* allocator, VkSurfaceKHR* surface);
+
+		// Loads a surface creation function by name and calls it with the given create info
+		muCOSAResult muCOSAVK_create_surface(const char* name, void* instance, const void* create_info, void* allocator, void* surface) {
+			// Load function
+			muCOSAVK_CreateSurface create = (muCOSAVK_CreateSurface)vkGetInstanceProcAddr((VkInstance)instance, name);
+			if (!create) {
+				return MUCOSA_FAILED_FIND_VULKAN_FUNCTION;
+			}
+
+			// Create surface
+			if (create((VkInstance)instance, create_info, (const VkAllocationCallbacks*)allocator, (VkSurfaceKHR*)surface) != VK_SUCCESS) {
+				return MUCOSA_FAILED_CREATE_VULKAN_SURFACE;
+			}
+			return MUCOSA_SUCCESS;
+		}
+
+	#endif /* MU_SUPPORT_VULKAN */
+
+	/* Win32 */
+
+	#ifdef MUCOSA_WIN32
+
+		// For all of the stuff that can't be included directly (CURSE YOU BILL)
+		#include <windows.h>
+
+		/* Useful functions */
+
+			// Hinstance retriever (thank you Raymond Chen)
+			EXTERN_C IMAGE_DOS_HEADER __ImageBase;
+			HINSTANCE muCOSAW32_get_hinstance(void) {
+				return ((HINSTANCE)&__ImageBase);
+			}
+
+			// UTF-8 -> wchar_t (UTF-16)
+			wchar_t* muCOSAW32_utf8_to_wchar(char* str) {
+				// Get length needed for conversion
+				// Note: we can use -1 here, since it's expected for it to be null-terminated
+				int len = MultiByteToWideChar(CP_UTF8, 0, str, -1, NULL, 0);
+				if (len == 0) {
+					return 0;
+				}
+
+				// Allocate data
+				wchar_t* wstr = (wchar_t*)mu_malloc(len * sizeof(wchar_t));
+				if (wstr == 0) {
+					return 0;
+				}
+
+				// Perform conversion
+				if (MultiByteToWideChar(CP_UTF8, 0, str, -1, (LPWSTR)wstr, len) == 0) {
+					mu_free(wstr);
+					return 0;
+				}
+
+				// Return converted data
+				return wstr;
+			}
+
+			// wchar_t (UTF-16) -> UTF-8
+			uint8_m* muCOSAW32_wchar_to_utf8(wchar_t* wstr) {
+				// Get length needed
+				int len = WideCharToMultiByte(CP_UTF8, 0, wstr, -1, NULL, 0, NULL, NULL);
+				if (!len) {
+					return 0;
+				}
+
+				// Allocate data needed for conversion
+				uint8_m* str = (uint8_m*)mu_malloc(len);
+				if (!str) {
+					return 0;
+				}
+
+				// Perform conversion
+				if (!WideCharToMultiByte(CP_UTF8, 0, wstr, -1, (LPSTR)str, len, NULL, NULL)) {
+					mu_free(str);
+					return 0;
+				}
+
+				return str;
+			}
+
+			// Win32 virtual key code to muCOSA key code
+			muKeyboardKey muCOSAW32_VK_to_muCOSA(WPARAM vk) {
+				switch (vk) {
+					default: return MU_KEYBOARD_UNKNOWN; break;
+					case VK_BACK: return MU_KEYBOARD_BACKSPACE; break;
+					case VK_TAB: return MU_KEYBOARD_TAB; break;
+					case VK_CLEAR: return MU_KEYBOARD_CLEAR; break;
+					case VK_RETURN: return MU_KEYBOARD_RETURN; break;
+					case VK_PAUSE: return MU_KEYBOARD_PAUSE; break;
+					case VK_ESCAPE: return MU_KEYBOARD_ESCAPE; break;
+					case VK_MODECHANGE: return MU_KEYBOARD_MODECHANGE; break;
+					case VK_SPACE: return MU_KEYBOARD_SPACE; break;
+					case VK_PRIOR: return MU_KEYBOARD_PRIOR; break;
+					case VK_NEXT: return MU_KEYBOARD_NEXT; break;
+					case VK_END: return MU_KEYBOARD_END; break;
+					case VK_HOME: return MU_KEYBOARD_HOME; break;
+					case VK_LEFT: return MU_KEYBOARD_LEFT; break;
+					case VK_UP: return MU_KEYBOARD_UP; break;
+					case VK_RIGHT: return MU_KEYBOARD_RIGHT; break;
+					case VK_DOWN: return MU_KEYBOARD_DOWN; break;
+					case VK_SELECT: return MU_KEYBOARD_SELECT; break;
+					case VK_PRINT: return MU_KEYBOARD_PRINT; break;
+					case VK_EXECUTE: return MU_KEYBOARD_EXECUTE; break;
+					case VK_INSERT: return MU_KEYBOARD_INSERT; break;
+					case VK_DELETE: return MU_KEYBOARD_DELETE; break;
+					case VK_HELP: return MU_KEYBOARD_HELP; break;
+					case 0x30: return MU_KEYBOARD_0; break;
+					case 0x31: return MU_KEYBOARD_1; break;
+					case 0x32: return MU_KEYBOARD_2; break;
+					case 0x33: return MU_KEYBOARD_3; break;
+					case 0x34: return MU_KEYBOARD_4; break;
+					case 0x35: return MU_KEYBOARD_5; break;
+					case 0x36: return MU_KEYBOARD_6; break;
+					case 0x37: return MU_KEYBOARD_7; break;
+					case 0x38: return MU_KEYBOARD_8; break;
+					case 0x39: return MU_KEYBOARD_9; break;
+					case 0x41: return MU_KEYBOARD_A; break;
+					case 0x42: return MU_KEYBOARD_B; break;
+					case 0x43: return MU_KEYBOARD_C; break;
+					case 0x44: return MU_KEYBOARD_D; break;
+					case 0x45: return MU_KEYBOARD_E; break;
+					case 0x46: return MU_KEYBOARD_F; break;
+					case 0x47: return MU_KEYBOARD_G; break;
+					case 0x48: return MU_KEYBOARD_H; break;
+					case 0x49: return MU_KEYBOARD_I; break;
+					case 0x4A: return MU_KEYBOARD_J; break;
+					case 0x4B: return MU_KEYBOARD_K; break;
+					case 0x4C: return MU_KEYBOARD_L; break;
+					case 0x4D: return MU_KEYBOARD_M; break;
+					case 0x4E: return MU_KEYBOARD_N; break;
+					case 0x4F: return MU_KEYBOARD_O; break;
+					case 0x50: return MU_KEYBOARD_P; break;
+					case 0x51: return MU_KEYBOARD_Q; break;
+					case 0x52: return MU_KEYBOARD_R; break;
+					case 0x53: return MU_KEYBOARD_S; break;
+					case 0x54: return MU_KEYBOARD_T; break;
+					case 0x55: return MU_KEYBOARD_U; break;
+					case 0x56: return MU_KEYBOARD_V; break;
+					case 0x57: return MU_KEYBOARD_W; break;
+					case 0x58: return MU_KEYBOARD_X; break;
+					case 0x59: return MU_KEYBOARD_Y; break;
+					case 0x5A: return MU_KEYBOARD_Z; break;
+					case VK_LWIN: return MU_KEYBOARD_LEFT_WINDOWS; break;
+					case VK_RWIN: return MU_KEYBOARD_RIGHT_WINDOWS; break;
+					case VK_NUMPAD0: return MU_KEYBOARD_NUMPAD_0; break;
+					case VK_NUMPAD1: return MU_KEYBOARD_NUMPAD_1; break;
+					case VK_NUMPAD2: return MU_KEYBOARD_NUMPAD_2; break;
+					case VK_NUMPAD3: return MU_KEYBOARD_NUMPAD_3; break;
+					case VK_NUMPAD4: return MU_KEYBOARD_NUMPAD_4; break;
+					case VK_NUMPAD5: return MU_KEYBOARD_NUMPAD_5; break;
+					case VK_NUMPAD6: return MU_KEYBOARD_NUMPAD_6; break;
+					case VK_NUMPAD7: return MU_KEYBOARD_NUMPAD_7; break;
+					case VK_NUMPAD8: return MU_KEYBOARD_NUMPAD_8; break;
+					case VK_NUMPAD9: return MU_KEYBOARD_NUMPAD_9; break;
+					case VK_MULTIPLY: return MU_KEYBOARD_MULTIPLY; break;
+					case VK_ADD: return MU_KEYBOARD_ADD; break;
+					case VK_SEPARATOR: return MU_KEYBOARD_SEPARATOR; break;
+					case VK_SUBTRACT: return MU_KEYBOARD_SUBTRACT; break;
+					case VK_DECIMAL: return MU_KEYBOARD_DECIMAL; break;
+					case VK_DIVIDE: return MU_KEYBOARD_DIVIDE; break;
+					case VK_F1: return MU_KEYBOARD_F1; break;
+					case VK_F2: return MU_KEYBOARD_F2; break;
+					case VK_F3: return MU_KEYBOARD_F3; break;
+					case VK_F4: return MU_KEYBOARD_F4; break;
+					case VK_F5: return MU_KEYBOARD_F5; break;
+					case VK_F6: return MU_KEYBOARD_F6; break;
+					case VK_F7: return MU_KEYBOARD_F7; break;
+					case VK_F8: return MU_KEYBOARD_F8; break;
+					case VK_F9: return MU_KEYBOARD_F9; break;
+					case VK_F10: return MU_KEYBOARD_F10; break;
+					case VK_F11: return MU_KEYBOARD_F11; break;
+					case VK_F12: return MU_KEYBOARD_F12; break;
+					case VK_F13: return MU_KEYBOARD_F13; break;
+					case VK_F14: return MU_KEYBOARD_F14; break;
+					case VK_F15: return MU_KEYBOARD_F15; break;
+					case VK_F16: return MU_KEYBOARD_F16; break;
+					case VK_F17: return MU_KEYBOARD_F17; break;
+					case VK_F18: return MU_KEYBOARD_F18; break;
+					case VK_F19: return MU_KEYBOARD_F19; break;
+					case VK_F20: return MU_KEYBOARD_F20; break;
+					case VK_F21: return MU_KEYBOARD_F21; break;
+					case VK_F22: return MU_KEYBOARD_F22; break;
+					case VK_F23: return MU_KEYBOARD_F23; break;
+					case VK_F24: return MU_KEYBOARD_F24; break;
+					case VK_NUMLOCK: return MU_KEYBOARD_NUMLOCK; break;
+					case VK_SCROLL: return MU_KEYBOARD_SCROLL; break;
+					case VK_LSHIFT: return MU_KEYBOARD_LEFT_SHIFT; break;
+					case VK_RSHIFT: return MU_KEYBOARD_RIGHT_SHIFT; break;
+					case VK_LCONTROL: return MU_KEYBOARD_LEFT_CONTROL; break;
+					case VK_RCONTROL: return MU_KEYBOARD_RIGHT_CONTROL; break;
+					case VK_LMENU: return MU_KEYBOARD_LEFT_MENU; break;
+					case VK_RMENU: return MU_KEYBOARD_RIGHT_MENU; break;
+					case VK_ATTN: return MU_KEYBOARD_ATTN; break;
+					case VK_CRSEL: return MU_KEYBOARD_CRSEL; break;
+					case VK_EXSEL: return MU_KEYBOARD_EXSEL; break;
+					case VK_EREOF: return MU_KEYBOARD_EREOF; break;
+					case VK_PLAY: return MU_KEYBOARD_PLAY; break;
+					case VK_PA1: return MU_KEYBOARD_PA1; break;
+				}
+			}
+
+			// muCOSA cursor style to Win32 cursor
+			void* muCOSAW32_muCOSA_cursor_to_W32(muCursorStyle style) {
+				switch (style) {
+					default: return IDC_ARROW; break;
+					case MU_CURSOR_ARROW: return IDC_ARROW; break;
+					case MU_CURSOR_IBEAM: return IDC_IBEAM; break;
+					case MU_CURSOR_WAIT: return IDC_WAIT; break;
+					case MU_CURSOR_WAIT_ARROW: return IDC_APPSTARTING; break;
+					case MU_CURSOR_CROSSHAIR: return IDC_CROSS; break;
+					case MU_CURSOR_HAND: return IDC_HAND; break;
+					case MU_CURSOR_SIZE_LR: return IDC_SIZEWE; break;
+					case MU_CURSOR_SIZE_TB: return IDC_SIZENS; break;
+					case MU_CURSOR_SIZE_TL_BR: return IDC_SIZENWSE; break;
+					case MU_CURSOR_SIZE_TR_BL: return IDC_SIZENESW; break;
+					case MU_CURSOR_SIZE_ALL: return IDC_SIZEALL; break;
+					case MU_CURSOR_NO: return IDC_NO; break;
+				}
+			}
+
+			// muCOSA keystate to Win32
+			int muCOSAW32_keystate_to_W32(muKeyboardState state) {
+				switch (state) {
+					default: return VK_NONAME; break;
+					case MU_KEYSTATE_CAPS_LOCK: return VK_CAPITAL; break;
+					case MU_KEYSTATE_SCROLL_LOCK: return VK_SCROLL; break;
+					case MU_KEYSTATE_NUM_LOCK: return VK_NUMLOCK; break;
+				}
+			}
+
+		/* OpenGL */
+
+		#ifdef MU_SUPPORT_OPENGL
+
+			/* Inclusion and common definition */
+
+				// Common OpenGL definitions
+				#ifndef MUCOSA_NO_INCLUDE_OPENGL
+					// Only include if "glClearColor" isn't defined; this is to avoid
+					// accidental double definition in many circumstances.
+					#ifndef glClearColor
+						#include <gl/gl.h>
+						#include <gl/glu.h>
+					#endif
+				#endif
+
+				// Device context -> valid OpenGL context
+				#include <wingdi.h>
+
+				// Typedefs for functions we need
+				// - wglCreateContextAttribs; needed for specifying exact version when creating context
+				typedef HGLRC WINAPI muCOSAW32_wglCreateContextAttribsARB_type(HDC hdc, HGLRC hShareContext, const int* attribList);
+				// - wglChoosePixelFormat; needed for choosing a more thorough pixel format when creating context
+				typedef BOOL WINAPI muCOSAW32_wglChoosePixelFormatARB_type(HDC hdc, const int* piAttribIList, const FLOAT* pfAttribFList, UINT uMaxFormats, int* piFormats, UINT* nNumFormats);
+				// - wglSwapInterval; not needed in context creation, but used for swap interval later
+				typedef BOOL WINAPI muCOSAW32_wglSwapIntervalEXT_type(int interval);
+
+				// Struct to hold WGL functions needed for context creation
+				struct muCOSAW32_WGL {
+					muCOSAW32_wglCreateContextAttribsARB_type* CreateContextAttribs;
+					muCOSAW32_wglChoosePixelFormatARB_type* ChoosePixelFormat;
+					muCOSAW32_wglSwapIntervalEXT_type* SwapInterval;
+				};
+				typedef struct muCOSAW32_WGL muCOSAW32_WGL;
+
+			/* WGL tokens */
+
+				// https://registry.khronos.org/OpenGL/extensions/ARB/WGL_ARB_create_context.txt
+
+				#define MUCOSAWGL_CONTEXT_MAJOR_VERSION_ARB             0x2091
+				#define MUCOSAWGL_CONTEXT_MINOR_VERSION_ARB             0x2092
+				#define MUCOSAWGL_CONTEXT_LAYER_PLANE_ARB               0x2093
+				#define MUCOSAWGL_CONTEXT_FLAGS_ARB                     0x2094
+				#define MUCOSAWGL_CONTEXT_PROFILE_MASK_ARB              0x9126
+
+				#define MUCOSAWGL_CONTEXT_DEBUG_BIT_ARB                 0x0001
+				#define MUCOSAWGL_CONTEXT_FORWARD_COMPATIBLE_BIT_ARB    0x0002
+
+				#define MUCOSAWGL_CONTEXT_CORE_PROFILE_BIT_ARB          0x00000001
+				#define MUCOSAWGL_CONTEXT_COMPATIBILITY_PROFILE_BIT_ARB 0x00000002
+
+				#define MUCOSAWGL_ERROR_INVALID_VERSION_ARB                 0x2095
+				#define MUCOSAWGL_ERROR_INVALID_PROFILE_ARB                 0x2096
+
+				// https://registry.khronos.org/OpenGL/extensions/ARB/WGL_ARB_pixel_format.txt
+
+				#define MUCOSAWGL_NUMBER_PIXEL_FORMATS_ARB    0x2000
+				#define MUCOSAWGL_DRAW_TO_WINDOW_ARB          0x2001
+				#define MUCOSAWGL_DRAW_TO_BITMAP_ARB          0x2002
+				#define MUCOSAWGL_ACCELERATION_ARB            0x2003
+				#define MUCOSAWGL_NEED_PALETTE_ARB            0x2004
+				#define MUCOSAWGL_NEED_SYSTEM_PALETTE_ARB     0x2005
+				#define MUCOSAWGL_SWAP_LAYER_BUFFERS_ARB      0x2006
+				#define MUCOSAWGL_SWAP_METHOD_ARB             0x2007
+				#define MUCOSAWGL_NUMBER_OVERLAYS_ARB         0x2008
+				#define MUCOSAWGL_NUMBER_UNDERLAYS_ARB        0x2009
+				#define MUCOSAWGL_TRANSPARENT_ARB             0x200A
+				#define MUCOSAWGL_TRANSPARENT_RED_VALUE_ARB   0x2037
+				#define MUCOSAWGL_TRANSPARENT_GREEN_VALUE_ARB 0x2038
+				#define MUCOSAWGL_TRANSPARENT_BLUE_VALUE_ARB  0x2039
+				#define MUCOSAWGL_TRANSPARENT_ALPHA_VALUE_ARB 0x203A
+				#define MUCOSAWGL_TRANSPARENT_INDEX_VALUE_ARB 0x203B
+				#define MUCOSAWGL_SHARE_DEPTH_ARB             0x200C
+				#define MUCOSAWGL_SHARE_STENCIL_ARB           0x200D
+				#define MUCOSAWGL_SHARE_ACCUM_ARB             0x200E
+				#define MUCOSAWGL_SUPPORT_GDI_ARB             0x200F
+				#define MUCOSAWGL_SUPPORT_OPENGL_ARB          0x2010
+				#define MUCOSAWGL_DOUBLE_BUFFER_ARB           0x2011
+				#define MUCOSAWGL_STEREO_ARB                  0x2012
+				#define MUCOSAWGL_PIXEL_TYPE_ARB              0x2013
+				#define MUCOSAWGL_COLOR_BITS_ARB              0x2014
+				#define MUCOSAWGL_RED_BITS_ARB                0x2015
+				#define MUCOSAWGL_RED_SHIFT_ARB               0x2016
+				#define MUCOSAWGL_GREEN_BITS_ARB              0x2017
+				#define MUCOSAWGL_GREEN_SHIFT_ARB             0x2018
+				#define MUCOSAWGL_BLUE_BITS_ARB               0x2019
+				#define MUCOSAWGL_BLUE_SHIFT_ARB              0x201A
+				#define MUCOSAWGL_ALPHA_BITS_ARB              0x201B
+				#define MUCOSAWGL_ALPHA_SHIFT_ARB             0x201C
+				#define MUCOSAWGL_ACCUM_BITS_ARB              0x201D
+				#define MUCOSAWGL_ACCUM_RED_BITS_ARB          0x201E
+				#define MUCOSAWGL_ACCUM_GREEN_BITS_ARB        0x201F
+				#define MUCOSAWGL_ACCUM_BLUE_BITS_ARB         0x2020
+				#define MUCOSAWGL_ACCUM_ALPHA_BITS_ARB        0x2021
+				#define MUCOSAWGL_DEPTH_BITS_ARB              0x2022
+				#define MUCOSAWGL_STENCIL_BITS_ARB            0x2023
+				#define MUCOSAWGL_AUX_BUFFERS_ARB             0x2024
+
+				#define MUCOSAWGL_NO_ACCELERATION_ARB         0x2025
+				#define MUCOSAWGL_GENERIC_ACCELERATION_ARB    0x2026
+				#define MUCOSAWGL_FULL_ACCELERATION_ARB       0x2027
+
+				#define MUCOSAWGL_SWAP_EXCHANGE_ARB           0x2028
+				#define MUCOSAWGL_SWAP_COPY_ARB               0x2029
+				#define MUCOSAWGL_SWAP_UNDEFINED_ARB          0x202A
+
+				#define MUCOSAWGL_TYPE_RGBA_ARB               0x202B
+				#define MUCOSAWGL_TYPE_COLORINDEX_ARB         0x202C
+
+				// https://nehe.gamedev.net/tutorial/fullscreen_antialiasing/16008/
+
+				#define MUCOSAWGL_SAMPLE_BUFFERS_ARB  0x2041
+				#define MUCOSAWGL_SAMPLES_ARB     0x2042
+
+			/* Functions */
+
+				// Retrieves OpenGL extensions needed for context creation
+				muCOSAResult muCOSAW32_get_opengl_extensions(muCOSAW32_WGL* wgl) {
+					// Create temp window class
+					WNDCLASSA wclass = MU_ZERO_STRUCT(WNDCLASSA);
+					wclass.style = CS_HREDRAW | CS_VREDRAW | CS_OWNDC;
+					wclass.lpfnWndProc = DefWindowProcA;
+					wclass.hInstance = muCOSAW32_get_hinstance();
+					wclass.lpszClassName = "Dummy WGL window class";
+					if (!RegisterClassA(&wclass)) {
+						return MUCOSA_WIN32_FAILED_REGISTER_DUMMY_WGL_WINDOW_CLASS;
+					}
+
+					// Create temp window
+					HWND win = CreateWindowExA(
+						0, wclass.lpszClassName, "Dummy WGL window", 0,
+						CW_USEDEFAULT, CW_USEDEFAULT, CW_USEDEFAULT, CW_USEDEFAULT, 0, 0,
+						wclass.hInstance, 0
+					);
+					if (win == NULL) {
+						UnregisterClassA(wclass.lpszClassName, wclass.hInstance);
+						return MUCOSA_WIN32_FAILED_CREATE_DUMMY_WGL_WINDOW;
+					}
+
+					// Get device context from this window
+					HDC dc = GetDC(win);
+
+					// Use pixel format number 1
+					// This is a HACK and a half, but works
+					int pixel_format = 1;
+					PIXELFORMATDESCRIPTOR format_desc;
+					if (!DescribePixelFormat(dc, pixel_format, sizeof(format_desc), &format_desc)) {
+						ReleaseDC(win, dc);
+						DestroyWindow(win);
+						UnregisterClassA(wclass.lpszClassName, wclass.hInstance);
+						return MUCOSA_WIN32_FAILED_DESCRIBE_DUMMY_WGL_PIXEL_FORMAT;
+					}
+
+					// Set pixel format. This doesn't make much sense, this is already definitionally
+					// the pixel format of the device, but it doesn't work if I don't do this, so, :L
+					// Note: this might not be okay, and we may need to specify SOME pixel format,
+					// but I don't know.
+					if (!SetPixelFormat(dc, pixel_format, &format_desc)) {
+						ReleaseDC(win, dc);
+						DestroyWindow(win);
+						UnregisterClassA(wclass.lpszClassName, wclass.hInstance);
+						return MUCOSA_WIN32_FAILED_SET_DUMMY_WGL_PIXEL_FORMAT;
+					}
+
+					// Create dummy context
+					HGLRC context = wglCreateContext(dc);
+					if (!context) {
+						ReleaseDC(win, dc);
+						DestroyWindow(win);
+						UnregisterClassA(wclass.lpszClassName, wclass.hInstance);
+						return MUCOSA_WIN32_FAILED_CREATE_DUMMY_WGL_CONTEXT;
+					}
+					// Bind dummy context
+					if (!wglMakeCurrent(dc, context)) {
+						wglDeleteContext(context);
+						ReleaseDC(win, dc);
+						DestroyWindow(win);
+						UnregisterClassA(wclass.lpszClassName, wclass.hInstance);
+						return MUCOSA_WIN32_FAILED_BIND_DUMMY_WGL_CONTEXT;
+					}
+
+					// Find necessary functions
+					PROC wglCreateContextAttribsARB_proc = wglGetProcAddress("wglCreateContextAttribsARB");
+					PROC wglChoosePixelFormatARB_proc    = wglGetProcAddress("wglChoosePixelFormatARB");
+					// Find helpful functions
+					PROC wglSwapIntervalEXT_proc         = wglGetProcAddress("wglSwapIntervalEXT");
+
+					// Destroy resources
+					wglMakeCurrent(dc, 0);
+					wglDeleteContext(context);
+					ReleaseDC(win, dc);
+					DestroyWindow(win);
+					UnregisterClassA(wclass.lpszClassName, wclass.hInstance);
+
+					// Detect if any required functions went unfound
+					if (!wglCreateContextAttribsARB_proc) {
+						return MUCOSA_WIN32_FAILED_FIND_WGL_CREATE_CONTEXT_ATTRIBS;
+					}
+					if (!wglChoosePixelFormatARB_proc) {
+						return MUCOSA_WIN32_FAILED_FIND_WGL_CHOOSE_PIXEL_FORMAT;
+					}
+
+					// Copy over functions
+					mu_memcpy(&wgl->CreateContextAttribs, &wglCreateContextAttribsARB_proc, sizeof(PROC));
+					mu_memcpy(&wgl->ChoosePixelFormat,    &wglChoosePixelFormatARB_proc,    sizeof(PROC));
+					mu_memcpy(&wgl->SwapInterval,         &wglSwapIntervalEXT_proc,         sizeof(PROC));
+					return MUCOSA_SUCCESS;
+				}
+
+				// Creates an OpenGL context
+				muCOSAResult muCOSAW32_create_opengl_context(HDC dc, int win_pixel_format, muCOSAW32_WGL* wgl, muPixelFormat* format, HGLRC* context, muGraphicsAPI api, muBool* set) {
+					muCOSAResult res = MUCOSA_SUCCESS;
+					// Choose pixel format
+					int pixel_format;
+
+					// - If a pixel format is supplied by the user:
+					if (format) {
+						// Set up an attribute field based on pixel format
+						int pixel_format_attributes[] = {
+							MUCOSAWGL_DRAW_TO_WINDOW_ARB, MU_TRUE,
+							MUCOSAWGL_SUPPORT_OPENGL_ARB, MU_TRUE,
+							MUCOSAWGL_DOUBLE_BUFFER_ARB,  MU_TRUE,
+							MUCOSAWGL_SAMPLE_BUFFERS_ARB, MU_TRUE, // (?)
+							MUCOSAWGL_ACCELERATION_ARB,   MUCOSAWGL_FULL_ACCELERATION_ARB, // (?)
+							MUCOSAWGL_PIXEL_TYPE_ARB,     MUCOSAWGL_TYPE_RGBA_ARB, // (?)
+							MUCOSAWGL_RED_BITS_ARB,       format->red_bits,
+							MUCOSAWGL_GREEN_BITS_ARB,     format->green_bits,
+							MUCOSAWGL_BLUE_BITS_ARB,      format->blue_bits,
+							MUCOSAWGL_ALPHA_BITS_ARB,     format->alpha_bits,
+							MUCOSAWGL_DEPTH_BITS_ARB,     format->depth_bits,
+							MUCOSAWGL_STENCIL_BITS_ARB,   format->stencil_bits,
+							MUCOSAWGL_SAMPLES_ARB,        format->samples,
+							0
+						};
+						// Find corresponding format using WGL
+						UINT format_count = 0;
+						// - Does the return value of this indicate error? Can't find documentation
+						wgl->ChoosePixelFormat(dc, pixel_format_attributes, 0, 1, &pixel_format, &format_count);
+						if (!format_count) {
+							res = MUCOSA_WIN32_FAILED_CHOOSE_WGL_PIXEL_FORMAT;
+						}
+					}
+
+					// - If a pixel format isn't supplied by the user (or it failed)
+					if ((!format) || (res != MUCOSA_SUCCESS)) {
+						// Get default pixel format from window
+						pixel_format = win_pixel_format;
+					}
+
+					// Describe pixel format
+					PIXELFORMATDESCRIPTOR format_desc;
+					if (!DescribePixelFormat(dc, pixel_format, sizeof(format_desc), &format_desc)) {
+						return MUCOSA_WIN32_FAILED_DESCRIBE_WGL_PIXEL_FORMAT;
+					}
+					// Set pixel format @TODO Figure this out in window creation
+					if (!*set) {
+						if (!SetPixelFormat(dc, pixel_format, &format_desc)) {
+							return MUCOSA_WIN32_FAILED_SET_WGL_PIXEL_FORMAT;
+						}
+						*set = MU_TRUE;
+					}
+
+					// OpenGL version info
+					int opengl_attributes[] = {
+						MUCOSAWGL_CONTEXT_MAJOR_VERSION_ARB, 0,
+						MUCOSAWGL_CONTEXT_MINOR_VERSION_ARB, 0,
+						MUCOSAWGL_CONTEXT_PROFILE_MASK_ARB, MUCOSAWGL_CONTEXT_CORE_PROFILE_BIT_ARB,
+						0
+					};
+
+					// - Fill in OpenGL version info based on graphics API value
+					switch (api) {
+						default: return MUCOSA_FAILED_UNKNOWN_GRAPHICS_API; break;
+						case MU_OPENGL_1_0: {
+							opengl_attributes[1] = 1;
+							opengl_attributes[3] = 0;
+							opengl_attributes[4] = 0;
+						} break;
+						case MU_OPENGL_1_1: {
+							opengl_attributes[1] = 1;
+							opengl_attributes[3] = 1;
+							opengl_attributes[4] = 0;
+						} break;
+						case MU_OPENGL_1_2: {
+							opengl_attributes[1] = 1;
+							opengl_attributes[3] = 2;
+							opengl_attributes[4] = 0;
+						} break;
+						// Don't know what to do, setting to 1.3
+						case MU_OPENGL_1_2_1: {
+							opengl_attributes[1] = 1;
+							opengl_attributes[3] = 3;
+							opengl_attributes[4] = 0;
+						} break;
+						case MU_OPENGL_1_3: {
+							opengl_attributes[1] = 1;
+							opengl_attributes[3] = 3;
 							opengl_attributes[4] = 0;
 						} break;
 						case MU_OPENGL_1_4: {
@@ -2691,1681 +4990,11645 @@ Uncommon pixel formats (such as no-alpha pixel formats) are not tested thoroughl
 						} break;
 					}
 
-					// Create context
-					*context = wgl->CreateContextAttribs(dc, 0, opengl_attributes);
-					if (!*context) {
-						return MUCOSA_WIN32_FAILED_CREATE_WGL_CONTEXT;
-					}
+					// Create context
+					*context = wgl->CreateContextAttribs(dc, 0, opengl_attributes);
+					if (!*context) {
+						return MUCOSA_WIN32_FAILED_CREATE_WGL_CONTEXT;
+					}
+
+					return res;
+				}
+
+		#endif /* MU_SUPPORT_OPENGL */
+
+		/* Time */
+
+			struct muCOSAW32_Time {
+				// @DOCLINE The original time the context was created.
+				double orig_time;
+				// @DOCLINE The non-overwritable time.
+				double fixed_time;
+			};
+			typedef struct muCOSAW32_Time muCOSAW32_Time;
+
+			// https://stackoverflow.com/questions/1695288/getting-the-current-time-in-milliseconds-from-the-system-clock-in-windows
+			double muCOSAW32_get_current_time(void) {
+				// Get system time
+				FILETIME file_time;
+				GetSystemTimeAsFileTime(&file_time);
+
+				// Format low + high time
+				LONGLONG ll_now = 
+					(LONGLONG)(file_time.dwLowDateTime) + ((LONGLONG)(file_time.dwHighDateTime) << 32LL)
+				;
+				// Return time properly divided
+				return (double)(ll_now) / (double)(1.0e7);
+			}
+
+			// Initiates the time struct
+			void muCOSAW32_time_init(muCOSAW32_Time* time) {
+				// Set time to current time
+				time->orig_time = time->fixed_time = muCOSAW32_get_current_time();
+			}
+
+		/* Clipboard */
+
+			uint8_m* muCOSAW32_clipboard_get(muCOSAResult* result) {
+				// Hold clipboard
+				if (!OpenClipboard(NULL)) {
+					MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_HOLD_CLIPBOARD)
+					return 0;
+				}
+
+				// Get handle to clipboard data (UTF-16)
+				HANDLE data = GetClipboardData(CF_UNICODETEXT);
+				if (!data) {
+					// I'm pretty sure this can happen if no clipboard is available, so I'm not
+					// throwing an error here
+					CloseClipboard();
+					return 0;
+				}
+
+				// Get clipboard data (UTF-16)
+				wchar_t* utf16 = (wchar_t*)GlobalLock(data);
+				if (!utf16) {
+					MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_GET_CLIPBOARD_DATA)
+					CloseClipboard();
+					return 0;
+				}
+
+				// Convert UTF-16 to UTF-8
+				uint8_m* utf8 = muCOSAW32_wchar_to_utf8(utf16);
+				if (!utf8) {
+					MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_CONVERT_CLIPBOARD_DATA_FORMAT)
+					GlobalUnlock(data);
+					CloseClipboard();
+					return 0;
+				}
+
+				// Close and return data
+				GlobalUnlock(data);
+				CloseClipboard();
+				return utf8;
+			}
+
+			void muCOSAW32_clipboard_set(muCOSAResult* result, uint8_m* data, size_m datalen) {
+				// Get length of UTF-16 equivalent
+				int wlen = MultiByteToWideChar(CP_UTF8, 0, (LPCCH)data, datalen, NULL, 0);
+				if (!wlen) {
+					MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_CONVERT_CLIPBOARD_DATA_FORMAT)
+					return;
+				}
+
+				// Allocate global memory for UTF-16 string
+				HGLOBAL g_mem = GlobalAlloc(GMEM_MOVEABLE, (SIZE_T)(wlen)*sizeof(wchar_t));
+				if (!g_mem) {
+					MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_ALLOCATE_CLIPBOARD_DATA)
+					return;
+				}
+
+				// Get memory pointer
+				LPVOID p_mem = GlobalLock(g_mem);
+				if (!p_mem) {
+					MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_ALLOCATE_CLIPBOARD_DATA)
+					GlobalFree(g_mem);
+					return;
+				}
+
+				// Perform conversion
+				if (!MultiByteToWideChar(CP_UTF8, 0, (LPCCH)data, datalen, (LPWSTR)p_mem, wlen)) {
+					MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_CONVERT_CLIPBOARD_DATA_FORMAT)
+					GlobalUnlock(g_mem);
+					GlobalFree(g_mem);
+					return;
+				}
+
+				// Release memory pointer
+				GlobalUnlock(g_mem);
+
+				// Hold clipboard
+				if (!OpenClipboard(NULL)) {
+					MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_HOLD_CLIPBOARD)
+					GlobalFree(g_mem);
+					return;
+				}
+
+				// Empty pre-existing clipboard data
+				if (!EmptyClipboard()) {
+					// Assuming this can get triggered if the clipboard was already empty,
+					// so no error thrown here.
+				}
+
+				// Set clipboard data
+				if (!SetClipboardData(CF_UNICODETEXT, g_mem)) {
+					MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_SET_CLIPBOARD_DATA)
+					GlobalFree(g_mem);
+					CloseClipboard();
+					return;
+				}
+
+				// Close clipboard and we're done
+				CloseClipboard();
+			}
+
+		/* Context */
+
+			struct muCOSAW32_Context {
+				muCOSAW32_Time time;
+				// Event signaled to interrupt waits (0 if it couldn't be created)
+				HANDLE wake;
+				// Windows
+				muCOSA_WindowList windows;
+				MUCOSA_OPENGL_CALL(muCOSAW32_WGL wgl;)
+				#ifdef MUCOSA_EVENT_THREAD
+				// Message-only window that calls are sent to, to be made on the event
+				// thread (0 if not created yet)
+				HWND calls;
+				#endif
+			};
+			typedef struct muCOSAW32_Context muCOSAW32_Context;
+
+			muCOSAResult muCOSAW32_context_init(muCOSAW32_Context* context) {
+				muCOSAResult res = MUCOSA_SUCCESS;
+				// Initiate context time
+				muCOSAW32_time_init(&context->time);
+				// Initiate window list
+				mu_memset(&context->windows, 0, sizeof(context->windows));
+				// Create wake event (auto-reset, so that a wait resets it)
+				context->wake = CreateEventA(0, FALSE, FALSE, 0);
+				// (The event thread creates the window for calls)
+				#ifdef MUCOSA_EVENT_THREAD
+				context->calls = 0;
+				#endif
+				// Load OpenGL extensions
+				MUCOSA_OPENGL_CALL(
+					mu_memset(&context->wgl, 0, sizeof(context->wgl));
+					res = muCOSAW32_get_opengl_extensions(&context->wgl);
+				)
+
+				return res;
+			}
+
+			void muCOSAW32_context_term(muCOSAW32_Context* context) {
+				// Close wake event
+				if (context->wake) {
+					CloseHandle(context->wake);
+				}
+				// Free window list
+				muCOSA_window_list_term(&context->windows);
+			}
+
+		/* Context time */
+
+			double muCOSAW32_fixed_time_get(muCOSAW32_Context* context) {
+				// Return the difference between now and when the context was created
+				return muCOSAW32_get_current_time() - context->time.fixed_time;
+			}
+
+			double muCOSAW32_time_get(muCOSAW32_Context* context) {
+				// Return the difference between now and the overridable original time
+				return muCOSAW32_get_current_time() - context->time.orig_time;
+			}
+
+			void muCOSAW32_time_set(muCOSAW32_Context* context, double time) {
+				// Set time to current time minus the given time
+				context->time.orig_time = muCOSAW32_get_current_time() - time;
+			}
+
+		/* Sleep */
+
+			void muCOSAW32_sleep(double time) {
+				// Sleep for the approx. amount of milliseconds
+				Sleep((DWORD)(time*1000.0));
+			}
+
+		/* Window structs */
+
+			struct muCOSAW32_Keymaps {
+				// Keyboard keys
+				muBool keyboard[MU_KEYBOARD_LENGTH];
+				// Keystates
+				muBool keystates[MU_KEYSTATE_LENGTH];
+				// Mouse keys
+				muBool mouse[MU_MOUSE_LENGTH];
+			};
+			typedef struct muCOSAW32_Keymaps muCOSAW32_Keymaps;
+
+			struct muCOSAW32_WindowHandles {
+				// Window class name
+				wchar_t wclass_name[2];
+				// Hinstance
+				HINSTANCE hinstance;
+				// Window handle
+				HWND hwnd;
+				// Device context
+				HDC dc;
+				// Cursor handle
+				HCURSOR hcursor;
+				// IMM context handle
+				HIMC imc;
+				// Context's time, used to timestamp messages
+				muCOSAW32_Time* time;
+			};
+			typedef struct muCOSAW32_WindowHandles muCOSAW32_WindowHandles;
+
+			// States possibly held by the window that are updated via proc
+			struct muCOSAW32_WindowStates {
+				// Closed or not
+				muBool closed;
+				// Cursor style
+				muCursorStyle cursor_style;
+				// If raw motion is received
+				muBool raw_motion;
+				// If the pointer is locked
+				muBool pointer_lock;
+			};
+			typedef struct muCOSAW32_WindowStates muCOSAW32_WindowStates;
+
+			struct muCOSAW32_WindowProperties {
+				// Pixel format
+				muPixelFormat format;
+				muBool use_format;
+				muBool format_set;
+				// Default pixel format value
+				int pixel_format;
+
+				// Min/Max dimensions
+				uint32_m min_width;
+				uint32_m min_height;
+				uint32_m max_width;
+				uint32_m max_height;
+
+				// Scroll level
+				int32_m scroll_level;
+
+				// Cursor position
+				int32_m cursor_x;
+				int32_m cursor_y;
+
+				// Text input
+				void (*text_input_callback)(muWindow window, uint8_m* data);
+				uint32_m text_cursor_x;
+				uint32_m text_cursor_y;
+			};
+			typedef struct muCOSAW32_WindowProperties muCOSAW32_WindowProperties;
+
+			struct muCOSAW32_WindowTemp {
+				// High surrogate for cross-WM_CHAR messages
+				WCHAR high_surrogate;
+			};
+			typedef struct muCOSAW32_WindowTemp muCOSAW32_WindowTemp;
+
+			struct muCOSAW32_Window {
+				muCOSAW32_WindowHandles handles;
+				muCOSAW32_Keymaps keymaps;
+				muCOSAW32_WindowStates states;
+				muCOSAW32_WindowProperties props;
+				muWindowCallbacks callbacks;
+				muCOSAW32_WindowTemp temp;
+				muCOSA_EventQueue events;
+				muCOSA_Coalesce coalesce;
+				#ifdef MUCOSA_THREAD_SAFE
+				muCOSA_Lock lock;
+				#endif
+				#ifdef MUCOSA_EVENT_THREAD
+				// Lock of the context, held while handling messages
+				muCOSA_Lock* context_lock;
+				// Signal that wakes threads waiting on events
+				muCOSA_Signal* handoff;
+				#endif
+			};
+			typedef struct muCOSAW32_Window muCOSAW32_Window;
+
+		/* Window map */
+
+			// Windows of every context, used to find a muCOSAW32_Window based on just
+			// its HWND, which happens in the proc function. Window procedures are
+			// per-process rather than per-context, so this map is global.
+			muCOSA_WindowMap muCOSAW32_GlobalWindowMap = MUCOSA_WINDOW_MAP_INIT;
+
+		/* Proc */
+
+			// Info about a proc message
+			struct muCOSAW32_ProcMsg {
+				// Proc stuff
+				UINT uMsg;
+				WPARAM wParam;
+				LPARAM lParam;
+
+				// muCOSA window
+				muCOSAW32_Window* win;
+			};
+			typedef struct muCOSAW32_ProcMsg muCOSAW32_ProcMsg;
+
+			// Gives a proc message default handling
+			LRESULT muCOSAW32_default(muCOSAW32_ProcMsg msg) {
+				// In event-thread mode, default handling can enter a modal loop (such
+				// as while the window is being moved or resized) that dispatches
+				// messages itself, so the context isn't kept locked during it
+				#ifdef MUCOSA_EVENT_THREAD
+				muCOSA_Lock* lock = msg.win->context_lock;
+				muCOSA_unlock(lock);
+				LRESULT res = DefWindowProcW(msg.win->handles.hwnd, msg.uMsg, msg.wParam, msg.lParam);
+				muCOSA_lock(lock);
+				return res;
+				#else
+				return DefWindowProcW(msg.win->handles.hwnd, msg.uMsg, msg.wParam, msg.lParam);
+				#endif
+			}
+
+			// Handling for WM_DESTROY; when a window is closed
+			LRESULT CALLBACK muCOSAW32_DESTROY(muCOSAW32_ProcMsg msg) {
+				PostQuitMessage(0);
+				msg.win->states.closed = MU_TRUE;
+				// Deliver coalesced changes first
+				muCOSA_coalesce_flush(&msg.win->coalesce, msg.win, &msg.win->callbacks, &msg.win->events);
+				muCOSA_event_push_close(&msg.win->events);
+				return 0;
+			}
+
+			// Separates left/right keys
+			WPARAM muCOSAW32_map_lr_keys(WPARAM vk, LPARAM lParam) {
+				// Separate scancode and left/right bit
+				UINT scancode = (lParam & 0x00ff0000) >> 16;
+				int  extended = (lParam & 0x01000000) != 0;
+
+				// Separate into left/right virtual key codes if need be
+				switch (vk) {
+					default: return vk; break;
+					case VK_SHIFT:   return MapVirtualKey(scancode, MAPVK_VSC_TO_VK_EX); break;
+					case VK_CONTROL: return extended ? VK_RCONTROL : VK_LCONTROL; break;
+					case VK_MENU:    return extended ? VK_RMENU    : VK_LMENU; break;
+				}
+			}
+
+			// Gets the state of every keystate (off if not recognized)
+			void muCOSAW32_get_keystates(muBool* states) {
+				// Loop through each possible keystate
+				for (muKeyboardState s = 1; s < MU_KEYSTATE_LENGTH; ++s) {
+					// Assume not on at first
+					states[s] = MU_FALSE;
+					// Convert keystate to Win32
+					int s_w32 = muCOSAW32_keystate_to_W32(s);
+					// If not recognized, continue:
+					if (s_w32 == VK_NONAME) {
+						continue;
+					}
+
+					// Set boolean to if it's on or off
+					states[s] = (GetKeyState(s_w32) & 0x0001) != 0;
+				}
+			}
+
+			// Checks all keystates against their states and updates accordingly
+			void muCOSAW32_update_keystate(muCOSAW32_Window* win, muBool* states) {
+				// Loop through each possible keystate
+				for (muKeyboardState s = 1; s < MU_KEYSTATE_LENGTH; ++s) {
+					// Change value if different
+					muBool b = states[s];
+					if (b != win->keymaps.keystates[s]) {
+						win->keymaps.keystates[s] = b;
+
+						// + Event + callback
+						muCOSA_event_push_keystate(&win->events, s, b);
+						if (win->callbacks.keystate) {
+							win->callbacks.keystate(win, s, b);
+						}
+					}
+				}
+			}
+
+			// Updates the keystates of a window; keystates can only change by the
+			// user pressing a lock key, so this is only done when the window
+			// receives one, or when it gains focus (since they could've been
+			// pressed while another window had focus)
+			void muCOSAW32_refresh_keystates(muCOSAW32_Window* win) {
+				muBool states[MU_KEYSTATE_LENGTH];
+				muCOSAW32_get_keystates(states);
+				muCOSAW32_update_keystate(win, states);
+			}
+
+			// Handling for WM_KEYDOWN and WM_KEYUP
+			LRESULT CALLBACK muCOSAW32_KEY(muCOSAW32_ProcMsg msg, muBool up) {
+				// Lock keys change keystates
+				muBool lock = msg.wParam == VK_CAPITAL || msg.wParam == VK_NUMLOCK || msg.wParam == VK_SCROLL;
+				// Handle separation of keys based on left/right
+				msg.wParam = muCOSAW32_map_lr_keys(msg.wParam, msg.lParam);
+				// Convert Win32 key value to muCOSA key value
+				muKeyboardKey key = muCOSAW32_VK_to_muCOSA(msg.wParam);
+				// Return if key is unknown or out of range
+				if (key == MU_KEYBOARD_UNKNOWN || key >= MU_KEYBOARD_LENGTH) {
+					return 0;
+				}
+
+				// Set key state
+				msg.win->keymaps.keyboard[key] = up;
+				// Deliver coalesced changes first
+				muCOSA_coalesce_flush(&msg.win->coalesce, msg.win, &msg.win->callbacks, &msg.win->events);
+				// Event + callback
+				muCOSA_event_push_keyboard(&msg.win->events, key, up);
+				if (msg.win->callbacks.keyboard) {
+					msg.win->callbacks.keyboard(msg.win, key, up);
+				}
+				// (Keystates are updated after the key itself)
+				if (lock) {
+					muCOSAW32_refresh_keystates(msg.win);
+				}
+
+				// Exit
+				return 0;
+			}
+
+			// Handling for WM_LBUTTONDOWN, WM_RBUTTONDOWN, WM_LBUTTONUP, and WM_RBUTTONDOWN
+			LRESULT CALLBACK muCOSAW32_MBUTTON(muCOSAW32_ProcMsg msg, muMouseKey key, muBool up) {
+				// Update keymap
+				msg.win->keymaps.mouse[key] = up;
+				// Deliver coalesced changes first
+				muCOSA_coalesce_flush(&msg.win->coalesce, msg.win, &msg.win->callbacks, &msg.win->events);
+				// + Event + callback
+				muCOSA_event_push_mouse_key(&msg.win->events, key, up);
+				if (msg.win->callbacks.mouse_key) {
+					msg.win->callbacks.mouse_key(msg.win, key, up);
+				}
+				return 0;
+			}
+
+			muCOSAResult muCOSAW32_window_get_dimensions(muCOSAW32_Window* win, uint32_m* data);
+			muCOSAResult muCOSAW32_window_get_cursor_pos(muCOSAW32_Window* win, int32_m* data);
+			// Handling for WM_SETCURSOR
+			LRESULT CALLBACK muCOSAW32_SETCURSOR(muCOSAW32_ProcMsg msg) {
+				// Only allow the cursor to change if it's outside the window surface
+				// This is a hack and a half, but largely works
+				int32_m cur[2]; muCOSAW32_window_get_cursor_pos(msg.win, cur);
+				uint32_m dim[2]; muCOSAW32_window_get_dimensions(msg.win, dim);
+				int32_m idim[2] = { (int32_m)dim[0], (int32_m)dim[1] };
+				if (cur[0] >= 0 && cur[1] >= 0 && cur[0] < idim[0] && cur[1] < idim[1]) {
+					// (Hidden while the pointer is locked)
+					SetCursor(msg.win->states.pointer_lock ? NULL : msg.win->handles.hcursor);
+				} else {
+					return muCOSAW32_default(msg);
+				}
+				return 0;
+			}
+
+			// Handling for WM_GETMINMAXINFO
+			LRESULT CALLBACK muCOSAW32_GETMINMAXINFO(muCOSAW32_ProcMsg msg) {
+				LPMINMAXINFO lp = (LPMINMAXINFO)msg.lParam;
+				// I have no idea why 16 and 39 need to be added here. Can't be borders
+				// because these numbers don't even nearly match the border values.
+				// If it works, it works :P
+				lp->ptMinTrackSize.x = msg.win->props.min_width + 16;
+				lp->ptMinTrackSize.y = msg.win->props.min_height + 39;
+				lp->ptMaxTrackSize.x = msg.win->props.max_width + 16;
+				lp->ptMaxTrackSize.y = msg.win->props.max_height + 39;
+				return 0;
+			}
+
+			// Handling for WM_MOUSEWHEEL
+			LRESULT CALLBACK muCOSAW32_MOUSEWHEEL(muCOSAW32_ProcMsg msg) {
+				// Add scroll level from wParam
+				int32_m add = GET_WHEEL_DELTA_WPARAM(msg.wParam);
+				msg.win->props.scroll_level += add;
+				// Deliver coalesced changes first
+				muCOSA_coalesce_flush(&msg.win->coalesce, msg.win, &msg.win->callbacks, &msg.win->events);
+				// + Event + callback
+				muCOSA_event_push_scroll(&msg.win->events, add);
+				if (msg.win->callbacks.scroll) {
+					msg.win->callbacks.scroll(msg.win, add);
+				}
+
+				return 0;
+			}
+
+			// Handling for WM_SIZE
+			LRESULT CALLBACK muCOSAW32_SIZE(muCOSAW32_ProcMsg msg) {
+				uint32_m width = (uint32_m)(LOWORD(msg.lParam));
+				uint32_m height = (uint32_m)(HIWORD(msg.lParam));
+
+				// Dimensions event + callback (unless coalesced); if coalesced, only
+				// post the paint message below for the first resize since the last
+				// delivery
+				muBool repaint = !(msg.win->coalesce.pending & MUCOSA_COALESCE_DIMENSIONS);
+				if (!muCOSA_coalesce_dimensions(&msg.win->coalesce, msg.win->events.time, width, height)) {
+					muCOSA_event_push_dimensions(&msg.win->events, width, height);
+					if (msg.win->callbacks.dimensions) {
+						msg.win->callbacks.dimensions(msg.win, width, height);
+					}
+				}
+
+				// Not sure why we're calling this
+				// I think I vaguely remember this fixing some issue, but idk
+				if (repaint) {
+					PostMessage(msg.win->handles.hwnd, WM_PAINT, 0, 0);
+				}
+				// Keep the pointer lock around the new client area
+				muCOSAW32_update_clip(msg.win);
+				return 0;
+			}
+
+			// Handling for WM_MOVE
+			LRESULT CALLBACK muCOSAW32_MOVE(muCOSAW32_ProcMsg msg) {
+				// https://www.autohotkey.com/boards/viewtopic.php?t=27857
+				// I would KISS Bill on the mouth if I ever met him...
+				int32_m x = (int32_m)( msg.lParam      & 0x8000 ? - ((~msg.lParam    ) & 0x7FFF)+1 : msg.lParam       & 0x7FFF);
+				int32_m y = (int32_m)((msg.lParam>>16) & 0x8000 ? - ((~msg.lParam>>16) & 0X7FFF)+1 : (msg.lParam>>16) & 0x7FFF);
+
+				// Position event + callback (unless coalesced)
+				if (!muCOSA_coalesce_position(&msg.win->coalesce, msg.win->events.time, x, y)) {
+					muCOSA_event_push_position(&msg.win->events, x, y);
+					if (msg.win->callbacks.position) {
+						msg.win->callbacks.position(msg.win, x, y);
+					}
+				}
+
+				// Keep the pointer lock around the new client area
+				muCOSAW32_update_clip(msg.win);
+				return 0;
+			}
+
+			// Clips the cursor to the window's client area if the window has the
+			// pointer locked and has focus
+			void muCOSAW32_update_clip(muCOSAW32_Window* win) {
+				if (!win->states.pointer_lock || GetFocus() != win->handles.hwnd) {
+					return;
+				}
+
+				// Get client rect in screen coordinates
+				RECT rect;
+				if (!GetClientRect(win->handles.hwnd, &rect)) {
+					return;
+				}
+				MapWindowPoints(win->handles.hwnd, NULL, (LPPOINT)&rect, 2);
+				// Clip cursor to it
+				ClipCursor(&rect);
+			}
+
+			// Handling for WM_SETFOCUS
+			LRESULT CALLBACK muCOSAW32_SETFOCUS(muCOSAW32_ProcMsg msg) {
+				// Lock keys may have been pressed while unfocused
+				muCOSAW32_refresh_keystates(msg.win);
+				// Restore pointer lock
+				muCOSAW32_update_clip(msg.win);
+				return muCOSAW32_default(msg);
+			}
+
+			// Handling for WM_KILLFOCUS
+			LRESULT CALLBACK muCOSAW32_KILLFOCUS(muCOSAW32_ProcMsg msg) {
+				// Release pointer lock while unfocused
+				if (msg.win->states.pointer_lock) {
+					ClipCursor(NULL);
+				}
+				return muCOSAW32_default(msg);
+			}
+
+			// Handling for WM_INPUT
+			LRESULT CALLBACK muCOSAW32_INPUT(muCOSAW32_ProcMsg msg) {
+				// Get raw input data
+				RAWINPUT raw;
+				UINT size = sizeof(raw);
+				if (GetRawInputData((HRAWINPUT)msg.lParam, RID_INPUT, &raw, &size, sizeof(RAWINPUTHEADER)) == (UINT)-1) {
+					return muCOSAW32_default(msg);
+				}
+
+				// Only relative mouse motion is raw motion; absolute motion comes
+				// from things like tablets and remote desktop
+				if (msg.win->states.raw_motion && raw.header.dwType == RIM_TYPEMOUSE
+					&& !(raw.data.mouse.usFlags & MOUSE_MOVE_ABSOLUTE)
+					&& (raw.data.mouse.lLastX != 0 || raw.data.mouse.lLastY != 0)
+				) {
+					double dx = (double)raw.data.mouse.lLastX;
+					double dy = (double)raw.data.mouse.lLastY;
+					// + Event + callback
+					muCOSA_event_push_raw_motion(&msg.win->events, dx, dy);
+					if (msg.win->callbacks.raw_motion) {
+						msg.win->callbacks.raw_motion(msg.win, dx, dy);
+					}
+				}
+
+				// WM_INPUT needs default handling for cleanup
+				return muCOSAW32_default(msg);
+			}
+
+			uint8_m muCOSAW32_UTF8_codepoint_size(uint32_m codepoint) {
+				// Storable in 7 bits = 1 byte
+				if (codepoint < 128) {
+					return 1;
+				}
+				// Storable in 11 bits = 2 bytes
+				if (codepoint < 2048) {
+					return 2;
+				}
+				// Storable in 16 bits = 3 bytes
+				if (codepoint < 65536) {
+					return 3;
+				}
+				return 4;
+			}
+
+			// Handling for WM_CHAR
+			LRESULT CALLBACK muCOSAW32_CHAR(muCOSAW32_ProcMsg msg) {
+				// Hold onto high surrogate if it is one
+				if (IS_HIGH_SURROGATE(msg.wParam)) {
+					msg.win->temp.high_surrogate = (WCHAR)msg.wParam;
+					return 0;
+				}
+
+				// Return if we aren't taking text input
+				if (!msg.win->props.text_input_callback) {
+					return muCOSAW32_default(msg);
+				}
+
+				// Convert UTF-16 wParam to wchar_t* UTF-16 string
+				WCHAR wstr[3];
+				// - Surrogate pair
+				if (msg.win->temp.high_surrogate) {
+					wstr[0] = msg.win->temp.high_surrogate;
+					wstr[1] = (WCHAR)msg.wParam;
+					wstr[2] = 0;
+					// (Reset high surrogate)
+					msg.win->temp.high_surrogate = 0;
+				}
+				// - Non-surrogate pair
+				else {
+					wstr[0] = (WCHAR)msg.wParam;
+					wstr[1] = 0;
+				}
+
+				// Convert wchar_t* UTF-16 string to UTF-8 string
+				uint8_m buf[5];
+				if (!WideCharToMultiByte(CP_UTF8, WC_ERR_INVALID_CHARS, wstr, -1, (LPSTR)buf, sizeof(buf), NULL, NULL)) {
+					return 0;
+				}
+
+				// Deliver coalesced changes first
+				muCOSA_coalesce_flush(&msg.win->coalesce, msg.win, &msg.win->callbacks, &msg.win->events);
+				// Event + callback
+				muCOSA_event_push_text(&msg.win->events, buf);
+				msg.win->props.text_input_callback(msg.win, buf);
+				return 0;
+			}
+
+			// Handling for WM_IME_STARTCOMPOSITION
+			LRESULT CALLBACK muCOSAW32_IME_STARTCOMPOSITION(muCOSAW32_ProcMsg msg) {
+				// Get IMM context handle
+				HIMC imc = ImmGetContext(msg.win->handles.hwnd);
+
+				// Fill out composition form
+				COMPOSITIONFORM cf = MU_ZERO_STRUCT(COMPOSITIONFORM);
+				cf.dwStyle = CFS_FORCE_POSITION;
+				cf.ptCurrentPos.x = msg.win->props.text_cursor_x;
+				cf.ptCurrentPos.y = msg.win->props.text_cursor_y;
+
+				// Send composition form
+				if (!ImmSetCompositionWindow(imc, &cf)) {
+					return 0;
+				}
+
+				// Release IMM context handle
+				ImmReleaseContext(msg.win->handles.hwnd, imc);
+				return 0;
+			}
+
+			#ifdef MUCOSA_EVENT_THREAD
+
+			// While a window is being moved or resized, default handling runs a
+			// modal loop that dispatches messages itself until the user lets go, so
+			// the event thread wouldn't get to refresh windows and wake threads
+			// waiting on events until then. A timer does so in the meantime
+			// instead, so that changes are handed off as they happen.
+
+			#define MUCOSAW32_REFRESH_TIMER 1
+
+			void muCOSAW32_window_refresh(muCOSAW32_Window* win, POINT* cursor);
+
+			// Handling for WM_ENTERSIZEMOVE
+			LRESULT CALLBACK muCOSAW32_ENTERSIZEMOVE(muCOSAW32_ProcMsg msg) {
+				SetTimer(msg.win->handles.hwnd, MUCOSAW32_REFRESH_TIMER, USER_TIMER_MINIMUM, NULL);
+				return muCOSAW32_default(msg);
+			}
+
+			// Handling for WM_EXITSIZEMOVE
+			LRESULT CALLBACK muCOSAW32_EXITSIZEMOVE(muCOSAW32_ProcMsg msg) {
+				KillTimer(msg.win->handles.hwnd, MUCOSAW32_REFRESH_TIMER);
+				return muCOSAW32_default(msg);
+			}
+
+			// Handling for WM_TIMER
+			LRESULT CALLBACK muCOSAW32_TIMER(muCOSAW32_ProcMsg msg) {
+				if (msg.wParam != MUCOSAW32_REFRESH_TIMER) {
+					return muCOSAW32_default(msg);
+				}
+
+				// Refresh window + hand off changes
+				POINT p;
+				muCOSAW32_window_refresh(msg.win, (GetCursorPos(&p)) ? (&p) : (0));
+				muCOSA_signal_raise(msg.win->handoff);
+				return 0;
+			}
+
+			#endif /* MUCOSA_EVENT_THREAD */
+
+			// Gets the time that a proc message occurred on the context's clock
+			double muCOSAW32_message_time(muCOSAW32_ProcMsg msg) {
+				double now = muCOSAW32_get_current_time() - msg.win->handles.time->orig_time;
+				// Input messages are posted with the tick count of when they
+				// occurred; other messages are sent as they occur
+				if ((msg.uMsg >= WM_KEYFIRST && msg.uMsg <= WM_KEYLAST) || (msg.uMsg >= WM_MOUSEFIRST && msg.uMsg <= WM_MOUSELAST) || msg.uMsg == WM_INPUT) {
+					DWORD age = GetTickCount() - (DWORD)GetMessageTime();
+					now -= (double)age / 1000.0;
+				}
+				return now;
+			}
+
+			// Handles a proc message
+			LRESULT muCOSAW32_procmsg(muCOSAW32_ProcMsg msg) {
+				// Timestamp message
+				msg.win->events.time = muCOSAW32_message_time(msg);
+
+				// Do things based on the message code
+				switch (msg.uMsg) {
+					// Message code we're not processing; return default handling at end of switch
+					default: break;
+					// Window closing
+					case WM_DESTROY: return muCOSAW32_DESTROY(msg); break;
+					// Key down
+					case WM_KEYDOWN: return muCOSAW32_KEY(msg, MU_TRUE); break;
+					// Key up
+					case WM_KEYUP: return muCOSAW32_KEY(msg, MU_FALSE); break;
+					// Left mouse up
+					case WM_LBUTTONUP: return muCOSAW32_MBUTTON(msg, MU_MOUSE_LEFT, MU_FALSE); break;
+					// Left mouse down
+					case WM_LBUTTONDOWN: return muCOSAW32_MBUTTON(msg, MU_MOUSE_LEFT, MU_TRUE); break;
+					// Right mouse up
+					case WM_RBUTTONUP: return muCOSAW32_MBUTTON(msg, MU_MOUSE_RIGHT, MU_FALSE); break;
+					// Right mouse down
+					case WM_RBUTTONDOWN: return muCOSAW32_MBUTTON(msg, MU_MOUSE_RIGHT, MU_TRUE); break;
+					// Middle mouse up
+					case WM_MBUTTONUP: return muCOSAW32_MBUTTON(msg, MU_MOUSE_MIDDLE, MU_FALSE); break;
+					// Middle mouse down
+					case WM_MBUTTONDOWN: return muCOSAW32_MBUTTON(msg, MU_MOUSE_MIDDLE, MU_TRUE); break;
+					// Cursor style changing
+					case WM_SETCURSOR: return muCOSAW32_SETCURSOR(msg); break;
+					// Windows asking for min/max dimensions
+					case WM_GETMINMAXINFO: return muCOSAW32_GETMINMAXINFO(msg); break;
+					// Scrolling
+					case WM_MOUSEWHEEL: return muCOSAW32_MOUSEWHEEL(msg); break;
+					// Resizing
+					case WM_SIZE: return muCOSAW32_SIZE(msg); break;
+					// Movement
+					case WM_MOVE: return muCOSAW32_MOVE(msg); break;
+					// Character input
+					case WM_CHAR: return muCOSAW32_CHAR(msg); break;
+					// IME composition position
+					case WM_IME_STARTCOMPOSITION: return muCOSAW32_IME_STARTCOMPOSITION(msg); break;
+					// Focus gained
+					case WM_SETFOCUS: return muCOSAW32_SETFOCUS(msg); break;
+					// Focus lost
+					case WM_KILLFOCUS: return muCOSAW32_KILLFOCUS(msg); break;
+					// Raw input
+					case WM_INPUT: return muCOSAW32_INPUT(msg); break;
+					#ifdef MUCOSA_EVENT_THREAD
+					// Moving/resizing starting
+					case WM_ENTERSIZEMOVE: return muCOSAW32_ENTERSIZEMOVE(msg); break;
+					// Moving/resizing ending
+					case WM_EXITSIZEMOVE: return muCOSAW32_EXITSIZEMOVE(msg); break;
+					// Timer
+					case WM_TIMER: return muCOSAW32_TIMER(msg); break;
+					#endif
+				}
+
+				// Default handling
+				return muCOSAW32_default(msg);
+			}
+
+			// Proc function for Win32
+			LRESULT CALLBACK muCOSAW32_winproc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam) {
+				// Return default if hwnd is NULL
+				if (!hwnd) {
+					return DefWindowProcW(hwnd, uMsg, wParam, lParam);
+				}
+
+				// Start getting info about the proc
+				muCOSAW32_ProcMsg msg;
+
+				// Find window based on HWND
+				msg.win = (muCOSAW32_Window*)muCOSA_window_map_find(&muCOSAW32_GlobalWindowMap, (uint64_m)(size_m)hwnd);
+				if (!msg.win) {
+					return DefWindowProcW(hwnd, uMsg, wParam, lParam);
+				}
+
+				// Copy over other info
+				msg.uMsg = uMsg;
+				msg.wParam = wParam;
+				msg.lParam = lParam;
+
+				// Return proc message handling; in event-thread mode, the event thread
+				// dispatches messages without the context locked, so it's locked here
+				// (through a pointer kept aside, as the window can be destroyed while
+				// the message is being handled)
+				#ifdef MUCOSA_EVENT_THREAD
+				muCOSA_Lock* lock = msg.win->context_lock;
+				muCOSA_lock(lock);
+				LRESULT res = muCOSAW32_procmsg(msg);
+				muCOSA_unlock(lock);
+				return res;
+				#else
+				return muCOSAW32_procmsg(msg);
+				#endif
+			}
+
+		/* Creation / Destruction */
+
+			muCOSAResult muCOSAW32_window_set_position(muCOSAW32_Window* win, int32_m* data);
+
+			void muCOSAW32_window_destroy(muCOSAW32_Context* context, muCOSAW32_Window* win);
+
+			muCOSAResult muCOSAW32_window_create(muCOSAW32_Context* context, muWindowInfo* info, muCOSAW32_Window* win) {
+				/* Default attributes */
+
+					// Zero-ing-out
+					mu_memset(&win->handles, 0, sizeof(win->handles));
+					mu_memset(&win->keymaps, 0, sizeof(win->keymaps));
+					win->handles.time = &context->time;
+
+					// Closed
+					win->states.closed = MU_FALSE;
+
+					// Cursor style
+					win->states.cursor_style = MU_CURSOR_ARROW;
+					win->states.raw_motion = MU_FALSE;
+					win->states.pointer_lock = MU_FALSE;
+
+					// Pixel format
+					if (info->pixel_format) {
+						win->props.use_format = MU_TRUE;
+						win->props.format = *info->pixel_format;
+					} else {
+						win->props.use_format = MU_FALSE;
+					}
+					win->props.format_set = MU_FALSE;
+
+					// Min/Max dimensions
+					win->props.min_width = info->min_width;
+					win->props.min_height = info->min_height;
+					win->props.max_width = info->max_width;
+					win->props.max_height = info->max_height;
+					// - (Fix 0 defaults)
+					if (win->props.min_width == 0) {
+						win->props.min_width = 120;
+					}
+					if (win->props.min_height == 0) {
+						win->props.min_height = 1;
+					}
+					if (win->props.max_width == 0) {
+						win->props.max_width = 0x0FFFFFFF;
+					}
+					if (win->props.max_height == 0) {
+						win->props.max_height = 0x0FFFFFFF;
+					}
+
+					// Scroll level
+					win->props.scroll_level = 0;
+
+					// Cursor position
+					win->props.cursor_x = win->props.cursor_y = 0;
+
+					// Callbacks
+					// - Zero-out if no callbacks specified
+					if (!info->callbacks) {
+						mu_memset(&win->callbacks, 0, sizeof(win->callbacks));
+					}
+					// - Set all callbacks if specified
+					else {
+						win->callbacks = *info->callbacks;
+					}
+
+					// Text focus
+					win->props.text_input_callback = 0;
+					win->props.text_cursor_x = win->props.text_cursor_y = 0;
+
+					// High surrogate for WM_CHAR messages
+					win->temp.high_surrogate = 0;
+
+				/* Class */
+
+					// Window title
+					wchar_t* wname = muCOSAW32_utf8_to_wchar(info->title);
+					if (!wname) {
+						return MUCOSA_WIN32_FAILED_CONVERT_UTF8_TO_WCHAR;
+					}
+
+					// This is some of the jankiest code I've written!
+					// To generate a unique window class, I hamfistedly
+					// attempt to generate one by adding the actual pointer
+					// value of 'win' to a character, creating an often
+					// unreadable class title. This needs to be improved
+					// at some point, but works for me :P
+
+					win->handles.wclass_name[0] = (wchar_t)'!';
+
+					wchar_t add; // (Purposely left uninitialized for more randomness)
+					if (sizeof(wchar_t) < sizeof(win)) {
+						mu_memcpy(&add, &win, sizeof(wchar_t));
+					} else {
+						mu_memcpy(&add, &win, sizeof(win));
+					}
+
+					win->handles.wclass_name[0] += add;
+					win->handles.wclass_name[1] = (wchar_t)'\0';
+
+					// Hinstance
+					win->handles.hinstance = muCOSAW32_get_hinstance();
+					// Hcursor
+					win->handles.hcursor = LoadCursor(NULL, IDC_ARROW);
+
+					// Create class struct
+					WNDCLASSEXW wclass = MU_ZERO_STRUCT(WNDCLASSEXW);
+					wclass.cbSize = sizeof(wclass);
+					wclass.style = CS_HREDRAW | CS_VREDRAW | CS_OWNDC;
+					wclass.lpfnWndProc = muCOSAW32_winproc;
+					wclass.hInstance = win->handles.hinstance;
+					wclass.hCursor = win->handles.hcursor;
+					wclass.lpszMenuName = wname;
+					wclass.lpszClassName = win->handles.wclass_name;
+
+					// Register
+					if(!RegisterClassExW(&wclass)) {
+						mu_free(wname);
+						return MUCOSA_WIN32_FAILED_REGISTER_WINDOW_CLASS;
+					}
+
+				/* Window */
+
+					// Style
+					DWORD style = WS_OVERLAPPEDWINDOW;
+
+					// Rect for the window's dimensions
+					RECT r;
+					r.left = r.top = 0;
+					r.right = (LONG)info->width;
+					r.bottom = (LONG)info->height;
+					AdjustWindowRect(&r, style, FALSE);
+
+					// Create window
+					win->handles.hwnd = CreateWindowExW(
+						// dwExStyle
+						0,
+						// lpClassName
+						wclass.lpszClassName,
+						// lpWindowName
+						wclass.lpszMenuName,
+						// dwStyle
+						style,
+						// X, Y,
+						(int)info->x, (int)info->y,
+						// nWidth, nHeight
+						r.right-r.left, r.bottom-r.top,
+						// hWndParent
+						NULL,
+						// hMenu
+						NULL,
+						// hInstance
+						win->handles.hinstance,
+						// lpParam
+						NULL
+					);
+
+					// - Handle fail case
+					mu_free(wname);
+					if (win->handles.hwnd == NULL) {
+						UnregisterClassW(win->handles.wclass_name, win->handles.hinstance);
+						return MUCOSA_WIN32_FAILED_CREATE_WINDOW;
+					}
+
+				/* Pixel format */
+
+					// Get device context
+					win->handles.dc = GetDC(win->handles.hwnd);
+
+					// Handle default pixel format:
+					if (!info->pixel_format) {
+						// Generic pixel format descriptor
+						// Based on https://www.khronos.org/opengl/wiki/Creating_an_OpenGL_Context_(WGL)
+						PIXELFORMATDESCRIPTOR pfd = {
+							sizeof(PIXELFORMATDESCRIPTOR),
+							1,
+							PFD_DRAW_TO_WINDOW | PFD_SUPPORT_OPENGL | PFD_DOUBLEBUFFER,
+							PFD_TYPE_RGBA,
+							32,
+							0, 0, 0, 0, 0, 0,
+							0, 0, 0,
+							0, 0, 0, 0,
+							24, 8, 8,
+							PFD_MAIN_PLANE,
+							0,
+							0, 0, 0
+						};
+
+						// Find pixel format; fallback on 1
+						win->props.pixel_format = ChoosePixelFormat(win->handles.dc, &pfd);
+						if (!win->props.pixel_format) {
+							win->props.pixel_format = 1;
+						}
+					}
+
+					// Show window
+					ShowWindow(win->handles.hwnd, SW_NORMAL);
+
+				/* Auto-disable IME */
+
+					if (ImmAssociateContextEx(win->handles.hwnd, NULL, 0) == FALSE) {
+						// ?
+					}
+
+				/* Set position manually */
+
+					// A bit of a hack considering that it should work on the first try,
+					// but frame extents on Win32 will be frame extents on Win32.
+
+					int32_m pos[2] = { info->x, info->y };
+					muCOSAW32_window_set_position(win, pos);
+
+				/* Add window to map */
+
+					muCOSAResult res = muCOSA_window_map_add(&muCOSAW32_GlobalWindowMap, (uint64_m)(size_m)win->handles.hwnd, win);
+					if (muCOSA_result_is_fatal(res)) {
+						return res;
+					}
+
+				/* Add window to list */
+
+					res = muCOSA_window_list_add(&context->windows, win);
+					if (muCOSA_result_is_fatal(res)) {
+						muCOSAW32_window_destroy(context, win);
+						return res;
+					}
+
+				return res;
+			}
+
+			void muCOSAW32_window_destroy(muCOSAW32_Context* context, muCOSAW32_Window* win) {
+				// Release pointer lock
+				if (win->states.pointer_lock) {
+					ClipCursor(NULL);
+				}
+				// Release device context
+				ReleaseDC(win->handles.hwnd, win->handles.dc);
+				// Destroy window
+				DestroyWindow(win->handles.hwnd);
+				// Unregister window class
+				UnregisterClassW(win->handles.wclass_name, win->handles.hinstance);
+				// Remove window from map
+				muCOSA_window_map_remove(&muCOSAW32_GlobalWindowMap, (uint64_m)(size_m)win->handles.hwnd);
+				// Remove window from list
+				muCOSA_window_list_remove(&context->windows, win);
+			}
+
+		/* Main loop */
+
+			muBool muCOSAW32_window_get_closed(muCOSAW32_Window* win) {
+				return win->states.closed;
+			}
+
+			void muCOSAW32_window_close(muCOSAW32_Window* win) {
+				// Set closed flag
+				win->states.closed = MU_TRUE;
+			}
+
+			// Handles the cursor changing position every frame, given the cursor's
+			// position on the screen (as this is only checked once per update, it's
+			// never coalesced);
+			// no corresponding Win32 proc for this as far as I'm aware :L
+			muCOSAResult muCOSAW32_window_get_position(muCOSAW32_Window* win, int32_m* data);
+			void muCOSAW32_update_cursor(muCOSAW32_Window* win, POINT* p) {
+				// Get window position
+				int32_m wpos[2];
+				if (muCOSA_result_is_fatal(muCOSAW32_window_get_position(win, wpos))) {
+					return;
+				}
+
+				// Get cursor position relative to window
+				int32_m c[2] = { p->x-wpos[0], p->y-wpos[1] };
+
+				// Update cursor position if changed
+				if (win->props.cursor_x != c[0] || win->props.cursor_y != c[1]) {
+					win->props.cursor_x = c[0];
+					win->props.cursor_y = c[1];
+					// + Event + callback
+					muCOSA_event_push_cursor(&win->events, c[0], c[1]);
+					if (win->callbacks.cursor) {
+						win->callbacks.cursor(win, c[0], c[1]);
+					}
+				}
+			}
+
+			// Processes every message in the thread's message queue without blocking
+			void muCOSAW32_dispatch(void) {
+				MSG msg = MU_ZERO_STRUCT(MSG);
+				while (PeekMessageA(&msg, 0, 0, 0, PM_REMOVE)) {
+					TranslateMessage(&msg);
+					DispatchMessage(&msg);
+				}
+			}
+
+			// Refreshes everything in a window not given by messages (after messages
+			// have been processed), given the cursor position (0 if it couldn't be
+			// retrieved)
+			void muCOSAW32_window_refresh(muCOSAW32_Window* win, POINT* cursor) {
+				// Deliver coalesced changes
+				muCOSA_coalesce_flush(&win->coalesce, win, &win->callbacks, &win->events);
+				// Changes found from here on are timestamped with now
+				win->events.time = muCOSAW32_get_current_time() - win->handles.time->orig_time;
+				// Update cursor position
+				if (cursor) {
+					muCOSAW32_update_cursor(win, cursor);
+				}
+				// Mark end of update in recording
+				muCOSA_recording_write_update(&win->events.recording, win->events.time);
+
+				// Frame callback
+				if (win->callbacks.frame) {
+					win->callbacks.frame(win);
+				}
+			}
+
+			void muCOSAW32_window_update(muCOSAW32_Window* win) {
+				// Process messages
+				muCOSAW32_dispatch();
+
+				// Refresh window
+				POINT p;
+				muCOSAW32_window_refresh(win, (GetCursorPos(&p)) ? (&p) : (0));
+			}
+
+			// Refreshes each unclosed window of a context, retrieving the cursor once
+			void muCOSAW32_context_refresh(muCOSAW32_Context* context) {
+				POINT p;
+				POINT* cursor = (GetCursorPos(&p)) ? (&p) : (0);
+				for (size_m i = 0; i < context->windows.wincount; ++i) {
+					muCOSAW32_Window* win = (muCOSAW32_Window*)context->windows.windows[i];
+					if (win && !win->states.closed) {
+						muCOSAW32_window_refresh(win, cursor);
+					}
+				}
+			}
+
+			void muCOSAW32_context_update(muCOSAW32_Context* context) {
+				// Process messages once for every window
+				muCOSAW32_dispatch();
+				// Refresh windows
+				muCOSAW32_context_refresh(context);
+			}
+
+			void muCOSAW32_window_wait(muCOSAW32_Context* context, double timeout) {
+				// Convert timeout to milliseconds, rounding up so that a short timeout
+				// doesn't turn into a busy loop
+				DWORD ms = INFINITE;
+				if (timeout >= 0.0) {
+					ms = (timeout == 0.0) ? 0 : (DWORD)(timeout * 1000.0) + 1;
+				}
+
+				// Wait for a message or the wake event; messages that are already in
+				// the queue but haven't been processed count as well
+				DWORD count = (context->wake) ? 1 : 0;
+				MsgWaitForMultipleObjectsEx(count, &context->wake, ms, QS_ALLINPUT, MWMO_INPUTAVAILABLE);
+			}
+
+		#ifdef MUCOSA_EVENT_THREAD
+
+		/* Event thread */
+
+			// Win32 delivers a window's messages to the thread that created it, so
+			// in event-thread mode, every window is created by the event thread.
+			// Calls that create, destroy, or change windows (which can send
+			// messages to them, and wait on them being handled) are made on the
+			// event thread on behalf of other threads by sending them to a
+			// message-only window, which the event thread handles even in the
+			// middle of a modal loop.
+
+			#define MUCOSAW32_CALL_MESSAGE WM_APP
+
+			// A call to be made on the event thread
+			struct muCOSAW32_Call {
+				void (*fn)(void* data);
+				void* data;
+			};
+			typedef struct muCOSAW32_Call muCOSAW32_Call;
+
+			LRESULT CALLBACK muCOSAW32_call_proc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam) {
+				if (uMsg == MUCOSAW32_CALL_MESSAGE) {
+					muCOSAW32_Call* call = (muCOSAW32_Call*)lParam;
+					call->fn(call->data);
+					return 0;
+				}
+				return DefWindowProcW(hwnd, uMsg, wParam, lParam);
+			}
+
+			// Creates the window for calls; called on the event thread
+			muBool muCOSAW32_calls_create(muCOSAW32_Context* context) {
+				// Register class (once for every context)
+				WNDCLASSEXW wclass = MU_ZERO_STRUCT(WNDCLASSEXW);
+				wclass.cbSize = sizeof(wclass);
+				wclass.lpfnWndProc = muCOSAW32_call_proc;
+				wclass.hInstance = muCOSAW32_get_hinstance();
+				wclass.lpszClassName = L"muCOSA calls";
+				if (!RegisterClassExW(&wclass) && GetLastError() != ERROR_CLASS_ALREADY_EXISTS) {
+					return MU_FALSE;
+				}
+
+				// Create message-only window
+				context->calls = CreateWindowExW(0, wclass.lpszClassName, L"", 0, 0, 0, 0, 0, HWND_MESSAGE, NULL, wclass.hInstance, NULL);
+				return context->calls != NULL;
+			}
+
+			// Destroys the window for calls; called on the event thread
+			void muCOSAW32_calls_destroy(muCOSAW32_Context* context) {
+				if (context->calls) {
+					DestroyWindow(context->calls);
+					context->calls = 0;
+				}
+			}
+
+			// Makes a call on the event thread, returning once it's done
+			void muCOSAW32_call(muCOSAW32_Context* context, muCOSAW32_Call* call) {
+				SendMessageW(context->calls, MUCOSAW32_CALL_MESSAGE, 0, (LPARAM)call);
+			}
+
+		#endif /* MUCOSA_EVENT_THREAD */
+
+		/* Title */
+
+			// Set title
+			muCOSAResult muCOSAW32_window_set_title(muCOSAW32_Window* win, char* data) {
+				// Convert UTF-8 data to wchar_t* data
+				wchar_t* wtitle = muCOSAW32_utf8_to_wchar(data);
+				if (!wtitle) {
+					return MUCOSA_WIN32_FAILED_CONVERT_UTF8_TO_WCHAR;
+				}
+
+				// Set window title
+				if (!SetWindowTextW(win->handles.hwnd, wtitle)) {
+					mu_free(wtitle);
+					return MUCOSA_WIN32_FAILED_SET_WINDOW_ATTRIB;
+				}
+
+				mu_free(wtitle);
+				return MUCOSA_SUCCESS;
+			}
+
+		/* Frame extents */
+
+			// Default frame extents
+			// I love you Bill...
+			void muCOSAW32_def_window_frame_extents(uint32_m* data) {
+				data[0] = data[1] = data[3] = (uint32_m)GetSystemMetrics(SM_CXSIZEFRAME);
+				data[2] = (uint32_m)(GetSystemMetrics(SM_CYFRAME) + GetSystemMetrics(SM_CYCAPTION) + GetSystemMetrics(92));
+			}
+
+			// Get frame extents for a window
+			// I LOVE YOU BILL GATES!!!!!
+			void muCOSAW32_window_get_frame_extents(muCOSAW32_Window* win, uint32_m* data) {
+				// Fallback
+				muCOSAW32_def_window_frame_extents(data);
+
+				// Get window and client rect
+				RECT wr, cr;
+				if (!GetWindowRect(win->handles.hwnd, &wr)) {
+					// (Not returning error since default window frame extents are filled)
+					return;
+				}
+				if (!GetClientRect(win->handles.hwnd, &cr)) {
+					return;
+				}
+
+				// Map client rect to window points
+				if (!MapWindowPoints(win->handles.hwnd, NULL, (LPPOINT)&cr, 2)) {
+					return;
+				}
+
+				// Set values based on window and client rect
+				data[0] = (uint32_m)(cr.left-wr.left);
+				data[1] = (uint32_m)(wr.right-cr.right);
+				data[2] = (uint32_m)(cr.top-wr.top);
+				data[3] = (uint32_m)(wr.bottom-cr.bottom);
+			}
+
+		/* Dimensions */
+
+			muCOSAResult muCOSAW32_window_get_dimensions(muCOSAW32_Window* win, uint32_m* data) {
+				// Get client rect
+				RECT r;
+				if (!GetClientRect(win->handles.hwnd, &r)) {
+					return MUCOSA_WIN32_FAILED_GET_WINDOW_ATTRIB;
+				}
+
+				// Set values
+				data[0] = (uint32_m)(r.right-r.left);
+				data[1] = (uint32_m)(r.bottom-r.top);
+				return MUCOSA_SUCCESS;
+			}
+
+			muCOSAResult muCOSAW32_window_set_dimensions(muCOSAW32_Window* win, uint32_m* data) {
+				// Get general window info for style
+				WINDOWINFO wi;
+				if (!GetWindowInfo(win->handles.hwnd, &wi)) {
+					return MUCOSA_WIN32_FAILED_SET_WINDOW_ATTRIB;
+				}
+
+				// Calculate rect
+				RECT r;
+				r.left = r.top = 0;
+				r.right = data[0];
+				r.bottom = data[1];
+
+				// Calculate appropriate window rect for dimensions
+				if (!AdjustWindowRect(&r, wi.dwStyle, FALSE)) {
+					return MUCOSA_WIN32_FAILED_SET_WINDOW_ATTRIB;
+				}
+
+				// Set window rect based on this
+				if (!SetWindowPos(win->handles.hwnd, HWND_TOP, 0, 0, r.right-r.left, r.bottom-r.top, SWP_NOACTIVATE | SWP_NOZORDER | SWP_NOMOVE)) {
+					return MUCOSA_WIN32_FAILED_SET_WINDOW_ATTRIB;
+				}
+				return MUCOSA_SUCCESS;
+			}
+
+		/* Position */
+
+			muCOSAResult muCOSAW32_window_get_position(muCOSAW32_Window* win, int32_m* data) {
+				// Get window rect
+				RECT r;
+				if (!GetWindowRect(win->handles.hwnd, &r)) {
+					return MUCOSA_WIN32_FAILED_GET_WINDOW_ATTRIB;
+				}
+
+				// Get frame extents
+				uint32_m fe[4];
+				muCOSAW32_window_get_frame_extents(win, fe);
+
+				// Set position based on rect and relative frame extents
+				data[0] = (int32_m)(r.left) + (int32_m)(fe[0]);
+				data[1] = (int32_m)(r.top) + (int32_m)(fe[2]);
+				return MUCOSA_SUCCESS;
+			}
+
+			muCOSAResult muCOSAW32_window_set_position(muCOSAW32_Window* win, int32_m* data) {
+				// Get frame extents
+				uint32_m fe[4];
+				muCOSAW32_window_get_frame_extents(win, fe);
+
+				// Translate x and y based on extents
+				int32_m x = data[0] - (int32_m)(fe[0]);
+				int32_m y = data[1] - (int32_m)(fe[2]);
+
+				// Set window position
+				if (!SetWindowPos(win->handles.hwnd, HWND_TOP, x, y, 0, 0, SWP_NOACTIVATE | SWP_NOZORDER | SWP_NOSIZE)) {
+					return MUCOSA_WIN32_FAILED_SET_WINDOW_ATTRIB;
+				}
+				return MUCOSA_SUCCESS;
+			}
+
+		/* Keymaps */
+
+			muCOSAResult muCOSAW32_window_get_keyboard_map(muCOSAW32_Window* win, muBool** data) {
+				// Point to keyboard keymap
+				*data = win->keymaps.keyboard;
+				return MUCOSA_SUCCESS;
+			}
+
+			muCOSAResult muCOSAW32_window_get_keystate_map(muCOSAW32_Window* win, muBool** data) {
+				// Point to keystate keymap
+				*data = win->keymaps.keystates;
+				return MUCOSA_SUCCESS;
+			}
+
+			muCOSAResult muCOSAW32_window_get_mouse_map(muCOSAW32_Window* win, muBool** data) {
+				// Point to mouse keymap
+				*data = win->keymaps.mouse;
+				return MUCOSA_SUCCESS;
+			}
+
+		/* Cursor */
+
+			muCOSAResult muCOSAW32_window_get_cursor_pos(muCOSAW32_Window* win, int32_m* data) {
+				// Get cursor position
+				POINT p;
+				if (!GetCursorPos(&p)) {
+					return MUCOSA_WIN32_FAILED_GET_WINDOW_ATTRIB;
+				}
+
+				// Get window position
+				int32_m wpos[2];
+				muCOSAResult res = muCOSAW32_window_get_position(win, wpos);
+				if (muCOSA_result_is_fatal(res)) {
+					return MUCOSA_WIN32_FAILED_GET_WINDOW_ATTRIB;
+				}
+
+				// Retrieve cursor position relative to window
+				data[0] = p.x-wpos[0];
+				data[1] = p.y-wpos[1];
+				return res;
+			}
+
+			muCOSAResult muCOSAW32_window_set_cursor_pos(muCOSAW32_Window* win, int32_m* data) {
+				// Get window position
+				int32_m wpos[2];
+				muCOSAResult res = muCOSAW32_window_get_position(win, wpos);
+				if (muCOSA_result_is_fatal(res)) {
+					return MUCOSA_WIN32_FAILED_SET_WINDOW_ATTRIB;
+				}
+
+				// Set cursor position relative to window
+				if (!SetCursorPos(wpos[0]+data[0], wpos[1]+data[1])) {
+					return MUCOSA_WIN32_FAILED_SET_WINDOW_ATTRIB;
+				}
+				return res;
+			}
+
+			muCOSAResult muCOSAW32_window_get_cursor_style(muCOSAW32_Window* win, muCursorStyle* data) {
+				// Set data to cursor style
+				*data = win->states.cursor_style;
+				return MUCOSA_SUCCESS;
+			}
+
+			muCOSAResult muCOSAW32_window_set_cursor_style(muCOSAW32_Window* win, muCursorStyle* data) {
+				// Set internal storage to cursor style
+				win->states.cursor_style = *data;
+				// Destroy cursor
+				DestroyCursor(win->handles.hcursor);
+				// Load cursor
+				win->handles.hcursor = LoadCursor(0, (LPCSTR)muCOSAW32_muCOSA_cursor_to_W32(*data));
+				// Set cursor
+				SetCursor(win->handles.hcursor);
+				return MUCOSA_SUCCESS;
+			}
+
+		/* Scroll */
+
+			void muCOSAW32_window_get_scroll(muCOSAW32_Window* win, int32_m* data) {
+				// Give scroll level
+				*data = win->props.scroll_level;
+			}
+
+			void muCOSAW32_window_set_scroll(muCOSAW32_Window* win, int32_m* data) {
+				// Overwrite scroll level
+				win->props.scroll_level = *data;
+			}
+
+		/* Event time */
+
+			void muCOSAW32_window_get_event_time(muCOSAW32_Window* win, double* data) {
+				// Give time of the most recent event
+				*data = win->events.time;
+			}
+
+		/* Raw motion */
+
+			void muCOSAW32_window_get_raw_motion(muCOSAW32_Window* win, muBool* data) {
+				*data = win->states.raw_motion;
+			}
+
+			muCOSAResult muCOSAW32_window_set_raw_motion(muCOSAW32_Window* win, muBool* data) {
+				// Register the mouse for raw input if enabling
+				// (Registration is per-process, so it's left registered afterwards;
+				// WM_INPUT is simply ignored for windows without raw motion)
+				if (*data && !win->states.raw_motion) {
+					RAWINPUTDEVICE rid = MU_ZERO_STRUCT(RAWINPUTDEVICE);
+					// - Generic desktop controls, mouse
+					rid.usUsagePage = 0x01;
+					rid.usUsage = 0x02;
+					// - Sent to the window with keyboard focus
+					rid.dwFlags = 0;
+					rid.hwndTarget = NULL;
+					if (!RegisterRawInputDevices(&rid, 1, sizeof(rid))) {
+						return MUCOSA_WIN32_FAILED_REGISTER_RAW_INPUT;
+					}
+				}
+
+				win->states.raw_motion = *data;
+				return MUCOSA_SUCCESS;
+			}
+
+		/* Pointer lock */
+
+			void muCOSAW32_window_get_pointer_lock(muCOSAW32_Window* win, muBool* data) {
+				*data = win->states.pointer_lock;
+			}
+
+			muCOSAResult muCOSAW32_window_set_pointer_lock(muCOSAW32_Window* win, muBool* data) {
+				if (*data == win->states.pointer_lock) {
+					return MUCOSA_SUCCESS;
+				}
+
+				// Lock: clip the cursor to the window (if focused)
+				win->states.pointer_lock = *data;
+				if (*data) {
+					muCOSAW32_update_clip(win);
+				}
+				// Unlock: release the clip
+				else {
+					ClipCursor(NULL);
+				}
+
+				// Update the cursor's visibility
+				POINT p;
+				if (GetCursorPos(&p)) {
+					SetCursorPos(p.x, p.y);
+				}
+				return MUCOSA_SUCCESS;
+			}
+
+		/* Callbacks */
+
+			void muCOSAW32_window_set_callback(muCOSAW32_Window* win, muWindowAttrib attrib, void* fun) {
+				switch (attrib) {
+					case MU_WINDOW_DIMENSIONS_CALLBACK: {
+						mu_memcpy(&win->callbacks.dimensions, fun, sizeof(win->callbacks.dimensions));
+					} break;
+					case MU_WINDOW_POSITION_CALLBACK: {
+						mu_memcpy(&win->callbacks.position, fun, sizeof(win->callbacks.position));
+					} break;
+					case MU_WINDOW_KEYBOARD_CALLBACK: {
+						mu_memcpy(&win->callbacks.keyboard, fun, sizeof(win->callbacks.keyboard));
+					} break;
+					case MU_WINDOW_KEYSTATE_CALLBACK: {
+						mu_memcpy(&win->callbacks.keystate, fun, sizeof(win->callbacks.keystate));
+					} break;
+					case MU_WINDOW_MOUSE_KEY_CALLBACK: {
+						mu_memcpy(&win->callbacks.mouse_key, fun, sizeof(win->callbacks.mouse_key));
+					} break;
+					case MU_WINDOW_CURSOR_CALLBACK: {
+						mu_memcpy(&win->callbacks.cursor, fun, sizeof(win->callbacks.cursor));
+					} break;
+					case MU_WINDOW_SCROLL_CALLBACK: {
+						mu_memcpy(&win->callbacks.scroll, fun, sizeof(win->callbacks.scroll));
+					} break;
+					case MU_WINDOW_FRAME_CALLBACK: {
+						mu_memcpy(&win->callbacks.frame, fun, sizeof(win->callbacks.frame));
+					} break;
+					case MU_WINDOW_RAW_MOTION_CALLBACK: {
+						mu_memcpy(&win->callbacks.raw_motion, fun, sizeof(win->callbacks.raw_motion));
+					} break;
+				}
+			}
+
+		/* Text input */
+
+			void muCOSAW32_window_update_text_cursor(muCOSAResult* result, muCOSAW32_Window* win, uint32_m cx, uint32_m cy);
+			void muCOSAW32_window_get_text_input(muCOSAResult* result, muCOSAW32_Window* win, uint32_m cx, uint32_m cy, void (*callback)(muWindow, uint8_m*)) {
+				// Associate IMM context with this window
+				if (!ImmAssociateContextEx(win->handles.hwnd, NULL, IACE_DEFAULT)) {
+					MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_ASSOCIATE_IMM)
+					return;
+				}
+
+				// Set callback
+				win->props.text_input_callback = callback;
+				// Update text cursor position
+				muCOSAW32_window_update_text_cursor(0, win, cx, cy);
+			}
+
+			void muCOSAW32_window_let_text_input(muCOSAW32_Window* win) {
+				// Set callback to nothing
+				win->props.text_input_callback = 0;
+				// Deassociate IMM context
+				ImmAssociateContextEx(win->handles.hwnd, NULL, 0);
+			}
+
+			void muCOSAW32_window_update_text_cursor(muCOSAResult* result, muCOSAW32_Window* win, uint32_m cx, uint32_m cy) {
+				// Do nothing if text input isn't being taken
+				if (!win->props.text_input_callback) {
+					return;
+				}
+
+				// Might not be a good idea to keep grabbing an releasing IMM context,
+				// but the entire IMM is so fragile that the smallest change makes it
+				// not function at all. So, I'm keeping it like this :L
+
+				// Get IMM context handle
+				win->handles.imc = ImmGetContext(win->handles.hwnd);
+
+				// Fill out composition form
+				COMPOSITIONFORM cf = MU_ZERO_STRUCT(COMPOSITIONFORM);
+				cf.dwStyle = CFS_FORCE_POSITION;
+				cf.ptCurrentPos.x = cx;
+				cf.ptCurrentPos.y = cy;
+
+				// Send composition form
+				if (!ImmSetCompositionWindow(win->handles.imc, &cf)) {
+					MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_SET_COMPOSITION_WINDOW_POSITION)
+				}
+
+				// Release IMM context handle
+				ImmReleaseContext(win->handles.hwnd, win->handles.imc);
+			}
+
+		/* OpenGL */
+
+		#ifdef MU_SUPPORT_OPENGL
+
+			struct muCOSAW32_GL {
+				HDC dc;
+				HGLRC hgl;
+			};
+			typedef struct muCOSAW32_GL muCOSAW32_GL;
+
+			void* muCOSAW32_gl_context_create(muCOSAW32_Context* context, muCOSAResult* result, muCOSAW32_Window* win, muGraphicsAPI api) {
+				// Allocate memory for context
+				muCOSAW32_GL* gl = (muCOSAW32_GL*)mu_malloc(sizeof(muCOSAW32_GL));
+				if (!gl) {
+					MU_SET_RESULT(result, MUCOSA_FAILED_MALLOC)
+					return 0;
+				}
+				gl->dc = win->handles.dc;
+
+				// Create OpenGL context
+				muPixelFormat* format = 0;
+				if (win->props.use_format) {
+					format = &win->props.format;
+				}
+				muCOSAResult res = muCOSAW32_create_opengl_context(win->handles.dc, win->props.pixel_format, &context->wgl, format, &gl->hgl, api, &win->props.format_set);
+				if (res != MUCOSA_SUCCESS) {
+					MU_SET_RESULT(result, res)
+					if (muCOSA_result_is_fatal(res)) {
+						mu_free(gl);
+						gl = 0;
+					}
+				}
+				return gl;
+			}
+
+			void muCOSAW32_gl_context_destroy(muCOSAW32_GL* gl) {
+				wglDeleteContext(gl->hgl);
+				mu_free(gl);
+			}
+
+			muCOSAResult muCOSAW32_gl_bind(muCOSAW32_GL* gl) {
+				if (!wglMakeCurrent(gl->dc, gl->hgl)) {
+					return MUCOSA_WIN32_FAILED_SET_WGL_CONTEXT;
+				}
+				return MUCOSA_SUCCESS;
+			}
+
+			muCOSAResult muCOSAW32_gl_swap_buffers(muCOSAW32_Window* win) {
+				if (!SwapBuffers(win->handles.dc)) {
+					return MUCOSA_WIN32_FAILED_SWAP_WGL_BUFFERS;
+				}
+				return MUCOSA_SUCCESS;
+			}
+
+			void* muCOSAW32_gl_get_proc_address(const char* name) {
+				// Get proc address based on name
+				PROC p = (PROC)wglGetProcAddress(name);
+
+				// If failed:
+				if (p == 0
+					|| (p == (PROC)1)
+					|| (p == (PROC)2)
+					|| (p == (PROC)3)
+					|| (p == (PROC)-1)
+				) {
+					// Try loading from DLL itself
+					HMODULE module = LoadLibraryA("opengl32.dll");
+					p = (PROC)GetProcAddress(module, name);
+				}
+
+				// Convert to void* in a way that avoids warnings
+				void* vptr = 0;
+				mu_memcpy(&vptr, &p, sizeof(void*));
+				return vptr;
+			}
+
+			muBool muCOSAW32_gl_swap_interval(muCOSAW32_Context* context, muCOSAResult* result, int interval) {
+				// If the swap interval function was not found when loading, quit
+				if (!context->wgl.SwapInterval) {
+					MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_FIND_WGL_FUNCTION)
+					return 0;
+				}
+
+				// Return a call to it if we've found it
+				return context->wgl.SwapInterval(interval);
+			}
+
+		#endif /* MU_SUPPORT_OPENGL */
+
+		/* Vulkan */
+
+		#ifdef MU_SUPPORT_VULKAN
+
+			// VkWin32SurfaceCreateInfoKHR
+			struct muCOSAW32_VkSurfaceCreateInfo {
+				VkStructureType sType;
+				const void* pNext;
+				VkFlags flags;
+				HINSTANCE hinstance;
+				HWND hwnd;
+			};
+			typedef struct muCOSAW32_VkSurfaceCreateInfo muCOSAW32_VkSurfaceCreateInfo;
+
+			// Instance extensions needed to create surfaces
+			const char* muCOSAW32_vk_extensions[2] = { "VK_KHR_surface", "VK_KHR_win32_surface" };
+
+			muCOSAResult muCOSAW32_vk_create_surface(muCOSAW32_Window* win, void* instance, void* allocator, void* surface) {
+				muCOSAW32_VkSurfaceCreateInfo ci = MU_ZERO_STRUCT(muCOSAW32_VkSurfaceCreateInfo);
+				ci.sType = (VkStructureType)MUCOSAVK_STRUCTURE_TYPE_WIN32_SURFACE_CREATE_INFO_KHR;
+				ci.hinstance = win->handles.hinstance;
+				ci.hwnd = win->handles.hwnd;
+				return muCOSAVK_create_surface("vkCreateWin32SurfaceKHR", instance, &ci, allocator, surface);
+			}
+
+		#endif /* MU_SUPPORT_VULKAN */
+
+	#endif /* MUCOSA_WIN32 */
+
+	/* POSIX */
+
+	// Time, sleep, and wait functionality shared by the window systems that run
+	// on POSIX systems (X11 and Wayland).
+
+	#ifdef MUCOSA_POSIX
+
+		#include <time.h>
+		#include <errno.h>
+		#include <poll.h>
+		#include <unistd.h>
+		#include <fcntl.h>
+
+		/* Time */
+
+			struct muCOSAPOSIX_Time {
+				// The original time the context was created.
+				double orig_time;
+				// The non-overwritable time.
+				double fixed_time;
+			};
+			typedef struct muCOSAPOSIX_Time muCOSAPOSIX_Time;
+
+			// Uses the monotonic clock so that changes to the system time don't
+			// make the context time jump around
+			double muCOSAPOSIX_get_current_time(void) {
+				struct timespec ts;
+				clock_gettime(CLOCK_MONOTONIC, &ts);
+				return (double)ts.tv_sec + ((double)ts.tv_nsec / 1.0e9);
+			}
+
+			// Initiates the time struct
+			void muCOSAPOSIX_time_init(muCOSAPOSIX_Time* time) {
+				// Set time to current time
+				time->orig_time = time->fixed_time = muCOSAPOSIX_get_current_time();
+			}
+
+			double muCOSAPOSIX_fixed_time_get(muCOSAPOSIX_Time* time) {
+				// Return the difference between now and when the context was created
+				return muCOSAPOSIX_get_current_time() - time->fixed_time;
+			}
+
+			double muCOSAPOSIX_time_get(muCOSAPOSIX_Time* time) {
+				// Return the difference between now and the overridable original time
+				return muCOSAPOSIX_get_current_time() - time->orig_time;
+			}
+
+			void muCOSAPOSIX_time_set(muCOSAPOSIX_Time* time, double set) {
+				// Set time to current time minus the given time
+				time->orig_time = muCOSAPOSIX_get_current_time() - set;
+			}
+
+		/* Sleep */
+
+			void muCOSAPOSIX_sleep(double time) {
+				// Nothing to do for non-positive amounts of time
+				if (time <= 0.0) {
+					return;
+				}
+
+				// Split seconds into seconds + nanoseconds
+				struct timespec ts;
+				ts.tv_sec = (time_t)time;
+				ts.tv_nsec = (long)((time - (double)ts.tv_sec) * 1.0e9);
+
+				// Sleep, continuing with the remaining time if interrupted by a signal
+				while (nanosleep(&ts, &ts) == -1 && errno == EINTR) {
+					// ...
+				}
+			}
+
+		/* Wait */
+
+			// Pipe written to in order to interrupt a wait from another thread; both
+			// ends are non-blocking so that waking never blocks, and so that it can be
+			// emptied without knowing how many times it was written to
+			struct muCOSAPOSIX_Wake {
+				// Read end + write end (both -1 if the pipe couldn't be created)
+				int fds[2];
+			};
+			typedef struct muCOSAPOSIX_Wake muCOSAPOSIX_Wake;
+
+			void muCOSAPOSIX_wake_init(muCOSAPOSIX_Wake* wake) {
+				// Create pipe; waits can't be interrupted if this fails, but still work
+				if (pipe(wake->fds) != 0) {
+					wake->fds[0] = wake->fds[1] = -1;
+					return;
+				}
+
+				// Make both ends non-blocking + not inherited by child processes
+				for (int i = 0; i < 2; ++i) {
+					fcntl(wake->fds[i], F_SETFL, fcntl(wake->fds[i], F_GETFL) | O_NONBLOCK);
+					fcntl(wake->fds[i], F_SETFD, FD_CLOEXEC);
+				}
+			}
+
+			void muCOSAPOSIX_wake_term(muCOSAPOSIX_Wake* wake) {
+				if (wake->fds[0] >= 0) {
+					close(wake->fds[0]);
+					close(wake->fds[1]);
+				}
+			}
+
+			void muCOSAPOSIX_wake(muCOSAPOSIX_Wake* wake) {
+				// Write a byte; if the pipe is full, a wake is already pending anyway
+				if (wake->fds[1] >= 0) {
+					uint8_m b = 0;
+					if (write(wake->fds[1], &b, 1)) {}
+				}
+			}
+
+			// Waits until a file descriptor has data to read, the wait is woken, or the
+			// timeout (in seconds; negative for none) elapses, returning if the file
+			// descriptor has data to read
+			muBool muCOSAPOSIX_wait(muCOSAPOSIX_Wake* wake, int fd, double timeout) {
+				// Calculate time we need to give up at
+				double end = muCOSAPOSIX_get_current_time() + timeout;
+
+				// Wait on both the file descriptor and the wake pipe (a negative file
+				// descriptor is ignored by poll)
+				struct pollfd pfds[2];
+				pfds[0].fd = fd;
+				pfds[0].events = POLLIN;
+				pfds[1].fd = wake->fds[0];
+				pfds[1].events = POLLIN;
+				while (1) {
+					// Convert time left to milliseconds, rounding up so that a short
+					// timeout doesn't turn into a busy loop
+					int ms = -1;
+					if (timeout >= 0.0) {
+						double left = end - muCOSAPOSIX_get_current_time();
+						ms = (left <= 0.0) ? 0 : (int)(left * 1000.0) + 1;
+					}
+
+					// Wait, continuing with the remaining time if interrupted by a signal
+					pfds[0].revents = pfds[1].revents = 0;
+					if (poll(pfds, 2, ms) != -1 || errno != EINTR) {
+						break;
+					}
+				}
+
+				// Empty the wake pipe so that the next wait isn't woken by this wake
+				if (pfds[1].revents) {
+					uint8_m buf[64];
+					while (read(wake->fds[0], buf, sizeof(buf)) > 0) {
+						// ...
+					}
+				}
+				return pfds[0].revents != 0;
+			}
+
+	#endif /* MUCOSA_POSIX */
+
+	/* X keysyms */
+
+	// Keysym and text conversion shared by the window systems that describe keys
+	// with X keysyms (X11, and Wayland through xkbcommon, whose keysyms match).
+
+	#ifdef MUCOSA_XKEYSYM
+
+		#include <X11/keysym.h>
+
+		/* Keys */
+
+			// X keysym to muCOSA key code
+			muKeyboardKey muCOSAXK_keysym_to_muCOSA(uint32_m sym) {
+				switch (sym) {
+					default: return MU_KEYBOARD_UNKNOWN; break;
+					case XK_BackSpace: return MU_KEYBOARD_BACKSPACE; break;
+					case XK_Tab: return MU_KEYBOARD_TAB; break;
+					case XK_Clear: return MU_KEYBOARD_CLEAR; break;
+					case XK_Return: return MU_KEYBOARD_RETURN; break;
+					case XK_Pause: return MU_KEYBOARD_PAUSE; break;
+					case XK_Escape: return MU_KEYBOARD_ESCAPE; break;
+					case XK_Mode_switch: return MU_KEYBOARD_MODECHANGE; break;
+					case XK_space: return MU_KEYBOARD_SPACE; break;
+					case XK_Prior: return MU_KEYBOARD_PRIOR; break;
+					case XK_Next: return MU_KEYBOARD_NEXT; break;
+					case XK_End: return MU_KEYBOARD_END; break;
+					case XK_Home: return MU_KEYBOARD_HOME; break;
+					case XK_Left: return MU_KEYBOARD_LEFT; break;
+					case XK_Up: return MU_KEYBOARD_UP; break;
+					case XK_Right: return MU_KEYBOARD_RIGHT; break;
+					case XK_Down: return MU_KEYBOARD_DOWN; break;
+					case XK_Select: return MU_KEYBOARD_SELECT; break;
+					case XK_Print: return MU_KEYBOARD_PRINT; break;
+					case XK_Execute: return MU_KEYBOARD_EXECUTE; break;
+					case XK_Insert: return MU_KEYBOARD_INSERT; break;
+					case XK_Delete: return MU_KEYBOARD_DELETE; break;
+					case XK_Help: return MU_KEYBOARD_HELP; break;
+					case XK_0: return MU_KEYBOARD_0; break;
+					case XK_1: return MU_KEYBOARD_1; break;
+					case XK_2: return MU_KEYBOARD_2; break;
+					case XK_3: return MU_KEYBOARD_3; break;
+					case XK_4: return MU_KEYBOARD_4; break;
+					case XK_5: return MU_KEYBOARD_5; break;
+					case XK_6: return MU_KEYBOARD_6; break;
+					case XK_7: return MU_KEYBOARD_7; break;
+					case XK_8: return MU_KEYBOARD_8; break;
+					case XK_9: return MU_KEYBOARD_9; break;
+					case XK_a: return MU_KEYBOARD_A; break;
+					case XK_b: return MU_KEYBOARD_B; break;
+					case XK_c: return MU_KEYBOARD_C; break;
+					case XK_d: return MU_KEYBOARD_D; break;
+					case XK_e: return MU_KEYBOARD_E; break;
+					case XK_f: return MU_KEYBOARD_F; break;
+					case XK_g: return MU_KEYBOARD_G; break;
+					case XK_h: return MU_KEYBOARD_H; break;
+					case XK_i: return MU_KEYBOARD_I; break;
+					case XK_j: return MU_KEYBOARD_J; break;
+					case XK_k: return MU_KEYBOARD_K; break;
+					case XK_l: return MU_KEYBOARD_L; break;
+					case XK_m: return MU_KEYBOARD_M; break;
+					case XK_n: return MU_KEYBOARD_N; break;
+					case XK_o: return MU_KEYBOARD_O; break;
+					case XK_p: return MU_KEYBOARD_P; break;
+					case XK_q: return MU_KEYBOARD_Q; break;
+					case XK_r: return MU_KEYBOARD_R; break;
+					case XK_s: return MU_KEYBOARD_S; break;
+					case XK_t: return MU_KEYBOARD_T; break;
+					case XK_u: return MU_KEYBOARD_U; break;
+					case XK_v: return MU_KEYBOARD_V; break;
+					case XK_w: return MU_KEYBOARD_W; break;
+					case XK_x: return MU_KEYBOARD_X; break;
+					case XK_y: return MU_KEYBOARD_Y; break;
+					case XK_z: return MU_KEYBOARD_Z; break;
+					case XK_Super_L: return MU_KEYBOARD_LEFT_WINDOWS; break;
+					case XK_Super_R: return MU_KEYBOARD_RIGHT_WINDOWS; break;
+					case XK_KP_0: return MU_KEYBOARD_NUMPAD_0; break;
+					case XK_KP_1: return MU_KEYBOARD_NUMPAD_1; break;
+					case XK_KP_2: return MU_KEYBOARD_NUMPAD_2; break;
+					case XK_KP_3: return MU_KEYBOARD_NUMPAD_3; break;
+					case XK_KP_4: return MU_KEYBOARD_NUMPAD_4; break;
+					case XK_KP_5: return MU_KEYBOARD_NUMPAD_5; break;
+					case XK_KP_6: return MU_KEYBOARD_NUMPAD_6; break;
+					case XK_KP_7: return MU_KEYBOARD_NUMPAD_7; break;
+					case XK_KP_8: return MU_KEYBOARD_NUMPAD_8; break;
+					case XK_KP_9: return MU_KEYBOARD_NUMPAD_9; break;
+					case XK_KP_Multiply: return MU_KEYBOARD_MULTIPLY; break;
+					case XK_KP_Add: return MU_KEYBOARD_ADD; break;
+					case XK_KP_Separator: return MU_KEYBOARD_SEPARATOR; break;
+					case XK_KP_Subtract: return MU_KEYBOARD_SUBTRACT; break;
+					case XK_KP_Decimal: return MU_KEYBOARD_DECIMAL; break;
+					case XK_KP_Divide: return MU_KEYBOARD_DIVIDE; break;
+					case XK_F1: return MU_KEYBOARD_F1; break;
+					case XK_F2: return MU_KEYBOARD_F2; break;
+					case XK_F3: return MU_KEYBOARD_F3; break;
+					case XK_F4: return MU_KEYBOARD_F4; break;
+					case XK_F5: return MU_KEYBOARD_F5; break;
+					case XK_F6: return MU_KEYBOARD_F6; break;
+					case XK_F7: return MU_KEYBOARD_F7; break;
+					case XK_F8: return MU_KEYBOARD_F8; break;
+					case XK_F9: return MU_KEYBOARD_F9; break;
+					case XK_F10: return MU_KEYBOARD_F10; break;
+					case XK_F11: return MU_KEYBOARD_F11; break;
+					case XK_F12: return MU_KEYBOARD_F12; break;
+					case XK_F13: return MU_KEYBOARD_F13; break;
+					case XK_F14: return MU_KEYBOARD_F14; break;
+					case XK_F15: return MU_KEYBOARD_F15; break;
+					case XK_F16: return MU_KEYBOARD_F16; break;
+					case XK_F17: return MU_KEYBOARD_F17; break;
+					case XK_F18: return MU_KEYBOARD_F18; break;
+					case XK_F19: return MU_KEYBOARD_F19; break;
+					case XK_F20: return MU_KEYBOARD_F20; break;
+					case XK_F21: return MU_KEYBOARD_F21; break;
+					case XK_F22: return MU_KEYBOARD_F22; break;
+					case XK_F23: return MU_KEYBOARD_F23; break;
+					case XK_F24: return MU_KEYBOARD_F24; break;
+					case XK_Num_Lock: return MU_KEYBOARD_NUMLOCK; break;
+					case XK_Scroll_Lock: return MU_KEYBOARD_SCROLL; break;
+					case XK_Shift_L: return MU_KEYBOARD_LEFT_SHIFT; break;
+					case XK_Shift_R: return MU_KEYBOARD_RIGHT_SHIFT; break;
+					case XK_Control_L: return MU_KEYBOARD_LEFT_CONTROL; break;
+					case XK_Control_R: return MU_KEYBOARD_RIGHT_CONTROL; break;
+					case XK_Alt_L: return MU_KEYBOARD_LEFT_MENU; break;
+					case XK_Alt_R: return MU_KEYBOARD_RIGHT_MENU; break;
+					// (AltGr usually replaces the right alt key)
+					case XK_ISO_Level3_Shift: return MU_KEYBOARD_RIGHT_MENU; break;
+					// (3270 keysyms aren't defined by keysym.h by default)
+					case 0xFD0E: return MU_KEYBOARD_ATTN; break;
+					case 0xFD1C: return MU_KEYBOARD_CRSEL; break;
+					case 0xFD1B: return MU_KEYBOARD_EXSEL; break;
+					case 0xFD06: return MU_KEYBOARD_EREOF; break;
+					case 0xFD16: return MU_KEYBOARD_PLAY; break;
+					case 0xFD0A: return MU_KEYBOARD_PA1; break;
+				}
+			}
+
+			// muCOSA key code to X keysym (0 if there isn't one)
+			uint32_m muCOSAXK_muCOSA_to_keysym(muKeyboardKey key) {
+				switch (key) {
+					default: return 0; break;
+					case MU_KEYBOARD_BACKSPACE: return XK_BackSpace; break;
+					case MU_KEYBOARD_TAB: return XK_Tab; break;
+					case MU_KEYBOARD_CLEAR: return XK_Clear; break;
+					case MU_KEYBOARD_RETURN: return XK_Return; break;
+					case MU_KEYBOARD_PAUSE: return XK_Pause; break;
+					case MU_KEYBOARD_ESCAPE: return XK_Escape; break;
+					case MU_KEYBOARD_MODECHANGE: return XK_Mode_switch; break;
+					case MU_KEYBOARD_SPACE: return XK_space; break;
+					case MU_KEYBOARD_PRIOR: return XK_Prior; break;
+					case MU_KEYBOARD_NEXT: return XK_Next; break;
+					case MU_KEYBOARD_END: return XK_End; break;
+					case MU_KEYBOARD_HOME: return XK_Home; break;
+					case MU_KEYBOARD_LEFT: return XK_Left; break;
+					case MU_KEYBOARD_UP: return XK_Up; break;
+					case MU_KEYBOARD_RIGHT: return XK_Right; break;
+					case MU_KEYBOARD_DOWN: return XK_Down; break;
+					case MU_KEYBOARD_SELECT: return XK_Select; break;
+					case MU_KEYBOARD_PRINT: return XK_Print; break;
+					case MU_KEYBOARD_EXECUTE: return XK_Execute; break;
+					case MU_KEYBOARD_INSERT: return XK_Insert; break;
+					case MU_KEYBOARD_DELETE: return XK_Delete; break;
+					case MU_KEYBOARD_HELP: return XK_Help; break;
+					case MU_KEYBOARD_0: return XK_0; break;
+					case MU_KEYBOARD_1: return XK_1; break;
+					case MU_KEYBOARD_2: return XK_2; break;
+					case MU_KEYBOARD_3: return XK_3; break;
+					case MU_KEYBOARD_4: return XK_4; break;
+					case MU_KEYBOARD_5: return XK_5; break;
+					case MU_KEYBOARD_6: return XK_6; break;
+					case MU_KEYBOARD_7: return XK_7; break;
+					case MU_KEYBOARD_8: return XK_8; break;
+					case MU_KEYBOARD_9: return XK_9; break;
+					case MU_KEYBOARD_A: return XK_a; break;
+					case MU_KEYBOARD_B: return XK_b; break;
+					case MU_KEYBOARD_C: return XK_c; break;
+					case MU_KEYBOARD_D: return XK_d; break;
+					case MU_KEYBOARD_E: return XK_e; break;
+					case MU_KEYBOARD_F: return XK_f; break;
+					case MU_KEYBOARD_G: return XK_g; break;
+					case MU_KEYBOARD_H: return XK_h; break;
+					case MU_KEYBOARD_I: return XK_i; break;
+					case MU_KEYBOARD_J: return XK_j; break;
+					case MU_KEYBOARD_K: return XK_k; break;
+					case MU_KEYBOARD_L: return XK_l; break;
+					case MU_KEYBOARD_M: return XK_m; break;
+					case MU_KEYBOARD_N: return XK_n; break;
+					case MU_KEYBOARD_O: return XK_o; break;
+					case MU_KEYBOARD_P: return XK_p; break;
+					case MU_KEYBOARD_Q: return XK_q; break;
+					case MU_KEYBOARD_R: return XK_r; break;
+					case MU_KEYBOARD_S: return XK_s; break;
+					case MU_KEYBOARD_T: return XK_t; break;
+					case MU_KEYBOARD_U: return XK_u; break;
+					case MU_KEYBOARD_V: return XK_v; break;
+					case MU_KEYBOARD_W: return XK_w; break;
+					case MU_KEYBOARD_X: return XK_x; break;
+					case MU_KEYBOARD_Y: return XK_y; break;
+					case MU_KEYBOARD_Z: return XK_z; break;
+					case MU_KEYBOARD_LEFT_WINDOWS: return XK_Super_L; break;
+					case MU_KEYBOARD_RIGHT_WINDOWS: return XK_Super_R; break;
+					case MU_KEYBOARD_NUMPAD_0: return XK_KP_0; break;
+					case MU_KEYBOARD_NUMPAD_1: return XK_KP_1; break;
+					case MU_KEYBOARD_NUMPAD_2: return XK_KP_2; break;
+					case MU_KEYBOARD_NUMPAD_3: return XK_KP_3; break;
+					case MU_KEYBOARD_NUMPAD_4: return XK_KP_4; break;
+					case MU_KEYBOARD_NUMPAD_5: return XK_KP_5; break;
+					case MU_KEYBOARD_NUMPAD_6: return XK_KP_6; break;
+					case MU_KEYBOARD_NUMPAD_7: return XK_KP_7; break;
+					case MU_KEYBOARD_NUMPAD_8: return XK_KP_8; break;
+					case MU_KEYBOARD_NUMPAD_9: return XK_KP_9; break;
+					case MU_KEYBOARD_MULTIPLY: return XK_KP_Multiply; break;
+					case MU_KEYBOARD_ADD: return XK_KP_Add; break;
+					case MU_KEYBOARD_SEPARATOR: return XK_KP_Separator; break;
+					case MU_KEYBOARD_SUBTRACT: return XK_KP_Subtract; break;
+					case MU_KEYBOARD_DECIMAL: return XK_KP_Decimal; break;
+					case MU_KEYBOARD_DIVIDE: return XK_KP_Divide; break;
+					case MU_KEYBOARD_F1: return XK_F1; break;
+					case MU_KEYBOARD_F2: return XK_F2; break;
+					case MU_KEYBOARD_F3: return XK_F3; break;
+					case MU_KEYBOARD_F4: return XK_F4; break;
+					case MU_KEYBOARD_F5: return XK_F5; break;
+					case MU_KEYBOARD_F6: return XK_F6; break;
+					case MU_KEYBOARD_F7: return XK_F7; break;
+					case MU_KEYBOARD_F8: return XK_F8; break;
+					case MU_KEYBOARD_F9: return XK_F9; break;
+					case MU_KEYBOARD_F10: return XK_F10; break;
+					case MU_KEYBOARD_F11: return XK_F11; break;
+					case MU_KEYBOARD_F12: return XK_F12; break;
+					case MU_KEYBOARD_F13: return XK_F13; break;
+					case MU_KEYBOARD_F14: return XK_F14; break;
+					case MU_KEYBOARD_F15: return XK_F15; break;
+					case MU_KEYBOARD_F16: return XK_F16; break;
+					case MU_KEYBOARD_F17: return XK_F17; break;
+					case MU_KEYBOARD_F18: return XK_F18; break;
+					case MU_KEYBOARD_F19: return XK_F19; break;
+					case MU_KEYBOARD_F20: return XK_F20; break;
+					case MU_KEYBOARD_F21: return XK_F21; break;
+					case MU_KEYBOARD_F22: return XK_F22; break;
+					case MU_KEYBOARD_F23: return XK_F23; break;
+					case MU_KEYBOARD_F24: return XK_F24; break;
+					case MU_KEYBOARD_NUMLOCK: return XK_Num_Lock; break;
+					case MU_KEYBOARD_SCROLL: return XK_Scroll_Lock; break;
+					case MU_KEYBOARD_LEFT_SHIFT: return XK_Shift_L; break;
+					case MU_KEYBOARD_RIGHT_SHIFT: return XK_Shift_R; break;
+					case MU_KEYBOARD_LEFT_CONTROL: return XK_Control_L; break;
+					case MU_KEYBOARD_RIGHT_CONTROL: return XK_Control_R; break;
+					case MU_KEYBOARD_LEFT_MENU: return XK_Alt_L; break;
+					case MU_KEYBOARD_RIGHT_MENU: return XK_Alt_R; break;
+					case MU_KEYBOARD_ATTN: return 0xFD0E; break;
+					case MU_KEYBOARD_CRSEL: return 0xFD1C; break;
+					case MU_KEYBOARD_EXSEL: return 0xFD1B; break;
+					case MU_KEYBOARD_EREOF: return 0xFD06; break;
+					case MU_KEYBOARD_PLAY: return 0xFD16; break;
+					case MU_KEYBOARD_PA1: return 0xFD0A; break;
+				}
+			}
+
+		/* Text */
+
+			// Encodes a Unicode codepoint as UTF-8; returns the amount of bytes written
+			int muCOSAXK_codepoint_to_utf8(uint32_m codepoint, uint8_m* data) {
+				// Storable in 7 bits = 1 byte
+				if (codepoint < 0x80) {
+					data[0] = (uint8_m)codepoint;
+					return 1;
+				}
+				// Storable in 11 bits = 2 bytes
+				if (codepoint < 0x800) {
+					data[0] = (uint8_m)(0xC0 | (codepoint >> 6));
+					data[1] = (uint8_m)(0x80 | (codepoint & 0x3F));
+					return 2;
+				}
+				// Storable in 16 bits = 3 bytes
+				if (codepoint < 0x10000) {
+					data[0] = (uint8_m)(0xE0 | (codepoint >> 12));
+					data[1] = (uint8_m)(0x80 | ((codepoint >> 6) & 0x3F));
+					data[2] = (uint8_m)(0x80 | (codepoint & 0x3F));
+					return 3;
+				}
+				data[0] = (uint8_m)(0xF0 | (codepoint >> 18));
+				data[1] = (uint8_m)(0x80 | ((codepoint >> 12) & 0x3F));
+				data[2] = (uint8_m)(0x80 | ((codepoint >> 6) & 0x3F));
+				data[3] = (uint8_m)(0x80 | (codepoint & 0x3F));
+				return 4;
+			}
+
+			// Gets the amount of bytes in a UTF-8 character based on its first byte
+			int muCOSAXK_utf8_char_size(uint8_m byte) {
+				if (byte < 0x80) {
+					return 1;
+				}
+				if (byte >= 0xC0 && byte < 0xE0) {
+					return 2;
+				}
+				if (byte >= 0xE0 && byte < 0xF0) {
+					return 3;
+				}
+				if (byte >= 0xF0 && byte <= 0xF7) {
+					return 4;
+				}
+				// (Invalid; skip the byte)
+				return 1;
+			}
+
+	#endif /* MUCOSA_XKEYSYM */
+
+	/* Pixel rectangles */
+
+	// Clipping of the rectangles given when presenting pixels, shared by every
+	// window system that supports pixel presentation.
+
+	#if defined(MUCOSA_X11) || defined(MUCOSA_WAYLAND) || defined(MUCOSA_HEADLESS)
+
+		// Clips a rectangle (0 for the entire buffer) to the dimensions of a buffer;
+		// returns if any part of the rectangle is left
+		muBool muCOSA_pixel_rect_clip(muPixelRect* rect, uint32_m width, uint32_m height, muPixelRect* clipped) {
+			// Entire buffer
+			if (!rect) {
+				clipped->x = clipped->y = 0;
+				clipped->width = width;
+				clipped->height = height;
+				return width != 0 && height != 0;
+			}
+
+			// Clip each edge
+			int64_m x1 = (rect->x < 0) ? 0 : (int64_m)rect->x;
+			int64_m y1 = (rect->y < 0) ? 0 : (int64_m)rect->y;
+			int64_m x2 = (int64_m)rect->x + (int64_m)rect->width;
+			int64_m y2 = (int64_m)rect->y + (int64_m)rect->height;
+			if (x2 > (int64_m)width) {
+				x2 = (int64_m)width;
+			}
+			if (y2 > (int64_m)height) {
+				y2 = (int64_m)height;
+			}
+			if (x2 <= x1 || y2 <= y1) {
+				return MU_FALSE;
+			}
+
+			clipped->x = (int32_m)x1;
+			clipped->y = (int32_m)y1;
+			clipped->width = (uint32_m)(x2 - x1);
+			clipped->height = (uint32_m)(y2 - y1);
+			return MU_TRUE;
+		}
+
+	#endif
+
+	/* OpenGL versions */
+
+	// Conversion of OpenGL graphics APIs to the version and profile attributes
+	// used in context creation, shared by EGL and GLX.
+
+	#if defined(MUCOSA_EGL) || defined(MUCOSA_GLX)
+
+		// Profile bits; these are the same in EGL_KHR_create_context and
+		// GLX_ARB_create_context_profile
+		#define MUCOSAGL_CORE_PROFILE_BIT          0x00000001
+		#define MUCOSAGL_COMPATIBILITY_PROFILE_BIT 0x00000002
+
+		// Version and profile of every OpenGL graphics API, indexed by the
+		// graphics API value minus 1; the profile is 0 for versions before 3.2,
+		// which don't have profiles.
+		static const int muCOSAGL_opengl_versions[][3] = {
+			{ 1, 0, 0 }, { 1, 1, 0 }, { 1, 2, 0 },
+			// (1.2.1 isn't a version that can be requested; 1.3 is used instead)
+			{ 1, 3, 0 },
+			{ 1, 3, 0 }, { 1, 4, 0 }, { 1, 5, 0 },
+			{ 2, 0, 0 }, { 2, 1, 0 },
+			{ 3, 0, 0 }, { 3, 1, 0 },
+			{ 3, 2, MUCOSAGL_CORE_PROFILE_BIT }, { 3, 2, MUCOSAGL_COMPATIBILITY_PROFILE_BIT },
+			{ 3, 3, MUCOSAGL_CORE_PROFILE_BIT }, { 3, 3, MUCOSAGL_COMPATIBILITY_PROFILE_BIT },
+			{ 4, 0, MUCOSAGL_CORE_PROFILE_BIT }, { 4, 0, MUCOSAGL_COMPATIBILITY_PROFILE_BIT },
+			{ 4, 1, MUCOSAGL_CORE_PROFILE_BIT }, { 4, 1, MUCOSAGL_COMPATIBILITY_PROFILE_BIT },
+			{ 4, 2, MUCOSAGL_CORE_PROFILE_BIT }, { 4, 2, MUCOSAGL_COMPATIBILITY_PROFILE_BIT },
+			{ 4, 3, MUCOSAGL_CORE_PROFILE_BIT }, { 4, 3, MUCOSAGL_COMPATIBILITY_PROFILE_BIT },
+			{ 4, 4, MUCOSAGL_CORE_PROFILE_BIT }, { 4, 4, MUCOSAGL_COMPATIBILITY_PROFILE_BIT },
+			{ 4, 5, MUCOSAGL_CORE_PROFILE_BIT }, { 4, 5, MUCOSAGL_COMPATIBILITY_PROFILE_BIT },
+			{ 4, 6, MUCOSAGL_CORE_PROFILE_BIT }, { 4, 6, MUCOSAGL_COMPATIBILITY_PROFILE_BIT },
+		};
+
+		// Gets the version and profile of an OpenGL graphics API
+		muBool muCOSAGL_get_opengl_version(muGraphicsAPI api, int* major, int* minor, int* profile) {
+			if (api < MU_OPENGL_1_0 || api > MU_OPENGL_4_6_COMPATIBILITY) {
+				return MU_FALSE;
+			}
+			*major = muCOSAGL_opengl_versions[api-1][0];
+			*minor = muCOSAGL_opengl_versions[api-1][1];
+			*profile = muCOSAGL_opengl_versions[api-1][2];
+			return MU_TRUE;
+		}
+
+		// Returns if two pixel formats are the same; used to reuse configs chosen
+		// for a pixel format
+		muBool muCOSAGL_pixel_format_equal(muPixelFormat* a, muPixelFormat* b) {
+			return
+				a->red_bits == b->red_bits && a->green_bits == b->green_bits &&
+				a->blue_bits == b->blue_bits && a->alpha_bits == b->alpha_bits &&
+				a->depth_bits == b->depth_bits && a->stencil_bits == b->stencil_bits &&
+				a->samples == b->samples
+			;
+		}
+
+	#endif
+
+	/* EGL */
+
+	// OpenGL functionality shared by the window systems that create their OpenGL
+	// contexts with EGL (X11 and Wayland). Each window system gives its own
+	// display connection and native window, and the rest is handled here.
+
+	#ifdef MUCOSA_EGL
+
+		// (Older versions of khrplatform.h, such as the one embedded in glad, don't
+		// define KHRONOS_APIENTRY, which egl.h needs)
+		#if defined(__khrplatform_h_) && !defined(KHRONOS_APIENTRY)
+			#define KHRONOS_APIENTRY
+		#endif
+		#include <EGL/egl.h>
+
+		// Common OpenGL definitions
+		#ifndef MUCOSA_NO_INCLUDE_OPENGL
+			// Only include if "glClearColor" isn't defined; this is to avoid
+			// accidental double definition in many circumstances.
+			#ifndef glClearColor
+				#include <GL/gl.h>
+			#endif
+		#endif
+
+		/* EGL tokens */
+
+			// https://registry.khronos.org/EGL/extensions/KHR/EGL_KHR_create_context.txt
+			#define MUCOSAEGL_CONTEXT_MAJOR_VERSION_KHR                    0x3098
+			#define MUCOSAEGL_CONTEXT_MINOR_VERSION_KHR                    0x30FB
+			#define MUCOSAEGL_CONTEXT_OPENGL_PROFILE_MASK_KHR              0x30FD
+
+			// https://registry.khronos.org/EGL/extensions/KHR/EGL_KHR_platform_x11.txt
+			#define MUCOSAEGL_PLATFORM_X11_KHR     0x31D5
+			// https://registry.khronos.org/EGL/extensions/KHR/EGL_KHR_platform_wayland.txt
+			#define MUCOSAEGL_PLATFORM_WAYLAND_KHR 0x31D8
+			// https://registry.khronos.org/EGL/extensions/MESA/EGL_MESA_platform_surfaceless.txt
+			#define MUCOSAEGL_PLATFORM_SURFACELESS_MESA 0x31DD
+
+			// https://registry.khronos.org/EGL/extensions/EXT/EGL_EXT_platform_base.txt
+			typedef EGLDisplay muCOSAEGL_eglGetPlatformDisplayEXT_type(EGLenum platform, void* native_display, const EGLint* attrib_list);
+
+		/* Display */
+
+			// Config chosen for a pixel format
+			struct muCOSAEGL_Config {
+				// If a config has been chosen
+				muBool init;
+				// Pixel format (only compared if use_format is true)
+				muBool use_format;
+				muPixelFormat format;
+				// Config + the result of choosing it
+				EGLConfig config;
+				muCOSAResult res;
+			};
+			typedef struct muCOSAEGL_Config muCOSAEGL_Config;
+
+			struct muCOSAEGL_Display {
+				// If EGL has been initialized for the display; this is done once the
+				// first OpenGL context is created, so that programs that don't use
+				// OpenGL don't pay for loading drivers
+				muBool init;
+				// EGL display
+				EGLDisplay display;
+				// If contexts can be bound without a surface (EGL_KHR_surfaceless_context)
+				muBool surfaceless;
+				// Config last chosen for offscreen contexts; programs usually create
+				// them all with the same pixel format, so it's only chosen once
+				muCOSAEGL_Config offscreen;
+			};
+			typedef struct muCOSAEGL_Display muCOSAEGL_Display;
+
+			// Returns if an EGL display supports an extension
+			muBool muCOSAEGL_has_extension(EGLDisplay display, const char* name) {
+				const char* ext = eglQueryString(display, EGL_EXTENSIONS);
+				if (!ext) {
+					return MU_FALSE;
+				}
+
+				// Compare against each space-separated name
+				while (*ext) {
+					size_m i = 0;
+					while (name[i] && ext[i] == name[i]) {
+						++i;
+					}
+					if (!name[i] && (ext[i] == ' ' || ext[i] == 0)) {
+						return MU_TRUE;
+					}
+					// (Skip to next name)
+					while (*ext && *ext != ' ') {
+						++ext;
+					}
+					while (*ext == ' ') {
+						++ext;
+					}
+				}
+				return MU_FALSE;
+			}
+
+			// Initializes EGL for a native display connection if it hasn't been already
+			muCOSAResult muCOSAEGL_display_init(muCOSAEGL_Display* egl, EGLenum platform, void* native) {
+				if (egl->init) {
+					return MUCOSA_SUCCESS;
+				}
+
+				// Get display of the given platform if supported...
+				egl->display = EGL_NO_DISPLAY;
+				muCOSAEGL_eglGetPlatformDisplayEXT_type* get_platform_display = 0;
+				void (*proc)(void) = eglGetProcAddress("eglGetPlatformDisplayEXT");
+				mu_memcpy(&get_platform_display, &proc, sizeof(proc));
+				if (get_platform_display) {
+					egl->display = get_platform_display(platform, native, 0);
+				}
+				// ...and let EGL guess the platform otherwise
+				if (egl->display == EGL_NO_DISPLAY) {
+					egl->display = eglGetDisplay((EGLNativeDisplayType)native);
+				}
+				if (egl->display == EGL_NO_DISPLAY) {
+					return MUCOSA_EGL_FAILED_INITIALIZE;
+				}
+
+				// Initialize for desktop OpenGL
+				if (!eglInitialize(egl->display, 0, 0)) {
+					return MUCOSA_EGL_FAILED_INITIALIZE;
+				}
+				if (!eglBindAPI(EGL_OPENGL_API)) {
+					eglTerminate(egl->display);
+					return MUCOSA_EGL_FAILED_INITIALIZE;
+				}
+
+				// Check if offscreen contexts need a pbuffer to be bound
+				egl->surfaceless = muCOSAEGL_has_extension(egl->display, "EGL_KHR_surfaceless_context");
+				egl->offscreen.init = MU_FALSE;
+
+				egl->init = MU_TRUE;
+				return MUCOSA_SUCCESS;
+			}
+
+			void muCOSAEGL_display_term(muCOSAEGL_Display* egl) {
+				if (egl->init) {
+					eglMakeCurrent(egl->display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+					eglTerminate(egl->display);
+					egl->init = MU_FALSE;
+				}
+			}
+
+		/* Config */
+
+			// Amount of configs looked through when matching a native visual
+			#define MUCOSAEGL_MAX_CONFIGS 64
+
+			// Finds a config with the given pixel format (default if 0) that is
+			// renderable with OpenGL and has the given surface type. If visual isn't
+			// 0, the config must also have that native visual ID.
+			muBool muCOSAEGL_find_config(EGLDisplay display, muPixelFormat* format, EGLint surface_type, EGLint visual, EGLConfig* config) {
+				// Set up an attribute list based on the pixel format
+				EGLint attributes[] = {
+					EGL_SURFACE_TYPE,    surface_type,
+					EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+					EGL_COLOR_BUFFER_TYPE, EGL_RGB_BUFFER,
+					EGL_RED_SIZE,        8,
+					EGL_GREEN_SIZE,      8,
+					EGL_BLUE_SIZE,       8,
+					EGL_ALPHA_SIZE,      0,
+					EGL_DEPTH_SIZE,      24,
+					EGL_STENCIL_SIZE,    8,
+					EGL_SAMPLE_BUFFERS,  0,
+					EGL_SAMPLES,         0,
+					EGL_NONE
+				};
+				if (format) {
+					attributes[7]  = (EGLint)format->red_bits;
+					attributes[9]  = (EGLint)format->green_bits;
+					attributes[11] = (EGLint)format->blue_bits;
+					attributes[13] = (EGLint)format->alpha_bits;
+					attributes[15] = (EGLint)format->depth_bits;
+					attributes[17] = (EGLint)format->stencil_bits;
+					if (format->samples > 1) {
+						attributes[19] = 1;
+						attributes[21] = (EGLint)format->samples;
+					}
+				}
+
+				// Find matching configs (sorted best-first by EGL)
+				EGLConfig configs[MUCOSAEGL_MAX_CONFIGS];
+				EGLint config_count = 0;
+				if (!eglChooseConfig(display, attributes, configs, MUCOSAEGL_MAX_CONFIGS, &config_count) || config_count <= 0) {
+					return MU_FALSE;
+				}
+
+				// Take the best one if any visual works
+				if (!visual) {
+					*config = configs[0];
+					return MU_TRUE;
+				}
+				// Take the best one with the visual otherwise
+				for (EGLint i = 0; i < config_count; ++i) {
+					EGLint config_visual = 0;
+					if (eglGetConfigAttrib(display, configs[i], EGL_NATIVE_VISUAL_ID, &config_visual) && config_visual == visual) {
+						*config = configs[i];
+						return MU_TRUE;
+					}
+				}
+				return MU_FALSE;
+			}
+
+			// Chooses a config for a pixel format (0 if none was specified),
+			// falling back on the default pixel format if it can't be found
+			muCOSAResult muCOSAEGL_choose_config(EGLDisplay display, muPixelFormat* format, EGLint surface_type, EGLint visual, EGLConfig* config) {
+				muCOSAResult res = MUCOSA_SUCCESS;
+
+				// Requested pixel format
+				if (format) {
+					if (muCOSAEGL_find_config(display, format, surface_type, visual, config)) {
+						return res;
+					}
+					res = MUCOSA_EGL_FAILED_CHOOSE_CONFIG;
+				}
+
+				// Default pixel format
+				if (!muCOSAEGL_find_config(display, 0, surface_type, visual, config)) {
+					return MUCOSA_EGL_FAILED_FIND_CONFIG;
+				}
+				return res;
+			}
+
+			// Gets the config of an offscreen context for a pixel format (0 if none
+			// was specified), choosing it if it's different from the last one
+			muCOSAResult muCOSAEGL_get_offscreen_config(muCOSAEGL_Display* egl, muPixelFormat* format, EGLConfig* config) {
+				muCOSAEGL_Config* c = &egl->offscreen;
+
+				// Reuse the last config if it's for the same pixel format
+				if (c->init && c->use_format == (format != 0) && (!format || muCOSAGL_pixel_format_equal(&c->format, format))) {
+					*config = c->config;
+					return c->res;
+				}
+
+				// Choose config; any surface type works if no surface is needed,
+				// and a pbuffer is needed otherwise
+				EGLint surface_type = EGL_PBUFFER_BIT;
+				if (egl->surfaceless) {
+					surface_type = 0;
+				}
+				muCOSAResult res = muCOSAEGL_choose_config(egl->display, format, surface_type, 0, config);
+				if (muCOSA_result_is_fatal(res)) {
+					return res;
+				}
+
+				// Remember it
+				c->init = MU_TRUE;
+				c->use_format = (format != 0);
+				if (format) {
+					c->format = *format;
+				}
+				c->config = *config;
+				c->res = res;
+				return res;
+			}
+
+		/* Surface */
+
+			// Window surface; there's one per window, shared by every OpenGL context
+			// created from it, and it's created along with the first one
+			struct muCOSAEGL_Surface {
+				EGLConfig config;
+				EGLSurface surface;
+			};
+			typedef struct muCOSAEGL_Surface muCOSAEGL_Surface;
+
+			// Creates the surface of a native window if it hasn't been created already
+			muCOSAResult muCOSAEGL_surface_create(muCOSAEGL_Display* egl, muCOSAEGL_Surface* surface, muPixelFormat* format, EGLint visual, EGLNativeWindowType native) {
+				if (surface->surface != EGL_NO_SURFACE) {
+					return MUCOSA_SUCCESS;
+				}
+
+				// Choose config
+				muCOSAResult res = muCOSAEGL_choose_config(egl->display, format, EGL_WINDOW_BIT, visual, &surface->config);
+				if (muCOSA_result_is_fatal(res)) {
+					return res;
+				}
+
+				// Create surface
+				surface->surface = eglCreateWindowSurface(egl->display, surface->config, native, 0);
+				if (surface->surface == EGL_NO_SURFACE) {
+					return MUCOSA_EGL_FAILED_CREATE_SURFACE;
+				}
+				return res;
+			}
+
+			void muCOSAEGL_surface_destroy(muCOSAEGL_Display* egl, muCOSAEGL_Surface* surface) {
+				if (surface->surface != EGL_NO_SURFACE) {
+					eglDestroySurface(egl->display, surface->surface);
+					surface->surface = EGL_NO_SURFACE;
+				}
+			}
+
+		/* OpenGL context */
+
+			struct muCOSAEGL_GL {
+				EGLDisplay display;
+				EGLSurface surface;
+				EGLContext context;
+				// Pbuffer owned by the context (EGL_NO_SURFACE if none); offscreen
+				// contexts use one if the display can't bind without a surface
+				EGLSurface pbuffer;
+			};
+			typedef struct muCOSAEGL_GL muCOSAEGL_GL;
+
+			// Creates an OpenGL context of the given graphics API from a config
+			muCOSAResult muCOSAEGL_create_context(EGLDisplay display, EGLConfig config, muGraphicsAPI api, EGLContext* context) {
+				// Get version of graphics API
+				int major, minor, profile;
+				if (!muCOSAGL_get_opengl_version(api, &major, &minor, &profile)) {
+					return MUCOSA_FAILED_UNKNOWN_GRAPHICS_API;
+				}
+
+				// OpenGL version info
+				EGLint attributes[] = {
+					MUCOSAEGL_CONTEXT_MAJOR_VERSION_KHR, major,
+					MUCOSAEGL_CONTEXT_MINOR_VERSION_KHR, minor,
+					MUCOSAEGL_CONTEXT_OPENGL_PROFILE_MASK_KHR, profile,
+					EGL_NONE
+				};
+				// - (No profile before 3.2)
+				if (!profile) {
+					attributes[4] = EGL_NONE;
+				}
+
+				// Create context
+				*context = eglCreateContext(display, config, EGL_NO_CONTEXT, attributes);
+				if (*context == EGL_NO_CONTEXT) {
+					return MUCOSA_EGL_FAILED_CREATE_CONTEXT;
+				}
+				return MUCOSA_SUCCESS;
+			}
+
+			// Creates an OpenGL context that renders to a window surface
+			void* muCOSAEGL_gl_context_create(muCOSAEGL_Display* egl, muCOSAResult* result, muCOSAEGL_Surface* surface, muGraphicsAPI api) {
+				// Allocate memory for context
+				muCOSAEGL_GL* gl = (muCOSAEGL_GL*)mu_malloc(sizeof(muCOSAEGL_GL));
+				if (!gl) {
+					MU_SET_RESULT(result, MUCOSA_FAILED_MALLOC)
+					return 0;
+				}
+				gl->display = egl->display;
+				gl->surface = surface->surface;
+				gl->pbuffer = EGL_NO_SURFACE;
+
+				// Create OpenGL context
+				muCOSAResult res = muCOSAEGL_create_context(egl->display, surface->config, api, &gl->context);
+				if (res != MUCOSA_SUCCESS) {
+					MU_SET_RESULT(result, res)
+					mu_free(gl);
+					return 0;
+				}
+				return gl;
+			}
+
+			// Creates an OpenGL context that isn't tied to a window; it's bound
+			// without a surface if the display supports it, and to a 1x1 pbuffer
+			// otherwise
+			void* muCOSAEGL_gl_offscreen_create(muCOSAEGL_Display* egl, muCOSAResult* result, muPixelFormat* format, muGraphicsAPI api) {
+				// Get config
+				EGLConfig config;
+				muCOSAResult res = muCOSAEGL_get_offscreen_config(egl, format, &config);
+				if (res != MUCOSA_SUCCESS) {
+					MU_SET_RESULT(result, res)
+					if (muCOSA_result_is_fatal(res)) {
+						return 0;
+					}
+				}
+
+				// Allocate memory for context
+				muCOSAEGL_GL* gl = (muCOSAEGL_GL*)mu_malloc(sizeof(muCOSAEGL_GL));
+				if (!gl) {
+					MU_SET_RESULT(result, MUCOSA_FAILED_MALLOC)
+					return 0;
+				}
+				gl->display = egl->display;
+				gl->surface = EGL_NO_SURFACE;
+				gl->pbuffer = EGL_NO_SURFACE;
+
+				// Create pbuffer if needed
+				if (!egl->surfaceless) {
+					EGLint attributes[] = { EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE };
+					gl->pbuffer = eglCreatePbufferSurface(egl->display, config, attributes);
+					if (gl->pbuffer == EGL_NO_SURFACE) {
+						MU_SET_RESULT(result, MUCOSA_EGL_FAILED_CREATE_SURFACE)
+						mu_free(gl);
+						return 0;
+					}
+					gl->surface = gl->pbuffer;
+				}
+
+				// Create OpenGL context
+				res = muCOSAEGL_create_context(egl->display, config, api, &gl->context);
+				if (res != MUCOSA_SUCCESS) {
+					MU_SET_RESULT(result, res)
+					if (gl->pbuffer != EGL_NO_SURFACE) {
+						eglDestroySurface(egl->display, gl->pbuffer);
+					}
+					mu_free(gl);
+					return 0;
+				}
+				return gl;
+			}
+
+			void muCOSAEGL_gl_context_destroy(muCOSAEGL_GL* gl) {
+				// Unbind if bound, as EGL only destroys bound contexts once unbound
+				if (eglGetCurrentContext() == gl->context) {
+					eglMakeCurrent(gl->display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+				}
+				eglDestroyContext(gl->display, gl->context);
+				// Destroy pbuffer if owned
+				if (gl->pbuffer != EGL_NO_SURFACE) {
+					eglDestroySurface(gl->display, gl->pbuffer);
+				}
+				mu_free(gl);
+			}
+
+			muCOSAResult muCOSAEGL_gl_bind(muCOSAEGL_Display* egl, muCOSAEGL_GL* gl) {
+				// Unbind
+				if (!gl) {
+					if (egl->init) {
+						eglMakeCurrent(egl->display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+					}
+					return MUCOSA_SUCCESS;
+				}
+
+				// Bind
+				if (!eglMakeCurrent(gl->display, gl->surface, gl->surface, gl->context)) {
+					return MUCOSA_EGL_FAILED_MAKE_CURRENT;
+				}
+				return MUCOSA_SUCCESS;
+			}
+
+			muCOSAResult muCOSAEGL_gl_swap_buffers(muCOSAEGL_Display* egl, muCOSAEGL_Surface* surface) {
+				if (!egl->init || surface->surface == EGL_NO_SURFACE || !eglSwapBuffers(egl->display, surface->surface)) {
+					return MUCOSA_EGL_FAILED_SWAP_BUFFERS;
+				}
+				return MUCOSA_SUCCESS;
+			}
+
+			void* muCOSAEGL_gl_get_proc_address(const char* name) {
+				// Convert to void* in a way that avoids warnings
+				void (*proc)(void) = eglGetProcAddress(name);
+				void* vptr = 0;
+				mu_memcpy(&vptr, &proc, sizeof(void*));
+				return vptr;
+			}
+
+			muBool muCOSAEGL_gl_swap_interval(muCOSAEGL_Display* egl, muCOSAResult* result, int interval) {
+				// Applies to the surface bound on the current thread
+				if (!egl->init || !eglSwapInterval(egl->display, (EGLint)interval)) {
+					MU_SET_RESULT(result, MUCOSA_EGL_FAILED_SWAP_INTERVAL)
+					return MU_FALSE;
+				}
+				return MU_TRUE;
+			}
+
+	#endif /* MUCOSA_EGL */
+
+	/* X11 */
+
+	#ifdef MUCOSA_X11
+
+		#include <X11/Xlib.h>
+		#include <X11/Xutil.h>
+		#include <X11/Xatom.h>
+		#include <X11/XKBlib.h>
+		#include <X11/cursorfont.h>
+		#include <poll.h>
+
+		// GLX, if used for OpenGL instead of EGL
+		#ifdef MUCOSA_GLX
+			#include <GL/glx.h>
+		#endif
+
+		// XCB connection of the display, used to pipeline queries
+		#ifdef MUCOSA_X11_XCB
+			#include <X11/Xlib-xcb.h>
+			#include <stdlib.h>
+		#endif
+
+		// XInput2, used for raw motion
+		#ifdef MUCOSA_X11_XI2
+			#include <X11/extensions/XInput2.h>
+		#endif
+
+		// XTest, used for input injection
+		#ifdef MUCOSA_X11_XTEST
+			#include <X11/extensions/XTest.h>
+		#endif
+
+		// MIT-SHM, used to share pixel buffers with the X server
+		#ifdef MUCOSA_X11_SHM
+			#include <X11/extensions/XShm.h>
+			#include <sys/ipc.h>
+			#include <sys/shm.h>
+		#endif
+
+		/* Useful functions */
+
+			// Gets the keysym identifying the physical key of a key event
+			KeySym muCOSAX11_key_event_keysym(XKeyEvent* event) {
+				// Get the unshifted keysym
+				KeySym sym = XLookupKeysym(event, 0);
+
+				// Keypad keys give their non-number-lock meaning unshifted
+				// (KP_Insert, KP_End, etc.), so use the shifted keysym if it's a
+				// keypad number/decimal to match the actual physical key
+				if (IsKeypadKey(sym)) {
+					KeySym kp = XLookupKeysym(event, 1);
+					if ((kp >= XK_KP_0 && kp <= XK_KP_9) || kp == XK_KP_Decimal || kp == XK_KP_Separator) {
+						sym = kp;
+					}
+				}
+				return sym;
+			}
+
+			// muCOSA cursor style to X11 cursor font shape
+			unsigned int muCOSAX11_muCOSA_cursor_to_X11(muCursorStyle style) {
+				switch (style) {
+					default: return XC_left_ptr; break;
+					case MU_CURSOR_ARROW: return XC_left_ptr; break;
+					case MU_CURSOR_IBEAM: return XC_xterm; break;
+					case MU_CURSOR_WAIT: return XC_watch; break;
+					// (No arrow + wait shape in the cursor font)
+					case MU_CURSOR_WAIT_ARROW: return XC_watch; break;
+					case MU_CURSOR_CROSSHAIR: return XC_crosshair; break;
+					case MU_CURSOR_HAND: return XC_hand2; break;
+					case MU_CURSOR_SIZE_LR: return XC_sb_h_double_arrow; break;
+					case MU_CURSOR_SIZE_TB: return XC_sb_v_double_arrow; break;
+					// (No diagonal double arrows in the cursor font)
+					case MU_CURSOR_SIZE_TL_BR: return XC_bottom_right_corner; break;
+					case MU_CURSOR_SIZE_TR_BL: return XC_bottom_left_corner; break;
+					case MU_CURSOR_SIZE_ALL: return XC_fleur; break;
+					case MU_CURSOR_NO: return XC_X_cursor; break;
+				}
+			}
+
+			// Waits (with a timeout) for an event of a given type sent to a given window,
+			// leaving every other event in the queue
+			muBool muCOSAX11_wait_for_event(Display* display, Window win, int type, XEvent* event, double timeout) {
+				// Calculate time we need to give up at
+				double end = muCOSAPOSIX_get_current_time() + timeout;
+
+				// Check the queue (flushing and reading anything new) until the event arrives
+				while (!XCheckTypedWindowEvent(display, win, type, event)) {
+					double left = end - muCOSAPOSIX_get_current_time();
+					if (left <= 0.0) {
+						return MU_FALSE;
+					}
+
+					// Wait for more data from the connection
+					struct pollfd pfd;
+					pfd.fd = ConnectionNumber(display);
+					pfd.events = POLLIN;
+					pfd.revents = 0;
+					poll(&pfd, 1, (int)(left * 1000.0) + 1);
+				}
+				return MU_TRUE;
+			}
+
+		/* Window structs */
+
+			// Atoms used by muCOSA; interned all at once upon context creation
+			struct muCOSAX11_Atoms {
+				Atom WM_PROTOCOLS;
+				Atom WM_DELETE_WINDOW;
+				Atom _NET_WM_NAME;
+				Atom _NET_WM_ICON_NAME;
+				Atom UTF8_STRING;
+				Atom CLIPBOARD;
+				Atom TARGETS;
+				Atom INCR;
+				Atom MUCOSA_CLIPBOARD;
+			};
+			typedef struct muCOSAX11_Atoms muCOSAX11_Atoms;
+
+			struct muCOSAX11_Keymaps {
+				// Keyboard keys
+				muBool keyboard[MU_KEYBOARD_LENGTH];
+				// Keystates
+				muBool keystates[MU_KEYSTATE_LENGTH];
+				// Mouse keys
+				muBool mouse[MU_MOUSE_LENGTH];
+			};
+			typedef struct muCOSAX11_Keymaps muCOSAX11_Keymaps;
+
+			// Pixel buffer owned by a window
+			struct muCOSAX11_Pixels {
+				// Image holding the pixels (0 if not created)
+				XImage* image;
+				#ifdef MUCOSA_X11_SHM
+				// Shared memory segment of the image + if it's used
+				XShmSegmentInfo shm;
+				muBool use_shm;
+				#endif
+				// If the X server is still reading from the buffer
+				muBool busy;
+			};
+			typedef struct muCOSAX11_Pixels muCOSAX11_Pixels;
+
+			struct muCOSAX11_WindowHandles {
+				// Display (copy of the context's)
+				Display* display;
+				#ifdef MUCOSA_X11_XCB
+				// XCB connection of the display (copy of the context's)
+				xcb_connection_t* connection;
+				#endif
+				// Atoms (pointer to the context's)
+				muCOSAX11_Atoms* atoms;
+				// Window handle
+				Window win;
+				// Root window
+				Window root;
+				// Current parent window (changed by reparenting window managers)
+				Window parent;
+				// Input context (0 if no input method is available)
+				XIC ic;
+				// Cursor handle
+				Cursor cursor;
+				// Graphics context used to present pixels (created upon first use)
+				GC gc;
+				// Pixel buffers
+				muCOSAX11_Pixels pixels[2];
+				#ifdef MUCOSA_EGL
+				// EGL surface (created along with the first OpenGL context)
+				muCOSAEGL_Surface egl;
+				#endif
+			};
+			typedef struct muCOSAX11_WindowHandles muCOSAX11_WindowHandles;
+
+			// States possibly held by the window that are updated via events
+			struct muCOSAX11_WindowStates {
+				// Closed or not
+				muBool closed;
+				// Cursor style
+				muCursorStyle cursor_style;
+				// Focused or not
+				muBool focused;
+				// If raw motion is received
+				muBool raw_motion;
+				// If the pointer is locked
+				muBool pointer_lock;
+			};
+			typedef struct muCOSAX11_WindowStates muCOSAX11_WindowStates;
+
+			struct muCOSAX11_WindowProperties {
+				// Pixel format
+				muPixelFormat format;
+				muBool use_format;
+
+				// Min/Max dimensions
+				uint32_m min_width;
+				uint32_m min_height;
+				uint32_m max_width;
+				uint32_m max_height;
+
+				// Last known dimensions and position; used for detecting changes
+				uint32_m width;
+				uint32_m height;
+				int32_m x;
+				int32_m y;
+
+				// Scroll level
+				int32_m scroll_level;
+
+				// Cursor position
+				int32_m cursor_x;
+				int32_m cursor_y;
+
+				// Text input
+				void (*text_input_callback)(muWindow window, uint8_m* data);
+				uint32_m text_cursor_x;
+				uint32_m text_cursor_y;
+			};
+			typedef struct muCOSAX11_WindowProperties muCOSAX11_WindowProperties;
+
+			struct muCOSAX11_Window {
+				muCOSAX11_WindowHandles handles;
+				muCOSAX11_Keymaps keymaps;
+				muCOSAX11_WindowStates states;
+				muCOSAX11_WindowProperties props;
+				muWindowCallbacks callbacks;
+				muCOSA_EventQueue events;
+				muCOSA_Coalesce coalesce;
+				#ifdef MUCOSA_THREAD_SAFE
+				muCOSA_Lock lock;
+				#endif
+			};
+			typedef struct muCOSAX11_Window muCOSAX11_Window;
+
+		/* GLX */
+
+		#ifdef MUCOSA_GLX
+
+			/* GLX tokens */
+
+				// https://registry.khronos.org/OpenGL/extensions/ARB/GLX_ARB_create_context.txt
+				#define MUCOSAGLX_CONTEXT_MAJOR_VERSION_ARB 0x2091
+				#define MUCOSAGLX_CONTEXT_MINOR_VERSION_ARB 0x2092
+				// https://registry.khronos.org/OpenGL/extensions/ARB/GLX_ARB_create_context_profile.txt
+				#define MUCOSAGLX_CONTEXT_PROFILE_MASK_ARB  0x9126
+
+				// Typedefs for functions we need
+				// - glXCreateContextAttribsARB; needed for specifying exact version when creating context
+				typedef GLXContext muCOSAX11_glXCreateContextAttribsARB_type(Display* dpy, GLXFBConfig config, GLXContext share_context, Bool direct, const int* attrib_list);
+				// - glXSwapIntervalEXT/MESA; not needed in context creation, but used for swap interval later
+				typedef void muCOSAX11_glXSwapIntervalEXT_type(Display* dpy, GLXDrawable drawable, int interval);
+				typedef int muCOSAX11_glXSwapIntervalMESA_type(unsigned int interval);
+
+			// Framebuffer config chosen for a pixel format
+			struct muCOSAX11_GLXConfig {
+				// If the config is for offscreen contexts (pbuffers) rather than windows
+				muBool offscreen;
+				// Pixel format (only compared if use_format is true)
+				muBool use_format;
+				muPixelFormat format;
+				// Config + the result of choosing it
+				GLXFBConfig config;
+				muCOSAResult res;
+			};
+			typedef struct muCOSAX11_GLXConfig muCOSAX11_GLXConfig;
+
+			struct muCOSAX11_GLX {
+				// If GLX functions have been loaded (done once the first OpenGL context is created)
+				muBool init;
+				// Functions
+				muCOSAX11_glXCreateContextAttribsARB_type* CreateContextAttribs;
+				muCOSAX11_glXSwapIntervalEXT_type* SwapIntervalEXT;
+				muCOSAX11_glXSwapIntervalMESA_type* SwapIntervalMESA;
+				// Framebuffer configs chosen so far; enumerating configs is expensive,
+				// so each pixel format's config is chosen once per display and reused
+				// for every window created with it
+				muCOSAX11_GLXConfig* configs;
+				size_m config_count;
+				size_m config_len;
+			};
+			typedef struct muCOSAX11_GLX muCOSAX11_GLX;
+
+		#endif /* MUCOSA_GLX */
+
+		/* Context */
+
+			struct muCOSAX11_Clipboard {
+				// Hidden window used to own and request the clipboard
+				Window win;
+				// Clipboard data currently owned by this context (0 if none)
+				uint8_m* data;
+				size_m datalen;
+			};
+			typedef struct muCOSAX11_Clipboard muCOSAX11_Clipboard;
+
+			struct muCOSAX11_Context {
+				// Display connection
+				Display* display;
+				#ifdef MUCOSA_X11_XCB
+				// XCB connection of the display
+				xcb_connection_t* connection;
+				#endif
+				// Time
+				muCOSAPOSIX_Time time;
+				// Converter of server time to system time
+				muCOSA_EventClock event_clock;
+				// Atoms
+				muCOSAX11_Atoms atoms;
+				// Input method (0 if unavailable) + the input style used with it
+				XIM im;
+				XIMStyle im_style;
+				// If XKB is available + the type of its events
+				muBool xkb;
+				int xkb_event;
+				// Indicator index of each keystate (-1 if not found)
+				int indicators[MU_KEYSTATE_LENGTH];
+				// State of every indicator; retrieved once, then kept up to date by
+				// XKB events
+				unsigned int indicator_state;
+				// Clipboard
+				muCOSAX11_Clipboard clipboard;
+				// Windows + map used to find a muCOSAX11_Window from the X11 window
+				// handle given in an event. There's one map per context, since each
+				// context has its own display connection (and therefore its own
+				// window handles).
+				muCOSA_WindowList windows;
+				muCOSA_WindowMap handles;
+				// Pipe to interrupt waits
+				muCOSAPOSIX_Wake wake;
+				// Window that the cursor is in + window that has the pointer locked
+				// (0 if none)
+				muCOSAX11_Window* pointer_window;
+				muCOSAX11_Window* locked_window;
+				// Invisible cursor used while the pointer is locked (created once
+				// first needed)
+				Cursor blank_cursor;
+				#ifdef MUCOSA_X11_XI2
+				// XInput2 major opcode (0 if unavailable) + the amount of windows
+				// receiving raw motion
+				int xi_opcode;
+				size_m raw_motion_windows;
+				#endif
+				#ifdef MUCOSA_X11_XTEST
+				// If XTest can be used
+				muBool xtest;
+				#endif
+				#ifdef MUCOSA_X11_SHM
+				// If MIT-SHM can be used + the type of its completion events
+				muBool shm;
+				int shm_event;
+				#endif
+				#ifdef MUCOSA_EGL
+				// EGL display (initialized once the first OpenGL context is created)
+				muCOSAEGL_Display egl;
+				#endif
+				#ifdef MUCOSA_GLX
+				// GLX functions + framebuffer configs
+				muCOSAX11_GLX glx;
+				#endif
+			};
+			typedef struct muCOSAX11_Context muCOSAX11_Context;
+
+			// Opens an input method and chooses the style used for input contexts
+			void muCOSAX11_open_im(muCOSAX11_Context* context) {
+				context->im = 0;
+				context->im_style = 0;
+
+				// Use input method set by the user's environment (XMODIFIERS)
+				if (!XSetLocaleModifiers("")) {
+					return;
+				}
+				context->im = XOpenIM(context->display, 0, 0, 0);
+				if (!context->im) {
+					return;
+				}
+
+				// Get supported input styles
+				XIMStyles* styles = 0;
+				if (XGetIMValues(context->im, XNQueryInputStyle, &styles, NULL) != NULL || !styles) {
+					XCloseIM(context->im);
+					context->im = 0;
+					return;
+				}
+
+				// Prefer over-the-spot preediting (uses the text cursor), but fallback
+				// on the input method handling preediting itself
+				for (unsigned short s = 0; s < styles->count_styles; ++s) {
+					XIMStyle style = styles->supported_styles[s];
+					if (style == (XIMPreeditPosition | XIMStatusNothing)) {
+						context->im_style = style;
+						break;
+					}
+					if (style == (XIMPreeditNothing | XIMStatusNothing)) {
+						context->im_style = style;
+					}
+				}
+				XFree(styles);
+
+				// No usable style
+				if (!context->im_style) {
+					XCloseIM(context->im);
+					context->im = 0;
+				}
+			}
+
+			muCOSAResult muCOSAX11_context_init(muCOSAX11_Context* context) {
+				// Zero-out
+				mu_memset(context, 0, sizeof(muCOSAX11_Context));
+				// Initiate window map
+				muCOSA_window_map_init(&context->handles);
+
+				// Let Xlib be used from several threads at once (waiting on the display
+				// is done without locking the context)
+				#ifdef MUCOSA_THREAD_SAFE
+				XInitThreads();
+				#endif
+
+				// Open display
+				context->display = XOpenDisplay(NULL);
+				if (!context->display) {
+					return MUCOSA_X11_FAILED_CONNECT_DISPLAY;
+				}
+				#ifdef MUCOSA_X11_XCB
+				context->connection = XGetXCBConnection(context->display);
+				#endif
+
+				// Initiate context time
+				muCOSAPOSIX_time_init(&context->time);
+				// Create wake pipe
+				muCOSAPOSIX_wake_init(&context->wake);
+
+				// Intern atoms (all in one round trip)
+				char* atom_names[] = {
+					(char*)"WM_PROTOCOLS", (char*)"WM_DELETE_WINDOW", (char*)"_NET_WM_NAME", (char*)"_NET_WM_ICON_NAME",
+					(char*)"UTF8_STRING", (char*)"CLIPBOARD", (char*)"TARGETS", (char*)"INCR", (char*)"MUCOSA_CLIPBOARD"
+				};
+				Atom atoms[sizeof(atom_names) / sizeof(char*)];
+				XInternAtoms(context->display, atom_names, sizeof(atom_names) / sizeof(char*), False, atoms);
+				context->atoms.WM_PROTOCOLS      = atoms[0];
+				context->atoms.WM_DELETE_WINDOW  = atoms[1];
+				context->atoms._NET_WM_NAME      = atoms[2];
+				context->atoms._NET_WM_ICON_NAME = atoms[3];
+				context->atoms.UTF8_STRING       = atoms[4];
+				context->atoms.CLIPBOARD         = atoms[5];
+				context->atoms.TARGETS           = atoms[6];
+				context->atoms.INCR              = atoms[7];
+				context->atoms.MUCOSA_CLIPBOARD  = atoms[8];
+
+				// XKB
+				int xkb_major = XkbMajorVersion, xkb_minor = XkbMinorVersion;
+				context->xkb = XkbQueryExtension(context->display, 0, &context->xkb_event, 0, &xkb_major, &xkb_minor);
+				for (muKeyboardState s = 0; s < MU_KEYSTATE_LENGTH; ++s) {
+					context->indicators[s] = -1;
+				}
+				if (context->xkb) {
+					// Only send key presses when a key is held down, like Win32
+					XkbSetDetectableAutoRepeat(context->display, True, 0);
+
+					// Find indicator index for each keystate
+					const char* indicator_names[MU_KEYSTATE_LENGTH] = { 0, "Caps Lock", "Scroll Lock", "Num Lock" };
+					for (muKeyboardState s = 1; s < MU_KEYSTATE_LENGTH; ++s) {
+						Atom name = XInternAtom(context->display, indicator_names[s], True);
+						int ndx = -1;
+						if (name != None && XkbGetNamedIndicator(context->display, name, &ndx, 0, 0, 0)) {
+							context->indicators[s] = ndx;
+						}
+					}
+
+					// Get the indicator state once, and be notified whenever it changes
+					// rather than querying it every update
+					XkbGetIndicatorState(context->display, XkbUseCoreKbd, &context->indicator_state);
+					XkbSelectEventDetails(context->display, XkbUseCoreKbd, XkbIndicatorStateNotify, XkbAllIndicatorsMask, XkbAllIndicatorsMask);
+				}
+
+				// Input method
+				muCOSAX11_open_im(context);
+
+				#ifdef MUCOSA_X11_XI2
+				// XInput2 (2.0 is needed for raw events)
+				int xi_event, xi_error;
+				if (XQueryExtension(context->display, "XInputExtension", &context->xi_opcode, &xi_event, &xi_error)) {
+					int xi_major = 2, xi_minor = 0;
+					if (XIQueryVersion(context->display, &xi_major, &xi_minor) != Success) {
+						context->xi_opcode = 0;
+					}
+				}
+				#endif
+
+				#ifdef MUCOSA_X11_XTEST
+				// XTest
+				int xtest_event, xtest_error, xtest_major, xtest_minor;
+				context->xtest = XTestQueryExtension(context->display, &xtest_event, &xtest_error, &xtest_major, &xtest_minor) != False;
+				#endif
+
+				#ifdef MUCOSA_X11_SHM
+				// MIT-SHM
+				context->shm = XShmQueryExtension(context->display);
+				if (context->shm) {
+					context->shm_event = XShmGetEventBase(context->display) + ShmCompletion;
+				}
+				#endif
+
+				// Clipboard window
+				context->clipboard.win = XCreateSimpleWindow(
+					context->display, DefaultRootWindow(context->display),
+					0, 0, 1, 1, 0, 0, 0
+				);
+
+				return MUCOSA_SUCCESS;
+			}
+
+			void muCOSAX11_context_term(muCOSAX11_Context* context) {
+				// Free clipboard data
+				if (context->clipboard.data) {
+					mu_free(context->clipboard.data);
+				}
+				// Destroy clipboard window
+				XDestroyWindow(context->display, context->clipboard.win);
+				// Close input method
+				if (context->im) {
+					XCloseIM(context->im);
+				}
+				// Free blank cursor
+				if (context->blank_cursor) {
+					XFreeCursor(context->display, context->blank_cursor);
+				}
+				// Free window list + map
+				muCOSA_window_list_term(&context->windows);
+				muCOSA_window_map_term(&context->handles);
+				// Destroy wake pipe
+				muCOSAPOSIX_wake_term(&context->wake);
+				#ifdef MUCOSA_EGL
+				// Terminate EGL
+				muCOSAEGL_display_term(&context->egl);
+				#endif
+				#ifdef MUCOSA_GLX
+				// Free GLX configs
+				if (context->glx.configs) {
+					mu_free(context->glx.configs);
+				}
+				#endif
+				// Close display
+				XCloseDisplay(context->display);
+			}
+
+		/* Window map */
+
+			// Finds a pointer to a muCOSA window based on the X11 window handle
+			muCOSAX11_Window* muCOSAX11_window_find(muCOSAX11_Context* context, Window handle) {
+				return (muCOSAX11_Window*)muCOSA_window_map_find(&context->handles, (uint64_m)handle);
+			}
+
+		/* Clipboard */
+
+			// Sends the clipboard data owned by this context to another client
+			void muCOSAX11_clipboard_handle_request(muCOSAX11_Context* context, XSelectionRequestEvent* req) {
+				// Fill out a refusal by default
+				XSelectionEvent reply = MU_ZERO_STRUCT(XSelectionEvent);
+				reply.type = SelectionNotify;
+				reply.display = req->display;
+				reply.requestor = req->requestor;
+				reply.selection = req->selection;
+				reply.target = req->target;
+				reply.time = req->time;
+				reply.property = None;
+
+				// Obsolete clients give no property; the target is used instead
+				Atom property = req->property;
+				if (property == None) {
+					property = req->target;
+				}
+
+				if (req->selection == context->atoms.CLIPBOARD && context->clipboard.data) {
+					// List of formats we can give
+					if (req->target == context->atoms.TARGETS) {
+						Atom targets[] = { context->atoms.TARGETS, context->atoms.UTF8_STRING, XA_STRING };
+						XChangeProperty(context->display, req->requestor, property, XA_ATOM, 32,
+							PropModeReplace, (unsigned char*)targets, sizeof(targets) / sizeof(Atom)
+						);
+						reply.property = property;
+					}
+					// The text itself
+					else if (req->target == context->atoms.UTF8_STRING || req->target == XA_STRING) {
+						// (Don't send the null-terminating character)
+						size_m len = context->clipboard.datalen;
+						if (len && context->clipboard.data[len-1] == 0) {
+							--len;
+						}
+						XChangeProperty(context->display, req->requestor, property, req->target, 8,
+							PropModeReplace, context->clipboard.data, (int)len
+						);
+						reply.property = property;
+					}
+				}
+
+				// Send reply
+				XSendEvent(context->display, req->requestor, False, 0, (XEvent*)&reply);
+			}
+
+			// Handles an event sent to the clipboard window
+			void muCOSAX11_clipboard_handle_event(muCOSAX11_Context* context, XEvent* event) {
+				switch (event->type) {
+					default: break;
+
+					// Another client wants our clipboard data
+					case SelectionRequest: muCOSAX11_clipboard_handle_request(context, &event->xselectionrequest); break;
+
+					// Another client took the clipboard; we no longer need our data
+					case SelectionClear: {
+						if (event->xselectionclear.selection == context->atoms.CLIPBOARD && context->clipboard.data) {
+							mu_free(context->clipboard.data);
+							context->clipboard.data = 0;
+							context->clipboard.datalen = 0;
+						}
+					} break;
+				}
+			}
+
+			// Requests the clipboard converted to a given target and reads it
+			uint8_m* muCOSAX11_clipboard_convert(muCOSAX11_Context* context, muCOSAResult* result, Atom target, muBool* refused) {
+				Display* d = context->display;
+				*refused = MU_FALSE;
+
+				// Ask owner to convert clipboard into our property
+				XConvertSelection(d, context->atoms.CLIPBOARD, target, context->atoms.MUCOSA_CLIPBOARD, context->clipboard.win, CurrentTime);
+
+				// Wait for the owner to respond (giving up after a second)
+				XEvent event;
+				if (!muCOSAX11_wait_for_event(d, context->clipboard.win, SelectionNotify, &event, 1.0)) {
+					MU_SET_RESULT(result, MUCOSA_X11_FAILED_GET_CLIPBOARD_DATA)
+					return 0;
+				}
+
+				// Owner couldn't convert to this target
+				if (event.xselection.property == None) {
+					*refused = MU_TRUE;
+					return 0;
+				}
+
+				// Read (and delete) the property
+				Atom type;
+				int format;
+				unsigned long nitems, after;
+				unsigned char* prop = 0;
+				if (XGetWindowProperty(d, context->clipboard.win, context->atoms.MUCOSA_CLIPBOARD, 0, 0x1FFFFFFF, True,
+					AnyPropertyType, &type, &format, &nitems, &after, &prop) != Success
+				) {
+					MU_SET_RESULT(result, MUCOSA_X11_FAILED_GET_CLIPBOARD_DATA)
+					return 0;
+				}
+
+				// Incremental transfers aren't supported
+				if (type == context->atoms.INCR || format != 8) {
+					if (prop) {
+						XFree(prop);
+					}
+					MU_SET_RESULT(result, MUCOSA_X11_FAILED_GET_CLIPBOARD_DATA)
+					return 0;
+				}
+
+				// Copy data with null-terminating character
+				uint8_m* data = (uint8_m*)mu_malloc(nitems + 1);
+				if (!data) {
+					XFree(prop);
+					MU_SET_RESULT(result, MUCOSA_FAILED_MALLOC)
+					return 0;
+				}
+				if (nitems) {
+					mu_memcpy(data, prop, nitems);
+				}
+				data[nitems] = 0;
+
+				XFree(prop);
+				return data;
+			}
+
+			uint8_m* muCOSAX11_clipboard_get(muCOSAX11_Context* context, muCOSAResult* result) {
+				// Get current clipboard owner
+				Window owner = XGetSelectionOwner(context->display, context->atoms.CLIPBOARD);
+
+				// No owner means no clipboard
+				if (owner == None) {
+					return 0;
+				}
+
+				// We own the clipboard; just copy our own data
+				if (owner == context->clipboard.win) {
+					if (!context->clipboard.data) {
+						return 0;
+					}
+					uint8_m* data = (uint8_m*)mu_malloc(context->clipboard.datalen + 1);
+					if (!data) {
+						MU_SET_RESULT(result, MUCOSA_FAILED_MALLOC)
+						return 0;
+					}
+					mu_memcpy(data, context->clipboard.data, context->clipboard.datalen);
+					data[context->clipboard.datalen] = 0;
+					return data;
+				}
+
+				// Ask for UTF-8, and fallback on plain strings
+				muBool refused;
+				uint8_m* data = muCOSAX11_clipboard_convert(context, result, context->atoms.UTF8_STRING, &refused);
+				if (refused) {
+					data = muCOSAX11_clipboard_convert(context, result, XA_STRING, &refused);
+				}
+				return data;
+			}
+
+			void muCOSAX11_clipboard_set(muCOSAX11_Context* context, muCOSAResult* result, uint8_m* data, size_m datalen) {
+				// Copy data, since it needs to be given out whenever another client asks for it
+				uint8_m* copy = (uint8_m*)mu_malloc(datalen);
+				if (!copy) {
+					MU_SET_RESULT(result, MUCOSA_FAILED_MALLOC)
+					return;
+				}
+				mu_memcpy(copy, data, datalen);
+
+				// Replace old data
+				if (context->clipboard.data) {
+					mu_free(context->clipboard.data);
+				}
+				context->clipboard.data = copy;
+				context->clipboard.datalen = datalen;
+
+				// Take ownership of the clipboard
+				XSetSelectionOwner(context->display, context->atoms.CLIPBOARD, context->clipboard.win, CurrentTime);
+				if (XGetSelectionOwner(context->display, context->atoms.CLIPBOARD) != context->clipboard.win) {
+					MU_SET_RESULT(result, MUCOSA_X11_FAILED_SET_CLIPBOARD_DATA)
+					mu_free(context->clipboard.data);
+					context->clipboard.data = 0;
+					context->clipboard.datalen = 0;
+				}
+			}
+
+		/* Pixels */
+
+			// Byte order of pixels in this program's memory
+			int muCOSAX11_native_byte_order(void) {
+				uint32_m one = 1;
+				return (*(uint8_m*)&one == 1) ? LSBFirst : MSBFirst;
+			}
+
+			// Checks if the window's visual stores pixels the same way as muCOSA (0xXXRRGGBB)
+			muBool muCOSAX11_pixels_supported(Display* display) {
+				int screen = DefaultScreen(display);
+				int depth = DefaultDepth(display, screen);
+				Visual* visual = DefaultVisual(display, screen);
+				return (depth == 24 || depth == 32) && visual->red_mask == 0xFF0000 && visual->green_mask == 0xFF00 && visual->blue_mask == 0xFF;
+			}
+
+			// Wraps pixels in an image; pixels are 0 if the image's memory is allocated separately
+			XImage* muCOSAX11_pixels_create_image(Display* display, uint32_m* pixels, uint32_m width, uint32_m height, uint32_m stride) {
+				// Check if pixels can be presented as-is
+				if (!muCOSAX11_pixels_supported(display)) {
+					return 0;
+				}
+
+				// Create image
+				int screen = DefaultScreen(display);
+				XImage* image = XCreateImage(display, DefaultVisual(display, screen), (unsigned int)DefaultDepth(display, screen),
+					ZPixmap, 0, (char*)pixels, (unsigned int)width, (unsigned int)height, 32, (int)stride
+				);
+				if (!image) {
+					return 0;
+				}
+
+				// Make sure each pixel takes up 32 bits
+				if (image->bits_per_pixel != 32) {
+					image->data = 0;
+					XDestroyImage(image);
+					return 0;
+				}
+
+				// Pixels are in our byte order; Xlib swaps them if the server's differs
+				image->byte_order = muCOSAX11_native_byte_order();
+				return image;
+			}
+
+			#ifdef MUCOSA_X11_SHM
+
+			// If an X error was caught by muCOSAX11_catch_error
+			muBool muCOSAX11_error_caught = MU_FALSE;
+
+			// Catches X errors; used while attaching shared memory, as the X server
+			// reports being unable to access it (such as over a network) via X errors
+			int muCOSAX11_catch_error(Display* display, XErrorEvent* event) {
+				muCOSAX11_error_caught = MU_TRUE;
+				return 0; if (display) {} if (event) {}
+			}
+
+			// Creates a pixel buffer with shared memory; returns if successful
+			muBool muCOSAX11_pixels_create_shm(muCOSAX11_Context* context, muCOSAX11_Pixels* pixels, uint32_m width, uint32_m height) {
+				Display* d = context->display;
+				int screen = DefaultScreen(d);
+
+				// The X server reads shared memory in its own byte order
+				if (ImageByteOrder(d) != muCOSAX11_native_byte_order()) {
+					return MU_FALSE;
+				}
+
+				// Create image
+				pixels->image = XShmCreateImage(d, DefaultVisual(d, screen), (unsigned int)DefaultDepth(d, screen),
+					ZPixmap, 0, &pixels->shm, (unsigned int)width, (unsigned int)height
+				);
+				if (!pixels->image) {
+					return MU_FALSE;
+				}
+				if (pixels->image->bits_per_pixel != 32) {
+					XDestroyImage(pixels->image);
+					pixels->image = 0;
+					return MU_FALSE;
+				}
+
+				// Create shared memory segment
+				pixels->shm.shmid = shmget(IPC_PRIVATE, (size_t)pixels->image->bytes_per_line * (size_t)height, IPC_CREAT | 0600);
+				if (pixels->shm.shmid == -1) {
+					XDestroyImage(pixels->image);
+					pixels->image = 0;
+					return MU_FALSE;
+				}
+				pixels->shm.shmaddr = (char*)shmat(pixels->shm.shmid, 0, 0);
+				if (pixels->shm.shmaddr == (char*)-1) {
+					shmctl(pixels->shm.shmid, IPC_RMID, 0);
+					XDestroyImage(pixels->image);
+					pixels->image = 0;
+					return MU_FALSE;
+				}
+				pixels->image->data = pixels->shm.shmaddr;
+				pixels->shm.readOnly = False;
+
+				// Attach it to the X server, catching errors
+				XSync(d, False);
+				muCOSAX11_error_caught = MU_FALSE;
+				int (*prev_handler)(Display*, XErrorEvent*) = XSetErrorHandler(muCOSAX11_catch_error);
+				Status attached = XShmAttach(d, &pixels->shm);
+				XSync(d, False);
+				XSetErrorHandler(prev_handler);
+
+				// Mark segment to be freed once it's detached from both us and the X server
+				shmctl(pixels->shm.shmid, IPC_RMID, 0);
+
+				// Stop using MIT-SHM if it can't be attached
+				if (!attached || muCOSAX11_error_caught) {
+					context->shm = MU_FALSE;
+					shmdt(pixels->shm.shmaddr);
+					pixels->image->data = 0;
+					XDestroyImage(pixels->image);
+					pixels->image = 0;
+					return MU_FALSE;
+				}
+
+				pixels->use_shm = MU_TRUE;
+				return MU_TRUE;
+			}
+
+			// Marks the pixel buffer that the X server is done with as no longer busy
+			void muCOSAX11_pixels_release(muCOSAX11_Window* win, XShmCompletionEvent* event) {
+				for (size_m i = 0; i < 2; ++i) {
+					muCOSAX11_Pixels* pixels = &win->handles.pixels[i];
+					if (pixels->image && pixels->use_shm && pixels->shm.shmseg == event->shmseg) {
+						pixels->busy = MU_FALSE;
+					}
+				}
+			}
+
+			#endif /* MUCOSA_X11_SHM */
+
+			// Processes any completion events for pixel buffers without processing other events
+			void muCOSAX11_pixels_check(muCOSAX11_Context* context) {
+				#ifdef MUCOSA_X11_SHM
+				if (!context->shm) {
+					return;
+				}
+
+				XEvent event;
+				while (XCheckTypedEvent(context->display, context->shm_event, &event)) {
+					muCOSAX11_Window* win = muCOSAX11_window_find(context, event.xany.window);
+					if (win) {
+						muCOSAX11_pixels_release(win, (XShmCompletionEvent*)&event);
+					}
+				}
+				#else
+				return; if (context) {}
+				#endif
+			}
+
+			void muCOSAX11_pixels_destroy(Display* display, muCOSAX11_Pixels* pixels) {
+				if (!pixels->image) {
+					return;
+				}
+
+				#ifdef MUCOSA_X11_SHM
+				// Detach + free shared memory
+				if (pixels->use_shm) {
+					// (Wait for the X server to be done with it)
+					XShmDetach(display, &pixels->shm);
+					XSync(display, False);
+					shmdt(pixels->shm.shmaddr);
+				}
+				// Free memory
+				else
+				#endif
+				{
+					mu_free(pixels->image->data);
+				}
+
+				// Destroy image (with its memory already freed)
+				pixels->image->data = 0;
+				XDestroyImage(pixels->image);
+				mu_memset(pixels, 0, sizeof(muCOSAX11_Pixels));
+				return; if (display) {}
+			}
+
+			muCOSAResult muCOSAX11_pixels_create(muCOSAX11_Context* context, muCOSAX11_Pixels* pixels, uint32_m width, uint32_m height) {
+				#ifdef MUCOSA_X11_SHM
+				// Try shared memory first
+				if (context->shm && muCOSAX11_pixels_create_shm(context, pixels, width, height)) {
+					return MUCOSA_SUCCESS;
+				}
+				#endif
+
+				// Allocate memory
+				uint32_m* data = (uint32_m*)mu_malloc((size_m)width * (size_m)height * 4);
+				if (!data) {
+					return MUCOSA_FAILED_MALLOC;
+				}
+
+				// Wrap it in an image
+				pixels->image = muCOSAX11_pixels_create_image(context->display, data, width, height, width * 4);
+				if (!pixels->image) {
+					mu_free(data);
+					return MUCOSA_X11_FAILED_CREATE_IMAGE;
+				}
+				return MUCOSA_SUCCESS;
+			}
+
+			// Finds the pixel buffer of a window holding the given pixels (0 if none)
+			muCOSAX11_Pixels* muCOSAX11_pixels_find(muCOSAX11_Window* win, uint32_m* pixels) {
+				for (size_m i = 0; i < 2; ++i) {
+					if (win->handles.pixels[i].image && (uint32_m*)win->handles.pixels[i].image->data == pixels) {
+						return &win->handles.pixels[i];
+					}
+				}
+				return 0;
+			}
+
+			uint32_m* muCOSAX11_window_get_pixels(muCOSAX11_Context* context, muCOSAResult* result, muCOSAX11_Window* win, uint32_m width, uint32_m height, uint32_m* stride) {
+				// Check for buffers the X server is done with
+				muCOSAX11_pixels_check(context);
+
+				// Use a free buffer, preferring one that already has the right dimensions
+				muCOSAX11_Pixels* pixels = 0;
+				for (size_m i = 0; i < 2; ++i) {
+					muCOSAX11_Pixels* p = &win->handles.pixels[i];
+					if (p->busy) {
+						continue;
+					}
+					if (p->image && (uint32_m)p->image->width == width && (uint32_m)p->image->height == height) {
+						pixels = p;
+						break;
+					}
+					if (!pixels) {
+						pixels = p;
+					}
+				}
+				if (!pixels) {
+					MU_SET_RESULT(result, MUCOSA_FAILED_PIXELS_BUSY)
+					return 0;
+				}
+
+				// (Re)create it if its dimensions don't match
+				if (!pixels->image || (uint32_m)pixels->image->width != width || (uint32_m)pixels->image->height != height) {
+					muCOSAX11_pixels_destroy(context->display, pixels);
+					muCOSAResult res = muCOSAX11_pixels_create(context, pixels, width, height);
+					if (res != MUCOSA_SUCCESS) {
+						MU_SET_RESULT(result, res)
+						return 0;
+					}
+				}
+
+				if (stride) {
+					*stride = (uint32_m)pixels->image->bytes_per_line;
+				}
+				return (uint32_m*)pixels->image->data;
+			}
+
+			muBool muCOSAX11_window_pixels_busy(muCOSAX11_Context* context, muCOSAX11_Window* win, uint32_m* pixels) {
+				// Check for buffers the X server is done with
+				muCOSAX11_pixels_check(context);
+
+				muCOSAX11_Pixels* owned = muCOSAX11_pixels_find(win, pixels);
+				return owned && owned->busy;
+			}
+
+			void muCOSAX11_window_present_pixels(muCOSAX11_Context* context, muCOSAResult* result, muCOSAX11_Window* win, uint32_m* pixels, uint32_m stride, muPixelRect* rect) {
+				Display* d = win->handles.display;
+
+				// Get buffer dimensions
+				muCOSAX11_Pixels* owned = muCOSAX11_pixels_find(win, pixels);
+				uint32_m width = (owned) ? (uint32_m)owned->image->width : win->props.width;
+				uint32_m height = (owned) ? (uint32_m)owned->image->height : win->props.height;
+
+				// Clip rectangle to the buffer
+				muPixelRect r;
+				if (!muCOSA_pixel_rect_clip(rect, width, height, &r)) {
+					return;
+				}
+
+				// Create graphics context if not already
+				if (!win->handles.gc) {
+					win->handles.gc = XCreateGC(d, win->handles.win, 0, 0);
+				}
+
+				// Window-owned buffer
+				if (owned) {
+					// Check for buffers the X server is done with
+					muCOSAX11_pixels_check(context);
+					if (owned->busy) {
+						MU_SET_RESULT(result, MUCOSA_FAILED_PIXELS_BUSY)
+						return;
+					}
+
+					#ifdef MUCOSA_X11_SHM
+					// Share pixels; busy until the X server sends a completion event
+					if (owned->use_shm) {
+						XShmPutImage(d, win->handles.win, win->handles.gc, owned->image, r.x, r.y, r.x, r.y, r.width, r.height, True);
+						owned->busy = MU_TRUE;
+						XFlush(d);
+						return;
+					}
+					#endif
+
+					// Copy pixels over the connection
+					XPutImage(d, win->handles.win, win->handles.gc, owned->image, r.x, r.y, r.x, r.y, r.width, r.height);
+					XFlush(d);
+					return;
+				}
+
+				// User memory; wrap it in an image temporarily
+				XImage* image = muCOSAX11_pixels_create_image(d, pixels, width, height, stride);
+				if (!image) {
+					MU_SET_RESULT(result, MUCOSA_X11_FAILED_CREATE_IMAGE)
+					return;
+				}
+				XPutImage(d, win->handles.win, win->handles.gc, image, r.x, r.y, r.x, r.y, r.width, r.height);
+				image->data = 0;
+				XDestroyImage(image);
+				XFlush(d);
+			}
+
+		/* Events */
+
+			// Handling for ClientMessage; used for the window being closed
+			void muCOSAX11_CLIENT_MESSAGE(muCOSAX11_Context* context, muCOSAX11_Window* win, XClientMessageEvent* event) {
+				// Window manager asking us to close the window
+				if (event->message_type == context->atoms.WM_PROTOCOLS &&
+					(Atom)event->data.l[0] == context->atoms.WM_DELETE_WINDOW
+				) {
+					win->states.closed = MU_TRUE;
+					// Deliver coalesced changes first
+					muCOSA_coalesce_flush(&win->coalesce, win, &win->callbacks, &win->events);
+					muCOSA_event_push_close(&win->events);
+					// Hide window until it gets destroyed
+					XUnmapWindow(win->handles.display, win->handles.win);
+				}
+			}
+
+			// Sends text input for a key press
+			void muCOSAX11_text_input(muCOSAX11_Window* win, XKeyEvent* event) {
+				uint8_m buf[64];
+				uint8_m* str = buf;
+				int len = 0;
+
+				// Input method available:
+				if (win->handles.ic) {
+					KeySym sym;
+					Status status;
+					len = Xutf8LookupString(win->handles.ic, event, (char*)buf, sizeof(buf), &sym, &status);
+
+					// - Composed string doesn't fit
+					if (status == XBufferOverflow) {
+						str = (uint8_m*)mu_malloc((size_m)len);
+						if (!str) {
+							return;
+						}
+						len = Xutf8LookupString(win->handles.ic, event, (char*)str, len, &sym, &status);
+					}
+
+					// - No characters
+					if (status != XLookupChars && status != XLookupBoth) {
+						len = 0;
+					}
+				}
+				// No input method; each Latin-1 character maps directly to a codepoint
+				else {
+					char latin1[16];
+					KeySym sym;
+					int latin1_len = XLookupString(event, latin1, sizeof(latin1), &sym, 0);
+					for (int i = 0; i < latin1_len; ++i) {
+						len += muCOSAXK_codepoint_to_utf8((uint8_m)latin1[i], &buf[len]);
+					}
+					// - Unicode keysyms
+					if (!latin1_len && (sym & 0xFF000000) == 0x01000000) {
+						len = muCOSAXK_codepoint_to_utf8((uint32_m)(sym & 0x00FFFFFF), buf);
+					}
+				}
+
+				// Send each character separately
+				for (int i = 0; i < len;) {
+					int size = muCOSAXK_utf8_char_size(str[i]);
+					if (i + size > len) {
+						break;
+					}
+
+					uint8_m c[5];
+					mu_memcpy(c, &str[i], (size_m)size);
+					c[size] = 0;
+					// Deliver coalesced changes first
+					muCOSA_coalesce_flush(&win->coalesce, win, &win->callbacks, &win->events);
+					muCOSA_event_push_text(&win->events, c);
+					win->props.text_input_callback(win, c);
+
+					// (Callback could've let go of text input)
+					if (!win->props.text_input_callback) {
+						break;
+					}
+					i += size;
+				}
+
+				if (str != buf) {
+					mu_free(str);
+				}
+			}
+
+			// Handling for KeyPress and KeyRelease
+			void muCOSAX11_KEY(muCOSAX11_Window* win, XKeyEvent* event, muBool status) {
+				// Convert X11 keysym to muCOSA key value
+				muKeyboardKey key = muCOSAXK_keysym_to_muCOSA((uint32_m)muCOSAX11_key_event_keysym(event));
+
+				// Set key state + event + callback if known
+				if (key != MU_KEYBOARD_UNKNOWN && key < MU_KEYBOARD_LENGTH) {
+					win->keymaps.keyboard[key] = status;
+					// Deliver coalesced changes first
+					muCOSA_coalesce_flush(&win->coalesce, win, &win->callbacks, &win->events);
+					muCOSA_event_push_keyboard(&win->events, key, status);
+					if (win->callbacks.keyboard) {
+						win->callbacks.keyboard(win, key, status);
+					}
+				}
+
+				// Text input
+				if (status && win->props.text_input_callback) {
+					muCOSAX11_text_input(win, event);
+				}
+			}
+
+			// Handling for ButtonPress and ButtonRelease
+			void muCOSAX11_BUTTON(muCOSAX11_Window* win, XButtonEvent* event, muBool status) {
+				muMouseKey key = MU_MOUSE_UNKNOWN;
+				switch (event->button) {
+					// Unknown button
+					default: return; break;
+					case Button1: key = MU_MOUSE_LEFT; break;
+					case Button2: key = MU_MOUSE_MIDDLE; break;
+					case Button3: key = MU_MOUSE_RIGHT; break;
+
+					// Scroll wheel; only button presses are meaningful
+					case Button4: case Button5: {
+						if (!status) {
+							return;
+						}
+						int32_m add = (event->button == Button4) ? 120 : -120;
+						win->props.scroll_level += add;
+						// Deliver coalesced changes first
+						muCOSA_coalesce_flush(&win->coalesce, win, &win->callbacks, &win->events);
+						// + Event + callback
+						muCOSA_event_push_scroll(&win->events, add);
+						if (win->callbacks.scroll) {
+							win->callbacks.scroll(win, add);
+						}
+						return;
+					} break;
+				}
+
+				// Update keymap
+				win->keymaps.mouse[key] = status;
+				// Deliver coalesced changes first
+				muCOSA_coalesce_flush(&win->coalesce, win, &win->callbacks, &win->events);
+				// + Event + callback
+				muCOSA_event_push_mouse_key(&win->events, key, status);
+				if (win->callbacks.mouse_key) {
+					win->callbacks.mouse_key(win, key, status);
+				}
+			}
+
+			// Handling for cursor movement (MotionNotify, EnterNotify, LeaveNotify)
+			void muCOSAX11_MOTION(muCOSAX11_Window* win, int x, int y) {
+				// Update cursor position if changed
+				if (win->props.cursor_x != (int32_m)x || win->props.cursor_y != (int32_m)y) {
+					win->props.cursor_x = (int32_m)x;
+					win->props.cursor_y = (int32_m)y;
+					// + Event + callback (unless coalesced)
+					if (!muCOSA_coalesce_cursor(&win->coalesce, win->events.time, (int32_m)x, (int32_m)y)) {
+						muCOSA_event_push_cursor(&win->events, (int32_m)x, (int32_m)y);
+						if (win->callbacks.cursor) {
+							win->callbacks.cursor(win, (int32_m)x, (int32_m)y);
+						}
+					}
+				}
+			}
+
+			// Handling for EnterNotify and LeaveNotify
+			void muCOSAX11_CROSSING(muCOSAX11_Context* context, muCOSAX11_Window* win, XCrossingEvent* event) {
+				// Keep track of the window that the cursor is in (for raw motion)
+				if (event->type == EnterNotify) {
+					context->pointer_window = win;
+				} else if (context->pointer_window == win) {
+					context->pointer_window = 0;
+				}
+				muCOSAX11_MOTION(win, event->x, event->y);
+			}
+
+			// Handling for ConfigureNotify
+			void muCOSAX11_CONFIGURE(muCOSAX11_Window* win, XConfigureEvent* event) {
+				// Dimensions
+				if ((uint32_m)event->width != win->props.width || (uint32_m)event->height != win->props.height) {
+					win->props.width = (uint32_m)event->width;
+					win->props.height = (uint32_m)event->height;
+					// + Event + callback (unless coalesced)
+					if (!muCOSA_coalesce_dimensions(&win->coalesce, win->events.time, win->props.width, win->props.height)) {
+						muCOSA_event_push_dimensions(&win->events, win->props.width, win->props.height);
+						if (win->callbacks.dimensions) {
+							win->callbacks.dimensions(win, win->props.width, win->props.height);
+						}
+					}
+				}
+
+				// Position; the coordinates are only relative to the root window if the
+				// event was sent by the window manager, or if we haven't been reparented
+				if (event->send_event || win->handles.parent == win->handles.root) {
+					if ((int32_m)event->x != win->props.x || (int32_m)event->y != win->props.y) {
+						win->props.x = (int32_m)event->x;
+						win->props.y = (int32_m)event->y;
+						// + Event + callback (unless coalesced)
+						if (!muCOSA_coalesce_position(&win->coalesce, win->events.time, win->props.x, win->props.y)) {
+							muCOSA_event_push_position(&win->events, win->props.x, win->props.y);
+							if (win->callbacks.position) {
+								win->callbacks.position(win, win->props.x, win->props.y);
+							}
+						}
+					}
+				}
+			}
+
+			// Grabs the pointer, confining it to the window and hiding it, returning
+			// if it was grabbed
+			muBool muCOSAX11_grab_pointer(muCOSAX11_Context* context, muCOSAX11_Window* win) {
+				// Create blank cursor if not already created
+				if (!context->blank_cursor) {
+					char data = 0;
+					Pixmap bitmap = XCreateBitmapFromData(context->display, win->handles.root, &data, 1, 1);
+					if (!bitmap) {
+						return MU_FALSE;
+					}
+					XColor black = MU_ZERO_STRUCT(XColor);
+					context->blank_cursor = XCreatePixmapCursor(context->display, bitmap, bitmap, &black, &black, 0, 0);
+					XFreePixmap(context->display, bitmap);
+				}
+
+				// Grab pointer
+				return XGrabPointer(
+					context->display, win->handles.win, True,
+					ButtonPressMask | ButtonReleaseMask | PointerMotionMask,
+					GrabModeAsync, GrabModeAsync, win->handles.win, context->blank_cursor, CurrentTime
+				) == GrabSuccess;
+			}
+
+			// Handling for FocusIn and FocusOut
+			void muCOSAX11_FOCUS(muCOSAX11_Context* context, muCOSAX11_Window* win, muBool focused) {
+				win->states.focused = focused;
+
+				// The pointer lock is released while unfocused
+				if (win->states.pointer_lock) {
+					if (focused) {
+						muCOSAX11_grab_pointer(context, win);
+					} else {
+						XUngrabPointer(context->display, CurrentTime);
+					}
+				}
+
+				// Text input is only sent while focused
+				if (win->handles.ic && win->props.text_input_callback) {
+					if (focused) {
+						XSetICFocus(win->handles.ic);
+					} else {
+						XUnsetICFocus(win->handles.ic);
+					}
+				}
+			}
+
+			// Gets the time that an event occurred on the context's clock
+			double muCOSAX11_event_time(muCOSAX11_Context* context, XEvent* event) {
+				double now = muCOSAPOSIX_get_current_time();
+
+				// Get server time of input events
+				Time time = CurrentTime;
+				switch (event->type) {
+					default: break;
+					case KeyPress: case KeyRelease: time = event->xkey.time; break;
+					case ButtonPress: case ButtonRelease: time = event->xbutton.time; break;
+					case MotionNotify: time = event->xmotion.time; break;
+					case EnterNotify: case LeaveNotify: time = event->xcrossing.time; break;
+				}
+
+				// Other events are timestamped with when they were received
+				if (time != CurrentTime) {
+					now = muCOSA_event_clock_convert(&context->event_clock, (uint32_m)time, now);
+				}
+				return now - context->time.orig_time;
+			}
+
+		#ifdef MUCOSA_X11_XI2
+			// Selects or deselects raw motion events for the whole display
+			void muCOSAX11_select_raw_motion(muCOSAX11_Context* context, muBool select) {
+				unsigned char mask[XIMaskLen(XI_RawMotion)];
+				mu_memset(mask, 0, sizeof(mask));
+				if (select) {
+					XISetMask(mask, XI_RawMotion);
+				}
+
+				// Raw events are only delivered to the root window
+				XIEventMask em;
+				em.deviceid = XIAllMasterDevices;
+				em.mask_len = sizeof(mask);
+				em.mask = mask;
+				XISelectEvents(context->display, DefaultRootWindow(context->display), &em, 1);
+				XFlush(context->display);
+			}
+
+			// Handles an XInput2 event
+			void muCOSAX11_xi_event(muCOSAX11_Context* context, XGenericEventCookie* cookie) {
+				if (cookie->extension != context->xi_opcode || !XGetEventData(context->display, cookie)) {
+					return;
+				}
+
+				if (cookie->evtype == XI_RawMotion) {
+					// Raw motion goes to the window with the pointer locked (if it's
+					// focused), and otherwise to the window that the cursor is in
+					muCOSAX11_Window* win = context->pointer_window;
+					if (context->locked_window && context->locked_window->states.focused) {
+						win = context->locked_window;
+					}
+
+					if (win && win->states.raw_motion && !win->states.closed) {
+						XIRawEvent* raw = (XIRawEvent*)cookie->data;
+						// Get the unaccelerated x (valuator 0) and y (valuator 1)
+						// motion; raw_values only holds the valuators that are set
+						double d[2] = { 0, 0 };
+						double* value = raw->raw_values;
+						for (int v = 0; v < 2 && v < raw->valuators.mask_len * 8; ++v) {
+							if (XIMaskIsSet(raw->valuators.mask, v)) {
+								d[v] = *value++;
+							}
+						}
+
+						if (d[0] != 0 || d[1] != 0) {
+							// Timestamp
+							double now = muCOSAPOSIX_get_current_time();
+							now = muCOSA_event_clock_convert(&context->event_clock, (uint32_m)raw->time, now);
+							win->events.time = now - context->time.orig_time;
+							// + Event + callback
+							muCOSA_event_push_raw_motion(&win->events, d[0], d[1]);
+							if (win->callbacks.raw_motion) {
+								win->callbacks.raw_motion(win, d[0], d[1]);
+							}
+						}
+					}
+				}
+
+				XFreeEventData(context->display, cookie);
+			}
+		#endif
+
+			// Handles an event
+			void muCOSAX11_handle_event(muCOSAX11_Context* context, XEvent* event) {
+				// Events for the input method
+				if (XFilterEvent(event, None)) {
+					return;
+				}
+
+				#ifdef MUCOSA_X11_XI2
+				// XInput2 events (which aren't tied to a window)
+				if (event->type == GenericEvent) {
+					if (context->xi_opcode) {
+						muCOSAX11_xi_event(context, &event->xcookie);
+					}
+					return;
+				}
+				#endif
+
+				// XKB events (which aren't tied to a window)
+				if (context->xkb && event->type == context->xkb_event) {
+					XkbEvent* xkb = (XkbEvent*)event;
+					if (xkb->any.xkb_type == XkbIndicatorStateNotify) {
+						context->indicator_state = xkb->indicators.state;
+					}
+					return;
+				}
+
+				// Events for the clipboard window
+				if (event->xany.window == context->clipboard.win) {
+					muCOSAX11_clipboard_handle_event(context, event);
+					return;
+				}
+
+				// Find window based on X11 window handle
+				muCOSAX11_Window* win = muCOSAX11_window_find(context, event->xany.window);
+				if (!win) {
+					return;
+				}
+
+				#ifdef MUCOSA_X11_SHM
+				// The X server being done with a pixel buffer
+				if (context->shm && event->type == context->shm_event) {
+					muCOSAX11_pixels_release(win, (XShmCompletionEvent*)event);
+					return;
+				}
+				#endif
+
+				// Timestamp event
+				win->events.time = muCOSAX11_event_time(context, event);
+
+				// Do things based on the event type
+				switch (event->type) {
+					// Event we're not processing
+					default: break;
+					// Window manager messages
+					case ClientMessage: muCOSAX11_CLIENT_MESSAGE(context, win, &event->xclient); break;
+					// Key down
+					case KeyPress: muCOSAX11_KEY(win, &event->xkey, MU_TRUE); break;
+					// Key up
+					case KeyRelease: muCOSAX11_KEY(win, &event->xkey, MU_FALSE); break;
+					// Mouse button down
+					case ButtonPress: muCOSAX11_BUTTON(win, &event->xbutton, MU_TRUE); break;
+					// Mouse button up
+					case ButtonRelease: muCOSAX11_BUTTON(win, &event->xbutton, MU_FALSE); break;
+					// Cursor movement
+					case MotionNotify: muCOSAX11_MOTION(win, event->xmotion.x, event->xmotion.y); break;
+					case EnterNotify: case LeaveNotify: muCOSAX11_CROSSING(context, win, &event->xcrossing); break;
+					// Resizing / Movement
+					case ConfigureNotify: muCOSAX11_CONFIGURE(win, &event->xconfigure); break;
+					// Reparenting by the window manager
+					case ReparentNotify: win->handles.parent = event->xreparent.parent; break;
+					// Focus
+					case FocusIn: muCOSAX11_FOCUS(context, win, MU_TRUE); break;
+					case FocusOut: muCOSAX11_FOCUS(context, win, MU_FALSE); break;
+				}
+			}
+
+		/* Creation / Destruction */
+
+			// Sets the size hints (min/max dimensions) of a window
+			void muCOSAX11_window_set_size_hints(muCOSAX11_Window* win, muBool position) {
+				XSizeHints* hints = XAllocSizeHints();
+				if (!hints) {
+					return;
+				}
+
+				hints->flags = PMinSize | PMaxSize | PWinGravity;
+				hints->min_width = (int)win->props.min_width;
+				hints->min_height = (int)win->props.min_height;
+				hints->max_width = (int)win->props.max_width;
+				hints->max_height = (int)win->props.max_height;
+				// Positions refer to the window's surface rather than its frame
+				hints->win_gravity = StaticGravity;
+
+				// Ask the window manager to respect the given position
+				if (position) {
+					hints->flags |= PPosition | USPosition;
+					hints->x = (int)win->props.x;
+					hints->y = (int)win->props.y;
+				}
+
+				XSetWMNormalHints(win->handles.display, win->handles.win, hints);
+				XFree(hints);
+			}
+
+			muCOSAResult muCOSAX11_window_set_title(muCOSAX11_Window* win, char* data);
+
+			muCOSAResult muCOSAX11_window_create(muCOSAX11_Context* context, muWindowInfo* info, muCOSAX11_Window* win) {
+				/* Default attributes */
+
+					// Zero-ing-out
+					mu_memset(&win->handles, 0, sizeof(win->handles));
+					mu_memset(&win->keymaps, 0, sizeof(win->keymaps));
+
+					// States
+					win->states.closed = MU_FALSE;
+					win->states.cursor_style = MU_CURSOR_ARROW;
+					win->states.focused = MU_FALSE;
+					win->states.raw_motion = MU_FALSE;
+					win->states.pointer_lock = MU_FALSE;
+
+					// Pixel format
+					if (info->pixel_format) {
+						win->props.use_format = MU_TRUE;
+						win->props.format = *info->pixel_format;
+					} else {
+						win->props.use_format = MU_FALSE;
+					}
+
+					// Min/Max dimensions
+					win->props.min_width = info->min_width;
+					win->props.min_height = info->min_height;
+					win->props.max_width = info->max_width;
+					win->props.max_height = info->max_height;
+					// - (Fix 0 defaults)
+					if (win->props.min_width == 0) {
+						win->props.min_width = 1;
+					}
+					if (win->props.min_height == 0) {
+						win->props.min_height = 1;
+					}
+					if (win->props.max_width == 0) {
+						win->props.max_width = 0x7FFF;
+					}
+					if (win->props.max_height == 0) {
+						win->props.max_height = 0x7FFF;
+					}
+
+					// Dimensions and position
+					win->props.width = info->width ? info->width : 1;
+					win->props.height = info->height ? info->height : 1;
+					win->props.x = info->x;
+					win->props.y = info->y;
+
+					// Scroll level
+					win->props.scroll_level = 0;
+
+					// Cursor position
+					win->props.cursor_x = win->props.cursor_y = 0;
+
+					// Callbacks
+					// - Zero-out if no callbacks specified
+					if (!info->callbacks) {
+						mu_memset(&win->callbacks, 0, sizeof(win->callbacks));
+					}
+					// - Set all callbacks if specified
+					else {
+						win->callbacks = *info->callbacks;
+					}
+
+					// Text focus
+					win->props.text_input_callback = 0;
+					win->props.text_cursor_x = win->props.text_cursor_y = 0;
+
+				/* Window */
+
+					Display* d = context->display;
+					win->handles.display = d;
+					#ifdef MUCOSA_X11_XCB
+					win->handles.connection = context->connection;
+					#endif
+					win->handles.atoms = &context->atoms;
+					win->handles.root = DefaultRootWindow(d);
+					win->handles.parent = win->handles.root;
+
+					// Attributes
+					XSetWindowAttributes wa = MU_ZERO_STRUCT(XSetWindowAttributes);
+					wa.event_mask =
+						KeyPressMask | KeyReleaseMask | ButtonPressMask | ButtonReleaseMask |
+						PointerMotionMask | EnterWindowMask | LeaveWindowMask |
+						StructureNotifyMask | FocusChangeMask | ExposureMask
+					;
+					wa.background_pixel = BlackPixel(d, DefaultScreen(d));
+					wa.border_pixel = 0;
+
+					// Create window
+					win->handles.win = XCreateWindow(d, win->handles.root,
+						(int)info->x, (int)info->y, (unsigned int)win->props.width, (unsigned int)win->props.height,
+						0, CopyFromParent, InputOutput, CopyFromParent,
+						CWEventMask | CWBackPixel | CWBorderPixel, &wa
+					);
+					if (!win->handles.win) {
+						return MUCOSA_X11_FAILED_CREATE_WINDOW;
+					}
+
+					// Ask to be told when the window is being closed rather than being killed
+					XSetWMProtocols(d, win->handles.win, &context->atoms.WM_DELETE_WINDOW, 1);
+
+					// Class
+					XClassHint* class_hint = XAllocClassHint();
+					if (class_hint) {
+						class_hint->res_name = (char*)"muCOSA";
+						class_hint->res_class = (char*)"muCOSA";
+						XSetClassHint(d, win->handles.win, class_hint);
+						XFree(class_hint);
+					}
+
+					// Title
+					muCOSAX11_window_set_title(win, info->title);
+
+					// Min/Max dimensions + position
+					muCOSAX11_window_set_size_hints(win, MU_TRUE);
+
+					// Cursor
+					win->handles.cursor = XCreateFontCursor(d, muCOSAX11_muCOSA_cursor_to_X11(win->states.cursor_style));
+					XDefineCursor(d, win->handles.win, win->handles.cursor);
+
+				/* Input context */
+
+					if (context->im) {
+						win->handles.ic = XCreateIC(context->im,
+							XNInputStyle, context->im_style,
+							XNClientWindow, win->handles.win,
+							XNFocusWindow, win->handles.win,
+							NULL
+						);
+
+						// Listen to any events the input method needs
+						if (win->handles.ic) {
+							unsigned long filter = 0;
+							if (XGetICValues(win->handles.ic, XNFilterEvents, &filter, NULL) == NULL) {
+								wa.event_mask |= (long)filter;
+								XSelectInput(d, win->handles.win, wa.event_mask);
+							}
+							// (Focus is only given once text input is requested)
+							XUnsetICFocus(win->handles.ic);
+						}
+					}
+
+				/* Add window to list + map */
+
+					muCOSAResult res = muCOSA_window_list_add(&context->windows, win);
+					if (!muCOSA_result_is_fatal(res)) {
+						res = muCOSA_window_map_add(&context->handles, (uint64_m)win->handles.win, win);
+						if (muCOSA_result_is_fatal(res)) {
+							muCOSA_window_list_remove(&context->windows, win);
+						}
+					}
+					if (muCOSA_result_is_fatal(res)) {
+						if (win->handles.ic) {
+							XDestroyIC(win->handles.ic);
+						}
+						XFreeCursor(d, win->handles.cursor);
+						XDestroyWindow(d, win->handles.win);
+						return res;
+					}
+
+				/* Show window */
+
+					XMapWindow(d, win->handles.win);
+					XFlush(d);
+
+				return res;
+			}
+
+			muCOSAResult muCOSAX11_window_set_raw_motion(muCOSAX11_Context* context, muCOSAX11_Window* win, muBool* data);
+			muCOSAResult muCOSAX11_window_set_pointer_lock(muCOSAX11_Context* context, muCOSAX11_Window* win, muBool* data);
+
+			void muCOSAX11_window_destroy(muCOSAX11_Context* context, muCOSAX11_Window* win) {
+				// Release pointer lock + stop receiving raw motion
+				muBool off = MU_FALSE;
+				muCOSAX11_window_set_pointer_lock(context, win, &off);
+				muCOSAX11_window_set_raw_motion(context, win, &off);
+				if (context->pointer_window == win) {
+					context->pointer_window = 0;
+				}
+				// Destroy input context
+				if (win->handles.ic) {
+					XDestroyIC(win->handles.ic);
+				}
+				// Free cursor
+				XFreeCursor(win->handles.display, win->handles.cursor);
+				// Destroy pixel buffers + graphics context
+				muCOSAX11_pixels_destroy(win->handles.display, &win->handles.pixels[0]);
+				muCOSAX11_pixels_destroy(win->handles.display, &win->handles.pixels[1]);
+				if (win->handles.gc) {
+					XFreeGC(win->handles.display, win->handles.gc);
+				}
+				#ifdef MUCOSA_EGL
+				// Destroy EGL surface
+				muCOSAEGL_surface_destroy(&context->egl, &win->handles.egl);
+				#endif
+				// Destroy window
+				XDestroyWindow(win->handles.display, win->handles.win);
+				XFlush(win->handles.display);
+				// Remove window from list + map
+				muCOSA_window_list_remove(&context->windows, win);
+				muCOSA_window_map_remove(&context->handles, (uint64_m)win->handles.win);
+			}
+
+		/* Main loop */
+
+			muBool muCOSAX11_window_get_closed(muCOSAX11_Window* win) {
+				return win->states.closed;
+			}
+
+			void muCOSAX11_window_close(muCOSAX11_Window* win) {
+				// Set closed flag
+				win->states.closed = MU_TRUE;
+			}
+
+			// Checks all keystates against the indicator state and updates accordingly
+			void muCOSAX11_update_keystate(muCOSAX11_Context* context, muCOSAX11_Window* win, unsigned int state) {
+				// Loop through each possible keystate
+				for (muKeyboardState s = 1; s < MU_KEYSTATE_LENGTH; ++s) {
+					// Skip if not recognized
+					if (context->indicators[s] < 0) {
+						continue;
+					}
+
+					// Change value if different
+					muBool b = (state & (1u << context->indicators[s])) != 0;
+					if (b != win->keymaps.keystates[s]) {
+						win->keymaps.keystates[s] = b;
+
+						// + Event + callback
+						muCOSA_event_push_keystate(&win->events, s, b);
+						if (win->callbacks.keystate) {
+							win->callbacks.keystate(win, s, b);
+						}
+					}
+				}
+			}
+
+			// Processes all events sent by the server without blocking
+			void muCOSAX11_dispatch(muCOSAX11_Context* context) {
+				// Flush requests and read whatever the server has sent; this is the
+				// only point where we read from the connection
+				XPending(context->display);
+
+				// Process every queued event; no more reading or syncing is done here,
+				// so anything that arrives in the meantime gets processed next time
+				XEvent event;
+				while (QLength(context->display) > 0) {
+					XNextEvent(context->display, &event);
+					muCOSAX11_handle_event(context, &event);
+				}
+			}
+
+			// Refreshes everything in a window not given directly by events (after
+			// events have been processed)
+			void muCOSAX11_window_refresh(muCOSAX11_Context* context, muCOSAX11_Window* win) {
+				// Deliver coalesced changes
+				muCOSA_coalesce_flush(&win->coalesce, win, &win->callbacks, &win->events);
+				// Changes found from here on are timestamped with now
+				win->events.time = muCOSAPOSIX_time_get(&context->time);
+				// Update keystates from the indicator state given by XKB events
+				muCOSAX11_update_keystate(context, win, context->indicator_state);
+				// Mark end of update in recording
+				muCOSA_recording_write_update(&win->events.recording, win->events.time);
+
+				// Frame callback
+				if (win->callbacks.frame) {
+					win->callbacks.frame(win);
+				}
+			}
+
+			void muCOSAX11_window_update(muCOSAX11_Context* context, muCOSAX11_Window* win) {
+				// Process events
+				muCOSAX11_dispatch(context);
+
+				// Refresh window
+				muCOSAX11_window_refresh(context, win);
+			}
+
+			void muCOSAX11_context_update(muCOSAX11_Context* context) {
+				// Process events once for every window
+				muCOSAX11_dispatch(context);
+
+				// Refresh each unclosed window
+				for (size_m i = 0; i < context->windows.wincount; ++i) {
+					muCOSAX11_Window* win = (muCOSAX11_Window*)context->windows.windows[i];
+					if (win && !win->states.closed) {
+						muCOSAX11_window_refresh(context, win);
+					}
+				}
+			}
+
+			void muCOSAX11_window_wait(muCOSAX11_Context* context, double timeout) {
+				// Don't wait if events have already been received (this flushes
+				// requests and reads anything new without blocking)
+				if (XPending(context->display) > 0) {
+					return;
+				}
+				// Wait for the server to send something
+				muCOSAPOSIX_wait(&context->wake, ConnectionNumber(context->display), timeout);
+			}
+
+		/* Queries */
+
+			// Dimensions, position, and cursor position are retrieved by querying the
+			// X server. With XCB, these queries are split into a request and its
+			// reply, so that the requests for several attributes can all be sent
+			// before waiting on any replies, costing one round trip in total rather
+			// than one per attribute.
+
+			// Checks if retrieving an attribute requires a query to the X server
+			muBool muCOSAX11_attrib_is_query(muWindowAttrib attrib) {
+				return attrib == MU_WINDOW_DIMENSIONS || attrib == MU_WINDOW_POSITION || attrib == MU_WINDOW_CURSOR;
+			}
+
+			#ifdef MUCOSA_X11_XCB
+
+			// Cookie of a query request
+			union muCOSAX11_Query {
+				xcb_get_geometry_cookie_t geometry;
+				xcb_translate_coordinates_cookie_t translate;
+				xcb_query_pointer_cookie_t pointer;
+			};
+			typedef union muCOSAX11_Query muCOSAX11_Query;
+
+			// Sends the request for a queried attribute without waiting for the reply
+			void muCOSAX11_query_request(muCOSAX11_Window* win, muWindowAttrib attrib, muCOSAX11_Query* query) {
+				xcb_connection_t* c = win->handles.connection;
+				switch (attrib) {
+					default: break;
+					// Dimensions (geometry of the window)
+					case MU_WINDOW_DIMENSIONS: {
+						query->geometry = xcb_get_geometry(c, (xcb_drawable_t)win->handles.win);
+					} break;
+					// Position (top-left of the surface in root window coordinates)
+					case MU_WINDOW_POSITION: {
+						query->translate = xcb_translate_coordinates(c, (xcb_window_t)win->handles.win, (xcb_window_t)win->handles.root, 0, 0);
+					} break;
+					// Cursor (pointer relative to the window)
+					case MU_WINDOW_CURSOR: {
+						query->pointer = xcb_query_pointer(c, (xcb_window_t)win->handles.win);
+					} break;
+				}
+			}
+
+			// Waits for the reply of a queried attribute and gives it; an error in
+			// reply is given back here rather than sent to Xlib's error handler
+			muCOSAResult muCOSAX11_query_reply(muCOSAX11_Window* win, muWindowAttrib attrib, muCOSAX11_Query* query, void* data) {
+				xcb_connection_t* c = win->handles.connection;
+				switch (attrib) {
+					default: return MUCOSA_SUCCESS; break;
+
+					// Dimensions
+					case MU_WINDOW_DIMENSIONS: {
+						xcb_generic_error_t* error = 0;
+						xcb_get_geometry_reply_t* reply = xcb_get_geometry_reply(c, query->geometry, &error);
+						if (!reply) {
+							free(error);
+							return MUCOSA_X11_FAILED_GET_WINDOW_ATTRIB;
+						}
+						((uint32_m*)data)[0] = (uint32_m)reply->width;
+						((uint32_m*)data)[1] = (uint32_m)reply->height;
+						free(reply);
+					} break;
+
+					// Position
+					case MU_WINDOW_POSITION: {
+						xcb_generic_error_t* error = 0;
+						xcb_translate_coordinates_reply_t* reply = xcb_translate_coordinates_reply(c, query->translate, &error);
+						if (!reply) {
+							free(error);
+							return MUCOSA_X11_FAILED_GET_WINDOW_ATTRIB;
+						}
+						((int32_m*)data)[0] = (int32_m)reply->dst_x;
+						((int32_m*)data)[1] = (int32_m)reply->dst_y;
+						free(reply);
+					} break;
+
+					// Cursor
+					case MU_WINDOW_CURSOR: {
+						xcb_generic_error_t* error = 0;
+						xcb_query_pointer_reply_t* reply = xcb_query_pointer_reply(c, query->pointer, &error);
+						if (!reply) {
+							free(error);
+							return MUCOSA_X11_FAILED_GET_WINDOW_ATTRIB;
+						}
+						// (Pointer is on another screen)
+						if (!reply->same_screen) {
+							free(reply);
+							return MUCOSA_X11_FAILED_GET_WINDOW_ATTRIB;
+						}
+						((int32_m*)data)[0] = (int32_m)reply->win_x;
+						((int32_m*)data)[1] = (int32_m)reply->win_y;
+						free(reply);
+					} break;
+				}
+				return MUCOSA_SUCCESS;
+			}
+
+			#endif /* MUCOSA_X11_XCB */
+
+			muCOSAResult muCOSAX11_window_get_dimensions(muCOSAX11_Window* win, uint32_m* data);
+			muCOSAResult muCOSAX11_window_get_position(muCOSAX11_Window* win, int32_m* data);
+			muCOSAResult muCOSAX11_window_get_cursor_pos(muCOSAX11_Window* win, int32_m* data);
+
+			// Retrieves every queried attribute in a list of attributes, skipping
+			// the rest
+			void muCOSAX11_window_get_queries(muCOSAResult* result, muCOSAX11_Window* win, size_m count, muWindowAttrib* attribs, void** data) {
+				#ifdef MUCOSA_X11_XCB
+				// Send requests in chunks, and then wait for all of their replies
+				#define MUCOSAX11_QUERY_CHUNK 16
+				muCOSAX11_Query queries[MUCOSAX11_QUERY_CHUNK];
+				for (size_m c = 0; c < count; c += MUCOSAX11_QUERY_CHUNK) {
+					size_m end = (count - c < MUCOSAX11_QUERY_CHUNK) ? count : c + MUCOSAX11_QUERY_CHUNK;
+
+					// Send requests
+					for (size_m i = c; i < end; ++i) {
+						if (muCOSAX11_attrib_is_query(attribs[i])) {
+							muCOSAX11_query_request(win, attribs[i], &queries[i-c]);
+						}
+					}
+
+					// Wait for replies
+					for (size_m i = c; i < end; ++i) {
+						if (muCOSAX11_attrib_is_query(attribs[i])) {
+							muCOSAResult res = muCOSAX11_query_reply(win, attribs[i], &queries[i-c], data[i]);
+							if (res != MUCOSA_SUCCESS) {
+								MU_SET_RESULT(result, res)
+							}
+						}
+					}
+				}
+				#undef MUCOSAX11_QUERY_CHUNK
+
+				#else
+				// Query each attribute one by one
+				for (size_m i = 0; i < count; ++i) {
+					muCOSAResult res = MUCOSA_SUCCESS;
+					switch (attribs[i]) {
+						default: continue; break;
+						case MU_WINDOW_DIMENSIONS: res = muCOSAX11_window_get_dimensions(win, (uint32_m*)data[i]); break;
+						case MU_WINDOW_POSITION: res = muCOSAX11_window_get_position(win, (int32_m*)data[i]); break;
+						case MU_WINDOW_CURSOR: res = muCOSAX11_window_get_cursor_pos(win, (int32_m*)data[i]); break;
+					}
+					if (res != MUCOSA_SUCCESS) {
+						MU_SET_RESULT(result, res)
+					}
+				}
+				#endif
+			}
+
+		/* Title */
+
+			muCOSAResult muCOSAX11_window_set_title(muCOSAX11_Window* win, char* data) {
+				// Set UTF-8 title for modern window managers
+				size_m len = 0;
+				while (data[len]) {
+					++len;
+				}
+				XChangeProperty(win->handles.display, win->handles.win,
+					win->handles.atoms->_NET_WM_NAME, win->handles.atoms->UTF8_STRING, 8,
+					PropModeReplace, (unsigned char*)data, (int)len
+				);
+				XChangeProperty(win->handles.display, win->handles.win,
+					win->handles.atoms->_NET_WM_ICON_NAME, win->handles.atoms->UTF8_STRING, 8,
+					PropModeReplace, (unsigned char*)data, (int)len
+				);
+
+				// Set converted title for older window managers
+				Xutf8SetWMProperties(win->handles.display, win->handles.win, data, data, NULL, 0, NULL, NULL, NULL);
+				XFlush(win->handles.display);
+				return MUCOSA_SUCCESS;
+			}
+
+		/* Dimensions */
+
+			muCOSAResult muCOSAX11_window_get_dimensions(muCOSAX11_Window* win, uint32_m* data) {
+				#ifdef MUCOSA_X11_XCB
+				// Send request + wait for reply
+				muCOSAX11_Query query;
+				muCOSAX11_query_request(win, MU_WINDOW_DIMENSIONS, &query);
+				return muCOSAX11_query_reply(win, MU_WINDOW_DIMENSIONS, &query, data);
+				#else
+				// Get window attributes
+				XWindowAttributes wa;
+				if (!XGetWindowAttributes(win->handles.display, win->handles.win, &wa)) {
+					return MUCOSA_X11_FAILED_GET_WINDOW_ATTRIB;
+				}
+
+				// Set values
+				data[0] = (uint32_m)wa.width;
+				data[1] = (uint32_m)wa.height;
+				return MUCOSA_SUCCESS;
+				#endif
+			}
+
+			muCOSAResult muCOSAX11_window_set_dimensions(muCOSAX11_Window* win, uint32_m* data) {
+				// X11 doesn't allow 0 dimensions
+				if (!data[0] || !data[1]) {
+					return MUCOSA_X11_FAILED_SET_WINDOW_ATTRIB;
+				}
+
+				// Resize window
+				XResizeWindow(win->handles.display, win->handles.win, (unsigned int)data[0], (unsigned int)data[1]);
+				XFlush(win->handles.display);
+				return MUCOSA_SUCCESS;
+			}
+
+		/* Position */
+
+			muCOSAResult muCOSAX11_window_get_position(muCOSAX11_Window* win, int32_m* data) {
+				#ifdef MUCOSA_X11_XCB
+				// Send request + wait for reply
+				muCOSAX11_Query query;
+				muCOSAX11_query_request(win, MU_WINDOW_POSITION, &query);
+				return muCOSAX11_query_reply(win, MU_WINDOW_POSITION, &query, data);
+				#else
+				// Translate top-left of surface into root window coordinates
+				int x, y;
+				Window child;
+				if (!XTranslateCoordinates(win->handles.display, win->handles.win, win->handles.root, 0, 0, &x, &y, &child)) {
+					return MUCOSA_X11_FAILED_GET_WINDOW_ATTRIB;
+				}
+
+				// Set values
+				data[0] = (int32_m)x;
+				data[1] = (int32_m)y;
+				return MUCOSA_SUCCESS;
+				#endif
+			}
+
+			muCOSAResult muCOSAX11_window_set_position(muCOSAX11_Window* win, int32_m* data) {
+				// Move window; static gravity makes this the position of the surface
+				XMoveWindow(win->handles.display, win->handles.win, (int)data[0], (int)data[1]);
+				XFlush(win->handles.display);
+				return MUCOSA_SUCCESS;
+			}
+
+		/* Keymaps */
+
+			muCOSAResult muCOSAX11_window_get_keyboard_map(muCOSAX11_Window* win, muBool** data) {
+				// Point to keyboard keymap
+				*data = win->keymaps.keyboard;
+				return MUCOSA_SUCCESS;
+			}
+
+			muCOSAResult muCOSAX11_window_get_keystate_map(muCOSAX11_Window* win, muBool** data) {
+				// Point to keystate keymap
+				*data = win->keymaps.keystates;
+				return MUCOSA_SUCCESS;
+			}
+
+			muCOSAResult muCOSAX11_window_get_mouse_map(muCOSAX11_Window* win, muBool** data) {
+				// Point to mouse keymap
+				*data = win->keymaps.mouse;
+				return MUCOSA_SUCCESS;
+			}
+
+		/* Cursor */
+
+			muCOSAResult muCOSAX11_window_get_cursor_pos(muCOSAX11_Window* win, int32_m* data) {
+				#ifdef MUCOSA_X11_XCB
+				// Send request + wait for reply
+				muCOSAX11_Query query;
+				muCOSAX11_query_request(win, MU_WINDOW_CURSOR, &query);
+				return muCOSAX11_query_reply(win, MU_WINDOW_CURSOR, &query, data);
+				#else
+				// Query pointer relative to the window
+				Window root, child;
+				int root_x, root_y, win_x, win_y;
+				unsigned int mask;
+				if (!XQueryPointer(win->handles.display, win->handles.win, &root, &child, &root_x, &root_y, &win_x, &win_y, &mask)) {
+					// (Pointer is on another screen)
+					return MUCOSA_X11_FAILED_GET_WINDOW_ATTRIB;
+				}
+
+				// Set values
+				data[0] = (int32_m)win_x;
+				data[1] = (int32_m)win_y;
+				return MUCOSA_SUCCESS;
+				#endif
+			}
+
+			muCOSAResult muCOSAX11_window_set_cursor_pos(muCOSAX11_Window* win, int32_m* data) {
+				// Warp pointer relative to the window
+				XWarpPointer(win->handles.display, None, win->handles.win, 0, 0, 0, 0, (int)data[0], (int)data[1]);
+				XFlush(win->handles.display);
+				return MUCOSA_SUCCESS;
+			}
+
+			muCOSAResult muCOSAX11_window_get_cursor_style(muCOSAX11_Window* win, muCursorStyle* data) {
+				// Set data to cursor style
+				*data = win->states.cursor_style;
+				return MUCOSA_SUCCESS;
+			}
+
+			muCOSAResult muCOSAX11_window_set_cursor_style(muCOSAX11_Window* win, muCursorStyle* data) {
+				// Create new cursor
+				Cursor cursor = XCreateFontCursor(win->handles.display, muCOSAX11_muCOSA_cursor_to_X11(*data));
+				if (!cursor) {
+					return MUCOSA_X11_FAILED_SET_WINDOW_ATTRIB;
+				}
+
+				// Set cursor
+				XDefineCursor(win->handles.display, win->handles.win, cursor);
+				// Free old cursor
+				XFreeCursor(win->handles.display, win->handles.cursor);
+				XFlush(win->handles.display);
+
+				// Set internal storage to cursor style
+				win->handles.cursor = cursor;
+				win->states.cursor_style = *data;
+				return MUCOSA_SUCCESS;
+			}
+
+		/* Scroll */
+
+			void muCOSAX11_window_get_scroll(muCOSAX11_Window* win, int32_m* data) {
+				// Give scroll level
+				*data = win->props.scroll_level;
+			}
+
+			void muCOSAX11_window_set_scroll(muCOSAX11_Window* win, int32_m* data) {
+				// Overwrite scroll level
+				win->props.scroll_level = *data;
+			}
+
+		/* Event time */
+
+			void muCOSAX11_window_get_event_time(muCOSAX11_Window* win, double* data) {
+				// Give time of the most recent event
+				*data = win->events.time;
+			}
+
+		/* Raw motion */
+
+			void muCOSAX11_window_get_raw_motion(muCOSAX11_Window* win, muBool* data) {
+				*data = win->states.raw_motion;
+			}
+
+			muCOSAResult muCOSAX11_window_set_raw_motion(muCOSAX11_Context* context, muCOSAX11_Window* win, muBool* data) {
+				if (*data == win->states.raw_motion) {
+					return MUCOSA_SUCCESS;
+				}
+
+				#ifdef MUCOSA_X11_XI2
+				if (!context->xi_opcode) {
+					return MUCOSA_FAILED_UNSUPPORTED_FEATURE;
+				}
+
+				// Raw events are selected for the whole display, so only select
+				// them while at least one window receives raw motion
+				win->states.raw_motion = *data;
+				if (*data) {
+					if (context->raw_motion_windows++ == 0) {
+						muCOSAX11_select_raw_motion(context, MU_TRUE);
+					}
+				} else {
+					if (--context->raw_motion_windows == 0) {
+						muCOSAX11_select_raw_motion(context, MU_FALSE);
+					}
+				}
+				return MUCOSA_SUCCESS;
+				#else
+				return MUCOSA_FAILED_UNSUPPORTED_FEATURE; if (context) {}
+				#endif
+			}
+
+		/* Pointer lock */
+
+			void muCOSAX11_window_get_pointer_lock(muCOSAX11_Window* win, muBool* data) {
+				*data = win->states.pointer_lock;
+			}
+
+			muCOSAResult muCOSAX11_window_set_pointer_lock(muCOSAX11_Context* context, muCOSAX11_Window* win, muBool* data) {
+				if (*data == win->states.pointer_lock) {
+					return MUCOSA_SUCCESS;
+				}
+
+				// Lock
+				if (*data) {
+					// Grab pointer
+					if (!muCOSAX11_grab_pointer(context, win)) {
+						return MUCOSA_X11_FAILED_GRAB_POINTER;
+					}
+					// Take the lock from any other window
+					if (context->locked_window) {
+						context->locked_window->states.pointer_lock = MU_FALSE;
+					}
+					context->locked_window = win;
+				}
+				// Unlock
+				else {
+					XUngrabPointer(context->display, CurrentTime);
+					XFlush(context->display);
+					if (context->locked_window == win) {
+						context->locked_window = 0;
+					}
+				}
+
+				win->states.pointer_lock = *data;
+				return MUCOSA_SUCCESS;
+			}
+
+		/* Input injection */
+
+			// Input is faked through XTest, so the X server sends it back as regular
+			// events, which are then handled like any other input.
+
+			#ifdef MUCOSA_X11_XTEST
+
+			// Fakes a press or release of the key that gives the given keysym
+			muCOSAResult muCOSAX11_fake_keysym(muCOSAX11_Context* context, KeySym sym, muBool status) {
+				KeyCode code = XKeysymToKeycode(context->display, sym);
+				if (!code) {
+					return MUCOSA_FAILED_UNKNOWN_INPUT;
+				}
+				XTestFakeKeyEvent(context->display, code, status ? True : False, CurrentTime);
+				return MUCOSA_SUCCESS;
+			}
+
+			muCOSAResult muCOSAX11_window_inject_key(muCOSAX11_Context* context, muKeyboardKey key, muBool status) {
+				if (!context->xtest) {
+					return MUCOSA_FAILED_UNSUPPORTED_FEATURE;
+				}
+				// Convert muCOSA key code to keysym
+				uint32_m sym = muCOSAXK_muCOSA_to_keysym(key);
+				if (!sym) {
+					return MUCOSA_FAILED_UNKNOWN_INPUT;
+				}
+				// Fake key
+				muCOSAResult res = muCOSAX11_fake_keysym(context, (KeySym)sym, status);
+				XFlush(context->display);
+				return res;
+			}
+
+			muCOSAResult muCOSAX11_window_inject_keystate(muCOSAX11_Context* context, muKeyboardState state, muBool status) {
+				if (!context->xtest) {
+					return MUCOSA_FAILED_UNSUPPORTED_FEATURE;
+				}
+				// Get lock key of state
+				KeySym sym;
+				switch (state) {
+					default: return MUCOSA_FAILED_UNKNOWN_INPUT; break;
+					case MU_KEYSTATE_CAPS_LOCK: sym = XK_Caps_Lock; break;
+					case MU_KEYSTATE_SCROLL_LOCK: sym = XK_Scroll_Lock; break;
+					case MU_KEYSTATE_NUM_LOCK: sym = XK_Num_Lock; break;
+				}
+				if (context->indicators[state] < 0) {
+					return MUCOSA_FAILED_UNKNOWN_INPUT;
+				}
+
+				// Do nothing if already in that state
+				muBool on = (context->indicator_state & (1u << context->indicators[state])) != 0;
+				if (on == status) {
+					return MUCOSA_SUCCESS;
+				}
+				// Press + release lock key to toggle it
+				muCOSAResult res = muCOSAX11_fake_keysym(context, sym, MU_TRUE);
+				if (res == MUCOSA_SUCCESS) {
+					muCOSAX11_fake_keysym(context, sym, MU_FALSE);
+				}
+				XFlush(context->display);
+				return res;
+			}
+
+			muCOSAResult muCOSAX11_window_inject_mouse_key(muCOSAX11_Context* context, muMouseKey key, muBool status) {
+				if (!context->xtest) {
+					return MUCOSA_FAILED_UNSUPPORTED_FEATURE;
+				}
+				// Convert muCOSA mouse key to button
+				unsigned int button;
+				switch (key) {
+					default: return MUCOSA_FAILED_UNKNOWN_INPUT; break;
+					case MU_MOUSE_LEFT: button = Button1; break;
+					case MU_MOUSE_MIDDLE: button = Button2; break;
+					case MU_MOUSE_RIGHT: button = Button3; break;
+				}
+				// Fake button
+				XTestFakeButtonEvent(context->display, button, status ? True : False, CurrentTime);
+				XFlush(context->display);
+				return MUCOSA_SUCCESS;
+			}
+
+			muCOSAResult muCOSAX11_window_inject_cursor(muCOSAX11_Context* context, muCOSAX11_Window* win, int32_m x, int32_m y) {
+				if (!context->xtest) {
+					return MUCOSA_FAILED_UNSUPPORTED_FEATURE;
+				}
+				// Convert window coordinates to screen coordinates
+				int rx, ry;
+				Window child;
+				if (!XTranslateCoordinates(context->display, win->handles.win, DefaultRootWindow(context->display), x, y, &rx, &ry, &child)) {
+					return MUCOSA_FAILED_UNSUPPORTED_FEATURE;
+				}
+				// Fake motion on the window's screen
+				XTestFakeMotionEvent(context->display, DefaultScreen(context->display), rx, ry, CurrentTime);
+				XFlush(context->display);
+				return MUCOSA_SUCCESS;
+			}
+
+			muCOSAResult muCOSAX11_window_inject_scroll(muCOSAX11_Context* context, int32_m add) {
+				if (!context->xtest) {
+					return MUCOSA_FAILED_UNSUPPORTED_FEATURE;
+				}
+				// Each scroll wheel press adds 120 or -120
+				unsigned int button = (add > 0) ? Button4 : Button5;
+				int32_m presses = ((add > 0) ? add : -add) / 120;
+				for (int32_m i = 0; i < presses; ++i) {
+					XTestFakeButtonEvent(context->display, button, True, CurrentTime);
+					XTestFakeButtonEvent(context->display, button, False, CurrentTime);
+				}
+				XFlush(context->display);
+				return MUCOSA_SUCCESS;
+			}
+
+			muCOSAResult muCOSAX11_window_inject_raw_motion(muCOSAX11_Context* context, double dx, double dy) {
+				if (!context->xtest) {
+					return MUCOSA_FAILED_UNSUPPORTED_FEATURE;
+				}
+				// Fake relative motion, rounded to whole pixels
+				int x = (int)((dx < 0.0) ? (dx - 0.5) : (dx + 0.5));
+				int y = (int)((dy < 0.0) ? (dy - 0.5) : (dy + 0.5));
+				XTestFakeRelativeMotionEvent(context->display, x, y, CurrentTime);
+				XFlush(context->display);
+				return MUCOSA_SUCCESS;
+			}
+
+			muCOSAResult muCOSAX11_window_inject_text(muCOSAX11_Context* context, uint8_m* text) {
+				if (!context->xtest) {
+					return MUCOSA_FAILED_UNSUPPORTED_FEATURE;
+				}
+
+				// Type each character
+				muCOSAResult res = MUCOSA_SUCCESS;
+				while (*text && res == MUCOSA_SUCCESS) {
+					// Decode UTF-8 character
+					int size = muCOSAXK_utf8_char_size(*text);
+					uint32_m codepoint = (size == 1) ? *text : (*text & (0x7F >> size));
+					for (int i = 1; i < size; ++i) {
+						if ((text[i] & 0xC0) != 0x80) {
+							return MUCOSA_FAILED_UNKNOWN_INPUT;
+						}
+						codepoint = (codepoint << 6) | (text[i] & 0x3F);
+					}
+					text += size;
+
+					// Convert to keysym (Latin-1 keysyms match their codepoint, and
+					// other characters have Unicode keysyms)
+					KeySym sym;
+					if (codepoint == '\n' || codepoint == '\r') {
+						sym = XK_Return;
+					} else if (codepoint == '\t') {
+						sym = XK_Tab;
+					} else if ((codepoint >= 0x20 && codepoint <= 0x7E) || (codepoint >= 0xA0 && codepoint <= 0xFF)) {
+						sym = (KeySym)codepoint;
+					} else {
+						sym = (KeySym)(0x01000000 | codepoint);
+					}
+
+					// Find key that gives the keysym, and if shift is needed for it
+					KeyCode code = XKeysymToKeycode(context->display, sym);
+					if (!code) {
+						return MUCOSA_FAILED_UNKNOWN_INPUT;
+					}
+					muBool shift = XkbKeycodeToKeysym(context->display, code, 0, 0) != sym;
+					if (shift && XkbKeycodeToKeysym(context->display, code, 0, 1) != sym) {
+						return MUCOSA_FAILED_UNKNOWN_INPUT;
+					}
+
+					// Type key (with shift held if needed)
+					if (shift) {
+						res = muCOSAX11_fake_keysym(context, XK_Shift_L, MU_TRUE);
+					}
+					if (res == MUCOSA_SUCCESS) {
+						XTestFakeKeyEvent(context->display, code, True, CurrentTime);
+						XTestFakeKeyEvent(context->display, code, False, CurrentTime);
+						if (shift) {
+							muCOSAX11_fake_keysym(context, XK_Shift_L, MU_FALSE);
+						}
+					}
+				}
+				XFlush(context->display);
+				return res;
+			}
+
+			#endif /* MUCOSA_X11_XTEST */
+
+			// Closing is faked as the window manager asking to close the window,
+			// which doesn't need XTest
+			muCOSAResult muCOSAX11_window_inject_close(muCOSAX11_Context* context, muCOSAX11_Window* win) {
+				XEvent event;
+				mu_memset(&event, 0, sizeof(event));
+				event.xclient.type = ClientMessage;
+				event.xclient.window = win->handles.win;
+				event.xclient.message_type = context->atoms.WM_PROTOCOLS;
+				event.xclient.format = 32;
+				event.xclient.data.l[0] = (long)context->atoms.WM_DELETE_WINDOW;
+				event.xclient.data.l[1] = CurrentTime;
+				if (!XSendEvent(context->display, win->handles.win, False, NoEventMask, &event)) {
+					return MUCOSA_FAILED_UNSUPPORTED_FEATURE;
+				}
+				XFlush(context->display);
+				return MUCOSA_SUCCESS;
+			}
+
+		/* Callbacks */
+
+			void muCOSAX11_window_set_callback(muCOSAX11_Window* win, muWindowAttrib attrib, void* fun) {
+				switch (attrib) {
+					case MU_WINDOW_DIMENSIONS_CALLBACK: {
+						mu_memcpy(&win->callbacks.dimensions, fun, sizeof(win->callbacks.dimensions));
+					} break;
+					case MU_WINDOW_POSITION_CALLBACK: {
+						mu_memcpy(&win->callbacks.position, fun, sizeof(win->callbacks.position));
+					} break;
+					case MU_WINDOW_KEYBOARD_CALLBACK: {
+						mu_memcpy(&win->callbacks.keyboard, fun, sizeof(win->callbacks.keyboard));
+					} break;
+					case MU_WINDOW_KEYSTATE_CALLBACK: {
+						mu_memcpy(&win->callbacks.keystate, fun, sizeof(win->callbacks.keystate));
+					} break;
+					case MU_WINDOW_MOUSE_KEY_CALLBACK: {
+						mu_memcpy(&win->callbacks.mouse_key, fun, sizeof(win->callbacks.mouse_key));
+					} break;
+					case MU_WINDOW_CURSOR_CALLBACK: {
+						mu_memcpy(&win->callbacks.cursor, fun, sizeof(win->callbacks.cursor));
+					} break;
+					case MU_WINDOW_SCROLL_CALLBACK: {
+						mu_memcpy(&win->callbacks.scroll, fun, sizeof(win->callbacks.scroll));
+					} break;
+					case MU_WINDOW_FRAME_CALLBACK: {
+						mu_memcpy(&win->callbacks.frame, fun, sizeof(win->callbacks.frame));
+					} break;
+					case MU_WINDOW_RAW_MOTION_CALLBACK: {
+						mu_memcpy(&win->callbacks.raw_motion, fun, sizeof(win->callbacks.raw_motion));
+					} break;
+				}
+			}
+
+		/* Text input */
+
+			void muCOSAX11_window_update_text_cursor(muCOSAResult* result, muCOSAX11_Window* win, uint32_m cx, uint32_m cy);
+			void muCOSAX11_window_get_text_input(muCOSAResult* result, muCOSAX11_Window* win, uint32_m cx, uint32_m cy, void (*callback)(muWindow, uint8_m*)) {
+				// Set callback
+				win->props.text_input_callback = callback;
+
+				// Give the input context focus if the window is focused
+				if (win->handles.ic && win->states.focused) {
+					XSetICFocus(win->handles.ic);
+				}
+
+				// Update text cursor position
+				muCOSAX11_window_update_text_cursor(result, win, cx, cy);
+			}
+
+			void muCOSAX11_window_let_text_input(muCOSAX11_Window* win) {
+				// Set callback to nothing
+				win->props.text_input_callback = 0;
+				// Take focus away from the input context
+				if (win->handles.ic) {
+					XUnsetICFocus(win->handles.ic);
+				}
+			}
+
+			void muCOSAX11_window_update_text_cursor(muCOSAResult* result, muCOSAX11_Window* win, uint32_m cx, uint32_m cy) {
+				// Do nothing if text input isn't being taken
+				if (!win->props.text_input_callback) {
+					return;
+				}
+
+				win->props.text_cursor_x = cx;
+				win->props.text_cursor_y = cy;
+
+				// The spot location only exists for over-the-spot preediting
+				if (!win->handles.ic) {
+					return;
+				}
+				XIMStyle style = 0;
+				if (XGetICValues(win->handles.ic, XNInputStyle, &style, NULL) != NULL || !(style & XIMPreeditPosition)) {
+					return;
+				}
+
+				// Set spot location
+				XPoint spot;
+				spot.x = (short)cx;
+				spot.y = (short)cy;
+				XVaNestedList attr = XVaCreateNestedList(0, XNSpotLocation, &spot, NULL);
+				if (!attr) {
+					MU_SET_RESULT(result, MUCOSA_X11_FAILED_SET_TEXT_CURSOR)
+					return;
+				}
+				if (XSetICValues(win->handles.ic, XNPreeditAttributes, attr, NULL) != NULL) {
+					MU_SET_RESULT(result, MUCOSA_X11_FAILED_SET_TEXT_CURSOR)
+				}
+				XFree(attr);
+			}
+
+		/* OpenGL */
+
+		// (EGL is used unless GLX was requested; MUCOSA_EGL can still be defined
+		// alongside GLX for Wayland)
+		#if defined(MUCOSA_EGL) && !defined(MUCOSA_GLX)
+
+			void* muCOSAX11_gl_context_create(muCOSAX11_Context* context, muCOSAResult* result, muCOSAX11_Window* win, muGraphicsAPI api) {
+				// Initialize EGL for the display
+				muCOSAResult res = muCOSAEGL_display_init(&context->egl, MUCOSAEGL_PLATFORM_X11_KHR, context->display);
+				if (res != MUCOSA_SUCCESS) {
+					MU_SET_RESULT(result, res)
+					return 0;
+				}
+
+				// Create the window's surface; its config has to match the visual
+				// that the window was created with
+				muPixelFormat* format = 0;
+				if (win->props.use_format) {
+					format = &win->props.format;
+				}
+				Display* d = context->display;
+				EGLint visual = (EGLint)XVisualIDFromVisual(DefaultVisual(d, DefaultScreen(d)));
+				res = muCOSAEGL_surface_create(&context->egl, &win->handles.egl, format, visual, (EGLNativeWindowType)win->handles.win);
+				if (res != MUCOSA_SUCCESS) {
+					MU_SET_RESULT(result, res)
+					if (muCOSA_result_is_fatal(res)) {
+						return 0;
+					}
+				}
+
+				// Create OpenGL context
+				return muCOSAEGL_gl_context_create(&context->egl, result, &win->handles.egl, api);
+			}
+
+			void* muCOSAX11_gl_offscreen_create(muCOSAX11_Context* context, muCOSAResult* result, muPixelFormat* format, muGraphicsAPI api) {
+				// Initialize EGL for the display
+				muCOSAResult res = muCOSAEGL_display_init(&context->egl, MUCOSAEGL_PLATFORM_X11_KHR, context->display);
+				if (res != MUCOSA_SUCCESS) {
+					MU_SET_RESULT(result, res)
+					return 0;
+				}
+
+				// Create OpenGL context
+				return muCOSAEGL_gl_offscreen_create(&context->egl, result, format, api);
+			}
+
+			void muCOSAX11_gl_context_destroy(void* gl) {
+				muCOSAEGL_gl_context_destroy((muCOSAEGL_GL*)gl);
+			}
+
+			muCOSAResult muCOSAX11_gl_bind(muCOSAX11_Context* context, void* gl) {
+				return muCOSAEGL_gl_bind(&context->egl, (muCOSAEGL_GL*)gl);
+			}
+
+			muCOSAResult muCOSAX11_gl_swap_buffers(muCOSAX11_Context* context, muCOSAX11_Window* win) {
+				return muCOSAEGL_gl_swap_buffers(&context->egl, &win->handles.egl);
+			}
+
+			void* muCOSAX11_gl_get_proc_address(const char* name) {
+				return muCOSAEGL_gl_get_proc_address(name);
+			}
+
+			muBool muCOSAX11_gl_swap_interval(muCOSAX11_Context* context, muCOSAResult* result, int interval) {
+				return muCOSAEGL_gl_swap_interval(&context->egl, result, interval);
+			}
+
+		#endif
+
+		#ifdef MUCOSA_GLX
+
+			// Ignores X errors; used while creating GLX contexts, as
+			// glXCreateContextAttribsARB reports unsupported versions via X errors,
+			// which would otherwise terminate the program
+			int muCOSAX11_ignore_error(Display* display, XErrorEvent* event) {
+				return 0; if (display) {} if (event) {}
+			}
+
+			// Loads the GLX functions needed if they haven't been already
+			muCOSAResult muCOSAX11_glx_init(muCOSAX11_Context* context) {
+				if (context->glx.init) {
+					return MUCOSA_SUCCESS;
+				}
+
+				// Check for GLX 1.3+ (needed for framebuffer configs)
+				int major = 0, minor = 0;
+				if (!glXQueryVersion(context->display, &major, &minor) || (major == 1 && minor < 3)) {
+					return MUCOSA_X11_FAILED_LOAD_GLX;
+				}
+
+				// Find necessary functions
+				void (*create_context_attribs)(void) = glXGetProcAddressARB((const GLubyte*)"glXCreateContextAttribsARB");
+				if (!create_context_attribs) {
+					return MUCOSA_X11_FAILED_LOAD_GLX;
+				}
+				// Find helpful functions
+				void (*swap_interval_ext)(void) = glXGetProcAddressARB((const GLubyte*)"glXSwapIntervalEXT");
+				void (*swap_interval_mesa)(void) = glXGetProcAddressARB((const GLubyte*)"glXSwapIntervalMESA");
+
+				// Copy over functions
+				mu_memcpy(&context->glx.CreateContextAttribs, &create_context_attribs, sizeof(void*));
+				mu_memcpy(&context->glx.SwapIntervalEXT,      &swap_interval_ext,      sizeof(void*));
+				mu_memcpy(&context->glx.SwapIntervalMESA,     &swap_interval_mesa,     sizeof(void*));
+				context->glx.init = MU_TRUE;
+				return MUCOSA_SUCCESS;
+			}
+
+			// Finds a framebuffer config with the given pixel format (default if 0)
+			// that matches the visual that windows are created with, or that
+			// supports pbuffers if offscreen
+			muBool muCOSAX11_glx_find_config(Display* d, muPixelFormat* format, muBool offscreen, GLXFBConfig* config) {
+				// Set up an attribute list based on the pixel format
+				int attributes[] = {
+					GLX_X_RENDERABLE,  True,
+					GLX_DRAWABLE_TYPE, GLX_WINDOW_BIT,
+					GLX_RENDER_TYPE,   GLX_RGBA_BIT,
+					GLX_DOUBLEBUFFER,  True,
+					GLX_RED_SIZE,      8,
+					GLX_GREEN_SIZE,    8,
+					GLX_BLUE_SIZE,     8,
+					GLX_ALPHA_SIZE,    0,
+					GLX_DEPTH_SIZE,    24,
+					GLX_STENCIL_SIZE,  8,
+					GLX_SAMPLE_BUFFERS, 0,
+					GLX_SAMPLES,       0,
+					None
+				};
+				if (format) {
+					attributes[9]  = (int)format->red_bits;
+					attributes[11] = (int)format->green_bits;
+					attributes[13] = (int)format->blue_bits;
+					attributes[15] = (int)format->alpha_bits;
+					attributes[17] = (int)format->depth_bits;
+					attributes[19] = (int)format->stencil_bits;
+					if (format->samples > 1) {
+						attributes[21] = 1;
+						attributes[23] = (int)format->samples;
+					}
+				}
+				// (Pbuffers are never presented, so they don't need a back buffer)
+				if (offscreen) {
+					attributes[3] = GLX_PBUFFER_BIT;
+					attributes[7] = (int)GLX_DONT_CARE;
+				}
+
+				// Find matching configs (sorted best-first by GLX)
+				int config_count = 0;
+				GLXFBConfig* configs = glXChooseFBConfig(d, DefaultScreen(d), attributes, &config_count);
+				if (!configs) {
+					return MU_FALSE;
+				}
+
+				// Take the best one if offscreen, as there's no visual to match
+				if (offscreen) {
+					muBool found = (config_count > 0);
+					if (found) {
+						*config = configs[0];
+					}
+					XFree(configs);
+					return found;
+				}
+
+				// Take the best one with the visual
+				VisualID visual = XVisualIDFromVisual(DefaultVisual(d, DefaultScreen(d)));
+				muBool found = MU_FALSE;
+				for (int i = 0; i < config_count; ++i) {
+					int config_visual = 0;
+					if (glXGetFBConfigAttrib(d, configs[i], GLX_VISUAL_ID, &config_visual) == Success && (VisualID)config_visual == visual) {
+						*config = configs[i];
+						found = MU_TRUE;
+						break;
+					}
+				}
+				XFree(configs);
+				return found;
+			}
+
+			// Gets the framebuffer config of a pixel format (0 if none was specified),
+			// choosing it if it hasn't been chosen before
+			muCOSAResult muCOSAX11_glx_get_config(muCOSAX11_Context* context, muPixelFormat* format, muBool offscreen, GLXFBConfig* config) {
+				muCOSAX11_GLX* glx = &context->glx;
+
+				// Look for config already chosen for the pixel format
+				for (size_m i = 0; i < glx->config_count; ++i) {
+					muCOSAX11_GLXConfig* c = &glx->configs[i];
+					if (c->use_format != (format != 0)) {
+						continue;
+					}
+					if (c->offscreen != offscreen || (format && !muCOSAGL_pixel_format_equal(&c->format, format))) {
+						continue;
+					}
+					*config = c->config;
+					return c->res;
+				}
+
+				// Choose config for requested pixel format...
+				muCOSAResult res = MUCOSA_SUCCESS;
+				if (!format || !muCOSAX11_glx_find_config(context->display, format, offscreen, config)) {
+					if (format) {
+						res = MUCOSA_X11_FAILED_CHOOSE_GLX_CONFIG;
+					}
+					// ...or the default one if it couldn't be found
+					if (!muCOSAX11_glx_find_config(context->display, 0, offscreen, config)) {
+						return MUCOSA_X11_FAILED_FIND_GLX_CONFIG;
+					}
+				}
+
+				// Remember it
+				if (glx->config_count >= glx->config_len) {
+					size_m len = glx->config_len ? glx->config_len * 2 : 4;
+					muCOSAX11_GLXConfig* configs = (muCOSAX11_GLXConfig*)mu_realloc(glx->configs, len * sizeof(muCOSAX11_GLXConfig));
+					// (Not remembering it isn't fatal)
+					if (!configs) {
+						return res;
+					}
+					glx->configs = configs;
+					glx->config_len = len;
+				}
+				muCOSAX11_GLXConfig* c = &glx->configs[glx->config_count++];
+				mu_memset(c, 0, sizeof(muCOSAX11_GLXConfig));
+				c->offscreen = offscreen;
+				c->use_format = (format != 0);
+				if (format) {
+					c->format = *format;
+				}
+				c->config = *config;
+				c->res = res;
+				return res;
+			}
+
+			struct muCOSAX11_GL {
+				Display* display;
+				// Drawable bound with the context (the window, or the pbuffer)
+				GLXDrawable drawable;
+				GLXContext context;
+				// Pbuffer owned by the context (None if created from a window)
+				GLXPbuffer pbuffer;
+			};
+			typedef struct muCOSAX11_GL muCOSAX11_GL;
+
+			// Creates an OpenGL context for a window, or for a 1x1 pbuffer if the
+			// window is 0
+			void* muCOSAX11_glx_context_create(muCOSAX11_Context* context, muCOSAResult* result, muCOSAX11_Window* win, muPixelFormat* format, muGraphicsAPI api) {
+				// Load GLX functions
+				muCOSAResult res = muCOSAX11_glx_init(context);
+				if (res != MUCOSA_SUCCESS) {
+					MU_SET_RESULT(result, res)
+					return 0;
+				}
+
+				// Get version of graphics API
+				int major, minor, profile;
+				if (!muCOSAGL_get_opengl_version(api, &major, &minor, &profile)) {
+					MU_SET_RESULT(result, MUCOSA_FAILED_UNKNOWN_GRAPHICS_API)
+					return 0;
+				}
+
+				// Get framebuffer config
+				GLXFBConfig config;
+				res = muCOSAX11_glx_get_config(context, format, (win == 0), &config);
+				if (res != MUCOSA_SUCCESS) {
+					MU_SET_RESULT(result, res)
+					if (muCOSA_result_is_fatal(res)) {
+						return 0;
+					}
+				}
+
+				// Allocate memory for context
+				muCOSAX11_GL* gl = (muCOSAX11_GL*)mu_malloc(sizeof(muCOSAX11_GL));
+				if (!gl) {
+					MU_SET_RESULT(result, MUCOSA_FAILED_MALLOC)
+					return 0;
+				}
+				gl->display = context->display;
+				gl->pbuffer = None;
+
+				// Get drawable
+				if (win) {
+					gl->drawable = win->handles.win;
+				}
+				// - Create pbuffer if offscreen
+				else {
+					int pbuffer_attributes[] = { GLX_PBUFFER_WIDTH, 1, GLX_PBUFFER_HEIGHT, 1, None };
+					gl->pbuffer = glXCreatePbuffer(context->display, config, pbuffer_attributes);
+					if (!gl->pbuffer) {
+						MU_SET_RESULT(result, MUCOSA_X11_FAILED_CREATE_GLX_PBUFFER)
+						mu_free(gl);
+						return 0;
+					}
+					gl->drawable = gl->pbuffer;
+				}
+
+				// OpenGL version info
+				int attributes[] = {
+					MUCOSAGLX_CONTEXT_MAJOR_VERSION_ARB, major,
+					MUCOSAGLX_CONTEXT_MINOR_VERSION_ARB, minor,
+					MUCOSAGLX_CONTEXT_PROFILE_MASK_ARB, profile,
+					None
+				};
+				// - (No profile before 3.2)
+				if (!profile) {
+					attributes[4] = None;
+				}
+
+				// Create context, catching errors about unsupported versions
+				XSync(context->display, False);
+				int (*prev_handler)(Display*, XErrorEvent*) = XSetErrorHandler(muCOSAX11_ignore_error);
+				gl->context = context->glx.CreateContextAttribs(context->display, config, 0, True, attributes);
+				XSync(context->display, False);
+				XSetErrorHandler(prev_handler);
+				if (!gl->context) {
+					MU_SET_RESULT(result, MUCOSA_X11_FAILED_CREATE_GLX_CONTEXT)
+					if (gl->pbuffer) {
+						glXDestroyPbuffer(context->display, gl->pbuffer);
+					}
+					mu_free(gl);
+					return 0;
+				}
+				return gl;
+			}
+
+			void* muCOSAX11_gl_context_create(muCOSAX11_Context* context, muCOSAResult* result, muCOSAX11_Window* win, muGraphicsAPI api) {
+				// Use the window's pixel format
+				muPixelFormat* format = 0;
+				if (win->props.use_format) {
+					format = &win->props.format;
+				}
+				return muCOSAX11_glx_context_create(context, result, win, format, api);
+			}
+
+			void* muCOSAX11_gl_offscreen_create(muCOSAX11_Context* context, muCOSAResult* result, muPixelFormat* format, muGraphicsAPI api) {
+				return muCOSAX11_glx_context_create(context, result, 0, format, api);
+			}
+
+			void muCOSAX11_gl_context_destroy(void* gl) {
+				muCOSAX11_GL* glx = (muCOSAX11_GL*)gl;
+				// Unbind if bound, as GLX only destroys bound contexts once unbound
+				if (glXGetCurrentContext() == glx->context) {
+					glXMakeCurrent(glx->display, None, 0);
+				}
+				glXDestroyContext(glx->display, glx->context);
+				// Destroy pbuffer if owned
+				if (glx->pbuffer) {
+					glXDestroyPbuffer(glx->display, glx->pbuffer);
+				}
+				mu_free(glx);
+			}
+
+			muCOSAResult muCOSAX11_gl_bind(muCOSAX11_Context* context, void* gl) {
+				// Unbind
+				if (!gl) {
+					glXMakeCurrent(context->display, None, 0);
+					return MUCOSA_SUCCESS;
+				}
+
+				// Bind
+				muCOSAX11_GL* glx = (muCOSAX11_GL*)gl;
+				if (!glXMakeCurrent(glx->display, glx->drawable, glx->context)) {
+					return MUCOSA_X11_FAILED_MAKE_GLX_CURRENT;
+				}
+				return MUCOSA_SUCCESS;
+			}
+
+			muCOSAResult muCOSAX11_gl_swap_buffers(muCOSAX11_Context* context, muCOSAX11_Window* win) {
+				glXSwapBuffers(context->display, win->handles.win);
+				return MUCOSA_SUCCESS;
+			}
+
+			void* muCOSAX11_gl_get_proc_address(const char* name) {
+				// Convert to void* in a way that avoids warnings
+				void (*proc)(void) = glXGetProcAddressARB((const GLubyte*)name);
+				void* vptr = 0;
+				mu_memcpy(&vptr, &proc, sizeof(void*));
+				return vptr;
+			}
+
+			muBool muCOSAX11_gl_swap_interval(muCOSAX11_Context* context, muCOSAResult* result, int interval) {
+				// Set for the drawable currently bound with the EXT version...
+				if (context->glx.SwapIntervalEXT) {
+					GLXDrawable drawable = glXGetCurrentDrawable();
+					if (drawable) {
+						context->glx.SwapIntervalEXT(context->display, drawable, interval);
+						return MU_TRUE;
+					}
+				}
+				// ...or for the current context with the MESA version
+				if (context->glx.SwapIntervalMESA && interval >= 0) {
+					return context->glx.SwapIntervalMESA((unsigned int)interval) == 0;
+				}
+
+				// (Neither was found)
+				MU_SET_RESULT(result, MUCOSA_X11_FAILED_FIND_GLX_FUNCTION)
+				return MU_FALSE;
+			}
+
+		#endif /* MUCOSA_GLX */
+
+		/* Vulkan */
+
+		#ifdef MU_SUPPORT_VULKAN
+
+			// VkXlibSurfaceCreateInfoKHR
+			struct muCOSAX11_VkSurfaceCreateInfo {
+				VkStructureType sType;
+				const void* pNext;
+				VkFlags flags;
+				Display* dpy;
+				Window window;
+			};
+			typedef struct muCOSAX11_VkSurfaceCreateInfo muCOSAX11_VkSurfaceCreateInfo;
+
+			// Instance extensions needed to create surfaces
+			const char* muCOSAX11_vk_extensions[2] = { "VK_KHR_surface", "VK_KHR_xlib_surface" };
+
+			muCOSAResult muCOSAX11_vk_create_surface(muCOSAX11_Window* win, void* instance, void* allocator, void* surface) {
+				muCOSAX11_VkSurfaceCreateInfo ci = MU_ZERO_STRUCT(muCOSAX11_VkSurfaceCreateInfo);
+				ci.sType = (VkStructureType)MUCOSAVK_STRUCTURE_TYPE_XLIB_SURFACE_CREATE_INFO_KHR;
+				ci.dpy = win->handles.display;
+				ci.window = win->handles.win;
+				return muCOSAVK_create_surface("vkCreateXlibSurfaceKHR", instance, &ci, allocator, surface);
+			}
+
+		#endif /* MU_SUPPORT_VULKAN */
+
+	#endif /* MUCOSA_X11 */
+
+	/* Wayland */
+
+	#ifdef MUCOSA_WAYLAND
+
+		#include <wayland-client.h>
+		#include <xkbcommon/xkbcommon.h>
+		#include <stdlib.h>
+		#include <poll.h>
+		#include <unistd.h>
+		#include <fcntl.h>
+		#include <sys/mman.h>
+
+		// Native windows that EGL surfaces are created from
+		#ifdef MUCOSA_EGL
+			#include <wayland-egl.h>
+		#endif
+
+		/* Protocols */
+
+			// The interfaces for xdg-shell, cursor-shape-v1, relative-pointer-unstable-v1,
+			// and pointer-constraints-unstable-v1 are normally generated by
+			// wayland-scanner; they're written out here so that the user doesn't need to
+			// generate and link them separately. Interfaces that muCOSA never creates
+			// objects of are left empty.
+
+			extern const struct wl_interface muCOSAWL_xdg_wm_base_interface;
+			extern const struct wl_interface muCOSAWL_xdg_positioner_interface;
+			extern const struct wl_interface muCOSAWL_xdg_surface_interface;
+			extern const struct wl_interface muCOSAWL_xdg_toplevel_interface;
+			extern const struct wl_interface muCOSAWL_xdg_popup_interface;
+			extern const struct wl_interface muCOSAWL_cursor_shape_manager_interface;
+			extern const struct wl_interface muCOSAWL_cursor_shape_device_interface;
+			extern const struct wl_interface muCOSAWL_relative_pointer_manager_interface;
+			extern const struct wl_interface muCOSAWL_relative_pointer_interface;
+			extern const struct wl_interface muCOSAWL_pointer_constraints_interface;
+			extern const struct wl_interface muCOSAWL_locked_pointer_interface;
+			extern const struct wl_interface muCOSAWL_confined_pointer_interface;
+
+			// Types of each message's arguments
+			const struct wl_interface* muCOSAWL_null_types[] = { 0, 0, 0, 0, 0, 0 };
+			const struct wl_interface* muCOSAWL_create_positioner_types[] = { &muCOSAWL_xdg_positioner_interface };
+			const struct wl_interface* muCOSAWL_get_xdg_surface_types[] = { &muCOSAWL_xdg_surface_interface, &wl_surface_interface };
+			const struct wl_interface* muCOSAWL_get_toplevel_types[] = { &muCOSAWL_xdg_toplevel_interface };
+			const struct wl_interface* muCOSAWL_get_popup_types[] = { &muCOSAWL_xdg_popup_interface, &muCOSAWL_xdg_surface_interface, &muCOSAWL_xdg_positioner_interface };
+			const struct wl_interface* muCOSAWL_set_parent_types[] = { &muCOSAWL_xdg_toplevel_interface };
+			const struct wl_interface* muCOSAWL_seat_serial_types[] = { &wl_seat_interface, 0, 0, 0 };
+			const struct wl_interface* muCOSAWL_set_fullscreen_types[] = { &wl_output_interface };
+			const struct wl_interface* muCOSAWL_get_pointer_types[] = { &muCOSAWL_cursor_shape_device_interface, &wl_pointer_interface };
+			const struct wl_interface* muCOSAWL_get_relative_pointer_types[] = { &muCOSAWL_relative_pointer_interface, &wl_pointer_interface };
+			const struct wl_interface* muCOSAWL_lock_pointer_types[] = { &muCOSAWL_locked_pointer_interface, &wl_surface_interface, &wl_pointer_interface, &wl_region_interface, 0 };
+			const struct wl_interface* muCOSAWL_confine_pointer_types[] = { &muCOSAWL_confined_pointer_interface, &wl_surface_interface, &wl_pointer_interface, &wl_region_interface, 0 };
+			const struct wl_interface* muCOSAWL_set_region_types[] = { &wl_region_interface };
+
+			// xdg_wm_base
+			const struct wl_message muCOSAWL_xdg_wm_base_requests[] = {
+				{ "destroy", "", muCOSAWL_null_types },
+				{ "create_positioner", "n", muCOSAWL_create_positioner_types },
+				{ "get_xdg_surface", "no", muCOSAWL_get_xdg_surface_types },
+				{ "pong", "u", muCOSAWL_null_types },
+			};
+			const struct wl_message muCOSAWL_xdg_wm_base_events[] = {
+				{ "ping", "u", muCOSAWL_null_types },
+			};
+			const struct wl_interface muCOSAWL_xdg_wm_base_interface = {
+				"xdg_wm_base", 1, 4, muCOSAWL_xdg_wm_base_requests, 1, muCOSAWL_xdg_wm_base_events
+			};
+
+			// xdg_positioner
+			const struct wl_interface muCOSAWL_xdg_positioner_interface = {
+				"xdg_positioner", 1, 0, 0, 0, 0
+			};
+
+			// xdg_surface
+			const struct wl_message muCOSAWL_xdg_surface_requests[] = {
+				{ "destroy", "", muCOSAWL_null_types },
+				{ "get_toplevel", "n", muCOSAWL_get_toplevel_types },
+				{ "get_popup", "n?oo", muCOSAWL_get_popup_types },
+				{ "set_window_geometry", "iiii", muCOSAWL_null_types },
+				{ "ack_configure", "u", muCOSAWL_null_types },
+			};
+			const struct wl_message muCOSAWL_xdg_surface_events[] = {
+				{ "configure", "u", muCOSAWL_null_types },
+			};
+			const struct wl_interface muCOSAWL_xdg_surface_interface = {
+				"xdg_surface", 1, 5, muCOSAWL_xdg_surface_requests, 1, muCOSAWL_xdg_surface_events
+			};
+
+			// xdg_toplevel
+			const struct wl_message muCOSAWL_xdg_toplevel_requests[] = {
+				{ "destroy", "", muCOSAWL_null_types },
+				{ "set_parent", "?o", muCOSAWL_set_parent_types },
+				{ "set_title", "s", muCOSAWL_null_types },
+				{ "set_app_id", "s", muCOSAWL_null_types },
+				{ "show_window_menu", "ouii", muCOSAWL_seat_serial_types },
+				{ "move", "ou", muCOSAWL_seat_serial_types },
+				{ "resize", "ouu", muCOSAWL_seat_serial_types },
+				{ "set_max_size", "ii", muCOSAWL_null_types },
+				{ "set_min_size", "ii", muCOSAWL_null_types },
+				{ "set_maximized", "", muCOSAWL_null_types },
+				{ "unset_maximized", "", muCOSAWL_null_types },
+				{ "set_fullscreen", "?o", muCOSAWL_set_fullscreen_types },
+				{ "unset_fullscreen", "", muCOSAWL_null_types },
+				{ "set_minimized", "", muCOSAWL_null_types },
+			};
+			const struct wl_message muCOSAWL_xdg_toplevel_events[] = {
+				{ "configure", "iia", muCOSAWL_null_types },
+				{ "close", "", muCOSAWL_null_types },
+			};
+			const struct wl_interface muCOSAWL_xdg_toplevel_interface = {
+				"xdg_toplevel", 1, 14, muCOSAWL_xdg_toplevel_requests, 2, muCOSAWL_xdg_toplevel_events
+			};
+
+			// xdg_popup
+			const struct wl_interface muCOSAWL_xdg_popup_interface = {
+				"xdg_popup", 1, 0, 0, 0, 0
+			};
+
+			// wp_cursor_shape_manager_v1 (get_tablet_tool_v2 is left out)
+			const struct wl_message muCOSAWL_cursor_shape_manager_requests[] = {
+				{ "destroy", "", muCOSAWL_null_types },
+				{ "get_pointer", "no", muCOSAWL_get_pointer_types },
+			};
+			const struct wl_interface muCOSAWL_cursor_shape_manager_interface = {
+				"wp_cursor_shape_manager_v1", 1, 2, muCOSAWL_cursor_shape_manager_requests, 0, 0
+			};
+
+			// wp_cursor_shape_device_v1
+			const struct wl_message muCOSAWL_cursor_shape_device_requests[] = {
+				{ "destroy", "", muCOSAWL_null_types },
+				{ "set_shape", "uu", muCOSAWL_null_types },
+			};
+			const struct wl_interface muCOSAWL_cursor_shape_device_interface = {
+				"wp_cursor_shape_device_v1", 1, 2, muCOSAWL_cursor_shape_device_requests, 0, 0
+			};
+
+			// zwp_relative_pointer_manager_v1
+			const struct wl_message muCOSAWL_relative_pointer_manager_requests[] = {
+				{ "destroy", "", muCOSAWL_null_types },
+				{ "get_relative_pointer", "no", muCOSAWL_get_relative_pointer_types },
+			};
+			const struct wl_interface muCOSAWL_relative_pointer_manager_interface = {
+				"zwp_relative_pointer_manager_v1", 1, 2, muCOSAWL_relative_pointer_manager_requests, 0, 0
+			};
+
+			// zwp_relative_pointer_v1
+			const struct wl_message muCOSAWL_relative_pointer_requests[] = {
+				{ "destroy", "", muCOSAWL_null_types },
+			};
+			const struct wl_message muCOSAWL_relative_pointer_events[] = {
+				{ "relative_motion", "uuffff", muCOSAWL_null_types },
+			};
+			const struct wl_interface muCOSAWL_relative_pointer_interface = {
+				"zwp_relative_pointer_v1", 1, 1, muCOSAWL_relative_pointer_requests, 1, muCOSAWL_relative_pointer_events
+			};
+
+			// zwp_pointer_constraints_v1
+			const struct wl_message muCOSAWL_pointer_constraints_requests[] = {
+				{ "destroy", "", muCOSAWL_null_types },
+				{ "lock_pointer", "noo?ou", muCOSAWL_lock_pointer_types },
+				{ "confine_pointer", "noo?ou", muCOSAWL_confine_pointer_types },
+			};
+			const struct wl_interface muCOSAWL_pointer_constraints_interface = {
+				"zwp_pointer_constraints_v1", 1, 3, muCOSAWL_pointer_constraints_requests, 0, 0
+			};
+
+			// zwp_locked_pointer_v1
+			const struct wl_message muCOSAWL_locked_pointer_requests[] = {
+				{ "destroy", "", muCOSAWL_null_types },
+				{ "set_cursor_position_hint", "ff", muCOSAWL_null_types },
+				{ "set_region", "?o", muCOSAWL_set_region_types },
+			};
+			const struct wl_message muCOSAWL_locked_pointer_events[] = {
+				{ "locked", "", muCOSAWL_null_types },
+				{ "unlocked", "", muCOSAWL_null_types },
+			};
+			const struct wl_interface muCOSAWL_locked_pointer_interface = {
+				"zwp_locked_pointer_v1", 1, 3, muCOSAWL_locked_pointer_requests, 2, muCOSAWL_locked_pointer_events
+			};
+
+			// zwp_confined_pointer_v1
+			const struct wl_interface muCOSAWL_confined_pointer_interface = {
+				"zwp_confined_pointer_v1", 1, 0, 0, 0, 0
+			};
+
+			// Listeners
+
+			struct muCOSAWL_xdg_wm_base_listener {
+				void (*ping)(void* data, struct wl_proxy* wm_base, uint32_t serial);
+			};
+
+			struct muCOSAWL_xdg_surface_listener {
+				void (*configure)(void* data, struct wl_proxy* xdg_surface, uint32_t serial);
+			};
+
+			struct muCOSAWL_xdg_toplevel_listener {
+				void (*configure)(void* data, struct wl_proxy* toplevel, int32_t width, int32_t height, struct wl_array* states);
+				void (*close)(void* data, struct wl_proxy* toplevel);
+			};
+
+			struct muCOSAWL_relative_pointer_listener {
+				void (*relative_motion)(void* data, struct wl_proxy* relative_pointer, uint32_t utime_hi, uint32_t utime_lo, wl_fixed_t dx, wl_fixed_t dy, wl_fixed_t dx_unaccel, wl_fixed_t dy_unaccel);
+			};
+
+			// Requests
+
+			void muCOSAWL_xdg_wm_base_destroy(struct wl_proxy* wm_base) {
+				wl_proxy_marshal_flags(wm_base, 0, 0, wl_proxy_get_version(wm_base), WL_MARSHAL_FLAG_DESTROY);
+			}
+
+			struct wl_proxy* muCOSAWL_xdg_wm_base_get_xdg_surface(struct wl_proxy* wm_base, struct wl_surface* surface) {
+				return wl_proxy_marshal_flags(wm_base, 2, &muCOSAWL_xdg_surface_interface, wl_proxy_get_version(wm_base), 0, NULL, surface);
+			}
+
+			void muCOSAWL_xdg_wm_base_pong(struct wl_proxy* wm_base, uint32_t serial) {
+				wl_proxy_marshal_flags(wm_base, 3, 0, wl_proxy_get_version(wm_base), 0, serial);
+			}
+
+			void muCOSAWL_xdg_surface_destroy(struct wl_proxy* xdg_surface) {
+				wl_proxy_marshal_flags(xdg_surface, 0, 0, wl_proxy_get_version(xdg_surface), WL_MARSHAL_FLAG_DESTROY);
+			}
+
+			struct wl_proxy* muCOSAWL_xdg_surface_get_toplevel(struct wl_proxy* xdg_surface) {
+				return wl_proxy_marshal_flags(xdg_surface, 1, &muCOSAWL_xdg_toplevel_interface, wl_proxy_get_version(xdg_surface), 0, NULL);
+			}
+
+			void muCOSAWL_xdg_surface_ack_configure(struct wl_proxy* xdg_surface, uint32_t serial) {
+				wl_proxy_marshal_flags(xdg_surface, 4, 0, wl_proxy_get_version(xdg_surface), 0, serial);
+			}
+
+			void muCOSAWL_xdg_toplevel_destroy(struct wl_proxy* toplevel) {
+				wl_proxy_marshal_flags(toplevel, 0, 0, wl_proxy_get_version(toplevel), WL_MARSHAL_FLAG_DESTROY);
+			}
+
+			void muCOSAWL_xdg_toplevel_set_title(struct wl_proxy* toplevel, const char* title) {
+				wl_proxy_marshal_flags(toplevel, 2, 0, wl_proxy_get_version(toplevel), 0, title);
+			}
+
+			void muCOSAWL_xdg_toplevel_set_app_id(struct wl_proxy* toplevel, const char* app_id) {
+				wl_proxy_marshal_flags(toplevel, 3, 0, wl_proxy_get_version(toplevel), 0, app_id);
+			}
+
+			void muCOSAWL_xdg_toplevel_set_max_size(struct wl_proxy* toplevel, int32_t width, int32_t height) {
+				wl_proxy_marshal_flags(toplevel, 7, 0, wl_proxy_get_version(toplevel), 0, width, height);
+			}
+
+			void muCOSAWL_xdg_toplevel_set_min_size(struct wl_proxy* toplevel, int32_t width, int32_t height) {
+				wl_proxy_marshal_flags(toplevel, 8, 0, wl_proxy_get_version(toplevel), 0, width, height);
+			}
+
+			void muCOSAWL_cursor_shape_manager_destroy(struct wl_proxy* manager) {
+				wl_proxy_marshal_flags(manager, 0, 0, wl_proxy_get_version(manager), WL_MARSHAL_FLAG_DESTROY);
+			}
+
+			struct wl_proxy* muCOSAWL_cursor_shape_manager_get_pointer(struct wl_proxy* manager, struct wl_pointer* pointer) {
+				return wl_proxy_marshal_flags(manager, 1, &muCOSAWL_cursor_shape_device_interface, wl_proxy_get_version(manager), 0, NULL, pointer);
+			}
+
+			void muCOSAWL_cursor_shape_device_destroy(struct wl_proxy* device) {
+				wl_proxy_marshal_flags(device, 0, 0, wl_proxy_get_version(device), WL_MARSHAL_FLAG_DESTROY);
+			}
+
+			void muCOSAWL_cursor_shape_device_set_shape(struct wl_proxy* device, uint32_t serial, uint32_t shape) {
+				wl_proxy_marshal_flags(device, 1, 0, wl_proxy_get_version(device), 0, serial, shape);
+			}
+
+			void muCOSAWL_relative_pointer_manager_destroy(struct wl_proxy* manager) {
+				wl_proxy_marshal_flags(manager, 0, 0, wl_proxy_get_version(manager), WL_MARSHAL_FLAG_DESTROY);
+			}
+
+			struct wl_proxy* muCOSAWL_relative_pointer_manager_get_relative_pointer(struct wl_proxy* manager, struct wl_pointer* pointer) {
+				return wl_proxy_marshal_flags(manager, 1, &muCOSAWL_relative_pointer_interface, wl_proxy_get_version(manager), 0, NULL, pointer);
+			}
+
+			void muCOSAWL_relative_pointer_destroy(struct wl_proxy* relative_pointer) {
+				wl_proxy_marshal_flags(relative_pointer, 0, 0, wl_proxy_get_version(relative_pointer), WL_MARSHAL_FLAG_DESTROY);
+			}
+
+			void muCOSAWL_pointer_constraints_destroy(struct wl_proxy* constraints) {
+				wl_proxy_marshal_flags(constraints, 0, 0, wl_proxy_get_version(constraints), WL_MARSHAL_FLAG_DESTROY);
+			}
+
+			struct wl_proxy* muCOSAWL_pointer_constraints_lock_pointer(struct wl_proxy* constraints, struct wl_surface* surface, struct wl_pointer* pointer, uint32_t lifetime) {
+				return wl_proxy_marshal_flags(constraints, 1, &muCOSAWL_locked_pointer_interface, wl_proxy_get_version(constraints), 0, NULL, surface, pointer, NULL, lifetime);
+			}
+
+			void muCOSAWL_locked_pointer_destroy(struct wl_proxy* locked_pointer) {
+				wl_proxy_marshal_flags(locked_pointer, 0, 0, wl_proxy_get_version(locked_pointer), WL_MARSHAL_FLAG_DESTROY);
+			}
+
+		/* Useful functions */
+
+			// Checks if two null-terminated strings are equal
+			muBool muCOSAWL_str_equal(const char* a, const char* b) {
+				while (*a && *a == *b) {
+					++a;
+					++b;
+				}
+				return *a == *b;
+			}
+
+			// muCOSA cursor style to cursor-shape-v1 shape
+			uint32_m muCOSAWL_muCOSA_cursor_to_shape(muCursorStyle style) {
+				switch (style) {
+					// (default)
+					default: return 1; break;
+					case MU_CURSOR_ARROW: return 1; break;
+					// (text)
+					case MU_CURSOR_IBEAM: return 9; break;
+					// (wait)
+					case MU_CURSOR_WAIT: return 6; break;
+					// (progress)
+					case MU_CURSOR_WAIT_ARROW: return 5; break;
+					// (crosshair)
+					case MU_CURSOR_CROSSHAIR: return 8; break;
+					// (pointer)
+					case MU_CURSOR_HAND: return 4; break;
+					// (ew_resize)
+					case MU_CURSOR_SIZE_LR: return 26; break;
+					// (ns_resize)
+					case MU_CURSOR_SIZE_TB: return 27; break;
+					// (nwse_resize)
+					case MU_CURSOR_SIZE_TL_BR: return 29; break;
+					// (nesw_resize)
+					case MU_CURSOR_SIZE_TR_BL: return 28; break;
+					// (move)
+					case MU_CURSOR_SIZE_ALL: return 13; break;
+					// (not_allowed)
+					case MU_CURSOR_NO: return 15; break;
+				}
+			}
+
+			// Linux input event code to muCOSA mouse key
+			muMouseKey muCOSAWL_button_to_muCOSA(uint32_m button) {
+				switch (button) {
+					default: return MU_MOUSE_UNKNOWN; break;
+					// (BTN_LEFT)
+					case 0x110: return MU_MOUSE_LEFT; break;
+					// (BTN_RIGHT)
+					case 0x111: return MU_MOUSE_RIGHT; break;
+					// (BTN_MIDDLE)
+					case 0x112: return MU_MOUSE_MIDDLE; break;
+				}
+			}
+
+		/* Window structs */
+
+			struct muCOSAWL_Context;
+
+			struct muCOSAWL_Keymaps {
+				// Keyboard keys
+				muBool keyboard[MU_KEYBOARD_LENGTH];
+				// Keystates
+				muBool keystates[MU_KEYSTATE_LENGTH];
+				// Mouse keys
+				muBool mouse[MU_MOUSE_LENGTH];
+			};
+			typedef struct muCOSAWL_Keymaps muCOSAWL_Keymaps;
+
+			// Pixel buffer owned by a window
+			struct muCOSAWL_Pixels {
+				// Buffer shared with the compositor (0 if not created)
+				struct wl_buffer* buffer;
+				// Mapped memory of the buffer
+				uint32_m* data;
+				size_m size;
+				// Dimensions
+				uint32_m width;
+				uint32_m height;
+				// If the compositor is still reading from the buffer
+				muBool busy;
+			};
+			typedef struct muCOSAWL_Pixels muCOSAWL_Pixels;
+
+			struct muCOSAWL_WindowHandles {
+				// Context the window belongs to
+				struct muCOSAWL_Context* context;
+				// Surface
+				struct wl_surface* surface;
+				// xdg_surface + xdg_toplevel roles of the surface
+				struct wl_proxy* xdg_surface;
+				struct wl_proxy* toplevel;
+				// Pending frame callback (0 if none)
+				struct wl_callback* frame;
+				// Pointer lock (0 if the pointer isn't locked)
+				struct wl_proxy* locked_pointer;
+				// Pixel buffers
+				muCOSAWL_Pixels pixels[2];
+				#ifdef MUCOSA_EGL
+				// EGL window + surface (created along with the first OpenGL context)
+				struct wl_egl_window* egl_window;
+				muCOSAEGL_Surface egl;
+				#endif
+			};
+			typedef struct muCOSAWL_WindowHandles muCOSAWL_WindowHandles;
+
+			// States possibly held by the window that are updated via events
+			struct muCOSAWL_WindowStates {
+				// Closed or not
+				muBool closed;
+				// Cursor style
+				muCursorStyle cursor_style;
+				// If the compositor is ready for a new frame
+				muBool frame_ready;
+				// If raw motion is received
+				muBool raw_motion;
+				// If the pointer is locked
+				muBool pointer_lock;
+			};
+			typedef struct muCOSAWL_WindowStates muCOSAWL_WindowStates;
+
+			struct muCOSAWL_WindowProperties {
+				// Pixel format
+				muPixelFormat format;
+				muBool use_format;
+
+				// Min/Max dimensions
+				uint32_m min_width;
+				uint32_m min_height;
+				uint32_m max_width;
+				uint32_m max_height;
+
+				// Dimensions
+				uint32_m width;
+				uint32_m height;
+				// Dimensions requested by the compositor, applied on the next configure
+				uint32_m pending_width;
+				uint32_m pending_height;
+
+				// Scroll level
+				int32_m scroll_level;
+
+				// Cursor position
+				int32_m cursor_x;
+				int32_m cursor_y;
+
+				// Text input
+				void (*text_input_callback)(muWindow window, uint8_m* data);
+				uint32_m text_cursor_x;
+				uint32_m text_cursor_y;
+			};
+			typedef struct muCOSAWL_WindowProperties muCOSAWL_WindowProperties;
+
+			struct muCOSAWL_Window {
+				muCOSAWL_WindowHandles handles;
+				muCOSAWL_Keymaps keymaps;
+				muCOSAWL_WindowStates states;
+				muCOSAWL_WindowProperties props;
+				muWindowCallbacks callbacks;
+				muCOSA_EventQueue events;
+				muCOSA_Coalesce coalesce;
+				#ifdef MUCOSA_THREAD_SAFE
+				muCOSA_Lock lock;
+				#endif
+			};
+			typedef struct muCOSAWL_Window muCOSAWL_Window;
+
+		/* Context */
+
+			struct muCOSAWL_Clipboard {
+				// Data device of the seat
+				struct wl_data_device* device;
+				// Offer of the current selection (0 if none)
+				struct wl_data_offer* selection;
+				// Offer of the current drag-and-drop (0 if none); unused, but kept track of to be destroyed
+				struct wl_data_offer* dnd;
+				// Data source owned by this context (0 if none) + its data
+				struct wl_data_source* source;
+				uint8_m* data;
+				size_m datalen;
+			};
+			typedef struct muCOSAWL_Clipboard muCOSAWL_Clipboard;
+
+			struct muCOSAWL_Context {
+				// Display connection
+				struct wl_display* display;
+				struct wl_registry* registry;
+				// Time
+				muCOSAPOSIX_Time time;
+
+				// Globals
+				struct wl_compositor* compositor;
+				struct wl_proxy* wm_base;
+				struct wl_seat* seat;
+				struct wl_data_device_manager* data_device_manager;
+				struct wl_proxy* cursor_shape_manager;
+				struct wl_proxy* relative_pointer_manager;
+				struct wl_proxy* pointer_constraints;
+				struct wl_shm* shm;
+
+				// Input devices
+				struct wl_keyboard* keyboard;
+				struct wl_pointer* pointer;
+				struct wl_proxy* cursor_shape_device;
+				struct wl_proxy* relative_pointer;
+
+				// XKB
+				struct xkb_context* xkb_context;
+				struct xkb_keymap* xkb_keymap;
+				struct xkb_state* xkb_state;
+				// Keystates; shared by all windows, and copied into each window's
+				// keymap when it's updated
+				muBool keystates[MU_KEYSTATE_LENGTH];
+
+				// Windows with keyboard/pointer focus (0 if none)
+				muCOSAWL_Window* keyboard_focus;
+				muCOSAWL_Window* pointer_focus;
+				// Serial of the last pointer enter; needed to set the cursor
+				uint32_m pointer_serial;
+				// Serial of the last input event; needed to set the clipboard
+				uint32_m input_serial;
+				// Scroll accumulated over a pointer frame, if it was given in 120ths
+				// of a notch (rather than surface distance), and when it occurred
+				int32_m scroll_add;
+				muBool scroll_value120;
+				double scroll_time;
+				// Converter of input event time to system time
+				muCOSA_EventClock event_clock;
+				// Converter of relative motion time to system time (it's given in
+				// microseconds, which can have a different base)
+				muCOSA_EventClock relative_clock;
+
+				// Clipboard
+				muCOSAWL_Clipboard clipboard;
+				// Pipe to interrupt waits
+				muCOSAPOSIX_Wake wake;
+				// Windows + map used to find a muCOSAWL_Window from the surface given
+				// in an input event
+				muCOSA_WindowList windows;
+				muCOSA_WindowMap handles;
+
+				// Queue of pixel buffer events, kept separate so that buffers can be
+				// checked for being released without processing other events (0 if
+				// no pixel buffers have been created yet)
+				struct wl_event_queue* pixels_queue;
+
+				#ifdef MUCOSA_EGL
+				// EGL display (initialized once the first OpenGL context is created)
+				muCOSAEGL_Display egl;
+				#endif
+			};
+			typedef struct muCOSAWL_Context muCOSAWL_Context;
+
+			// Gets the time that an input event occurred on the context's clock
+			double muCOSAWL_event_time(muCOSAWL_Context* context, uint32_m ms) {
+				return muCOSA_event_clock_convert(&context->event_clock, ms, muCOSAPOSIX_get_current_time()) - context->time.orig_time;
+			}
+
+			// Finds a pointer to a muCOSA window based on its surface (0 if the
+			// surface isn't one of a window)
+			muCOSAWL_Window* muCOSAWL_window_find(muCOSAWL_Context* context, struct wl_surface* surface) {
+				return (muCOSAWL_Window*)muCOSA_window_map_find(&context->handles, (uint64_m)(size_m)surface);
+			}
+
+			// The version of wl_seat bound; determines which pointer events are sent
+			#ifdef WL_POINTER_AXIS_VALUE120_SINCE_VERSION
+				#define MUCOSAWL_SEAT_VERSION 8
+			#else
+				#define MUCOSAWL_SEAT_VERSION 5
+			#endif
+
+		/* Keyboard */
+
+			void muCOSAWL_keyboard_keymap(void* data, struct wl_keyboard* keyboard, uint32_t format, int32_t fd, uint32_t size) {
+				muCOSAWL_Context* context = (muCOSAWL_Context*)data;
+
+				// Only XKB keymaps are supported
+				if (format != WL_KEYBOARD_KEYMAP_FORMAT_XKB_V1) {
+					close(fd);
+					return;
+				}
+
+				// Map keymap text
+				char* str = (char*)mmap(0, size, PROT_READ, MAP_PRIVATE, fd, 0);
+				if (str == MAP_FAILED) {
+					close(fd);
+					return;
+				}
+
+				// Compile keymap
+				struct xkb_keymap* keymap = xkb_keymap_new_from_string(context->xkb_context, str, XKB_KEYMAP_FORMAT_TEXT_V1, XKB_KEYMAP_COMPILE_NO_FLAGS);
+				munmap(str, size);
+				close(fd);
+				if (!keymap) {
+					return;
+				}
+
+				// Create state
+				struct xkb_state* state = xkb_state_new(keymap);
+				if (!state) {
+					xkb_keymap_unref(keymap);
+					return;
+				}
+
+				// Replace old keymap + state
+				if (context->xkb_state) {
+					xkb_state_unref(context->xkb_state);
+				}
+				if (context->xkb_keymap) {
+					xkb_keymap_unref(context->xkb_keymap);
+				}
+				context->xkb_keymap = keymap;
+				context->xkb_state = state;
+				return; if (keyboard) {}
+			}
+
+			void muCOSAWL_keyboard_enter(void* data, struct wl_keyboard* keyboard, uint32_t serial, struct wl_surface* surface, struct wl_array* keys) {
+				muCOSAWL_Context* context = (muCOSAWL_Context*)data;
+				context->input_serial = serial;
+				context->keyboard_focus = surface ? muCOSAWL_window_find(context, surface) : 0;
+				return; if (keyboard) {} if (keys) {}
+			}
+
+			void muCOSAWL_keyboard_leave(void* data, struct wl_keyboard* keyboard, uint32_t serial, struct wl_surface* surface) {
+				muCOSAWL_Context* context = (muCOSAWL_Context*)data;
+				muCOSAWL_Window* win = context->keyboard_focus;
+				context->keyboard_focus = 0;
+				if (!win) {
+					return;
+				}
+				// (Not timestamped; timestamp with now)
+				win->events.time = muCOSAPOSIX_time_get(&context->time);
+
+				// Deliver coalesced changes first
+				muCOSA_coalesce_flush(&win->coalesce, win, &win->callbacks, &win->events);
+
+				// Release keys still held down, since the window won't be told when they're released
+				for (muKeyboardKey k = 0; k < MU_KEYBOARD_LENGTH; ++k) {
+					if (win->keymaps.keyboard[k]) {
+						win->keymaps.keyboard[k] = MU_FALSE;
+						muCOSA_event_push_keyboard(&win->events, k, MU_FALSE);
+						if (win->callbacks.keyboard) {
+							win->callbacks.keyboard(win, k, MU_FALSE);
+						}
+					}
+				}
+				return; if (keyboard) {} if (serial) {} if (surface) {}
+			}
+
+			// Gets the keysym identifying the physical key of a key code
+			uint32_m muCOSAWL_key_keysym(muCOSAWL_Context* context, xkb_keycode_t keycode) {
+				// Get unshifted keysym of the current layout
+				xkb_layout_index_t layout = xkb_state_key_get_layout(context->xkb_state, keycode);
+				const xkb_keysym_t* syms;
+				if (xkb_keymap_key_get_syms_by_level(context->xkb_keymap, keycode, layout, 0, &syms) < 1) {
+					return 0;
+				}
+				uint32_m sym = syms[0];
+
+				// Keypad keys give their non-number-lock meaning unshifted
+				// (KP_Insert, KP_End, etc.), so use the shifted keysym if it's a
+				// keypad number/decimal to match the actual physical key
+				if (sym >= XK_KP_Space && sym <= XK_KP_Equal) {
+					if (xkb_keymap_key_get_syms_by_level(context->xkb_keymap, keycode, layout, 1, &syms) > 0) {
+						uint32_m kp = syms[0];
+						if ((kp >= XK_KP_0 && kp <= XK_KP_9) || kp == XK_KP_Decimal || kp == XK_KP_Separator) {
+							sym = kp;
+						}
+					}
+				}
+				return sym;
+			}
+
+			void muCOSAWL_keyboard_key(void* data, struct wl_keyboard* keyboard, uint32_t serial, uint32_t time, uint32_t key, uint32_t state) {
+				muCOSAWL_Context* context = (muCOSAWL_Context*)data;
+				context->input_serial = serial;
+
+				// Window and keymap are needed
+				muCOSAWL_Window* win = context->keyboard_focus;
+				if (!win || !context->xkb_state) {
+					return;
+				}
+				win->events.time = muCOSAWL_event_time(context, time);
+
+				// Convert evdev key code to XKB key code, and then to muCOSA key value
+				xkb_keycode_t keycode = key + 8;
+				muBool status = (state == WL_KEYBOARD_KEY_STATE_PRESSED);
+				muKeyboardKey mu_key = muCOSAXK_keysym_to_muCOSA(muCOSAWL_key_keysym(context, keycode));
+
+				// Set key state + event + callback if known
+				if (mu_key != MU_KEYBOARD_UNKNOWN && mu_key < MU_KEYBOARD_LENGTH) {
+					win->keymaps.keyboard[mu_key] = status;
+					// Deliver coalesced changes first
+					muCOSA_coalesce_flush(&win->coalesce, win, &win->callbacks, &win->events);
+					muCOSA_event_push_keyboard(&win->events, mu_key, status);
+					if (win->callbacks.keyboard) {
+						win->callbacks.keyboard(win, mu_key, status);
+					}
+				}
+
+				// Text input
+				if (status && win->props.text_input_callback) {
+					uint32_m codepoint = xkb_state_key_get_utf32(context->xkb_state, keycode);
+					if (codepoint) {
+						uint8_m c[5];
+						c[muCOSAXK_codepoint_to_utf8(codepoint, c)] = 0;
+						// Deliver coalesced changes first
+						muCOSA_coalesce_flush(&win->coalesce, win, &win->callbacks, &win->events);
+						muCOSA_event_push_text(&win->events, c);
+						win->props.text_input_callback(win, c);
+					}
+				}
+				return; if (keyboard) {}
+			}
+
+			void muCOSAWL_keyboard_modifiers(void* data, struct wl_keyboard* keyboard, uint32_t serial, uint32_t depressed, uint32_t latched, uint32_t locked, uint32_t group) {
+				muCOSAWL_Context* context = (muCOSAWL_Context*)data;
+				if (!context->xkb_state) {
+					return;
+				}
+
+				// Update XKB state
+				xkb_state_update_mask(context->xkb_state, depressed, latched, locked, 0, 0, group);
+
+				// Update keystates based on the keyboard's LEDs
+				context->keystates[MU_KEYSTATE_CAPS_LOCK] = xkb_state_led_name_is_active(context->xkb_state, XKB_LED_NAME_CAPS) > 0;
+				context->keystates[MU_KEYSTATE_SCROLL_LOCK] = xkb_state_led_name_is_active(context->xkb_state, XKB_LED_NAME_SCROLL) > 0;
+				context->keystates[MU_KEYSTATE_NUM_LOCK] = xkb_state_led_name_is_active(context->xkb_state, XKB_LED_NAME_NUM) > 0;
+				return; if (keyboard) {} if (serial) {}
+			}
+
+			void muCOSAWL_keyboard_repeat_info(void* data, struct wl_keyboard* keyboard, int32_t rate, int32_t delay) {
+				return; if (data) {} if (keyboard) {} if (rate) {} if (delay) {}
+			}
+
+			const struct wl_keyboard_listener muCOSAWL_keyboard_listener = {
+				muCOSAWL_keyboard_keymap,
+				muCOSAWL_keyboard_enter,
+				muCOSAWL_keyboard_leave,
+				muCOSAWL_keyboard_key,
+				muCOSAWL_keyboard_modifiers,
+				muCOSAWL_keyboard_repeat_info,
+			};
+
+		/* Pointer */
+
+			// Sets the cursor shape of the pointer to the style of the window it's in
+			void muCOSAWL_update_cursor_shape(muCOSAWL_Context* context) {
+				// Hide the cursor if the window has the pointer locked
+				if (context->pointer_focus && context->pointer_focus->states.pointer_lock) {
+					wl_pointer_set_cursor(context->pointer, context->pointer_serial, NULL, 0, 0);
+				}
+				else if (context->cursor_shape_device && context->pointer_focus) {
+					muCOSAWL_cursor_shape_device_set_shape(context->cursor_shape_device, context->pointer_serial,
+						muCOSAWL_muCOSA_cursor_to_shape(context->pointer_focus->states.cursor_style)
+					);
+				}
+			}
+
+			// Updates the cursor position of a window
+			void muCOSAWL_pointer_move(muCOSAWL_Window* win, wl_fixed_t sx, wl_fixed_t sy) {
+				int32_m x = (int32_m)wl_fixed_to_int(sx);
+				int32_m y = (int32_m)wl_fixed_to_int(sy);
+
+				// Update cursor position if changed
+				if (win->props.cursor_x != x || win->props.cursor_y != y) {
+					win->props.cursor_x = x;
+					win->props.cursor_y = y;
+					// + Event + callback (unless coalesced)
+					if (!muCOSA_coalesce_cursor(&win->coalesce, win->events.time, x, y)) {
+						muCOSA_event_push_cursor(&win->events, x, y);
+						if (win->callbacks.cursor) {
+							win->callbacks.cursor(win, x, y);
+						}
+					}
+				}
+			}
+
+			void muCOSAWL_pointer_enter(void* data, struct wl_pointer* pointer, uint32_t serial, struct wl_surface* surface, wl_fixed_t sx, wl_fixed_t sy) {
+				muCOSAWL_Context* context = (muCOSAWL_Context*)data;
+				context->pointer_serial = serial;
+				context->pointer_focus = surface ? muCOSAWL_window_find(context, surface) : 0;
+				if (!context->pointer_focus) {
+					return;
+				}
+
+				// Each window has its own cursor style, which needs to be set upon entering
+				muCOSAWL_update_cursor_shape(context);
+				// (Not timestamped; timestamp with now)
+				context->pointer_focus->events.time = muCOSAPOSIX_time_get(&context->time);
+				muCOSAWL_pointer_move(context->pointer_focus, sx, sy);
+				return; if (pointer) {}
+			}
+
+			void muCOSAWL_pointer_leave(void* data, struct wl_pointer* pointer, uint32_t serial, struct wl_surface* surface) {
+				muCOSAWL_Context* context = (muCOSAWL_Context*)data;
+				context->pointer_focus = 0;
+				return; if (pointer) {} if (serial) {} if (surface) {}
+			}
+
+			void muCOSAWL_pointer_motion(void* data, struct wl_pointer* pointer, uint32_t time, wl_fixed_t sx, wl_fixed_t sy) {
+				muCOSAWL_Context* context = (muCOSAWL_Context*)data;
+				if (context->pointer_focus) {
+					context->pointer_focus->events.time = muCOSAWL_event_time(context, time);
+					muCOSAWL_pointer_move(context->pointer_focus, sx, sy);
+				}
+				return; if (pointer) {}
+			}
+
+			void muCOSAWL_pointer_button(void* data, struct wl_pointer* pointer, uint32_t serial, uint32_t time, uint32_t button, uint32_t state) {
+				muCOSAWL_Context* context = (muCOSAWL_Context*)data;
+				context->input_serial = serial;
+
+				// Window and known button are needed
+				muCOSAWL_Window* win = context->pointer_focus;
+				muMouseKey key = muCOSAWL_button_to_muCOSA(button);
+				if (!win || key == MU_MOUSE_UNKNOWN) {
+					return;
+				}
+				win->events.time = muCOSAWL_event_time(context, time);
+
+				// Update keymap
+				muBool status = (state == WL_POINTER_BUTTON_STATE_PRESSED);
+				win->keymaps.mouse[key] = status;
+				// Deliver coalesced changes first
+				muCOSA_coalesce_flush(&win->coalesce, win, &win->callbacks, &win->events);
+				// + Event + callback
+				muCOSA_event_push_mouse_key(&win->events, key, status);
+				if (win->callbacks.mouse_key) {
+					win->callbacks.mouse_key(win, key, status);
+				}
+				return; if (pointer) {}
+			}
+
+			// Applies the scroll accumulated by a pointer frame
+			void muCOSAWL_pointer_scroll(muCOSAWL_Context* context) {
+				int32_m add = context->scroll_add;
+				context->scroll_add = 0;
+				context->scroll_value120 = MU_FALSE;
+
+				muCOSAWL_Window* win = context->pointer_focus;
+				if (!win || !add) {
+					return;
+				}
+				win->events.time = context->scroll_time;
+
+				win->props.scroll_level += add;
+				// Deliver coalesced changes first
+				muCOSA_coalesce_flush(&win->coalesce, win, &win->callbacks, &win->events);
+				// + Event + callback
+				muCOSA_event_push_scroll(&win->events, add);
+				if (win->callbacks.scroll) {
+					win->callbacks.scroll(win, add);
+				}
+			}
+
+			void muCOSAWL_pointer_axis(void* data, struct wl_pointer* pointer, uint32_t time, uint32_t axis, wl_fixed_t value) {
+				muCOSAWL_Context* context = (muCOSAWL_Context*)data;
+				if (axis != WL_POINTER_AXIS_VERTICAL_SCROLL) {
+					return;
+				}
+				// (Also sent alongside 120ths of a notch, which aren't timestamped)
+				context->scroll_time = muCOSAWL_event_time(context, time);
+				if (context->scroll_value120) {
+					return;
+				}
+
+				// Compositors usually give 10 units per wheel notch; positive is down,
+				// while muCOSA's positive is up
+				context->scroll_add -= (int32_m)(wl_fixed_to_double(value) * 12.0);
+
+				// No frame event to wait for in old versions of wl_pointer
+				if (wl_proxy_get_version((struct wl_proxy*)pointer) < 5) {
+					muCOSAWL_pointer_scroll(context);
+				}
+			}
+
+			void muCOSAWL_pointer_frame(void* data, struct wl_pointer* pointer) {
+				muCOSAWL_pointer_scroll((muCOSAWL_Context*)data);
+				return; if (pointer) {}
+			}
+
+			void muCOSAWL_pointer_axis_source(void* data, struct wl_pointer* pointer, uint32_t source) {
+				return; if (data) {} if (pointer) {} if (source) {}
+			}
+
+			void muCOSAWL_pointer_axis_stop(void* data, struct wl_pointer* pointer, uint32_t time, uint32_t axis) {
+				return; if (data) {} if (pointer) {} if (time) {} if (axis) {}
+			}
+
+			void muCOSAWL_pointer_axis_discrete(void* data, struct wl_pointer* pointer, uint32_t axis, int32_t discrete) {
+				return; if (data) {} if (pointer) {} if (axis) {} if (discrete) {}
+			}
+
+			#ifdef WL_POINTER_AXIS_VALUE120_SINCE_VERSION
+			void muCOSAWL_pointer_axis_value120(void* data, struct wl_pointer* pointer, uint32_t axis, int32_t value120) {
+				muCOSAWL_Context* context = (muCOSAWL_Context*)data;
+				if (axis != WL_POINTER_AXIS_VERTICAL_SCROLL) {
+					return;
+				}
+
+				// 120ths of a notch match muCOSA's scroll units exactly, so this
+				// replaces whatever was given by the axis event of this frame
+				if (!context->scroll_value120) {
+					context->scroll_add = 0;
+					context->scroll_value120 = MU_TRUE;
+				}
+				context->scroll_add -= (int32_m)value120;
+				return; if (pointer) {}
+			}
+			#endif
+
+			const struct wl_pointer_listener muCOSAWL_pointer_listener = {
+				muCOSAWL_pointer_enter,
+				muCOSAWL_pointer_leave,
+				muCOSAWL_pointer_motion,
+				muCOSAWL_pointer_button,
+				muCOSAWL_pointer_axis,
+				muCOSAWL_pointer_frame,
+				muCOSAWL_pointer_axis_source,
+				muCOSAWL_pointer_axis_stop,
+				muCOSAWL_pointer_axis_discrete,
+				#ifdef WL_POINTER_AXIS_VALUE120_SINCE_VERSION
+				muCOSAWL_pointer_axis_value120,
+				#endif
+			};
+
+			void muCOSAWL_relative_pointer_motion(void* data, struct wl_proxy* relative_pointer, uint32_t utime_hi, uint32_t utime_lo, wl_fixed_t dx, wl_fixed_t dy, wl_fixed_t dx_unaccel, wl_fixed_t dy_unaccel) {
+				muCOSAWL_Context* context = (muCOSAWL_Context*)data;
+				muCOSAWL_Window* win = context->pointer_focus;
+				if (!win || !win->states.raw_motion) {
+					return;
+				}
+
+				// Timestamp (given in microseconds)
+				uint64_m utime = ((uint64_m)utime_hi << 32) | (uint64_m)utime_lo;
+				double now = muCOSA_event_clock_convert(&context->relative_clock, (uint32_m)(utime / 1000), muCOSAPOSIX_get_current_time());
+				win->events.time = now - context->time.orig_time;
+
+				// + Event + callback (unaccelerated)
+				double rx = wl_fixed_to_double(dx_unaccel);
+				double ry = wl_fixed_to_double(dy_unaccel);
+				muCOSA_event_push_raw_motion(&win->events, rx, ry);
+				if (win->callbacks.raw_motion) {
+					win->callbacks.raw_motion(win, rx, ry);
+				}
+				return; if (relative_pointer) {} if (dx) {} if (dy) {}
+			}
+
+			const struct muCOSAWL_relative_pointer_listener muCOSAWL_relative_pointer_listener = {
+				muCOSAWL_relative_pointer_motion,
+			};
+
+			// Creates the relative pointer of the pointer (if possible)
+			void muCOSAWL_relative_pointer_create(muCOSAWL_Context* context) {
+				if (context->pointer && context->relative_pointer_manager && !context->relative_pointer) {
+					context->relative_pointer = muCOSAWL_relative_pointer_manager_get_relative_pointer(context->relative_pointer_manager, context->pointer);
+					wl_proxy_add_listener(context->relative_pointer, (void (**)(void))&muCOSAWL_relative_pointer_listener, context);
+				}
+			}
+
+		/* Seat */
+
+			void muCOSAWL_seat_capabilities(void* data, struct wl_seat* seat, uint32_t caps) {
+				muCOSAWL_Context* context = (muCOSAWL_Context*)data;
+
+				// Keyboard gained
+				if ((caps & WL_SEAT_CAPABILITY_KEYBOARD) && !context->keyboard) {
+					context->keyboard = wl_seat_get_keyboard(seat);
+					wl_keyboard_add_listener(context->keyboard, &muCOSAWL_keyboard_listener, context);
+				}
+				// Keyboard lost
+				else if (!(caps & WL_SEAT_CAPABILITY_KEYBOARD) && context->keyboard) {
+					wl_keyboard_destroy(context->keyboard);
+					context->keyboard = 0;
+					context->keyboard_focus = 0;
+				}
+
+				// Pointer gained
+				if ((caps & WL_SEAT_CAPABILITY_POINTER) && !context->pointer) {
+					context->pointer = wl_seat_get_pointer(seat);
+					wl_pointer_add_listener(context->pointer, &muCOSAWL_pointer_listener, context);
+					// Cursor shapes for the pointer
+					if (context->cursor_shape_manager) {
+						context->cursor_shape_device = muCOSAWL_cursor_shape_manager_get_pointer(context->cursor_shape_manager, context->pointer);
+					}
+					// Raw motion of the pointer
+					muCOSAWL_relative_pointer_create(context);
+				}
+				// Pointer lost
+				else if (!(caps & WL_SEAT_CAPABILITY_POINTER) && context->pointer) {
+					if (context->cursor_shape_device) {
+						muCOSAWL_cursor_shape_device_destroy(context->cursor_shape_device);
+						context->cursor_shape_device = 0;
+					}
+					if (context->relative_pointer) {
+						muCOSAWL_relative_pointer_destroy(context->relative_pointer);
+						context->relative_pointer = 0;
+					}
+					wl_pointer_destroy(context->pointer);
+					context->pointer = 0;
+					context->pointer_focus = 0;
+				}
+			}
+
+			void muCOSAWL_seat_name(void* data, struct wl_seat* seat, const char* name) {
+				return; if (data) {} if (seat) {} if (name) {}
+			}
+
+			const struct wl_seat_listener muCOSAWL_seat_listener = {
+				muCOSAWL_seat_capabilities,
+				muCOSAWL_seat_name,
+			};
+
+		/* Clipboard */
+
+			// MIME types for text; the bit of each one is stored as the user data of
+			// the offers that offer it
+			#define MUCOSAWL_MIME_UTF8 1
+			#define MUCOSAWL_MIME_UTF8_STRING 2
+			#define MUCOSAWL_MIME_TEXT 4
+
+			void muCOSAWL_data_offer_offer(void* data, struct wl_data_offer* offer, const char* mime) {
+				uintptr_t mimes = (uintptr_t)data;
+				if (muCOSAWL_str_equal(mime, "text/plain;charset=utf-8")) {
+					mimes |= MUCOSAWL_MIME_UTF8;
+				} else if (muCOSAWL_str_equal(mime, "UTF8_STRING")) {
+					mimes |= MUCOSAWL_MIME_UTF8_STRING;
+				} else if (muCOSAWL_str_equal(mime, "text/plain")) {
+					mimes |= MUCOSAWL_MIME_TEXT;
+				}
+				wl_data_offer_set_user_data(offer, (void*)mimes);
+			}
+
+			void muCOSAWL_data_offer_source_actions(void* data, struct wl_data_offer* offer, uint32_t actions) {
+				return; if (data) {} if (offer) {} if (actions) {}
+			}
+
+			void muCOSAWL_data_offer_action(void* data, struct wl_data_offer* offer, uint32_t action) {
+				return; if (data) {} if (offer) {} if (action) {}
+			}
+
+			const struct wl_data_offer_listener muCOSAWL_data_offer_listener = {
+				muCOSAWL_data_offer_offer,
+				muCOSAWL_data_offer_source_actions,
+				muCOSAWL_data_offer_action,
+			};
+
+			void muCOSAWL_data_device_data_offer(void* data, struct wl_data_device* device, struct wl_data_offer* offer) {
+				// Keep track of the MIME types it offers (none so far)
+				wl_data_offer_add_listener(offer, &muCOSAWL_data_offer_listener, 0);
+				return; if (data) {} if (device) {}
+			}
+
+			void muCOSAWL_data_device_enter(void* data, struct wl_data_device* device, uint32_t serial, struct wl_surface* surface, wl_fixed_t x, wl_fixed_t y, struct wl_data_offer* offer) {
+				muCOSAWL_Context* context = (muCOSAWL_Context*)data;
+				// Drag-and-drop isn't supported; just hold onto the offer to destroy it later
+				if (context->clipboard.dnd) {
+					wl_data_offer_destroy(context->clipboard.dnd);
+				}
+				context->clipboard.dnd = offer;
+				return; if (device) {} if (serial) {} if (surface) {} if (x) {} if (y) {}
+			}
+
+			void muCOSAWL_data_device_leave(void* data, struct wl_data_device* device) {
+				muCOSAWL_Context* context = (muCOSAWL_Context*)data;
+				if (context->clipboard.dnd) {
+					wl_data_offer_destroy(context->clipboard.dnd);
+					context->clipboard.dnd = 0;
+				}
+				return; if (device) {}
+			}
+
+			void muCOSAWL_data_device_motion(void* data, struct wl_data_device* device, uint32_t time, wl_fixed_t x, wl_fixed_t y) {
+				return; if (data) {} if (device) {} if (time) {} if (x) {} if (y) {}
+			}
+
+			void muCOSAWL_data_device_drop(void* data, struct wl_data_device* device) {
+				muCOSAWL_data_device_leave(data, device);
+			}
+
+			void muCOSAWL_data_device_selection(void* data, struct wl_data_device* device, struct wl_data_offer* offer) {
+				muCOSAWL_Context* context = (muCOSAWL_Context*)data;
+				// Replace old selection
+				if (context->clipboard.selection) {
+					wl_data_offer_destroy(context->clipboard.selection);
+				}
+				context->clipboard.selection = offer;
+				return; if (device) {}
+			}
+
+			const struct wl_data_device_listener muCOSAWL_data_device_listener = {
+				muCOSAWL_data_device_data_offer,
+				muCOSAWL_data_device_enter,
+				muCOSAWL_data_device_leave,
+				muCOSAWL_data_device_motion,
+				muCOSAWL_data_device_drop,
+				muCOSAWL_data_device_selection,
+			};
+
+			// Lets go of the data source owned by the context
+			void muCOSAWL_clipboard_release(muCOSAWL_Context* context) {
+				if (context->clipboard.source) {
+					wl_data_source_destroy(context->clipboard.source);
+					context->clipboard.source = 0;
+				}
+				if (context->clipboard.data) {
+					mu_free(context->clipboard.data);
+					context->clipboard.data = 0;
+					context->clipboard.datalen = 0;
+				}
+			}
+
+			void muCOSAWL_data_source_target(void* data, struct wl_data_source* source, const char* mime) {
+				return; if (data) {} if (source) {} if (mime) {}
+			}
+
+			void muCOSAWL_data_source_send(void* data, struct wl_data_source* source, const char* mime, int32_t fd) {
+				muCOSAWL_Context* context = (muCOSAWL_Context*)data;
+
+				// (Don't send the null-terminating character)
+				size_m len = context->clipboard.datalen;
+				if (len && context->clipboard.data[len-1] == 0) {
+					--len;
+				}
+
+				// Write all of the data
+				size_m written = 0;
+				while (written < len) {
+					ssize_t w = write(fd, context->clipboard.data + written, len - written);
+					if (w < 0) {
+						if (errno == EINTR) {
+							continue;
+						}
+						break;
+					}
+					written += (size_m)w;
+				}
+				close(fd);
+				return; if (source) {} if (mime) {}
+			}
+
+			void muCOSAWL_data_source_cancelled(void* data, struct wl_data_source* source) {
+				muCOSAWL_Context* context = (muCOSAWL_Context*)data;
+				// Another client took the clipboard
+				if (source == context->clipboard.source) {
+					muCOSAWL_clipboard_release(context);
+				} else {
+					wl_data_source_destroy(source);
+				}
+			}
+
+			void muCOSAWL_data_source_dnd_drop_performed(void* data, struct wl_data_source* source) {
+				return; if (data) {} if (source) {}
+			}
+
+			void muCOSAWL_data_source_dnd_finished(void* data, struct wl_data_source* source) {
+				return; if (data) {} if (source) {}
+			}
+
+			void muCOSAWL_data_source_action(void* data, struct wl_data_source* source, uint32_t action) {
+				return; if (data) {} if (source) {} if (action) {}
+			}
+
+			const struct wl_data_source_listener muCOSAWL_data_source_listener = {
+				muCOSAWL_data_source_target,
+				muCOSAWL_data_source_send,
+				muCOSAWL_data_source_cancelled,
+				muCOSAWL_data_source_dnd_drop_performed,
+				muCOSAWL_data_source_dnd_finished,
+				muCOSAWL_data_source_action,
+			};
+
+			uint8_m* muCOSAWL_clipboard_get(muCOSAWL_Context* context, muCOSAResult* result) {
+				// We own the clipboard; just copy our own data
+				if (context->clipboard.source) {
+					uint8_m* data = (uint8_m*)mu_malloc(context->clipboard.datalen + 1);
+					if (!data) {
+						MU_SET_RESULT(result, MUCOSA_FAILED_MALLOC)
+						return 0;
+					}
+					mu_memcpy(data, context->clipboard.data, context->clipboard.datalen);
+					data[context->clipboard.datalen] = 0;
+					return data;
+				}
+
+				// No selection means no clipboard
+				struct wl_data_offer* offer = context->clipboard.selection;
+				if (!offer) {
+					return 0;
+				}
+
+				// Pick text MIME type, preferring UTF-8
+				uintptr_t mimes = (uintptr_t)wl_data_offer_get_user_data(offer);
+				const char* mime;
+				if (mimes & MUCOSAWL_MIME_UTF8) {
+					mime = "text/plain;charset=utf-8";
+				} else if (mimes & MUCOSAWL_MIME_UTF8_STRING) {
+					mime = "UTF8_STRING";
+				} else if (mimes & MUCOSAWL_MIME_TEXT) {
+					mime = "text/plain";
+				} else {
+					// (No text)
+					return 0;
+				}
+
+				// Ask owner to write the data into a pipe
+				int fds[2];
+				if (pipe(fds) != 0) {
+					MU_SET_RESULT(result, MUCOSA_WAYLAND_FAILED_GET_CLIPBOARD_DATA)
+					return 0;
+				}
+				wl_data_offer_receive(offer, mime, fds[1]);
+				close(fds[1]);
+				wl_display_flush(context->display);
+
+				// Read until the owner closes the pipe (giving up after a second)
+				double end = muCOSAPOSIX_get_current_time() + 1.0;
+				uint8_m* data = 0;
+				size_m datalen = 0, datasize = 0;
+				for (;;) {
+					// Expand memory if needed
+					if (datalen + 1 >= datasize) {
+						size_m new_size = datasize ? datasize * 2 : 256;
+						uint8_m* new_data = (uint8_m*)mu_realloc(data, new_size);
+						if (!new_data) {
+							MU_SET_RESULT(result, data ? MUCOSA_FAILED_REALLOC : MUCOSA_FAILED_MALLOC)
+							break;
+						}
+						data = new_data;
+						datasize = new_size;
+					}
+
+					// Wait for data
+					double left = end - muCOSAPOSIX_get_current_time();
+					struct pollfd pfd;
+					pfd.fd = fds[0];
+					pfd.events = POLLIN;
+					pfd.revents = 0;
+					if (left <= 0.0 || poll(&pfd, 1, (int)(left * 1000.0) + 1) <= 0) {
+						MU_SET_RESULT(result, MUCOSA_WAYLAND_FAILED_GET_CLIPBOARD_DATA)
+						break;
+					}
+
+					// Read data
+					ssize_t r = read(fds[0], data + datalen, datasize - datalen - 1);
+					if (r < 0 && errno == EINTR) {
+						continue;
+					}
+					if (r < 0) {
+						MU_SET_RESULT(result, MUCOSA_WAYLAND_FAILED_GET_CLIPBOARD_DATA)
+						break;
+					}
+
+					// Finished
+					if (r == 0) {
+						close(fds[0]);
+						data[datalen] = 0;
+						return data;
+					}
+					datalen += (size_m)r;
+				}
+
+				// Failure
+				close(fds[0]);
+				if (data) {
+					mu_free(data);
+				}
+				return 0;
+			}
+
+			void muCOSAWL_clipboard_set(muCOSAWL_Context* context, muCOSAResult* result, uint8_m* data, size_m datalen) {
+				// Setting the selection requires a data device and a recent input event
+				if (!context->clipboard.device || !context->input_serial) {
+					MU_SET_RESULT(result, MUCOSA_WAYLAND_FAILED_SET_CLIPBOARD_DATA)
+					return;
+				}
+
+				// Copy data, since it needs to be given out whenever another client asks for it
+				uint8_m* copy = (uint8_m*)mu_malloc(datalen);
+				if (!copy) {
+					MU_SET_RESULT(result, MUCOSA_FAILED_MALLOC)
+					return;
+				}
+				mu_memcpy(copy, data, datalen);
+
+				// Create data source offering text
+				struct wl_data_source* source = wl_data_device_manager_create_data_source(context->data_device_manager);
+				if (!source) {
+					mu_free(copy);
+					MU_SET_RESULT(result, MUCOSA_WAYLAND_FAILED_SET_CLIPBOARD_DATA)
+					return;
+				}
+				wl_data_source_add_listener(source, &muCOSAWL_data_source_listener, context);
+				wl_data_source_offer(source, "text/plain;charset=utf-8");
+				wl_data_source_offer(source, "UTF8_STRING");
+				wl_data_source_offer(source, "text/plain");
+
+				// Replace old source
+				muCOSAWL_clipboard_release(context);
+				context->clipboard.source = source;
+				context->clipboard.data = copy;
+				context->clipboard.datalen = datalen;
+
+				// Set selection
+				wl_data_device_set_selection(context->clipboard.device, source, context->input_serial);
+				wl_display_flush(context->display);
+			}
+
+		/* Registry */
+
+			void muCOSAWL_xdg_wm_base_ping(void* data, struct wl_proxy* wm_base, uint32_t serial) {
+				// Let the compositor know we're still responsive
+				muCOSAWL_xdg_wm_base_pong(wm_base, serial);
+				return; if (data) {}
+			}
+
+			const struct muCOSAWL_xdg_wm_base_listener muCOSAWL_wm_base_listener = {
+				muCOSAWL_xdg_wm_base_ping,
+			};
+
+			void muCOSAWL_registry_global(void* data, struct wl_registry* registry, uint32_t name, const char* interface, uint32_t version) {
+				muCOSAWL_Context* context = (muCOSAWL_Context*)data;
+
+				// Compositor
+				if (muCOSAWL_str_equal(interface, "wl_compositor")) {
+					context->compositor = (struct wl_compositor*)wl_registry_bind(registry, name, &wl_compositor_interface, version < 4 ? version : 4);
+				}
+				// Shell
+				else if (muCOSAWL_str_equal(interface, "xdg_wm_base")) {
+					context->wm_base = (struct wl_proxy*)wl_registry_bind(registry, name, &muCOSAWL_xdg_wm_base_interface, 1);
+					wl_proxy_add_listener(context->wm_base, (void (**)(void))&muCOSAWL_wm_base_listener, context);
+				}
+				// Seat (only the first one is used)
+				else if (muCOSAWL_str_equal(interface, "wl_seat") && !context->seat) {
+					context->seat = (struct wl_seat*)wl_registry_bind(registry, name, &wl_seat_interface, version < MUCOSAWL_SEAT_VERSION ? version : MUCOSAWL_SEAT_VERSION);
+					wl_seat_add_listener(context->seat, &muCOSAWL_seat_listener, context);
+				}
+				// Clipboard
+				else if (muCOSAWL_str_equal(interface, "wl_data_device_manager")) {
+					context->data_device_manager = (struct wl_data_device_manager*)wl_registry_bind(registry, name, &wl_data_device_manager_interface, version < 3 ? version : 3);
+				}
+				// Cursor shapes
+				else if (muCOSAWL_str_equal(interface, "wp_cursor_shape_manager_v1")) {
+					context->cursor_shape_manager = (struct wl_proxy*)wl_registry_bind(registry, name, &muCOSAWL_cursor_shape_manager_interface, 1);
+				}
+				// Raw motion
+				else if (muCOSAWL_str_equal(interface, "zwp_relative_pointer_manager_v1")) {
+					context->relative_pointer_manager = (struct wl_proxy*)wl_registry_bind(registry, name, &muCOSAWL_relative_pointer_manager_interface, 1);
+				}
+				// Pointer lock
+				else if (muCOSAWL_str_equal(interface, "zwp_pointer_constraints_v1")) {
+					context->pointer_constraints = (struct wl_proxy*)wl_registry_bind(registry, name, &muCOSAWL_pointer_constraints_interface, 1);
+				}
+				// Shared memory (for pixel buffers)
+				else if (muCOSAWL_str_equal(interface, "wl_shm")) {
+					context->shm = (struct wl_shm*)wl_registry_bind(registry, name, &wl_shm_interface, 1);
+				}
+			}
+
+			void muCOSAWL_registry_global_remove(void* data, struct wl_registry* registry, uint32_t name) {
+				return; if (data) {} if (registry) {} if (name) {}
+			}
+
+			const struct wl_registry_listener muCOSAWL_registry_listener = {
+				muCOSAWL_registry_global,
+				muCOSAWL_registry_global_remove,
+			};
+
+		/* Context */
+
+			void muCOSAWL_context_term(muCOSAWL_Context* context);
+
+			muCOSAResult muCOSAWL_context_init(muCOSAWL_Context* context) {
+				// Zero-out
+				mu_memset(context, 0, sizeof(muCOSAWL_Context));
+				// Initiate window map
+				muCOSA_window_map_init(&context->handles);
+
+				// Connect to compositor
+				context->display = wl_display_connect(NULL);
+				if (!context->display) {
+					return MUCOSA_WAYLAND_FAILED_CONNECT_DISPLAY;
+				}
+
+				// Initiate context time
+				muCOSAPOSIX_time_init(&context->time);
+
+				// XKB context
+				context->xkb_context = xkb_context_new(XKB_CONTEXT_NO_FLAGS);
+				if (!context->xkb_context) {
+					wl_display_disconnect(context->display);
+					return MUCOSA_WAYLAND_FAILED_CREATE_XKB_CONTEXT;
+				}
+
+				// Create wake pipe
+				muCOSAPOSIX_wake_init(&context->wake);
+
+				// Get globals
+				context->registry = wl_display_get_registry(context->display);
+				wl_registry_add_listener(context->registry, &muCOSAWL_registry_listener, context);
+				wl_display_roundtrip(context->display);
+
+				// A compositor and shell are needed to create windows
+				if (!context->compositor || !context->wm_base) {
+					muCOSAWL_context_term(context);
+					return MUCOSA_WAYLAND_FAILED_FIND_GLOBALS;
+				}
+
+				// Cursor shapes + raw motion for a pointer created before the managers
+				// were bound
+				if (context->pointer && context->cursor_shape_manager && !context->cursor_shape_device) {
+					context->cursor_shape_device = muCOSAWL_cursor_shape_manager_get_pointer(context->cursor_shape_manager, context->pointer);
+				}
+				muCOSAWL_relative_pointer_create(context);
+
+				// Clipboard
+				if (context->data_device_manager && context->seat) {
+					context->clipboard.device = wl_data_device_manager_get_data_device(context->data_device_manager, context->seat);
+					wl_data_device_add_listener(context->clipboard.device, &muCOSAWL_data_device_listener, context);
+				}
+
+				// Get initial state of the seat (keymap, selection, etc.)
+				wl_display_roundtrip(context->display);
+				return MUCOSA_SUCCESS;
+			}
+
+			void muCOSAWL_context_term(muCOSAWL_Context* context) {
+				// Clipboard
+				muCOSAWL_clipboard_release(context);
+				if (context->clipboard.selection) {
+					wl_data_offer_destroy(context->clipboard.selection);
+				}
+				if (context->clipboard.dnd) {
+					wl_data_offer_destroy(context->clipboard.dnd);
+				}
+				if (context->clipboard.device) {
+					wl_data_device_destroy(context->clipboard.device);
+				}
+
+				// Input devices
+				if (context->cursor_shape_device) {
+					muCOSAWL_cursor_shape_device_destroy(context->cursor_shape_device);
+				}
+				if (context->relative_pointer) {
+					muCOSAWL_relative_pointer_destroy(context->relative_pointer);
+				}
+				if (context->pointer) {
+					wl_pointer_destroy(context->pointer);
+				}
+				if (context->keyboard) {
+					wl_keyboard_destroy(context->keyboard);
+				}
+
+				// XKB
+				if (context->xkb_state) {
+					xkb_state_unref(context->xkb_state);
+				}
+				if (context->xkb_keymap) {
+					xkb_keymap_unref(context->xkb_keymap);
+				}
+				xkb_context_unref(context->xkb_context);
+
+				// Pixel buffer queue
+				if (context->pixels_queue) {
+					wl_event_queue_destroy(context->pixels_queue);
+				}
+
+				// Globals
+				if (context->shm) {
+					wl_shm_destroy(context->shm);
+				}
+				if (context->cursor_shape_manager) {
+					muCOSAWL_cursor_shape_manager_destroy(context->cursor_shape_manager);
+				}
+				if (context->relative_pointer_manager) {
+					muCOSAWL_relative_pointer_manager_destroy(context->relative_pointer_manager);
+				}
+				if (context->pointer_constraints) {
+					muCOSAWL_pointer_constraints_destroy(context->pointer_constraints);
+				}
+				if (context->data_device_manager) {
+					wl_data_device_manager_destroy(context->data_device_manager);
+				}
+				if (context->seat) {
+					wl_seat_destroy(context->seat);
+				}
+				if (context->wm_base) {
+					muCOSAWL_xdg_wm_base_destroy(context->wm_base);
+				}
+				if (context->compositor) {
+					wl_compositor_destroy(context->compositor);
+				}
+				wl_registry_destroy(context->registry);
+
+				#ifdef MUCOSA_EGL
+				// EGL
+				muCOSAEGL_display_term(&context->egl);
+				#endif
+
+				// Wake pipe
+				muCOSAPOSIX_wake_term(&context->wake);
+				// Window list + map
+				muCOSA_window_list_term(&context->windows);
+				muCOSA_window_map_term(&context->handles);
+
+				// Disconnect
+				wl_display_disconnect(context->display);
+			}
+
+			// Processes all events sent by the compositor without blocking
+			void muCOSAWL_dispatch(muCOSAWL_Context* context) {
+				struct wl_display* d = context->display;
+
+				// Process events that have already been read
+				while (wl_display_prepare_read(d) != 0) {
+					wl_display_dispatch_pending(d);
+				}
+
+				// Send requests
+				wl_display_flush(d);
+
+				// Read new events only if there are any
+				struct pollfd pfd;
+				pfd.fd = wl_display_get_fd(d);
+				pfd.events = POLLIN;
+				pfd.revents = 0;
+				if (poll(&pfd, 1, 0) > 0) {
+					wl_display_read_events(d);
+				} else {
+					wl_display_cancel_read(d);
+				}
+
+				// Process them
+				wl_display_dispatch_pending(d);
+				if (context->pixels_queue) {
+					wl_display_dispatch_queue_pending(d, context->pixels_queue);
+				}
+			}
+
+		/* Window events */
+
+			// Resizes the EGL window to the window's dimensions, if it exists; the
+			// new size is used once the next frame is swapped
+			void muCOSAWL_resize_egl_window(muCOSAWL_Window* win) {
+				#ifdef MUCOSA_EGL
+				if (win->handles.egl_window) {
+					wl_egl_window_resize(win->handles.egl_window, (int)win->props.width, (int)win->props.height, 0, 0);
+				}
+				#else
+				return; if (win) {}
+				#endif
+			}
+
+			void muCOSAWL_xdg_surface_configure(void* data, struct wl_proxy* xdg_surface, uint32_t serial) {
+				muCOSAWL_Window* win = (muCOSAWL_Window*)data;
+
+				// Accept configuration
+				muCOSAWL_xdg_surface_ack_configure(xdg_surface, serial);
+
+				// Apply dimensions given by the compositor
+				if (win->props.pending_width && win->props.pending_height &&
+					(win->props.pending_width != win->props.width || win->props.pending_height != win->props.height)
+				) {
+					win->props.width = win->props.pending_width;
+					win->props.height = win->props.pending_height;
+					muCOSAWL_resize_egl_window(win);
+					// (Not timestamped; timestamp with now)
+					win->events.time = muCOSAPOSIX_time_get(&win->handles.context->time);
+					// + Event + callback (unless coalesced)
+					if (!muCOSA_coalesce_dimensions(&win->coalesce, win->events.time, win->props.width, win->props.height)) {
+						muCOSA_event_push_dimensions(&win->events, win->props.width, win->props.height);
+						if (win->callbacks.dimensions) {
+							win->callbacks.dimensions(win, win->props.width, win->props.height);
+						}
+					}
+				}
+			}
+
+			const struct muCOSAWL_xdg_surface_listener muCOSAWL_window_xdg_surface_listener = {
+				muCOSAWL_xdg_surface_configure,
+			};
+
+			void muCOSAWL_toplevel_configure(void* data, struct wl_proxy* toplevel, int32_t width, int32_t height, struct wl_array* states) {
+				muCOSAWL_Window* win = (muCOSAWL_Window*)data;
+
+				// 0 means that we get to decide the dimensions
+				win->props.pending_width = (uint32_m)(width > 0 ? width : 0);
+				win->props.pending_height = (uint32_m)(height > 0 ? height : 0);
+				return; if (toplevel) {} if (states) {}
+			}
+
+			void muCOSAWL_toplevel_close(void* data, struct wl_proxy* toplevel) {
+				muCOSAWL_Window* win = (muCOSAWL_Window*)data;
+				win->states.closed = MU_TRUE;
+				// (Not timestamped; timestamp with now)
+				win->events.time = muCOSAPOSIX_time_get(&win->handles.context->time);
+				// Deliver coalesced changes first
+				muCOSA_coalesce_flush(&win->coalesce, win, &win->callbacks, &win->events);
+				muCOSA_event_push_close(&win->events);
+				return; if (toplevel) {}
+			}
+
+			const struct muCOSAWL_xdg_toplevel_listener muCOSAWL_window_toplevel_listener = {
+				muCOSAWL_toplevel_configure,
+				muCOSAWL_toplevel_close,
+			};
+
+			void muCOSAWL_frame_done(void* data, struct wl_callback* callback, uint32_t time) {
+				muCOSAWL_Window* win = (muCOSAWL_Window*)data;
+
+				// The compositor is ready for a new frame
+				wl_callback_destroy(callback);
+				win->handles.frame = 0;
+				win->states.frame_ready = MU_TRUE;
+				return; if (time) {}
+			}
+
+			const struct wl_callback_listener muCOSAWL_frame_listener = {
+				muCOSAWL_frame_done,
+			};
+
+		/* Pixels */
+
+			// Amount of shared memory files created; used to generate unique names
+			uint32_m muCOSAWL_shm_count = 0;
+
+			// Creates an anonymous shared memory file of the given size (-1 if failed)
+			int muCOSAWL_create_shm_file(size_m size) {
+				// Try names until one isn't taken
+				char name[] = "/muCOSA-00000000";
+				for (uint32_m attempt = 0; attempt < 100; ++attempt) {
+					// Generate name from the process ID and the amount of files created
+					uint32_m id = ((uint32_m)getpid() * 2654435761u) ^ (muCOSAWL_shm_count++);
+					for (uint32_m i = 0; i < 8; ++i) {
+						name[8+i] = "0123456789abcdef"[(id >> (i*4)) & 0xF];
+					}
+
+					// Create file, and unlink its name so that it's freed once closed and unmapped
+					int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+					if (fd < 0) {
+						continue;
+					}
+					shm_unlink(name);
+
+					// Set size
+					if (ftruncate(fd, (off_t)size) < 0) {
+						close(fd);
+						return -1;
+					}
+					return fd;
+				}
+				return -1;
+			}
+
+			void muCOSAWL_buffer_release(void* data, struct wl_buffer* buffer) {
+				// The compositor is done reading the buffer
+				((muCOSAWL_Pixels*)data)->busy = MU_FALSE;
+				return; if (buffer) {}
+			}
+
+			const struct wl_buffer_listener muCOSAWL_buffer_listener = {
+				muCOSAWL_buffer_release,
+			};
+
+			// Processes release events for pixel buffers without processing other events
+			void muCOSAWL_pixels_check(muCOSAWL_Context* context) {
+				struct wl_display* d = context->display;
+				if (!context->pixels_queue) {
+					return;
+				}
+
+				// Process events that have already been read
+				while (wl_display_prepare_read_queue(d, context->pixels_queue) != 0) {
+					wl_display_dispatch_queue_pending(d, context->pixels_queue);
+				}
+
+				// Send requests
+				wl_display_flush(d);
+
+				// Read new events only if there are any (other queues keep theirs)
+				struct pollfd pfd;
+				pfd.fd = wl_display_get_fd(d);
+				pfd.events = POLLIN;
+				pfd.revents = 0;
+				if (poll(&pfd, 1, 0) > 0) {
+					wl_display_read_events(d);
+				} else {
+					wl_display_cancel_read(d);
+				}
+
+				// Process them
+				wl_display_dispatch_queue_pending(d, context->pixels_queue);
+			}
+
+			void muCOSAWL_pixels_destroy(muCOSAWL_Pixels* pixels) {
+				if (!pixels->buffer) {
+					return;
+				}
+				wl_buffer_destroy(pixels->buffer);
+				munmap(pixels->data, pixels->size);
+				mu_memset(pixels, 0, sizeof(muCOSAWL_Pixels));
+			}
+
+			muCOSAResult muCOSAWL_pixels_create(muCOSAWL_Context* context, muCOSAWL_Pixels* pixels, uint32_m width, uint32_m height) {
+				// Shared memory is needed
+				if (!context->shm) {
+					return MUCOSA_WAYLAND_FAILED_CREATE_BUFFER;
+				}
+
+				// Create queue for release events if not already
+				if (!context->pixels_queue) {
+					context->pixels_queue = wl_display_create_queue(context->display);
+					if (!context->pixels_queue) {
+						return MUCOSA_WAYLAND_FAILED_CREATE_BUFFER;
+					}
+				}
+
+				// Create shared memory file
+				size_m size = (size_m)width * (size_m)height * 4;
+				int fd = muCOSAWL_create_shm_file(size);
+				if (fd < 0) {
+					return MUCOSA_WAYLAND_FAILED_CREATE_BUFFER;
+				}
+
+				// Map it into our memory
+				void* data = mmap(0, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+				if (data == MAP_FAILED) {
+					close(fd);
+					return MUCOSA_WAYLAND_FAILED_CREATE_BUFFER;
+				}
+
+				// Share it with the compositor as a buffer
+				// (The pool and file are no longer needed once the buffer exists)
+				struct wl_shm_pool* pool = wl_shm_create_pool(context->shm, fd, (int32_t)size);
+				pixels->buffer = wl_shm_pool_create_buffer(pool, 0, (int32_t)width, (int32_t)height, (int32_t)(width * 4), WL_SHM_FORMAT_XRGB8888);
+				wl_shm_pool_destroy(pool);
+				close(fd);
+				if (!pixels->buffer) {
+					munmap(data, size);
+					return MUCOSA_WAYLAND_FAILED_CREATE_BUFFER;
+				}
+				wl_proxy_set_queue((struct wl_proxy*)pixels->buffer, context->pixels_queue);
+				wl_buffer_add_listener(pixels->buffer, &muCOSAWL_buffer_listener, pixels);
+
+				pixels->data = (uint32_m*)data;
+				pixels->size = size;
+				pixels->width = width;
+				pixels->height = height;
+				pixels->busy = MU_FALSE;
+				return MUCOSA_SUCCESS;
+			}
+
+			// Finds the pixel buffer of a window holding the given pixels (0 if none)
+			muCOSAWL_Pixels* muCOSAWL_pixels_find(muCOSAWL_Window* win, uint32_m* pixels) {
+				for (size_m i = 0; i < 2; ++i) {
+					if (win->handles.pixels[i].buffer && win->handles.pixels[i].data == pixels) {
+						return &win->handles.pixels[i];
+					}
+				}
+				return 0;
+			}
+
+			// Gets a free pixel buffer with the given dimensions, (re)creating it if needed
+			muCOSAResult muCOSAWL_pixels_get(muCOSAWL_Context* context, muCOSAWL_Window* win, uint32_m width, uint32_m height, muCOSAWL_Pixels** pixels) {
+				// Check for buffers the compositor is done with
+				muCOSAWL_pixels_check(context);
+
+				// Use a free buffer, preferring one that already has the right dimensions
+				muCOSAWL_Pixels* free_pixels = 0;
+				for (size_m i = 0; i < 2; ++i) {
+					muCOSAWL_Pixels* p = &win->handles.pixels[i];
+					if (p->busy) {
+						continue;
+					}
+					if (p->buffer && p->width == width && p->height == height) {
+						free_pixels = p;
+						break;
+					}
+					if (!free_pixels) {
+						free_pixels = p;
+					}
+				}
+				if (!free_pixels) {
+					return MUCOSA_FAILED_PIXELS_BUSY;
+				}
+
+				// (Re)create it if its dimensions don't match
+				if (!free_pixels->buffer || free_pixels->width != width || free_pixels->height != height) {
+					muCOSAWL_pixels_destroy(free_pixels);
+					muCOSAResult res = muCOSAWL_pixels_create(context, free_pixels, width, height);
+					if (res != MUCOSA_SUCCESS) {
+						return res;
+					}
+				}
+
+				*pixels = free_pixels;
+				return MUCOSA_SUCCESS;
+			}
+
+			uint32_m* muCOSAWL_window_get_pixels(muCOSAWL_Context* context, muCOSAResult* result, muCOSAWL_Window* win, uint32_m width, uint32_m height, uint32_m* stride) {
+				muCOSAWL_Pixels* pixels = 0;
+				muCOSAResult res = muCOSAWL_pixels_get(context, win, width, height, &pixels);
+				if (res != MUCOSA_SUCCESS) {
+					MU_SET_RESULT(result, res)
+					return 0;
+				}
+
+				if (stride) {
+					*stride = width * 4;
+				}
+				return pixels->data;
+			}
+
+			muBool muCOSAWL_window_pixels_busy(muCOSAWL_Context* context, muCOSAWL_Window* win, uint32_m* pixels) {
+				// Check for buffers the compositor is done with
+				muCOSAWL_pixels_check(context);
+
+				muCOSAWL_Pixels* owned = muCOSAWL_pixels_find(win, pixels);
+				return owned && owned->busy;
+			}
+
+			void muCOSAWL_window_present_pixels(muCOSAWL_Context* context, muCOSAResult* result, muCOSAWL_Window* win, uint32_m* pixels, uint32_m stride, muPixelRect* rect) {
+				// Get buffer dimensions
+				muCOSAWL_Pixels* owned = muCOSAWL_pixels_find(win, pixels);
+				uint32_m width = (owned) ? owned->width : win->props.width;
+				uint32_m height = (owned) ? owned->height : win->props.height;
+
+				// Clip rectangle to the buffer
+				muPixelRect r;
+				if (!muCOSA_pixel_rect_clip(rect, width, height, &r)) {
+					return;
+				}
+
+				// Window-owned buffer
+				if (owned) {
+					// Check for buffers the compositor is done with
+					muCOSAWL_pixels_check(context);
+					if (owned->busy) {
+						MU_SET_RESULT(result, MUCOSA_FAILED_PIXELS_BUSY)
+						return;
+					}
+				}
+				// User memory; copy it into a free buffer
+				else {
+					muCOSAResult res = muCOSAWL_pixels_get(context, win, width, height, &owned);
+					if (res != MUCOSA_SUCCESS) {
+						MU_SET_RESULT(result, res)
+						return;
+					}
+					for (uint32_m y = 0; y < height; ++y) {
+						mu_memcpy(&owned->data[y*width], (uint8_m*)pixels + (size_m)y*(size_m)stride, (size_m)width * 4);
+					}
+				}
+
+				// Attach buffer; busy until the compositor releases it
+				wl_surface_attach(win->handles.surface, owned->buffer, 0, 0);
+				wl_surface_damage(win->handles.surface, r.x, r.y, (int32_t)r.width, (int32_t)r.height);
+				wl_surface_commit(win->handles.surface);
+				owned->busy = MU_TRUE;
+				wl_display_flush(context->display);
+			}
+
+		/* Creation / Destruction */
+
+			void muCOSAWL_window_destroy(muCOSAWL_Context* context, muCOSAWL_Window* win);
+
+			muCOSAResult muCOSAWL_window_create(muCOSAWL_Context* context, muWindowInfo* info, muCOSAWL_Window* win) {
+				/* Default attributes */
+
+					// Zero-ing-out
+					mu_memset(&win->handles, 0, sizeof(win->handles));
+					mu_memset(&win->keymaps, 0, sizeof(win->keymaps));
+					win->handles.context = context;
+
+					// States
+					win->states.closed = MU_FALSE;
+					win->states.cursor_style = MU_CURSOR_ARROW;
+					win->states.raw_motion = MU_FALSE;
+					win->states.pointer_lock = MU_FALSE;
+					win->states.frame_ready = MU_TRUE;
+
+					// Pixel format
+					if (info->pixel_format) {
+						win->props.use_format = MU_TRUE;
+						win->props.format = *info->pixel_format;
+					} else {
+						win->props.use_format = MU_FALSE;
+					}
+
+					// Min/Max dimensions (0 means no limit)
+					win->props.min_width = info->min_width;
+					win->props.min_height = info->min_height;
+					win->props.max_width = info->max_width;
+					win->props.max_height = info->max_height;
+
+					// Dimensions
+					win->props.width = info->width ? info->width : 1;
+					win->props.height = info->height ? info->height : 1;
+					win->props.pending_width = win->props.pending_height = 0;
+
+					// Scroll level
+					win->props.scroll_level = 0;
+
+					// Cursor position
+					win->props.cursor_x = win->props.cursor_y = 0;
+
+					// Callbacks
+					// - Zero-out if no callbacks specified
+					if (!info->callbacks) {
+						mu_memset(&win->callbacks, 0, sizeof(win->callbacks));
+					}
+					// - Set all callbacks if specified
+					else {
+						win->callbacks = *info->callbacks;
+					}
+
+					// Text focus
+					win->props.text_input_callback = 0;
+					win->props.text_cursor_x = win->props.text_cursor_y = 0;
+
+				/* Surface */
+
+					win->handles.surface = wl_compositor_create_surface(context->compositor);
+					if (!win->handles.surface) {
+						return MUCOSA_WAYLAND_FAILED_CREATE_WINDOW;
+					}
+
+				/* Toplevel */
+
+					win->handles.xdg_surface = muCOSAWL_xdg_wm_base_get_xdg_surface(context->wm_base, win->handles.surface);
+					if (!win->handles.xdg_surface) {
+						wl_surface_destroy(win->handles.surface);
+						return MUCOSA_WAYLAND_FAILED_CREATE_WINDOW;
+					}
+					wl_proxy_add_listener(win->handles.xdg_surface, (void (**)(void))&muCOSAWL_window_xdg_surface_listener, win);
+
+					win->handles.toplevel = muCOSAWL_xdg_surface_get_toplevel(win->handles.xdg_surface);
+					if (!win->handles.toplevel) {
+						muCOSAWL_xdg_surface_destroy(win->handles.xdg_surface);
+						wl_surface_destroy(win->handles.surface);
+						return MUCOSA_WAYLAND_FAILED_CREATE_WINDOW;
+					}
+					wl_proxy_add_listener(win->handles.toplevel, (void (**)(void))&muCOSAWL_window_toplevel_listener, win);
+
+					// Title + ID
+					muCOSAWL_xdg_toplevel_set_title(win->handles.toplevel, info->title);
+					muCOSAWL_xdg_toplevel_set_app_id(win->handles.toplevel, "muCOSA");
+
+					// Min/Max dimensions
+					muCOSAWL_xdg_toplevel_set_min_size(win->handles.toplevel, (int32_t)win->props.min_width, (int32_t)win->props.min_height);
+					muCOSAWL_xdg_toplevel_set_max_size(win->handles.toplevel, (int32_t)win->props.max_width, (int32_t)win->props.max_height);
+
+				/* Add window to map */
+
+					// (Done before the initial configure, as input events can come
+					// with it)
+					muCOSAResult res = muCOSA_window_map_add(&context->handles, (uint64_m)(size_m)win->handles.surface, win);
+					if (muCOSA_result_is_fatal(res)) {
+						muCOSAWL_xdg_toplevel_destroy(win->handles.toplevel);
+						muCOSAWL_xdg_surface_destroy(win->handles.xdg_surface);
+						wl_surface_destroy(win->handles.surface);
+						return res;
+					}
+
+				/* Initial configure */
+
+					// Commit the role without a buffer and wait for the compositor's
+					// initial configuration of the surface
+					wl_surface_commit(win->handles.surface);
+					wl_display_roundtrip(context->display);
+
+				/* Add window to list */
+
+					res = muCOSA_window_list_add(&context->windows, win);
+					if (muCOSA_result_is_fatal(res)) {
+						muCOSAWL_window_destroy(context, win);
+						return res;
+					}
+
+				return res;
+			}
+
+			void muCOSAWL_window_destroy(muCOSAWL_Context* context, muCOSAWL_Window* win) {
+				// Remove focus
+				if (context->keyboard_focus == win) {
+					context->keyboard_focus = 0;
+				}
+				if (context->pointer_focus == win) {
+					context->pointer_focus = 0;
+				}
+
+				// Destroy objects
+				if (win->handles.frame) {
+					wl_callback_destroy(win->handles.frame);
+				}
+				if (win->handles.locked_pointer) {
+					muCOSAWL_locked_pointer_destroy(win->handles.locked_pointer);
+				}
+				muCOSAWL_pixels_destroy(&win->handles.pixels[0]);
+				muCOSAWL_pixels_destroy(&win->handles.pixels[1]);
+				#ifdef MUCOSA_EGL
+				muCOSAEGL_surface_destroy(&context->egl, &win->handles.egl);
+				if (win->handles.egl_window) {
+					wl_egl_window_destroy(win->handles.egl_window);
+				}
+				#endif
+				muCOSAWL_xdg_toplevel_destroy(win->handles.toplevel);
+				muCOSAWL_xdg_surface_destroy(win->handles.xdg_surface);
+				muCOSA_window_map_remove(&context->handles, (uint64_m)(size_m)win->handles.surface);
+				wl_surface_destroy(win->handles.surface);
+				wl_display_flush(context->display);
+
+				// Remove window from list
+				muCOSA_window_list_remove(&context->windows, win);
+			}
+
+		/* Main loop */
+
+			muBool muCOSAWL_window_get_closed(muCOSAWL_Window* win) {
+				return win->states.closed;
+			}
+
+			void muCOSAWL_window_close(muCOSAWL_Window* win) {
+				// Set closed flag
+				win->states.closed = MU_TRUE;
+			}
+
+			// Copies the context's keystates into the window's keymap
+			void muCOSAWL_update_keystate(muCOSAWL_Context* context, muCOSAWL_Window* win) {
+				for (muKeyboardState s = 1; s < MU_KEYSTATE_LENGTH; ++s) {
+					// Change value if different
+					if (context->keystates[s] != win->keymaps.keystates[s]) {
+						win->keymaps.keystates[s] = context->keystates[s];
+
+						// + Event + callback
+						muCOSA_event_push_keystate(&win->events, s, win->keymaps.keystates[s]);
+						if (win->callbacks.keystate) {
+							win->callbacks.keystate(win, s, win->keymaps.keystates[s]);
+						}
+					}
+				}
+			}
+
+			// Refreshes everything in a window not given by events (after events have
+			// been processed)
+			void muCOSAWL_window_refresh(muCOSAWL_Context* context, muCOSAWL_Window* win) {
+				// Deliver coalesced changes
+				muCOSA_coalesce_flush(&win->coalesce, win, &win->callbacks, &win->events);
+				// Changes found from here on are timestamped with now
+				win->events.time = muCOSAPOSIX_time_get(&context->time);
+				// Update keystates
+				muCOSAWL_update_keystate(context, win);
+				// Mark end of update in recording
+				muCOSA_recording_write_update(&win->events.recording, win->events.time);
+
+				// Frame callback, once the compositor is ready for a new frame
+				if (win->states.frame_ready && win->callbacks.frame) {
+					// Request to be told when to draw the next frame; this is attached
+					// to the next commit, which is made by presenting the frame
+					win->states.frame_ready = MU_FALSE;
+					win->handles.frame = wl_surface_frame(win->handles.surface);
+					wl_callback_add_listener(win->handles.frame, &muCOSAWL_frame_listener, win);
+
+					// Draw frame
+					win->callbacks.frame(win);
+
+					// (Commit in case the frame callback didn't present anything)
+					wl_surface_commit(win->handles.surface);
+					wl_display_flush(context->display);
+				}
+			}
+
+			void muCOSAWL_window_update(muCOSAWL_Context* context, muCOSAWL_Window* win) {
+				// Process events
+				muCOSAWL_dispatch(context);
+				// Refresh window
+				muCOSAWL_window_refresh(context, win);
+			}
+
+			void muCOSAWL_context_update(muCOSAWL_Context* context) {
+				// Process events once for every window
+				muCOSAWL_dispatch(context);
+
+				// Refresh each unclosed window
+				for (size_m i = 0; i < context->windows.wincount; ++i) {
+					muCOSAWL_Window* win = (muCOSAWL_Window*)context->windows.windows[i];
+					if (win && !win->states.closed) {
+						muCOSAWL_window_refresh(context, win);
+					}
+				}
+			}
+
+			void muCOSAWL_window_wait(muCOSAWL_Context* context, double timeout) {
+				struct wl_display* d = context->display;
+
+				// Don't wait if events have already been read but not processed
+				if (wl_display_prepare_read(d) != 0) {
+					return;
+				}
+				// Send requests
+				wl_display_flush(d);
+
+				// Wait for the compositor to send something, reading it if it did
+				if (muCOSAPOSIX_wait(&context->wake, wl_display_get_fd(d), timeout)) {
+					wl_display_read_events(d);
+				} else {
+					wl_display_cancel_read(d);
+				}
+			}
+
+		/* Title */
+
+			muCOSAResult muCOSAWL_window_set_title(muCOSAWL_Window* win, char* data) {
+				muCOSAWL_xdg_toplevel_set_title(win->handles.toplevel, data);
+				wl_display_flush(win->handles.context->display);
+				return MUCOSA_SUCCESS;
+			}
+
+		/* Dimensions */
+
+			muCOSAResult muCOSAWL_window_get_dimensions(muCOSAWL_Window* win, uint32_m* data) {
+				data[0] = win->props.width;
+				data[1] = win->props.height;
+				return MUCOSA_SUCCESS;
+			}
+
+			muCOSAResult muCOSAWL_window_set_dimensions(muCOSAWL_Window* win, uint32_m* data) {
+				// Surfaces can't have 0 dimensions
+				if (!data[0] || !data[1]) {
+					return MUCOSA_WAYLAND_UNSUPPORTED_WINDOW_ATTRIB;
+				}
+
+				// On Wayland, the client decides its own dimensions; they take effect
+				// with the next frame presented
+				win->props.width = data[0];
+				win->props.height = data[1];
+				muCOSAWL_resize_egl_window(win);
+				return MUCOSA_SUCCESS;
+			}
+
+		/* Position */
+
+			// Wayland doesn't let clients know or decide where their surfaces are
+			muCOSAResult muCOSAWL_window_get_position(muCOSAWL_Window* win, int32_m* data) {
+				data[0] = data[1] = 0;
+				return MUCOSA_WAYLAND_UNSUPPORTED_WINDOW_ATTRIB;
+				if (win) {}
+			}
+
+			muCOSAResult muCOSAWL_window_set_position(muCOSAWL_Window* win, int32_m* data) {
+				return MUCOSA_WAYLAND_UNSUPPORTED_WINDOW_ATTRIB;
+				if (win) {} if (data) {}
+			}
+
+		/* Keymaps */
+
+			muCOSAResult muCOSAWL_window_get_keyboard_map(muCOSAWL_Window* win, muBool** data) {
+				// Point to keyboard keymap
+				*data = win->keymaps.keyboard;
+				return MUCOSA_SUCCESS;
+			}
+
+			muCOSAResult muCOSAWL_window_get_keystate_map(muCOSAWL_Window* win, muBool** data) {
+				// Point to keystate keymap
+				*data = win->keymaps.keystates;
+				return MUCOSA_SUCCESS;
+			}
+
+			muCOSAResult muCOSAWL_window_get_mouse_map(muCOSAWL_Window* win, muBool** data) {
+				// Point to mouse keymap
+				*data = win->keymaps.mouse;
+				return MUCOSA_SUCCESS;
+			}
+
+		/* Cursor */
+
+			muCOSAResult muCOSAWL_window_get_cursor_pos(muCOSAWL_Window* win, int32_m* data) {
+				// Give last known cursor position
+				data[0] = win->props.cursor_x;
+				data[1] = win->props.cursor_y;
+				return MUCOSA_SUCCESS;
+			}
+
+			muCOSAResult muCOSAWL_window_set_cursor_pos(muCOSAWL_Window* win, int32_m* data) {
+				// Warping the pointer isn't allowed (outside of pointer constraints)
+				return MUCOSA_WAYLAND_UNSUPPORTED_WINDOW_ATTRIB;
+				if (win) {} if (data) {}
+			}
+
+			muCOSAResult muCOSAWL_window_get_cursor_style(muCOSAWL_Window* win, muCursorStyle* data) {
+				// Set data to cursor style
+				*data = win->states.cursor_style;
+				return MUCOSA_SUCCESS;
+			}
+
+			muCOSAResult muCOSAWL_window_set_cursor_style(muCOSAWL_Window* win, muCursorStyle* data) {
+				// Set internal storage to cursor style
+				win->states.cursor_style = *data;
+
+				// Update cursor if the pointer is currently in the window
+				muCOSAWL_Context* context = win->handles.context;
+				if (context->pointer_focus == win) {
+					muCOSAWL_update_cursor_shape(context);
+					wl_display_flush(context->display);
+				}
+				return MUCOSA_SUCCESS;
+			}
+
+		/* Scroll */
+
+			void muCOSAWL_window_get_scroll(muCOSAWL_Window* win, int32_m* data) {
+				// Give scroll level
+				*data = win->props.scroll_level;
+			}
+
+			void muCOSAWL_window_set_scroll(muCOSAWL_Window* win, int32_m* data) {
+				// Overwrite scroll level
+				win->props.scroll_level = *data;
+			}
+
+		/* Event time */
+
+			void muCOSAWL_window_get_event_time(muCOSAWL_Window* win, double* data) {
+				// Give time of the most recent event
+				*data = win->events.time;
+			}
+
+		/* Raw motion */
+
+			void muCOSAWL_window_get_raw_motion(muCOSAWL_Window* win, muBool* data) {
+				*data = win->states.raw_motion;
+			}
+
+			muCOSAResult muCOSAWL_window_set_raw_motion(muCOSAWL_Window* win, muBool* data) {
+				// Relative motion is always received if it's available; it's just
+				// ignored for windows that don't receive raw motion
+				if (*data && !win->handles.context->relative_pointer_manager) {
+					return MUCOSA_FAILED_UNSUPPORTED_FEATURE;
+				}
+				win->states.raw_motion = *data;
+				return MUCOSA_SUCCESS;
+			}
+
+		/* Pointer lock */
+
+			void muCOSAWL_window_get_pointer_lock(muCOSAWL_Window* win, muBool* data) {
+				*data = win->states.pointer_lock;
+			}
+
+			muCOSAResult muCOSAWL_window_set_pointer_lock(muCOSAWL_Window* win, muBool* data) {
+				muCOSAWL_Context* context = win->handles.context;
+				if (*data == win->states.pointer_lock) {
+					return MUCOSA_SUCCESS;
+				}
+
+				// Lock; persistent, so that the compositor locks the pointer again
+				// whenever it's deactivated (such as by losing focus) and reactivated
+				if (*data) {
+					if (!context->pointer_constraints || !context->pointer) {
+						return MUCOSA_FAILED_UNSUPPORTED_FEATURE;
+					}
+					win->handles.locked_pointer = muCOSAWL_pointer_constraints_lock_pointer(context->pointer_constraints, win->handles.surface, context->pointer, 2);
+				}
+				// Unlock
+				else if (win->handles.locked_pointer) {
+					muCOSAWL_locked_pointer_destroy(win->handles.locked_pointer);
+					win->handles.locked_pointer = 0;
+				}
+				win->states.pointer_lock = *data;
+
+				// Hide/Show the cursor if the pointer is currently in the window
+				if (context->pointer_focus == win) {
+					muCOSAWL_update_cursor_shape(context);
+				}
+				wl_display_flush(context->display);
+				return MUCOSA_SUCCESS;
+			}
+
+		/* Callbacks */
+
+			void muCOSAWL_window_set_callback(muCOSAWL_Window* win, muWindowAttrib attrib, void* fun) {
+				switch (attrib) {
+					case MU_WINDOW_DIMENSIONS_CALLBACK: {
+						mu_memcpy(&win->callbacks.dimensions, fun, sizeof(win->callbacks.dimensions));
+					} break;
+					case MU_WINDOW_POSITION_CALLBACK: {
+						mu_memcpy(&win->callbacks.position, fun, sizeof(win->callbacks.position));
+					} break;
+					case MU_WINDOW_KEYBOARD_CALLBACK: {
+						mu_memcpy(&win->callbacks.keyboard, fun, sizeof(win->callbacks.keyboard));
+					} break;
+					case MU_WINDOW_KEYSTATE_CALLBACK: {
+						mu_memcpy(&win->callbacks.keystate, fun, sizeof(win->callbacks.keystate));
+					} break;
+					case MU_WINDOW_MOUSE_KEY_CALLBACK: {
+						mu_memcpy(&win->callbacks.mouse_key, fun, sizeof(win->callbacks.mouse_key));
+					} break;
+					case MU_WINDOW_CURSOR_CALLBACK: {
+						mu_memcpy(&win->callbacks.cursor, fun, sizeof(win->callbacks.cursor));
+					} break;
+					case MU_WINDOW_SCROLL_CALLBACK: {
+						mu_memcpy(&win->callbacks.scroll, fun, sizeof(win->callbacks.scroll));
+					} break;
+					case MU_WINDOW_FRAME_CALLBACK: {
+						mu_memcpy(&win->callbacks.frame, fun, sizeof(win->callbacks.frame));
+					} break;
+					case MU_WINDOW_RAW_MOTION_CALLBACK: {
+						mu_memcpy(&win->callbacks.raw_motion, fun, sizeof(win->callbacks.raw_motion));
+					} break;
+				}
+			}
+
+		/* Text input */
+
+			void muCOSAWL_window_get_text_input(muCOSAResult* result, muCOSAWL_Window* win, uint32_m cx, uint32_m cy, void (*callback)(muWindow, uint8_m*)) {
+				// Set callback
+				win->props.text_input_callback = callback;
+				// Set text cursor position; there's no input method support to give it to
+				win->props.text_cursor_x = cx;
+				win->props.text_cursor_y = cy;
+				return; if (result) {}
+			}
+
+			void muCOSAWL_window_let_text_input(muCOSAWL_Window* win) {
+				// Set callback to nothing
+				win->props.text_input_callback = 0;
+			}
+
+			void muCOSAWL_window_update_text_cursor(muCOSAResult* result, muCOSAWL_Window* win, uint32_m cx, uint32_m cy) {
+				// Do nothing if text input isn't being taken
+				if (!win->props.text_input_callback) {
+					return;
+				}
+
+				win->props.text_cursor_x = cx;
+				win->props.text_cursor_y = cy;
+				return; if (result) {}
+			}
+
+		/* OpenGL */
+
+		#ifdef MUCOSA_EGL
+
+			void* muCOSAWL_gl_context_create(muCOSAWL_Context* context, muCOSAResult* result, muCOSAWL_Window* win, muGraphicsAPI api) {
+				// Initialize EGL for the display
+				muCOSAResult res = muCOSAEGL_display_init(&context->egl, MUCOSAEGL_PLATFORM_WAYLAND_KHR, context->display);
+				if (res != MUCOSA_SUCCESS) {
+					MU_SET_RESULT(result, res)
+					return 0;
+				}
+
+				// Create the EGL window of the surface
+				if (!win->handles.egl_window) {
+					win->handles.egl_window = wl_egl_window_create(win->handles.surface, (int)win->props.width, (int)win->props.height);
+					if (!win->handles.egl_window) {
+						MU_SET_RESULT(result, MUCOSA_EGL_FAILED_CREATE_SURFACE)
+						return 0;
+					}
+				}
+
+				// Create the window's surface
+				muPixelFormat* format = 0;
+				if (win->props.use_format) {
+					format = &win->props.format;
+				}
+				res = muCOSAEGL_surface_create(&context->egl, &win->handles.egl, format, 0, (EGLNativeWindowType)win->handles.egl_window);
+				if (res != MUCOSA_SUCCESS) {
+					MU_SET_RESULT(result, res)
+					if (muCOSA_result_is_fatal(res)) {
+						return 0;
+					}
+				}
+
+				// Create OpenGL context
+				return muCOSAEGL_gl_context_create(&context->egl, result, &win->handles.egl, api);
+			}
+
+			void* muCOSAWL_gl_offscreen_create(muCOSAWL_Context* context, muCOSAResult* result, muPixelFormat* format, muGraphicsAPI api) {
+				// Initialize EGL for the display
+				muCOSAResult res = muCOSAEGL_display_init(&context->egl, MUCOSAEGL_PLATFORM_WAYLAND_KHR, context->display);
+				if (res != MUCOSA_SUCCESS) {
+					MU_SET_RESULT(result, res)
+					return 0;
+				}
+
+				// Create OpenGL context
+				return muCOSAEGL_gl_offscreen_create(&context->egl, result, format, api);
+			}
+
+		#endif /* MUCOSA_EGL */
+
+		/* Vulkan */
+
+		#ifdef MU_SUPPORT_VULKAN
+
+			// VkWaylandSurfaceCreateInfoKHR
+			struct muCOSAWL_VkSurfaceCreateInfo {
+				VkStructureType sType;
+				const void* pNext;
+				VkFlags flags;
+				struct wl_display* display;
+				struct wl_surface* surface;
+			};
+			typedef struct muCOSAWL_VkSurfaceCreateInfo muCOSAWL_VkSurfaceCreateInfo;
+
+			// Instance extensions needed to create surfaces
+			const char* muCOSAWL_vk_extensions[2] = { "VK_KHR_surface", "VK_KHR_wayland_surface" };
+
+			muCOSAResult muCOSAWL_vk_create_surface(muCOSAWL_Context* context, muCOSAWL_Window* win, void* instance, void* allocator, void* surface) {
+				muCOSAWL_VkSurfaceCreateInfo ci = MU_ZERO_STRUCT(muCOSAWL_VkSurfaceCreateInfo);
+				ci.sType = (VkStructureType)MUCOSAVK_STRUCTURE_TYPE_WAYLAND_SURFACE_CREATE_INFO_KHR;
+				ci.display = context->display;
+				ci.surface = win->handles.surface;
+				return muCOSAVK_create_surface("vkCreateWaylandSurfaceKHR", instance, &ci, allocator, surface);
+			}
+
+		#endif /* MU_SUPPORT_VULKAN */
+
+	#endif /* MUCOSA_WAYLAND */
+
+	/* Headless */
+
+	#ifdef MUCOSA_HEADLESS
+
+		/* Time */
+
+			// The headless clock is virtual: it only moves forward when the program
+			// sleeps, so that runs are deterministic and no time is actually wasted
+			struct muCOSAHL_Time {
+				// Time elapsed since the context was created
+				double elapsed;
+				// Offset of the overridable time from the elapsed time
+				double offset;
+			};
+			typedef struct muCOSAHL_Time muCOSAHL_Time;
+
+		/* Useful functions */
+
+			// Gets the amount of bytes in a UTF-8 character based on its first byte
+			size_m muCOSAHL_utf8_char_size(uint8_m c) {
+				if (c < 128) {
+					return 1;
+				} else if (c >= 192 && c < 224) {
+					return 2;
+				} else if (c >= 224 && c < 240) {
+					return 3;
+				} else if (c >= 240 && c < 248) {
+					return 4;
+				}
+				// (Continuation or invalid byte)
+				return 1;
+			}
+
+		/* Window structs */
+
+			struct muCOSAHL_Keymaps {
+				// Keyboard keys
+				muBool keyboard[MU_KEYBOARD_LENGTH];
+				// Keystates
+				muBool keystates[MU_KEYSTATE_LENGTH];
+				// Mouse keys
+				muBool mouse[MU_MOUSE_LENGTH];
+			};
+			typedef struct muCOSAHL_Keymaps muCOSAHL_Keymaps;
+
+			// States possibly held by the window that are updated via events
+			struct muCOSAHL_WindowStates {
+				// Closed or not
+				muBool closed;
+				// Cursor style
+				muCursorStyle cursor_style;
+				// If raw motion is received
+				muBool raw_motion;
+				// If the pointer is locked
+				muBool pointer_lock;
+			};
+			typedef struct muCOSAHL_WindowStates muCOSAHL_WindowStates;
+
+			struct muCOSAHL_WindowProperties {
+				// Min/Max dimensions
+				uint32_m min_width;
+				uint32_m min_height;
+				uint32_m max_width;
+				uint32_m max_height;
+
+				// Dimensions
+				uint32_m width;
+				uint32_m height;
+
+				// Position
+				int32_m x;
+				int32_m y;
+
+				// Scroll level
+				int32_m scroll_level;
+
+				// Cursor position
+				int32_m cursor_x;
+				int32_m cursor_y;
+
+				// Text input
+				void (*text_input_callback)(muWindow window, uint8_m* data);
+				uint32_m text_cursor_x;
+				uint32_m text_cursor_y;
+			};
+			typedef struct muCOSAHL_WindowProperties muCOSAHL_WindowProperties;
+
+			// Types of injected input
+			#define MUCOSAHL_INPUT_KEY 0
+			#define MUCOSAHL_INPUT_KEYSTATE 1
+			#define MUCOSAHL_INPUT_MOUSE_KEY 2
+			#define MUCOSAHL_INPUT_CURSOR 3
+			#define MUCOSAHL_INPUT_SCROLL 4
+			#define MUCOSAHL_INPUT_TEXT 5
+			#define MUCOSAHL_INPUT_DIMENSIONS 6
+			#define MUCOSAHL_INPUT_POSITION 7
+			#define MUCOSAHL_INPUT_CLOSE 8
+			#define MUCOSAHL_INPUT_RAW_MOTION 9
+			// (Only used in replays, marking the end of a recorded update)
+			#define MUCOSAHL_INPUT_UPDATE 10
+
+			// A piece of injected input, waiting to be processed by the next update
+			struct muCOSAHL_Input {
+				uint8_m type;
+				// Time it was injected
+				double time;
+				union {
+					// Key (keyboard key, keystate, or mouse key) + status
+					struct {
+						uint16_m key;
+						muBool status;
+					} key;
+					// Coordinates (cursor/position) or dimensions
+					struct {
+						int32_m x;
+						int32_m y;
+					} point;
+					// Scroll added
+					int32_m scroll;
+					// Raw motion
+					struct {
+						double dx;
+						double dy;
+					} motion;
+					// UTF-8 character + null-terminating character
+					uint8_m text[5];
+				} data;
+			};
+			typedef struct muCOSAHL_Input muCOSAHL_Input;
+
+			// A recording being replayed to a window
+			struct muCOSAHL_Replay {
+				// Recorded input (timestamped relative to the start of the recording)
+				muCOSAHL_Input* inputs;
+				size_m len;
+				// Next input to inject
+				size_m next;
+				// Time that replaying started
+				double start;
+				// If input is replayed at its original speed
+				muBool realtime;
+			};
+			typedef struct muCOSAHL_Replay muCOSAHL_Replay;
+
+			struct muCOSAHL_Window {
+				muCOSAHL_Keymaps keymaps;
+				muCOSAHL_WindowStates states;
+				muCOSAHL_WindowProperties props;
+				muWindowCallbacks callbacks;
+				muCOSA_EventQueue events;
+				muCOSA_Coalesce coalesce;
+
+				// Injected input queue
+				muCOSAHL_Input* inputs;
+				size_m input_len;
+				size_m input_cap;
+				// Recording being replayed (inputs are 0 if none)
+				muCOSAHL_Replay replay;
+
+				// Pixel buffer (0 if not allocated)
+				uint32_m* pixels;
+				uint32_m pixels_width;
+				uint32_m pixels_height;
+
+				#ifdef MUCOSA_THREAD_SAFE
+				muCOSA_Lock lock;
+				#endif
+			};
+			typedef struct muCOSAHL_Window muCOSAHL_Window;
+
+		/* Context */
+
+			struct muCOSAHL_Context {
+				// Time
+				muCOSAHL_Time time;
+
+				// Clipboard data (0 if none)
+				uint8_m* clipboard;
+				size_m clipboard_len;
+
+				// Windows
+				muCOSA_WindowList windows;
+
+				// EGL display used for offscreen OpenGL contexts
+				#ifdef MUCOSA_EGL
+				muCOSAEGL_Display egl;
+				#endif
+			};
+			typedef struct muCOSAHL_Context muCOSAHL_Context;
+
+			muCOSAResult muCOSAHL_context_init(muCOSAHL_Context* context) {
+				// Zero-out
+				mu_memset(context, 0, sizeof(muCOSAHL_Context));
+				return MUCOSA_SUCCESS;
+			}
+
+			void muCOSAHL_context_term(muCOSAHL_Context* context) {
+				// Free clipboard data
+				if (context->clipboard) {
+					mu_free(context->clipboard);
+				}
+				// Free window list
+				muCOSA_window_list_term(&context->windows);
+				// Terminate EGL
+				#ifdef MUCOSA_EGL
+				muCOSAEGL_display_term(&context->egl);
+				#endif
+			}
+
+		/* Context time */
+
+			double muCOSAHL_fixed_time_get(muCOSAHL_Context* context) {
+				return context->time.elapsed;
+			}
+
+			double muCOSAHL_time_get(muCOSAHL_Context* context) {
+				return context->time.elapsed + context->time.offset;
+			}
+
+			void muCOSAHL_time_set(muCOSAHL_Context* context, double time) {
+				context->time.offset = time - context->time.elapsed;
+			}
+
+		/* Sleep */
+
+			void muCOSAHL_sleep(muCOSAHL_Context* context, double time) {
+				// Advance the clock instead of sleeping
+				if (time > 0.0) {
+					context->time.elapsed += time;
+				}
+			}
+
+		/* Clipboard */
+
+			uint8_m* muCOSAHL_clipboard_get(muCOSAHL_Context* context, muCOSAResult* result) {
+				// No clipboard
+				if (!context->clipboard) {
+					return 0;
+				}
+
+				// Copy clipboard data
+				uint8_m* data = (uint8_m*)mu_malloc(context->clipboard_len + 1);
+				if (!data) {
+					MU_SET_RESULT(result, MUCOSA_FAILED_MALLOC)
+					return 0;
+				}
+				mu_memcpy(data, context->clipboard, context->clipboard_len);
+				data[context->clipboard_len] = 0;
+				return data;
+			}
+
+			void muCOSAHL_clipboard_set(muCOSAHL_Context* context, muCOSAResult* result, uint8_m* data, size_m datalen) {
+				// Copy data
+				uint8_m* copy = (uint8_m*)mu_malloc(datalen);
+				if (!copy) {
+					MU_SET_RESULT(result, MUCOSA_FAILED_MALLOC)
+					return;
+				}
+				mu_memcpy(copy, data, datalen);
+
+				// Replace old clipboard data
+				if (context->clipboard) {
+					mu_free(context->clipboard);
+				}
+				context->clipboard = copy;
+				context->clipboard_len = datalen;
+			}
+
+		/* Creation / Destruction */
+
+			muCOSAResult muCOSAHL_window_create(muCOSAHL_Context* context, muWindowInfo* info, muCOSAHL_Window* win) {
+				// Zero-ing-out
+				mu_memset(&win->keymaps, 0, sizeof(win->keymaps));
+				win->inputs = 0;
+				win->input_len = win->input_cap = 0;
+				win->replay.inputs = 0;
+				win->pixels = 0;
+				win->pixels_width = win->pixels_height = 0;
+
+				// States
+				win->states.closed = MU_FALSE;
+				win->states.cursor_style = MU_CURSOR_ARROW;
+				win->states.raw_motion = MU_FALSE;
+				win->states.pointer_lock = MU_FALSE;
+
+				// Min/Max dimensions
+				win->props.min_width = info->min_width;
+				win->props.min_height = info->min_height;
+				win->props.max_width = info->max_width;
+				win->props.max_height = info->max_height;
+
+				// Dimensions + position
+				win->props.width = info->width;
+				win->props.height = info->height;
+				win->props.x = info->x;
+				win->props.y = info->y;
+
+				// Scroll level
+				win->props.scroll_level = 0;
+
+				// Cursor position
+				win->props.cursor_x = win->props.cursor_y = 0;
+
+				// Callbacks
+				// - Zero-out if no callbacks specified
+				if (!info->callbacks) {
+					mu_memset(&win->callbacks, 0, sizeof(win->callbacks));
+				}
+				// - Set all callbacks if specified
+				else {
+					win->callbacks = *info->callbacks;
+				}
+
+				// Text focus
+				win->props.text_input_callback = 0;
+				win->props.text_cursor_x = win->props.text_cursor_y = 0;
+
+				// Add window to list
+				return muCOSA_window_list_add(&context->windows, win);
+			}
+
+			void muCOSAHL_window_destroy(muCOSAHL_Context* context, muCOSAHL_Window* win) {
+				// Remove window from list
+				muCOSA_window_list_remove(&context->windows, win);
+				// Free input queue
+				if (win->inputs) {
+					mu_free(win->inputs);
+				}
+				// Free replay
+				if (win->replay.inputs) {
+					mu_free(win->replay.inputs);
+				}
+				// Free pixel buffer
+				if (win->pixels) {
+					mu_free(win->pixels);
+				}
+			}
+
+		/* Pixels */
+
+			uint32_m* muCOSAHL_window_get_pixels(muCOSAResult* result, muCOSAHL_Window* win, uint32_m width, uint32_m height, uint32_m* stride) {
+				// (Re)allocate buffer if its dimensions don't match
+				if (!win->pixels || win->pixels_width != width || win->pixels_height != height) {
+					uint32_m* pixels = (uint32_m*)mu_malloc((size_m)width * (size_m)height * 4);
+					if (!pixels) {
+						MU_SET_RESULT(result, MUCOSA_FAILED_MALLOC)
+						return 0;
+					}
+					if (win->pixels) {
+						mu_free(win->pixels);
+					}
+					win->pixels = pixels;
+					win->pixels_width = width;
+					win->pixels_height = height;
+				}
+
+				// Nothing reads from the buffer, so it's never busy
+				if (stride) {
+					*stride = width * 4;
+				}
+				return win->pixels;
+			}
+
+		/* Input */
+
+			// Adds input to the back of a window's input queue, keeping its timestamp
+			muCOSAResult muCOSAHL_window_add_input(muCOSAHL_Window* win, muCOSAHL_Input* input) {
+				// Expand queue if needed
+				if (win->input_len == win->input_cap) {
+					size_m new_cap = win->input_cap ? win->input_cap * 2 : 64;
+					muCOSAHL_Input* new_inputs = (muCOSAHL_Input*)mu_realloc(win->inputs, new_cap * sizeof(muCOSAHL_Input));
+					if (!new_inputs) {
+						return win->inputs ? MUCOSA_FAILED_REALLOC : MUCOSA_FAILED_MALLOC;
+					}
+					win->inputs = new_inputs;
+					win->input_cap = new_cap;
+				}
+
+				// Add input
+				win->inputs[win->input_len++] = *input;
+				return MUCOSA_SUCCESS;
+			}
+
+			// Adds input to the back of a window's input queue, timestamped with now
+			muCOSAResult muCOSAHL_window_push_input(muCOSAHL_Context* context, muCOSAHL_Window* win, muCOSAHL_Input* input) {
+				input->time = muCOSAHL_time_get(context);
+				return muCOSAHL_window_add_input(win, input);
+			}
+
+			// Processes a piece of input the same way that the other window systems process events
+			void muCOSAHL_window_handle_input(muCOSAHL_Window* win, muCOSAHL_Input* input) {
+				// Timestamp with when it was injected
+				win->events.time = input->time;
+
+				// Deliver coalesced changes before any input that can't be coalesced
+				// (Raw motion doesn't affect the coalesced changes, so it doesn't need to)
+				if (input->type != MUCOSAHL_INPUT_CURSOR && input->type != MUCOSAHL_INPUT_DIMENSIONS && input->type != MUCOSAHL_INPUT_POSITION && input->type != MUCOSAHL_INPUT_RAW_MOTION) {
+					muCOSA_coalesce_flush(&win->coalesce, win, &win->callbacks, &win->events);
+				}
+
+				switch (input->type) {
+					default: return; break;
+
+					// Keyboard key
+					case MUCOSAHL_INPUT_KEY: {
+						muKeyboardKey key = (muKeyboardKey)input->data.key.key;
+						win->keymaps.keyboard[key] = input->data.key.status;
+						// + Event + callback
+						muCOSA_event_push_keyboard(&win->events, key, input->data.key.status);
+						if (win->callbacks.keyboard) {
+							win->callbacks.keyboard(win, key, input->data.key.status);
+						}
+					} break;
+
+					// Keystate (only changes are reported, like with lock keys)
+					case MUCOSAHL_INPUT_KEYSTATE: {
+						muKeyboardState state = (muKeyboardState)input->data.key.key;
+						if (win->keymaps.keystates[state] == input->data.key.status) {
+							return;
+						}
+						win->keymaps.keystates[state] = input->data.key.status;
+						// + Event + callback
+						muCOSA_event_push_keystate(&win->events, state, input->data.key.status);
+						if (win->callbacks.keystate) {
+							win->callbacks.keystate(win, state, input->data.key.status);
+						}
+					} break;
+
+					// Mouse key
+					case MUCOSAHL_INPUT_MOUSE_KEY: {
+						muMouseKey key = (muMouseKey)input->data.key.key;
+						win->keymaps.mouse[key] = input->data.key.status;
+						// + Event + callback
+						muCOSA_event_push_mouse_key(&win->events, key, input->data.key.status);
+						if (win->callbacks.mouse_key) {
+							win->callbacks.mouse_key(win, key, input->data.key.status);
+						}
+					} break;
+
+					// Cursor position
+					case MUCOSAHL_INPUT_CURSOR: {
+						int32_m x = input->data.point.x, y = input->data.point.y;
+						if (win->props.cursor_x == x && win->props.cursor_y == y) {
+							return;
+						}
+						win->props.cursor_x = x;
+						win->props.cursor_y = y;
+						// + Event + callback (unless coalesced)
+						if (!muCOSA_coalesce_cursor(&win->coalesce, win->events.time, x, y)) {
+							muCOSA_event_push_cursor(&win->events, x, y);
+							if (win->callbacks.cursor) {
+								win->callbacks.cursor(win, x, y);
+							}
+						}
+					} break;
+
+					// Scroll
+					case MUCOSAHL_INPUT_SCROLL: {
+						win->props.scroll_level += input->data.scroll;
+						// + Event + callback
+						muCOSA_event_push_scroll(&win->events, input->data.scroll);
+						if (win->callbacks.scroll) {
+							win->callbacks.scroll(win, input->data.scroll);
+						}
+					} break;
+
+					// Text
+					case MUCOSAHL_INPUT_TEXT: {
+						if (win->props.text_input_callback) {
+							muCOSA_event_push_text(&win->events, input->data.text);
+							win->props.text_input_callback(win, input->data.text);
+						}
+					} break;
+
+					// Dimensions
+					case MUCOSAHL_INPUT_DIMENSIONS: {
+						uint32_m w = (uint32_m)input->data.point.x, h = (uint32_m)input->data.point.y;
+						// Keep within min/max dimensions, like a real window manager would
+						if (win->props.min_width && w < win->props.min_width) { w = win->props.min_width; }
+						if (win->props.min_height && h < win->props.min_height) { h = win->props.min_height; }
+						if (win->props.max_width && w > win->props.max_width) { w = win->props.max_width; }
+						if (win->props.max_height && h > win->props.max_height) { h = win->props.max_height; }
+
+						if (win->props.width == w && win->props.height == h) {
+							return;
+						}
+						win->props.width = w;
+						win->props.height = h;
+						// + Event + callback (unless coalesced)
+						if (!muCOSA_coalesce_dimensions(&win->coalesce, win->events.time, w, h)) {
+							muCOSA_event_push_dimensions(&win->events, w, h);
+							if (win->callbacks.dimensions) {
+								win->callbacks.dimensions(win, w, h);
+							}
+						}
+					} break;
+
+					// Position
+					case MUCOSAHL_INPUT_POSITION: {
+						int32_m x = input->data.point.x, y = input->data.point.y;
+						if (win->props.x == x && win->props.y == y) {
+							return;
+						}
+						win->props.x = x;
+						win->props.y = y;
+						// + Event + callback (unless coalesced)
+						if (!muCOSA_coalesce_position(&win->coalesce, win->events.time, x, y)) {
+							muCOSA_event_push_position(&win->events, x, y);
+							if (win->callbacks.position) {
+								win->callbacks.position(win, x, y);
+							}
+						}
+					} break;
+
+					// Close
+					case MUCOSAHL_INPUT_CLOSE: {
+						win->states.closed = MU_TRUE;
+						muCOSA_event_push_close(&win->events);
+					} break;
+
+					// Raw motion
+					case MUCOSAHL_INPUT_RAW_MOTION: {
+						// Only delivered if the window receives raw motion
+						if (!win->states.raw_motion) {
+							return;
+						}
+						// + Event + callback
+						muCOSA_event_push_raw_motion(&win->events, input->data.motion.dx, input->data.motion.dy);
+						if (win->callbacks.raw_motion) {
+							win->callbacks.raw_motion(win, input->data.motion.dx, input->data.motion.dy);
+						}
+					} break;
+				}
+			}
+
+			muCOSAResult muCOSAHL_window_inject_key(muCOSAHL_Context* context, muCOSAHL_Window* win, muKeyboardKey key, muBool status) {
+				if (key >= MU_KEYBOARD_LENGTH) {
+					return MUCOSA_FAILED_UNKNOWN_INPUT;
+				}
+				muCOSAHL_Input input;
+				input.type = MUCOSAHL_INPUT_KEY;
+				input.data.key.key = key;
+				input.data.key.status = status;
+				return muCOSAHL_window_push_input(context, win, &input);
+			}
+
+			muCOSAResult muCOSAHL_window_inject_keystate(muCOSAHL_Context* context, muCOSAHL_Window* win, muKeyboardState state, muBool status) {
+				if (state >= MU_KEYSTATE_LENGTH) {
+					return MUCOSA_FAILED_UNKNOWN_INPUT;
+				}
+				muCOSAHL_Input input;
+				input.type = MUCOSAHL_INPUT_KEYSTATE;
+				input.data.key.key = state;
+				input.data.key.status = status;
+				return muCOSAHL_window_push_input(context, win, &input);
+			}
+
+			muCOSAResult muCOSAHL_window_inject_mouse_key(muCOSAHL_Context* context, muCOSAHL_Window* win, muMouseKey key, muBool status) {
+				if (key >= MU_MOUSE_LENGTH) {
+					return MUCOSA_FAILED_UNKNOWN_INPUT;
+				}
+				muCOSAHL_Input input;
+				input.type = MUCOSAHL_INPUT_MOUSE_KEY;
+				input.data.key.key = key;
+				input.data.key.status = status;
+				return muCOSAHL_window_push_input(context, win, &input);
+			}
+
+			muCOSAResult muCOSAHL_window_inject_point(muCOSAHL_Context* context, muCOSAHL_Window* win, uint8_m type, int32_m x, int32_m y) {
+				muCOSAHL_Input input;
+				input.type = type;
+				input.data.point.x = x;
+				input.data.point.y = y;
+				return muCOSAHL_window_push_input(context, win, &input);
+			}
+
+			muCOSAResult muCOSAHL_window_inject_scroll(muCOSAHL_Context* context, muCOSAHL_Window* win, int32_m add) {
+				muCOSAHL_Input input;
+				input.type = MUCOSAHL_INPUT_SCROLL;
+				input.data.scroll = add;
+				return muCOSAHL_window_push_input(context, win, &input);
+			}
+
+			muCOSAResult muCOSAHL_window_inject_raw_motion(muCOSAHL_Context* context, muCOSAHL_Window* win, double dx, double dy) {
+				muCOSAHL_Input input;
+				input.type = MUCOSAHL_INPUT_RAW_MOTION;
+				input.data.motion.dx = dx;
+				input.data.motion.dy = dy;
+				return muCOSAHL_window_push_input(context, win, &input);
+			}
+
+			muCOSAResult muCOSAHL_window_inject_text(muCOSAHL_Context* context, muCOSAHL_Window* win, uint8_m* text) {
+				// Add each character as its own input, just like typing them one by one
+				muCOSAHL_Input input;
+				input.type = MUCOSAHL_INPUT_TEXT;
+				while (*text) {
+					size_m size = muCOSAHL_utf8_char_size(*text);
+					size_m i = 0;
+					for (; i < size && text[i]; ++i) {
+						input.data.text[i] = text[i];
+					}
+					input.data.text[i] = 0;
+					text += i;
+
+					muCOSAResult res = muCOSAHL_window_push_input(context, win, &input);
+					if (res != MUCOSA_SUCCESS) {
+						return res;
+					}
+				}
+				return MUCOSA_SUCCESS;
+			}
+
+			muCOSAResult muCOSAHL_window_inject_close(muCOSAHL_Context* context, muCOSAHL_Window* win) {
+				muCOSAHL_Input input;
+				input.type = MUCOSAHL_INPUT_CLOSE;
+				return muCOSAHL_window_push_input(context, win, &input);
+			}
+
+		/* Replay */
+
+			// Converts a recorded event (or the end of an update) to the input that
+			// would lead to it
+			void muCOSAHL_replay_convert(uint8_m type, muEvent* event, muCOSAHL_Input* input) {
+				input->time = event->time;
+				switch (type) {
+					default: input->type = MUCOSAHL_INPUT_UPDATE; break;
+					case MU_EVENT_DIMENSIONS: {
+						input->type = MUCOSAHL_INPUT_DIMENSIONS;
+						input->data.point.x = (int32_m)event->data.dimensions.width;
+						input->data.point.y = (int32_m)event->data.dimensions.height;
+					} break;
+					case MU_EVENT_POSITION: {
+						input->type = MUCOSAHL_INPUT_POSITION;
+						input->data.point.x = event->data.position.x;
+						input->data.point.y = event->data.position.y;
+					} break;
+					case MU_EVENT_KEYBOARD: {
+						input->type = MUCOSAHL_INPUT_KEY;
+						input->data.key.key = (uint16_m)event->data.keyboard.key;
+						input->data.key.status = event->data.keyboard.status;
+					} break;
+					case MU_EVENT_KEYSTATE: {
+						input->type = MUCOSAHL_INPUT_KEYSTATE;
+						input->data.key.key = (uint16_m)event->data.keystate.state;
+						input->data.key.status = event->data.keystate.status;
+					} break;
+					case MU_EVENT_MOUSE_KEY: {
+						input->type = MUCOSAHL_INPUT_MOUSE_KEY;
+						input->data.key.key = (uint16_m)event->data.mouse_key.key;
+						input->data.key.status = event->data.mouse_key.status;
+					} break;
+					case MU_EVENT_CURSOR: {
+						input->type = MUCOSAHL_INPUT_CURSOR;
+						input->data.point.x = event->data.cursor.x;
+						input->data.point.y = event->data.cursor.y;
+					} break;
+					case MU_EVENT_SCROLL: {
+						input->type = MUCOSAHL_INPUT_SCROLL;
+						input->data.scroll = event->data.scroll;
+					} break;
+					case MU_EVENT_TEXT: {
+						input->type = MUCOSAHL_INPUT_TEXT;
+						mu_memcpy(input->data.text, event->data.text, 5);
+					} break;
+					case MU_EVENT_CLOSE: {
+						input->type = MUCOSAHL_INPUT_CLOSE;
+					} break;
+					case MU_EVENT_RAW_MOTION: {
+						input->type = MUCOSAHL_INPUT_RAW_MOTION;
+						input->data.motion.dx = event->data.raw_motion.dx;
+						input->data.motion.dy = event->data.raw_motion.dy;
+					} break;
+				}
+			}
+
+			void muCOSAHL_window_replay_stop(muCOSAHL_Window* win) {
+				if (win->replay.inputs) {
+					mu_free(win->replay.inputs);
+					win->replay.inputs = 0;
+				}
+			}
+
+			muCOSAResult muCOSAHL_window_replay_start(muCOSAHL_Context* context, muCOSAHL_Window* win, const char* path, muBool realtime) {
+				// Read file
+				uint8_m* data;
+				size_m len;
+				muCOSAResult res = muCOSA_recording_read_file(path, &data, &len);
+				if (res != MUCOSA_SUCCESS) {
+					return res;
+				}
+
+				// Check signature + version
+				if (len < 9 || mu_memcmp(data, "muCOSArc", 8) != 0 || data[8] != MUCOSA_RECORD_VERSION) {
+					mu_free(data);
+					return MUCOSA_FAILED_INVALID_RECORDING;
+				}
+
+				// Count records
+				size_m count = 0;
+				size_m pos = 9;
+				uint8_m type;
+				muEvent event;
+				while (pos < len) {
+					if (!muCOSA_recording_read(data, len, &pos, &type, &event)) {
+						mu_free(data);
+						return MUCOSA_FAILED_INVALID_RECORDING;
+					}
+					++count;
+				}
+
+				// Convert each record to input
+				muCOSAHL_Input* inputs = 0;
+				if (count > 0) {
+					inputs = (muCOSAHL_Input*)mu_malloc(count * sizeof(muCOSAHL_Input));
+					if (!inputs) {
+						mu_free(data);
+						return MUCOSA_FAILED_MALLOC;
+					}
+				}
+				pos = 9;
+				for (size_m i = 0; i < count; ++i) {
+					muCOSA_recording_read(data, len, &pos, &type, &event);
+					muCOSAHL_replay_convert(type, &event, &inputs[i]);
+				}
+				mu_free(data);
+
+				// Replace previous replay
+				muCOSAHL_window_replay_stop(win);
+				if (!inputs) {
+					return MUCOSA_SUCCESS;
+				}
+				win->replay.inputs = inputs;
+				win->replay.len = count;
+				win->replay.next = 0;
+				win->replay.start = muCOSAHL_time_get(context);
+				win->replay.realtime = realtime;
+				return MUCOSA_SUCCESS;
+			}
+
+			// Injects the next part of a replay, as done before each update
+			void muCOSAHL_window_replay_inject(muCOSAHL_Context* context, muCOSAHL_Window* win) {
+				muCOSAHL_Replay* replay = &win->replay;
+				if (!replay->inputs) {
+					return;
+				}
+
+				// Real-time: everything that happened up to now
+				// Otherwise: everything up to and including the end of the next update
+				double elapsed = muCOSAHL_time_get(context) - replay->start;
+				while (replay->next < replay->len) {
+					muCOSAHL_Input input = replay->inputs[replay->next];
+					if (replay->realtime && input.time > elapsed) {
+						break;
+					}
+					++replay->next;
+					if (input.type == MUCOSAHL_INPUT_UPDATE) {
+						if (replay->realtime) {
+							continue;
+						}
+						break;
+					}
+
+					// Inject at the time it was recorded relative to the start
+					input.time += replay->start;
+					if (muCOSAHL_window_add_input(win, &input) != MUCOSA_SUCCESS) {
+						break;
+					}
+				}
+
+				// Finish once everything has been injected
+				if (replay->next == replay->len) {
+					muCOSAHL_window_replay_stop(win);
+				}
+			}
+
+		/* Main loop */
+
+			muBool muCOSAHL_window_get_closed(muCOSAHL_Window* win) {
+				return win->states.closed;
+			}
+
+			void muCOSAHL_window_close(muCOSAHL_Window* win) {
+				// Set closed flag
+				win->states.closed = MU_TRUE;
+			}
+
+			void muCOSAHL_window_update(muCOSAHL_Context* context, muCOSAHL_Window* win) {
+				// Inject next part of replay
+				muCOSAHL_window_replay_inject(context, win);
+
+				// Process injected input in the order it was given; input injected by
+				// callbacks during this gets processed in this update as well (each
+				// piece is copied out first, since injecting can reallocate the queue)
+				for (size_m i = 0; i < win->input_len; ++i) {
+					muCOSAHL_Input input = win->inputs[i];
+					muCOSAHL_window_handle_input(win, &input);
+				}
+				win->input_len = 0;
+				// Deliver coalesced changes
+				muCOSA_coalesce_flush(&win->coalesce, win, &win->callbacks, &win->events);
+				// Mark end of update in recording
+				muCOSA_recording_write_update(&win->events.recording, muCOSAHL_time_get(context));
+
+				// Frame callback
+				if (win->callbacks.frame) {
+					win->callbacks.frame(win);
+				}
+			}
+
+			void muCOSAHL_context_update(muCOSAHL_Context* context) {
+				// There's nothing shared between windows to process; just update each
+				// unclosed window
+				for (size_m i = 0; i < context->windows.wincount; ++i) {
+					muCOSAHL_Window* win = (muCOSAHL_Window*)context->windows.windows[i];
+					if (win && !win->states.closed) {
+						// (Windows can be used by other threads without the context
+						// being locked on the headless window system)
+						#ifdef MUCOSA_THREAD_SAFE
+						muCOSA_lock(&win->lock);
+						#endif
+						muCOSAHL_window_update(context, win);
+						#ifdef MUCOSA_THREAD_SAFE
+						muCOSA_unlock(&win->lock);
+						#endif
+					}
+				}
+			}
+
+			void muCOSAHL_window_wait(muCOSAHL_Context* context, muCOSAHL_Window* win, double timeout) {
+				// Injected input that hasn't been processed is there immediately
+				if (win->input_len > 0) {
+					return;
+				}
+				// Otherwise, no input can come in while waiting, so wait out the
+				// entire timeout (which just advances the clock)
+				muCOSAHL_sleep(context, timeout);
+			}
+
+		/* Title */
+
+			muCOSAResult muCOSAHL_window_set_title(muCOSAHL_Window* win, char* data) {
+				// There's nothing to show the title on
+				return MUCOSA_SUCCESS;
+				if (win) {} if (data) {}
+			}
+
+		/* Dimensions */
+
+			muCOSAResult muCOSAHL_window_get_dimensions(muCOSAHL_Window* win, uint32_m* data) {
+				data[0] = win->props.width;
+				data[1] = win->props.height;
+				return MUCOSA_SUCCESS;
+			}
+
+			muCOSAResult muCOSAHL_window_set_dimensions(muCOSAHL_Window* win, uint32_m* data) {
+				win->props.width = data[0];
+				win->props.height = data[1];
+				return MUCOSA_SUCCESS;
+			}
+
+		/* Position */
+
+			muCOSAResult muCOSAHL_window_get_position(muCOSAHL_Window* win, int32_m* data) {
+				data[0] = win->props.x;
+				data[1] = win->props.y;
+				return MUCOSA_SUCCESS;
+			}
+
+			muCOSAResult muCOSAHL_window_set_position(muCOSAHL_Window* win, int32_m* data) {
+				win->props.x = data[0];
+				win->props.y = data[1];
+				return MUCOSA_SUCCESS;
+			}
+
+		/* Keymaps */
+
+			muCOSAResult muCOSAHL_window_get_keyboard_map(muCOSAHL_Window* win, muBool** data) {
+				// Point to keyboard keymap
+				*data = win->keymaps.keyboard;
+				return MUCOSA_SUCCESS;
+			}
+
+			muCOSAResult muCOSAHL_window_get_keystate_map(muCOSAHL_Window* win, muBool** data) {
+				// Point to keystate keymap
+				*data = win->keymaps.keystates;
+				return MUCOSA_SUCCESS;
+			}
+
+			muCOSAResult muCOSAHL_window_get_mouse_map(muCOSAHL_Window* win, muBool** data) {
+				// Point to mouse keymap
+				*data = win->keymaps.mouse;
+				return MUCOSA_SUCCESS;
+			}
+
+		/* Cursor */
+
+			muCOSAResult muCOSAHL_window_get_cursor_pos(muCOSAHL_Window* win, int32_m* data) {
+				data[0] = win->props.cursor_x;
+				data[1] = win->props.cursor_y;
+				return MUCOSA_SUCCESS;
+			}
+
+			muCOSAResult muCOSAHL_window_set_cursor_pos(muCOSAHL_Window* win, int32_m* data) {
+				win->props.cursor_x = data[0];
+				win->props.cursor_y = data[1];
+				return MUCOSA_SUCCESS;
+			}
+
+			muCOSAResult muCOSAHL_window_get_cursor_style(muCOSAHL_Window* win, muCursorStyle* data) {
+				*data = win->states.cursor_style;
+				return MUCOSA_SUCCESS;
+			}
+
+			muCOSAResult muCOSAHL_window_set_cursor_style(muCOSAHL_Window* win, muCursorStyle* data) {
+				win->states.cursor_style = *data;
+				return MUCOSA_SUCCESS;
+			}
+
+		/* Scroll */
+
+			void muCOSAHL_window_get_scroll(muCOSAHL_Window* win, int32_m* data) {
+				// Give scroll level
+				*data = win->props.scroll_level;
+			}
+
+			void muCOSAHL_window_set_scroll(muCOSAHL_Window* win, int32_m* data) {
+				// Overwrite scroll level
+				win->props.scroll_level = *data;
+			}
+
+		/* Event time */
+
+			void muCOSAHL_window_get_event_time(muCOSAHL_Window* win, double* data) {
+				// Give time of the most recent event
+				*data = win->events.time;
+			}
+
+		/* Raw motion */
+
+			void muCOSAHL_window_get_raw_motion(muCOSAHL_Window* win, muBool* data) {
+				*data = win->states.raw_motion;
+			}
+
+			muCOSAResult muCOSAHL_window_set_raw_motion(muCOSAHL_Window* win, muBool* data) {
+				// Raw motion only comes from injection, so just store it
+				win->states.raw_motion = *data;
+				return MUCOSA_SUCCESS;
+			}
+
+		/* Pointer lock */
+
+			void muCOSAHL_window_get_pointer_lock(muCOSAHL_Window* win, muBool* data) {
+				*data = win->states.pointer_lock;
+			}
+
+			muCOSAResult muCOSAHL_window_set_pointer_lock(muCOSAHL_Window* win, muBool* data) {
+				// There's no pointer to lock, so just store it
+				win->states.pointer_lock = *data;
+				return MUCOSA_SUCCESS;
+			}
+
+		/* Callbacks */
+
+			void muCOSAHL_window_set_callback(muCOSAHL_Window* win, muWindowAttrib attrib, void* fun) {
+				switch (attrib) {
+					case MU_WINDOW_DIMENSIONS_CALLBACK: {
+						mu_memcpy(&win->callbacks.dimensions, fun, sizeof(win->callbacks.dimensions));
+					} break;
+					case MU_WINDOW_POSITION_CALLBACK: {
+						mu_memcpy(&win->callbacks.position, fun, sizeof(win->callbacks.position));
+					} break;
+					case MU_WINDOW_KEYBOARD_CALLBACK: {
+						mu_memcpy(&win->callbacks.keyboard, fun, sizeof(win->callbacks.keyboard));
+					} break;
+					case MU_WINDOW_KEYSTATE_CALLBACK: {
+						mu_memcpy(&win->callbacks.keystate, fun, sizeof(win->callbacks.keystate));
+					} break;
+					case MU_WINDOW_MOUSE_KEY_CALLBACK: {
+						mu_memcpy(&win->callbacks.mouse_key, fun, sizeof(win->callbacks.mouse_key));
+					} break;
+					case MU_WINDOW_CURSOR_CALLBACK: {
+						mu_memcpy(&win->callbacks.cursor, fun, sizeof(win->callbacks.cursor));
+					} break;
+					case MU_WINDOW_SCROLL_CALLBACK: {
+						mu_memcpy(&win->callbacks.scroll, fun, sizeof(win->callbacks.scroll));
+					} break;
+					case MU_WINDOW_FRAME_CALLBACK: {
+						mu_memcpy(&win->callbacks.frame, fun, sizeof(win->callbacks.frame));
+					} break;
+					case MU_WINDOW_RAW_MOTION_CALLBACK: {
+						mu_memcpy(&win->callbacks.raw_motion, fun, sizeof(win->callbacks.raw_motion));
+					} break;
+				}
+			}
+
+		/* Text input */
+
+			void muCOSAHL_window_get_text_input(muCOSAResult* result, muCOSAHL_Window* win, uint32_m cx, uint32_m cy, void (*callback)(muWindow, uint8_m*)) {
+				// Set callback
+				win->props.text_input_callback = callback;
+				// Set text cursor position
+				win->props.text_cursor_x = cx;
+				win->props.text_cursor_y = cy;
+				return; if (result) {}
+			}
+
+			void muCOSAHL_window_let_text_input(muCOSAHL_Window* win) {
+				// Set callback to nothing
+				win->props.text_input_callback = 0;
+			}
+
+			void muCOSAHL_window_update_text_cursor(muCOSAResult* result, muCOSAHL_Window* win, uint32_m cx, uint32_m cy) {
+				// Do nothing if text input isn't being taken
+				if (!win->props.text_input_callback) {
+					return;
+				}
+
+				win->props.text_cursor_x = cx;
+				win->props.text_cursor_y = cy;
+				return; if (result) {}
+			}
+
+		/* OpenGL */
+
+		// Headless windows can't be rendered to, but offscreen OpenGL contexts
+		// can still be created with EGL, using a display that doesn't need a
+		// window system (such as Mesa's surfaceless platform)
+		#ifdef MU_SUPPORT_OPENGL
+
+			void* muCOSAHL_gl_offscreen_create(muCOSAHL_Context* context, muCOSAResult* result, muPixelFormat* format, muGraphicsAPI api) {
+				#ifdef MUCOSA_EGL
+				// Initialize EGL for the surfaceless platform (falls back on the default display)
+				muCOSAResult res = muCOSAEGL_display_init(&context->egl, MUCOSAEGL_PLATFORM_SURFACELESS_MESA, 0);
+				if (res != MUCOSA_SUCCESS) {
+					MU_SET_RESULT(result, res)
+					return 0;
+				}
+
+				// Create OpenGL context
+				return muCOSAEGL_gl_offscreen_create(&context->egl, result, format, api);
+
+				#else
+				MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_GRAPHICS_API)
+				return 0;
+				if (context) {} if (format) {} if (api) {}
+				#endif
+			}
+
+			void muCOSAHL_gl_context_destroy(void* gl) {
+				#ifdef MUCOSA_EGL
+				muCOSAEGL_gl_context_destroy((muCOSAEGL_GL*)gl);
+				#else
+				if (gl) {}
+				#endif
+			}
+
+			muCOSAResult muCOSAHL_gl_bind(muCOSAHL_Context* context, void* gl) {
+				#ifdef MUCOSA_EGL
+				return muCOSAEGL_gl_bind(&context->egl, (muCOSAEGL_GL*)gl);
+				#else
+				return MUCOSA_FAILED_UNSUPPORTED_GRAPHICS_API;
+				if (context) {} if (gl) {}
+				#endif
+			}
+
+			void* muCOSAHL_gl_get_proc_address(const char* name) {
+				#ifdef MUCOSA_EGL
+				return muCOSAEGL_gl_get_proc_address(name);
+				#else
+				return 0;
+				if (name) {}
+				#endif
+			}
+
+		#endif /* MU_SUPPORT_OPENGL */
+
+	#endif /* MUCOSA_HEADLESS */
+
+	/* Inner */
+
+		#ifdef MUCOSA_EVENT_THREAD
+		// Event thread of a context (see "Thread safety" below)
+		struct muCOSA_EventThread {
+			#ifdef _WIN32
+			HANDLE handle;
+			DWORD id;
+			#else
+			pthread_t handle;
+			#endif
+			// Raised after every round of handling events, waking threads waiting
+			// on them
+			muCOSA_Signal handoff;
+			// Raised to wake the thread itself on the headless window system,
+			// which has no connection to wait on
+			muCOSA_Signal wake;
+			// If the thread should stop (loaded/stored atomically)
+			size_m stop;
+			// If the thread failed to get ready
+			muBool failed;
+			// The context that owns the thread
+			muCOSAContext* context;
+		};
+		typedef struct muCOSA_EventThread muCOSA_EventThread;
+		#endif
+
+		// Inner struct
+		struct muCOSA_Inner {
+			muWindowSystem system;
+			void* context;
+			#ifdef MUCOSA_THREAD_SAFE
+			muCOSA_Lock lock;
+			#endif
+			#ifdef MUCOSA_EVENT_THREAD
+			muCOSA_EventThread thread;
+			#endif
+		};
+		typedef struct muCOSA_Inner muCOSA_Inner;
+
+		// Determines the best window system
+		muWindowSystem muCOSA_best_window_system(void) {
+			// Wayland if there's a compositor to connect to
+			#if defined(MUCOSA_WAYLAND)
+				if (getenv("WAYLAND_DISPLAY")) {
+					return MU_WINDOW_WAYLAND;
+				}
+			#endif
+
+			#if defined(MUCOSA_WIN32)
+				return MU_WINDOW_WIN32;
+			#elif defined(MUCOSA_X11)
+				return MU_WINDOW_X11;
+			#elif defined(MUCOSA_WAYLAND)
+				return MU_WINDOW_WAYLAND;
+			#else
+				return 0;
+			#endif
+		}
+
+		// Creates a valid inner struct based on the requested system
+		muCOSAResult muCOSA_inner_create(muCOSA_Inner* inner, muWindowSystem system) {
+			// Find best window system
+			if (system == 0) {
+				system = muCOSA_best_window_system();
+			}
+			inner->system = system;
+
+			// Create context based on system
+			switch (system) {
+				// Unknown/Unsupported/None supported:
+				default: return MUCOSA_FAILED_NULL_WINDOW_SYSTEM; break;
+
+				// Win32
+				MUCOSA_WIN32_CALL(
+					case MU_WINDOW_WIN32: {
+						// Allocate context
+						inner->context = mu_malloc(sizeof(muCOSAW32_Context));
+						if (!inner->context) {
+							return MUCOSA_FAILED_MALLOC;
+						}
+
+						// Create context
+						muCOSAResult res = muCOSAW32_context_init((muCOSAW32_Context*)inner->context);
+						if (muCOSA_result_is_fatal(res)) {
+							mu_free(inner->context);
+						}
+						return res;
+					} break;
+				)
+
+				// X11
+				MUCOSA_X11_CALL(
+					case MU_WINDOW_X11: {
+						// Allocate context
+						inner->context = mu_malloc(sizeof(muCOSAX11_Context));
+						if (!inner->context) {
+							return MUCOSA_FAILED_MALLOC;
+						}
+
+						// Create context
+						muCOSAResult res = muCOSAX11_context_init((muCOSAX11_Context*)inner->context);
+						if (muCOSA_result_is_fatal(res)) {
+							mu_free(inner->context);
+						}
+						return res;
+					} break;
+				)
+
+				// Wayland
+				MUCOSA_WAYLAND_CALL(
+					case MU_WINDOW_WAYLAND: {
+						// Allocate context
+						inner->context = mu_malloc(sizeof(muCOSAWL_Context));
+						if (!inner->context) {
+							return MUCOSA_FAILED_MALLOC;
+						}
+
+						// Create context
+						muCOSAResult res = muCOSAWL_context_init((muCOSAWL_Context*)inner->context);
+						if (muCOSA_result_is_fatal(res)) {
+							mu_free(inner->context);
+						}
+						return res;
+					} break;
+				)
+
+				// Headless
+				MUCOSA_HEADLESS_CALL(
+					case MU_WINDOW_HEADLESS: {
+						// Allocate context
+						inner->context = mu_malloc(sizeof(muCOSAHL_Context));
+						if (!inner->context) {
+							return MUCOSA_FAILED_MALLOC;
+						}
+
+						// Create context
+						muCOSAResult res = muCOSAHL_context_init((muCOSAHL_Context*)inner->context);
+						if (muCOSA_result_is_fatal(res)) {
+							mu_free(inner->context);
+						}
+						return res;
+					} break;
+				)
+			}
+		}
+
+		// Destroys inner struct based on system
+		void muCOSA_inner_destroy(muCOSA_Inner* inner) {
+			switch (MUCOSA_SYSTEM(inner)) {
+				default: break;
+
+				// Win32
+				MUCOSA_WIN32_CALL(
+					case MU_WINDOW_WIN32: {
+						// Destroy context
+						muCOSAW32_context_term((muCOSAW32_Context*)inner->context);
+					} break;
+				)
+
+				// X11
+				MUCOSA_X11_CALL(
+					case MU_WINDOW_X11: {
+						// Destroy context
+						muCOSAX11_context_term((muCOSAX11_Context*)inner->context);
+						// Free context memory
+						mu_free(inner->context);
+					} break;
+				)
+
+				// Wayland
+				MUCOSA_WAYLAND_CALL(
+					case MU_WINDOW_WAYLAND: {
+						// Destroy context
+						muCOSAWL_context_term((muCOSAWL_Context*)inner->context);
+						// Free context memory
+						mu_free(inner->context);
+					} break;
+				)
+
+				// Headless
+				MUCOSA_HEADLESS_CALL(
+					case MU_WINDOW_HEADLESS: {
+						// Destroy context
+						muCOSAHL_context_term((muCOSAHL_Context*)inner->context);
+						// Free context memory
+						mu_free(inner->context);
+					} break;
+				)
+			}
+		}
+
+	// Name call macro
+	#ifdef MUCOSA_NAMES
+		#define MUCOSA_NAME_CALL(...) __VA_ARGS__
+	#else
+		#define MUCOSA_NAME_CALL(...)
+	#endif
+
+	// Unlocked name of a public function; in thread-safe mode, public functions
+	// are defined under this name, and wrapped by functions that lock them (see
+	// "Thread safety" below)
+	#ifdef MUCOSA_THREAD_SAFE
+		#define MUCOSA_UNLOCKED(name) name##_unlocked
+	#else
+		#define MUCOSA_UNLOCKED(name) name
+	#endif
+
+	// Starting and stopping a context's event thread (also see "Thread safety"
+	// below)
+	#ifdef MUCOSA_EVENT_THREAD
+		muCOSAResult muCOSATS_event_thread_start(muCOSAContext* context);
+		void muCOSATS_event_thread_stop(muCOSAContext* context);
+	#endif
+
+	/* Context */
+
+		MUDEF void muCOSA_context_create(muCOSAContext* context, muWindowSystem system, muBool set_context) {
+			// Allocate context
+			context->inner = mu_malloc(sizeof(muCOSA_Inner));
+			if (!context->inner) {
+				context->result = MUCOSA_FAILED_MALLOC;
+				return;
+			}
+
+			// Create context
+			context->result = muCOSA_inner_create((muCOSA_Inner*)context->inner, system);
+			if (muCOSA_result_is_fatal(context->result)) {
+				mu_free(context->inner);
+				return;
+			}
+
+			// Create lock
+			#ifdef MUCOSA_THREAD_SAFE
+			if (!muCOSA_lock_init(&((muCOSA_Inner*)context->inner)->lock)) {
+				muCOSA_inner_destroy((muCOSA_Inner*)context->inner);
+				mu_free(context->inner);
+				context->result = MUCOSA_FAILED_CREATE_LOCK;
+				return;
+			}
+			#endif
+
+			// Start event thread
+			#ifdef MUCOSA_EVENT_THREAD
+			muCOSAResult res = muCOSATS_event_thread_start(context);
+			if (res != MUCOSA_SUCCESS) {
+				muCOSA_lock_term(&((muCOSA_Inner*)context->inner)->lock);
+				muCOSA_inner_destroy((muCOSA_Inner*)context->inner);
+				mu_free(context->inner);
+				context->result = res;
+				return;
+			}
+			#endif
+
+			// Set context if necessary
+			if (set_context) {
+				muCOSA_context_set(context);
+			}
+		}
+
+		MUDEF void muCOSA_context_destroy(muCOSAContext* context) {
+			// Free and destroy if inner contents exist
+			if (context->inner) {
+				// (The event thread is stopped first, as it uses the context)
+				#ifdef MUCOSA_EVENT_THREAD
+				muCOSATS_event_thread_stop(context);
+				#endif
+				muCOSA_inner_destroy((muCOSA_Inner*)context->inner);
+				#ifdef MUCOSA_THREAD_SAFE
+				muCOSA_lock_term(&((muCOSA_Inner*)context->inner)->lock);
+				#endif
+				mu_free(context->inner);
+			}
+		}
+
+		// Global context (thread-local if MUCOSA_THREAD_LOCAL_CONTEXT is defined)
+		MUCOSA_THREAD_LOCAL muCOSAContext* muCOSA_global_context = 0;
+
+		// Set context
+		MUDEF void muCOSA_context_set(muCOSAContext* context) {
+			muCOSA_global_context = context;
+		}
+
+		// Get window system
+		MUDEF muWindowSystem muCOSA_context_get_window_system(muCOSAContext* context) {
+			return ((muCOSA_Inner*)context->inner)->system;
+		}
+
+		// Wake
+		MUDEF void muCOSA_context_wake(muCOSAContext* context) {
+			// Get inner from context
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+
+			// Wake threads waiting on the event thread, along with the event
+			// thread itself on the headless window system
+			#ifdef MUCOSA_EVENT_THREAD
+			muCOSA_signal_raise(&inner->thread.handoff);
+			muCOSA_signal_raise(&inner->thread.wake);
+			#endif
+
+			// Do things based on window system
+			switch (MUCOSA_SYSTEM(inner)) {
+				default: return; break;
+
+				// Win32
+				MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+					muCOSAW32_Context* w32 = (muCOSAW32_Context*)inner->context;
+					if (w32->wake) {
+						SetEvent(w32->wake);
+					}
+					return;
+				} break;)
+
+				// X11
+				MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+					muCOSAPOSIX_wake(&((muCOSAX11_Context*)inner->context)->wake);
+					return;
+				} break;)
+
+				// Wayland
+				MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+					muCOSAPOSIX_wake(&((muCOSAWL_Context*)inner->context)->wake);
+					return;
+				} break;)
+
+				// Headless (waiting never blocks)
+				MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+					return;
+				} break;)
+			}
+		}
+
+		// Get file descriptor
+		MUDEF int muCOSA_context_get_fd(muCOSAContext* context, muCOSAResult* result) {
+			// Get inner from context
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+
+			// Do things based on window system
+			switch (MUCOSA_SYSTEM(inner)) {
+				default: MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_FEATURE) return -1; break;
+
+				// X11
+				MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+					return ConnectionNumber(((muCOSAX11_Context*)inner->context)->display);
+				} break;)
+
+				// Wayland
+				MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+					return wl_display_get_fd(((muCOSAWL_Context*)inner->context)->display);
+				} break;)
+			}
+		}
+
+		// Dispatch pending
+		MUDEF void MUCOSA_UNLOCKED(muCOSA_context_dispatch_pending)(muCOSAContext* context, muCOSAResult* result) {
+			// Get inner from context
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+
+			// Do things based on window system
+			switch (MUCOSA_SYSTEM(inner)) {
+				default: return; break;
+
+				// Win32
+				MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+					muCOSAW32_dispatch();
+					return;
+				} break;)
+
+				// X11
+				MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+					muCOSAX11_dispatch((muCOSAX11_Context*)inner->context);
+					return;
+				} break;)
+
+				// Wayland
+				MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+					muCOSAWL_dispatch((muCOSAWL_Context*)inner->context);
+					return;
+				} break;)
+
+				// Headless (injected input is processed upon updating)
+				MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+					return;
+				} break;)
+			}
+
+			// To avoid unused parameter warnings in some cases
+			if (result) {}
+		}
+
+	/* Window */
+
+		/* Creation / Destruction */
+
+			MUDEF muWindow MUCOSA_UNLOCKED(muCOSA_window_create)(muCOSAContext* context, muCOSAResult* result, muWindowInfo* info) {
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+
+				// Do thing based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: return 0; break;
+
+					// Win32
+					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32 : {
+						// Allocate window memory
+						muCOSAW32_Window* win = (muCOSAW32_Window*)mu_malloc(sizeof(muCOSAW32_Window));
+						if (!win) {
+							MU_SET_RESULT(result, MUCOSA_FAILED_MALLOC)
+							return 0;
+						}
+
+						// Create event queue + set coalescing
+						muCOSAResult res = muCOSA_event_queue_create(&win->events, info->event_capacity);
+						muCOSA_coalesce_init(&win->coalesce, info->coalesce);
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+							mu_free(win);
+							return 0;
+						}
+
+						// Give window what it needs to handle messages on the event thread
+						// (which can happen during creation)
+						MUCOSA_EVENT_THREAD_CALL(
+							win->context_lock = &inner->lock;
+							win->handoff = &inner->thread.handoff;
+						)
+
+						// Create window
+						res = muCOSAW32_window_create((muCOSAW32_Context*)inner->context, info, win);
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+							if (muCOSA_result_is_fatal(res)) {
+								muCOSA_event_queue_destroy(&win->events);
+								mu_free(win);
+								MU_SET_RESULT(result, res)
+								return 0;
+							}
+						}
+						return win;
+					} break;)
+
+					// X11
+					MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+						// Allocate window memory
+						muCOSAX11_Window* win = (muCOSAX11_Window*)mu_malloc(sizeof(muCOSAX11_Window));
+						if (!win) {
+							MU_SET_RESULT(result, MUCOSA_FAILED_MALLOC)
+							return 0;
+						}
+
+						// Create event queue + set coalescing
+						muCOSAResult res = muCOSA_event_queue_create(&win->events, info->event_capacity);
+						muCOSA_coalesce_init(&win->coalesce, info->coalesce);
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+							mu_free(win);
+							return 0;
+						}
+
+						// Create window
+						res = muCOSAX11_window_create((muCOSAX11_Context*)inner->context, info, win);
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+							if (muCOSA_result_is_fatal(res)) {
+								muCOSA_event_queue_destroy(&win->events);
+								mu_free(win);
+								return 0;
+							}
+						}
+						return win;
+					} break;)
+
+					// Wayland
+					MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+						// Allocate window memory
+						muCOSAWL_Window* win = (muCOSAWL_Window*)mu_malloc(sizeof(muCOSAWL_Window));
+						if (!win) {
+							MU_SET_RESULT(result, MUCOSA_FAILED_MALLOC)
+							return 0;
+						}
+
+						// Create event queue + set coalescing
+						muCOSAResult res = muCOSA_event_queue_create(&win->events, info->event_capacity);
+						muCOSA_coalesce_init(&win->coalesce, info->coalesce);
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+							mu_free(win);
+							return 0;
+						}
+
+						// Create window
+						res = muCOSAWL_window_create((muCOSAWL_Context*)inner->context, info, win);
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+							if (muCOSA_result_is_fatal(res)) {
+								muCOSA_event_queue_destroy(&win->events);
+								mu_free(win);
+								return 0;
+							}
+						}
+						return win;
+					} break;)
+
+					// Headless
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						// Allocate window memory
+						muCOSAHL_Window* win = (muCOSAHL_Window*)mu_malloc(sizeof(muCOSAHL_Window));
+						if (!win) {
+							MU_SET_RESULT(result, MUCOSA_FAILED_MALLOC)
+							return 0;
+						}
+
+						// Create event queue + set coalescing
+						muCOSAResult res = muCOSA_event_queue_create(&win->events, info->event_capacity);
+						muCOSA_coalesce_init(&win->coalesce, info->coalesce);
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+							mu_free(win);
+							return 0;
+						}
+
+						// Create window
+						res = muCOSAHL_window_create((muCOSAHL_Context*)inner->context, info, win);
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+							if (muCOSA_result_is_fatal(res)) {
+								muCOSA_event_queue_destroy(&win->events);
+								mu_free(win);
+								return 0;
+							}
+						}
+						return win;
+					} break;)
+				}
+
+				// To avoid unused parameter warnings in some cases
+				if (result) {} if (info) {}
+			}
+
+			MUDEF muWindow MUCOSA_UNLOCKED(muCOSA_window_destroy)(muCOSAContext* context, muWindow win) {
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: return 0; break;
+
+					// Win32
+					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+						// Destroy window
+						muCOSAW32_window_destroy((muCOSAW32_Context*)inner->context, (muCOSAW32_Window*)win);
+						// Destroy event queue
+						muCOSA_event_queue_destroy(&((muCOSAW32_Window*)win)->events);
+						// Free memory
+						mu_free(win);
+						return 0;
+					} break;)
+
+					// X11
+					MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+						// Destroy window
+						muCOSAX11_window_destroy((muCOSAX11_Context*)inner->context, (muCOSAX11_Window*)win);
+						// Destroy event queue
+						muCOSA_event_queue_destroy(&((muCOSAX11_Window*)win)->events);
+						// Free memory
+						mu_free(win);
+						return 0;
+					} break;)
+
+					// Wayland
+					MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+						// Destroy window
+						muCOSAWL_window_destroy((muCOSAWL_Context*)inner->context, (muCOSAWL_Window*)win);
+						// Destroy event queue
+						muCOSA_event_queue_destroy(&((muCOSAWL_Window*)win)->events);
+						// Free memory
+						mu_free(win);
+						return 0;
+					} break;)
+
+					// Headless
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						// Destroy window
+						muCOSAHL_window_destroy((muCOSAHL_Context*)inner->context, (muCOSAHL_Window*)win);
+						// Destroy event queue
+						muCOSA_event_queue_destroy(&((muCOSAHL_Window*)win)->events);
+						// Free memory
+						mu_free(win);
+						return 0;
+					} break;)
+				}
+
+				// To avoid unused parameter warnings in some cases
+				if (win) {}
+			}
+
+		/* Main loop */
+
+			MUDEF muBool MUCOSA_UNLOCKED(muCOSA_window_get_closed)(muCOSAContext* context, muCOSAResult* result, muWindow win) {
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: return 0; break;
+
+					// Win32
+					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+						return muCOSAW32_window_get_closed((muCOSAW32_Window*)win);
+					} break;)
+
+					// X11
+					MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+						return muCOSAX11_window_get_closed((muCOSAX11_Window*)win);
+					} break;)
+
+					// Wayland
+					MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+						return muCOSAWL_window_get_closed((muCOSAWL_Window*)win);
+					} break;)
 
-					return res;
+					// Headless
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						return muCOSAHL_window_get_closed((muCOSAHL_Window*)win);
+					} break;)
 				}
 
-		#endif /* MU_SUPPORT_OPENGL */
+				// To avoid unused parameter warnings in some cases
+				if (result) {} if (win) {}
+			}
 
-		/* Time */
+			MUDEF void MUCOSA_UNLOCKED(muCOSA_window_close)(muCOSAContext* context, muWindow win) {
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-			struct muCOSAW32_Time {
-				// @DOCLINE The original time the context was created.
-				double orig_time;
-				// @DOCLINE The non-overwritable time.
-				double fixed_time;
-			};
-			typedef struct muCOSAW32_Time muCOSAW32_Time;
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: return; break;
 
-			// https://stackoverflow.com/questions/1695288/getting-the-current-time-in-milliseconds-from-the-system-clock-in-windows
-			double muCOSAW32_get_current_time(void) {
-				// Get system time
-				FILETIME file_time;
-				GetSystemTimeAsFileTime(&file_time);
+					// Win32
+					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+						muCOSAW32_window_close((muCOSAW32_Window*)win);
+						return;
+					} break;)
 
-				// Format low + high time
-				LONGLONG ll_now = 
-					(LONGLONG)(file_time.dwLowDateTime) + ((LONGLONG)(file_time.dwHighDateTime) << 32LL)
-				;
-				// Return time properly divided
-				return (double)(ll_now) / (double)(1.0e7);
-			}
+					// X11
+					MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+						muCOSAX11_window_close((muCOSAX11_Window*)win);
+						return;
+					} break;)
 
-			// Initiates the time struct
-			void muCOSAW32_time_init(muCOSAW32_Time* time) {
-				// Set time to current time
-				time->orig_time = time->fixed_time = muCOSAW32_get_current_time();
+					// Wayland
+					MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+						muCOSAWL_window_close((muCOSAWL_Window*)win);
+						return;
+					} break;)
+
+					// Headless
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						muCOSAHL_window_close((muCOSAHL_Window*)win);
+						return;
+					} break;)
+				}
+
+				// To avoid unused parameter warnings in some cases
+				if (win) {}
 			}
 
-		/* Clipboard */
+			MUDEF void MUCOSA_UNLOCKED(muCOSA_window_update)(muCOSAContext* context, muCOSAResult* result, muWindow win) {
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-			uint8_m* muCOSAW32_clipboard_get(muCOSAResult* result) {
-				// Hold clipboard
-				if (!OpenClipboard(NULL)) {
-					MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_HOLD_CLIPBOARD)
-					return 0;
-				}
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: return; break;
 
-				// Get handle to clipboard data (UTF-16)
-				HANDLE data = GetClipboardData(CF_UNICODETEXT);
-				if (!data) {
-					// I'm pretty sure this can happen if no clipboard is available, so I'm not
-					// throwing an error here
-					CloseClipboard();
-					return 0;
-				}
+					// Win32
+					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+						muCOSAW32_window_update((muCOSAW32_Window*)win);
+						return;
+					} break;)
 
-				// Get clipboard data (UTF-16)
-				wchar_t* utf16 = (wchar_t*)GlobalLock(data);
-				if (!utf16) {
-					MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_GET_CLIPBOARD_DATA)
-					CloseClipboard();
-					return 0;
-				}
+					// X11
+					MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+						muCOSAX11_window_update((muCOSAX11_Context*)inner->context, (muCOSAX11_Window*)win);
+						return;
+					} break;)
 
-				// Convert UTF-16 to UTF-8
-				uint8_m* utf8 = muCOSAW32_wchar_to_utf8(utf16);
-				if (!utf8) {
-					MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_CONVERT_CLIPBOARD_DATA_FORMAT)
-					GlobalUnlock(data);
-					CloseClipboard();
-					return 0;
+					// Wayland
+					MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+						muCOSAWL_window_update((muCOSAWL_Context*)inner->context, (muCOSAWL_Window*)win);
+						return;
+					} break;)
+
+					// Headless
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						muCOSAHL_window_update((muCOSAHL_Context*)inner->context, (muCOSAHL_Window*)win);
+						return;
+					} break;)
 				}
 
-				// Close and return data
-				GlobalUnlock(data);
-				CloseClipboard();
-				return utf8;
+				// To avoid unused parameter warnings in some cases
+				if (result) {} if (win) {}
 			}
 
-			void muCOSAW32_clipboard_set(muCOSAResult* result, uint8_m* data, size_m datalen) {
-				// Get length of UTF-16 equivalent
-				int wlen = MultiByteToWideChar(CP_UTF8, 0, (LPCCH)data, datalen, NULL, 0);
-				if (!wlen) {
-					MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_CONVERT_CLIPBOARD_DATA_FORMAT)
-					return;
-				}
+			MUDEF void MUCOSA_UNLOCKED(muCOSA_context_update)(muCOSAContext* context, muCOSAResult* result) {
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-				// Allocate global memory for UTF-16 string
-				HGLOBAL g_mem = GlobalAlloc(GMEM_MOVEABLE, (SIZE_T)(wlen)*sizeof(wchar_t));
-				if (!g_mem) {
-					MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_ALLOCATE_CLIPBOARD_DATA)
-					return;
-				}
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: return; break;
 
-				// Get memory pointer
-				LPVOID p_mem = GlobalLock(g_mem);
-				if (!p_mem) {
-					MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_ALLOCATE_CLIPBOARD_DATA)
-					GlobalFree(g_mem);
-					return;
-				}
+					// Win32
+					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+						muCOSAW32_context_update((muCOSAW32_Context*)inner->context);
+						return;
+					} break;)
 
-				// Perform conversion
-				if (!MultiByteToWideChar(CP_UTF8, 0, (LPCCH)data, datalen, (LPWSTR)p_mem, wlen)) {
-					MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_CONVERT_CLIPBOARD_DATA_FORMAT)
-					GlobalUnlock(g_mem);
-					GlobalFree(g_mem);
-					return;
-				}
+					// X11
+					MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+						muCOSAX11_context_update((muCOSAX11_Context*)inner->context);
+						return;
+					} break;)
 
-				// Release memory pointer
-				GlobalUnlock(g_mem);
+					// Wayland
+					MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+						muCOSAWL_context_update((muCOSAWL_Context*)inner->context);
+						return;
+					} break;)
 
-				// Hold clipboard
-				if (!OpenClipboard(NULL)) {
-					MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_HOLD_CLIPBOARD)
-					GlobalFree(g_mem);
-					return;
+					// Headless
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						muCOSAHL_context_update((muCOSAHL_Context*)inner->context);
+						return;
+					} break;)
 				}
 
-				// Empty pre-existing clipboard data
-				if (!EmptyClipboard()) {
-					// Assuming this can get triggered if the clipboard was already empty,
-					// so no error thrown here.
+				// To avoid unused parameter warnings in some cases
+				if (result) {}
+			}
+
+			MUDEF void MUCOSA_UNLOCKED(muCOSA_window_wait)(muCOSAContext* context, muCOSAResult* result, muWindow win, double timeout) {
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: return; break;
+
+					// Win32
+					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+						muCOSAW32_window_wait((muCOSAW32_Context*)inner->context, timeout);
+						return;
+					} break;)
+
+					// X11
+					MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+						muCOSAX11_window_wait((muCOSAX11_Context*)inner->context, timeout);
+						return;
+					} break;)
+
+					// Wayland
+					MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+						muCOSAWL_window_wait((muCOSAWL_Context*)inner->context, timeout);
+						return;
+					} break;)
+
+					// Headless
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						muCOSAHL_window_wait((muCOSAHL_Context*)inner->context, (muCOSAHL_Window*)win, timeout);
+						return;
+					} break;)
 				}
 
-				// Set clipboard data
-				if (!SetClipboardData(CF_UNICODETEXT, g_mem)) {
-					MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_SET_CLIPBOARD_DATA)
-					GlobalFree(g_mem);
-					CloseClipboard();
-					return;
+				// To avoid unused parameter warnings in some cases
+				if (result) {} if (win) {} if (timeout) {}
+			}
+
+		/* Events */
+
+			MUDEF size_m MUCOSA_UNLOCKED(muCOSA_window_poll_events)(muCOSAContext* context, muWindow win, muEvent* events, size_m max) {
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: return 0; break;
+
+					// Win32
+					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+						return muCOSA_event_queue_poll(&((muCOSAW32_Window*)win)->events, events, max);
+					} break;)
+
+					// X11
+					MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+						return muCOSA_event_queue_poll(&((muCOSAX11_Window*)win)->events, events, max);
+					} break;)
+
+					// Wayland
+					MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+						return muCOSA_event_queue_poll(&((muCOSAWL_Window*)win)->events, events, max);
+					} break;)
+
+					// Headless
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						return muCOSA_event_queue_poll(&((muCOSAHL_Window*)win)->events, events, max);
+					} break;)
 				}
 
-				// Close clipboard and we're done
-				CloseClipboard();
+				// To avoid unused parameter warnings in some cases
+				if (win) {} if (events) {} if (max) {}
 			}
 
-		/* Context */
+		/* Get / Set */
 
-			struct muCOSAW32_Context {
-				muCOSAW32_Time time;
-				MUCOSA_OPENGL_CALL(muCOSAW32_WGL wgl;)
-			};
-			typedef struct muCOSAW32_Context muCOSAW32_Context;
+			MUDEF void MUCOSA_UNLOCKED(muCOSA_window_get)(muCOSAContext* context, muCOSAResult* result, muWindow win, muWindowAttrib attrib, void* data) {
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-			// Accessing/Deaccessing pointer map functions needed for contexts
-			void muCOSAW32_window_pmap_access(void);
-			void muCOSAW32_window_pmap_deaccess(void);
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: return; break;
 
-			muCOSAResult muCOSAW32_context_init(muCOSAW32_Context* context) {
-				muCOSAResult res = MUCOSA_SUCCESS;
-				// Mark newly created context for pmap
-				muCOSAW32_window_pmap_access();
-				// Initiate context time
-				muCOSAW32_time_init(&context->time);
-				// Load OpenGL extensions
-				MUCOSA_OPENGL_CALL(
-					mu_memset(&context->wgl, 0, sizeof(context->wgl));
-					res = muCOSAW32_get_opengl_extensions(&context->wgl);
-				)
+					// Win32
+					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+						muCOSAResult res = MUCOSA_SUCCESS;
+						muCOSAW32_Window* w32_win = (muCOSAW32_Window*)win;
+
+						// Do things based on attribute
+						switch (attrib) {
+							default: MU_SET_RESULT(result, MUCOSA_FAILED_UNKNOWN_WINDOW_ATTRIB) return; break;
+
+							// Dimensions
+							case MU_WINDOW_DIMENSIONS: res = muCOSAW32_window_get_dimensions(w32_win, (uint32_m*)data); break;
+							// Position
+							case MU_WINDOW_POSITION: res = muCOSAW32_window_get_position(w32_win, (int32_m*)data); break;
+							// Keyboard keymap
+							case MU_WINDOW_KEYBOARD_MAP: res = muCOSAW32_window_get_keyboard_map(w32_win, (muBool**)data); break;
+							// Keystate keymap
+							case MU_WINDOW_KEYSTATE_MAP: res = muCOSAW32_window_get_keystate_map(w32_win, (muBool**)data); break;
+							// Mouse keymap
+							case MU_WINDOW_MOUSE_MAP: res = muCOSAW32_window_get_mouse_map(w32_win, (muBool**)data); break;
+							// Scroll
+							case MU_WINDOW_SCROLL_LEVEL: muCOSAW32_window_get_scroll(w32_win, (int32_m*)data); return; break;
+							// Cursor
+							case MU_WINDOW_CURSOR: res = muCOSAW32_window_get_cursor_pos(w32_win, (int32_m*)data); break;
+							// Cursor style
+							case MU_WINDOW_CURSOR_STYLE: res = muCOSAW32_window_get_cursor_style(w32_win, (muCursorStyle*)data); break;
+							// Event time
+							case MU_WINDOW_EVENT_TIME: muCOSAW32_window_get_event_time(w32_win, (double*)data); return; break;
+							// Raw motion
+							case MU_WINDOW_RAW_MOTION: muCOSAW32_window_get_raw_motion(w32_win, (muBool*)data); return; break;
+							// Pointer lock
+							case MU_WINDOW_POINTER_LOCK: muCOSAW32_window_get_pointer_lock(w32_win, (muBool*)data); return; break;
+						}
+
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+						return;
+					} break;)
 
-				return res;
-			}
+					// X11
+					MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+						muCOSAResult res = MUCOSA_SUCCESS;
+						muCOSAX11_Window* x11_win = (muCOSAX11_Window*)win;
 
-			void muCOSAW32_context_term(muCOSAW32_Context* context) {
-				// Remove context from pmap
-				muCOSAW32_window_pmap_deaccess();
-				return; if (context) {}
-			}
+						// Do things based on attribute
+						switch (attrib) {
+							default: MU_SET_RESULT(result, MUCOSA_FAILED_UNKNOWN_WINDOW_ATTRIB) return; break;
 
-		/* Context time */
+							// Dimensions
+							case MU_WINDOW_DIMENSIONS: res = muCOSAX11_window_get_dimensions(x11_win, (uint32_m*)data); break;
+							// Position
+							case MU_WINDOW_POSITION: res = muCOSAX11_window_get_position(x11_win, (int32_m*)data); break;
+							// Keyboard keymap
+							case MU_WINDOW_KEYBOARD_MAP: res = muCOSAX11_window_get_keyboard_map(x11_win, (muBool**)data); break;
+							// Keystate keymap
+							case MU_WINDOW_KEYSTATE_MAP: res = muCOSAX11_window_get_keystate_map(x11_win, (muBool**)data); break;
+							// Mouse keymap
+							case MU_WINDOW_MOUSE_MAP: res = muCOSAX11_window_get_mouse_map(x11_win, (muBool**)data); break;
+							// Scroll
+							case MU_WINDOW_SCROLL_LEVEL: muCOSAX11_window_get_scroll(x11_win, (int32_m*)data); return; break;
+							// Cursor
+							case MU_WINDOW_CURSOR: res = muCOSAX11_window_get_cursor_pos(x11_win, (int32_m*)data); break;
+							// Cursor style
+							case MU_WINDOW_CURSOR_STYLE: res = muCOSAX11_window_get_cursor_style(x11_win, (muCursorStyle*)data); break;
+							// Event time
+							case MU_WINDOW_EVENT_TIME: muCOSAX11_window_get_event_time(x11_win, (double*)data); return; break;
+							// Raw motion
+							case MU_WINDOW_RAW_MOTION: muCOSAX11_window_get_raw_motion(x11_win, (muBool*)data); return; break;
+							// Pointer lock
+							case MU_WINDOW_POINTER_LOCK: muCOSAX11_window_get_pointer_lock(x11_win, (muBool*)data); return; break;
+						}
 
-			double muCOSAW32_fixed_time_get(muCOSAW32_Context* context) {
-				// Return the difference between now and when the context was created
-				return muCOSAW32_get_current_time() - context->time.fixed_time;
-			}
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+						return;
+					} break;)
 
-			double muCOSAW32_time_get(muCOSAW32_Context* context) {
-				// Return the difference between now and the overridable original time
-				return muCOSAW32_get_current_time() - context->time.orig_time;
-			}
+					// Wayland
+					MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+						muCOSAResult res = MUCOSA_SUCCESS;
+						muCOSAWL_Window* wl_win = (muCOSAWL_Window*)win;
 
-			void muCOSAW32_time_set(muCOSAW32_Context* context, double time) {
-				// Set time to current time minus the given time
-				context->time.orig_time = muCOSAW32_get_current_time() - time;
-			}
+						// Do things based on attribute
+						switch (attrib) {
+							default: MU_SET_RESULT(result, MUCOSA_FAILED_UNKNOWN_WINDOW_ATTRIB) return; break;
 
-		/* Sleep */
+							// Dimensions
+							case MU_WINDOW_DIMENSIONS: res = muCOSAWL_window_get_dimensions(wl_win, (uint32_m*)data); break;
+							// Position
+							case MU_WINDOW_POSITION: res = muCOSAWL_window_get_position(wl_win, (int32_m*)data); break;
+							// Keyboard keymap
+							case MU_WINDOW_KEYBOARD_MAP: res = muCOSAWL_window_get_keyboard_map(wl_win, (muBool**)data); break;
+							// Keystate keymap
+							case MU_WINDOW_KEYSTATE_MAP: res = muCOSAWL_window_get_keystate_map(wl_win, (muBool**)data); break;
+							// Mouse keymap
+							case MU_WINDOW_MOUSE_MAP: res = muCOSAWL_window_get_mouse_map(wl_win, (muBool**)data); break;
+							// Scroll
+							case MU_WINDOW_SCROLL_LEVEL: muCOSAWL_window_get_scroll(wl_win, (int32_m*)data); return; break;
+							// Cursor
+							case MU_WINDOW_CURSOR: res = muCOSAWL_window_get_cursor_pos(wl_win, (int32_m*)data); break;
+							// Cursor style
+							case MU_WINDOW_CURSOR_STYLE: res = muCOSAWL_window_get_cursor_style(wl_win, (muCursorStyle*)data); break;
+							// Event time
+							case MU_WINDOW_EVENT_TIME: muCOSAWL_window_get_event_time(wl_win, (double*)data); return; break;
+							// Raw motion
+							case MU_WINDOW_RAW_MOTION: muCOSAWL_window_get_raw_motion(wl_win, (muBool*)data); return; break;
+							// Pointer lock
+							case MU_WINDOW_POINTER_LOCK: muCOSAWL_window_get_pointer_lock(wl_win, (muBool*)data); return; break;
+						}
 
-			void muCOSAW32_sleep(double time) {
-				// Sleep for the approx. amount of milliseconds
-				Sleep((DWORD)(time*1000.0));
-			}
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+						return;
+					} break;)
 
-		/* Window structs */
+					// Headless
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						muCOSAResult res = MUCOSA_SUCCESS;
+						muCOSAHL_Window* hl_win = (muCOSAHL_Window*)win;
 
-			struct muCOSAW32_Keymaps {
-				// Keyboard keys
-				muBool keyboard[MU_KEYBOARD_LENGTH];
-				// Keystates
-				muBool keystates[MU_KEYSTATE_LENGTH];
-				// Mouse keys
-				muBool mouse[MU_MOUSE_LENGTH];
-			};
-			typedef struct muCOSAW32_Keymaps muCOSAW32_Keymaps;
+						// Do things based on attribute
+						switch (attrib) {
+							default: MU_SET_RESULT(result, MUCOSA_FAILED_UNKNOWN_WINDOW_ATTRIB) return; break;
 
-			struct muCOSAW32_WindowHandles {
-				// Window class name
-				wchar_t wclass_name[2];
-				// Hinstance
-				HINSTANCE hinstance;
-				// Window handle
-				HWND hwnd;
-				// Device context
-				HDC dc;
-				// Cursor handle
-				HCURSOR hcursor;
-				// IMM context handle
-				HIMC imc;
-			};
-			typedef struct muCOSAW32_WindowHandles muCOSAW32_WindowHandles;
+							// Dimensions
+							case MU_WINDOW_DIMENSIONS: res = muCOSAHL_window_get_dimensions(hl_win, (uint32_m*)data); break;
+							// Position
+							case MU_WINDOW_POSITION: res = muCOSAHL_window_get_position(hl_win, (int32_m*)data); break;
+							// Keyboard keymap
+							case MU_WINDOW_KEYBOARD_MAP: res = muCOSAHL_window_get_keyboard_map(hl_win, (muBool**)data); break;
+							// Keystate keymap
+							case MU_WINDOW_KEYSTATE_MAP: res = muCOSAHL_window_get_keystate_map(hl_win, (muBool**)data); break;
+							// Mouse keymap
+							case MU_WINDOW_MOUSE_MAP: res = muCOSAHL_window_get_mouse_map(hl_win, (muBool**)data); break;
+							// Scroll
+							case MU_WINDOW_SCROLL_LEVEL: muCOSAHL_window_get_scroll(hl_win, (int32_m*)data); return; break;
+							// Cursor
+							case MU_WINDOW_CURSOR: res = muCOSAHL_window_get_cursor_pos(hl_win, (int32_m*)data); break;
+							// Cursor style
+							case MU_WINDOW_CURSOR_STYLE: res = muCOSAHL_window_get_cursor_style(hl_win, (muCursorStyle*)data); break;
+							// Event time
+							case MU_WINDOW_EVENT_TIME: muCOSAHL_window_get_event_time(hl_win, (double*)data); return; break;
+							// Raw motion
+							case MU_WINDOW_RAW_MOTION: muCOSAHL_window_get_raw_motion(hl_win, (muBool*)data); return; break;
+							// Pointer lock
+							case MU_WINDOW_POINTER_LOCK: muCOSAHL_window_get_pointer_lock(hl_win, (muBool*)data); return; break;
+						}
 
-			// States possibly held by the window that are updated via proc
-			struct muCOSAW32_WindowStates {
-				// Closed or not
-				muBool closed;
-				// Cursor style
-				muCursorStyle cursor_style;
-			};
-			typedef struct muCOSAW32_WindowStates muCOSAW32_WindowStates;
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+						return;
+					} break;)
+				}
 
-			struct muCOSAW32_WindowProperties {
-				// Pixel format
-				muPixelFormat format;
-				muBool use_format;
-				muBool format_set;
-				// Default pixel format value
-				int pixel_format;
+				// To avoid unused parameter warnings in some cases
+				if (result) {} if (win) {} if (attrib) {} if (data) {}
+			}
 
-				// Min/Max dimensions
-				uint32_m min_width;
-				uint32_m min_height;
-				uint32_m max_width;
-				uint32_m max_height;
+			MUDEF void MUCOSA_UNLOCKED(muCOSA_window_set)(muCOSAContext* context, muCOSAResult* result, muWindow win, muWindowAttrib attrib, void* data) {
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-				// Scroll level
-				int32_m scroll_level;
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: return; break;
 
-				// Cursor position
-				int32_m cursor_x;
-				int32_m cursor_y;
+					// Win32
+					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+						muCOSAResult res = MUCOSA_SUCCESS;
+						muCOSAW32_Window* w32_win = (muCOSAW32_Window*)win;
 
-				// Text input
-				void (*text_input_callback)(muWindow window, uint8_m* data);
-				uint32_m text_cursor_x;
-				uint32_m text_cursor_y;
-			};
-			typedef struct muCOSAW32_WindowProperties muCOSAW32_WindowProperties;
+						// Do things based on attribute
+						switch (attrib) {
+							default: MU_SET_RESULT(result, MUCOSA_FAILED_UNKNOWN_WINDOW_ATTRIB) return; break;
 
-			struct muCOSAW32_WindowTemp {
-				// High surrogate for cross-WM_CHAR messages
-				WCHAR high_surrogate;
-			};
-			typedef struct muCOSAW32_WindowTemp muCOSAW32_WindowTemp;
+							// Title
+							case MU_WINDOW_TITLE: res = muCOSAW32_window_set_title(w32_win, (char*)data); break;
+							// Dimensions
+							case MU_WINDOW_DIMENSIONS: res = muCOSAW32_window_set_dimensions(w32_win, (uint32_m*)data); break;
+							// Position
+							case MU_WINDOW_POSITION: res = muCOSAW32_window_set_position(w32_win, (int32_m*)data); break;
+							// Scroll
+							case MU_WINDOW_SCROLL_LEVEL: muCOSAW32_window_set_scroll(w32_win, (int32_m*)data); return; break;
+							// Cursor
+							case MU_WINDOW_CURSOR: res = muCOSAW32_window_set_cursor_pos(w32_win, (int32_m*)data); break;
+							// Cursor style
+							case MU_WINDOW_CURSOR_STYLE: res = muCOSAW32_window_set_cursor_style(w32_win, (muCursorStyle*)data); break;
+							// Raw motion
+							case MU_WINDOW_RAW_MOTION: res = muCOSAW32_window_set_raw_motion(w32_win, (muBool*)data); break;
+							// Pointer lock
+							case MU_WINDOW_POINTER_LOCK: res = muCOSAW32_window_set_pointer_lock(w32_win, (muBool*)data); break;
+							// Callbacks
+							case MU_WINDOW_DIMENSIONS_CALLBACK: case MU_WINDOW_POSITION_CALLBACK:
+							case MU_WINDOW_KEYBOARD_CALLBACK: case MU_WINDOW_KEYSTATE_CALLBACK:
+							case MU_WINDOW_MOUSE_KEY_CALLBACK: case MU_WINDOW_CURSOR_CALLBACK:
+							case MU_WINDOW_SCROLL_CALLBACK: case MU_WINDOW_FRAME_CALLBACK:
+							case MU_WINDOW_RAW_MOTION_CALLBACK:
+								muCOSAW32_window_set_callback(w32_win, attrib, data); return; break;
+						}
 
-			struct muCOSAW32_Window {
-				muCOSAW32_WindowHandles handles;
-				muCOSAW32_Keymaps keymaps;
-				muCOSAW32_WindowStates states;
-				muCOSAW32_WindowProperties props;
-				muWindowCallbacks callbacks;
-				muCOSAW32_WindowTemp temp;
-			};
-			typedef struct muCOSAW32_Window muCOSAW32_Window;
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+						return;
+					} break;)
 
-		/* Pmap */
-
-			// This entire section describes an atom-locked array of muCOSAW32_Window's.
-			// This is needed for when we need to find a muCOSAW32_Window based on just
-			// the Win32 handle (HWND), which happens in the proc function. Really sucks
-			// that I have to do this, but it works!
-
-			// The way the array works is by using a pointer array that doubles in memory
-			// to keep up with allocation every time new memory is needed. Each element
-			// in the array is a pointer to a valid muCOSA window or 0; when a window is
-			// removed, its slot is set to 0, marking it for overwriting, which will be
-			// done if a new window needs to be added and there is an empty slot.
-
-			// The limitation to this is that the array cannot "de-expand"; for the
-			// entire time that at least one muCOSA context exists, the amount of windows
-			// alllocated can only go up. This is never likely to be a large issue, as
-			// the VAST majority of programs will never allocate enough windows at once
-			// to ever make this considerable in terms of memory allocated, but it is a
-			// limitation nonetheless.
-
-			// Pointer map struct
-			struct muCOSAW32_WindowPMAP {
-				// Pointer to each window's memory
-				muCOSAW32_Window** windows;
-				// Amount of windows
-				size_m wincount;
-				// Amount of window array memory allocated; unit is amount of windows
-				size_m winlen;
-				// Locked state
-				LONG volatile locked;
-				// Amount of active muCOSA contexts;
-				// used to destroy all memory once all muCOSA contexts deactivate
-				size_m access_count;
-			};
-			typedef struct muCOSAW32_WindowPMAP muCOSAW32_WindowPMAP;
+					// X11
+					MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+						muCOSAResult res = MUCOSA_SUCCESS;
+						muCOSAX11_Window* x11_win = (muCOSAX11_Window*)win;
+
+						// Do things based on attribute
+						switch (attrib) {
+							default: MU_SET_RESULT(result, MUCOSA_FAILED_UNKNOWN_WINDOW_ATTRIB) return; break;
 
-			// Global window pmap
-			muCOSAW32_WindowPMAP muCOSAW32_GlobalWindowPMAP = MU_ZERO_STRUCT_CONST(muCOSAW32_WindowPMAP);
+							// Title
+							case MU_WINDOW_TITLE: res = muCOSAX11_window_set_title(x11_win, (char*)data); break;
+							// Dimensions
+							case MU_WINDOW_DIMENSIONS: res = muCOSAX11_window_set_dimensions(x11_win, (uint32_m*)data); break;
+							// Position
+							case MU_WINDOW_POSITION: res = muCOSAX11_window_set_position(x11_win, (int32_m*)data); break;
+							// Scroll
+							case MU_WINDOW_SCROLL_LEVEL: muCOSAX11_window_set_scroll(x11_win, (int32_m*)data); return; break;
+							// Cursor
+							case MU_WINDOW_CURSOR: res = muCOSAX11_window_set_cursor_pos(x11_win, (int32_m*)data); break;
+							// Cursor style
+							case MU_WINDOW_CURSOR_STYLE: res = muCOSAX11_window_set_cursor_style(x11_win, (muCursorStyle*)data); break;
+							// Raw motion
+							case MU_WINDOW_RAW_MOTION: res = muCOSAX11_window_set_raw_motion((muCOSAX11_Context*)inner->context, x11_win, (muBool*)data); break;
+							// Pointer lock
+							case MU_WINDOW_POINTER_LOCK: res = muCOSAX11_window_set_pointer_lock((muCOSAX11_Context*)inner->context, x11_win, (muBool*)data); break;
+							// Callbacks
+							case MU_WINDOW_DIMENSIONS_CALLBACK: case MU_WINDOW_POSITION_CALLBACK:
+							case MU_WINDOW_KEYBOARD_CALLBACK: case MU_WINDOW_KEYSTATE_CALLBACK:
+							case MU_WINDOW_MOUSE_KEY_CALLBACK: case MU_WINDOW_CURSOR_CALLBACK:
+							case MU_WINDOW_SCROLL_CALLBACK: case MU_WINDOW_FRAME_CALLBACK:
+							case MU_WINDOW_RAW_MOTION_CALLBACK:
+								muCOSAX11_window_set_callback(x11_win, attrib, data); return; break;
+						}
 
-			// Locks the window pmap to this thread
-			void muCOSAW32_window_pmap_lock(void) {
-				// Wait until we have it locked for this thread
-				while (InterlockedCompareExchange(&muCOSAW32_GlobalWindowPMAP.locked, 1, 0) == 1) {
-					// ...
-				}
-			}
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+						return;
+					} break;)
 
-			// Unlocks the window pmap (make sure you have it locked under the current thread!)
-			void muCOSAW32_window_pmap_unlock(void) {
-				// Set locked bit to 0 atomically
-				_interlockedbittestandreset(&muCOSAW32_GlobalWindowPMAP.locked, 0);
-			}
+					// Wayland
+					MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+						muCOSAResult res = MUCOSA_SUCCESS;
+						muCOSAWL_Window* wl_win = (muCOSAWL_Window*)win;
 
-			// Adds a window to the window pmap
-			muCOSAResult muCOSAW32_window_pmap_add(muCOSAW32_Window* win) {
-				// Lock pmap to this thread
-				muCOSAW32_window_pmap_lock();
+						// Do things based on attribute
+						switch (attrib) {
+							default: MU_SET_RESULT(result, MUCOSA_FAILED_UNKNOWN_WINDOW_ATTRIB) return; break;
 
-				// Try and find an empty slot to fill
-				for (size_m s = 0; s < muCOSAW32_GlobalWindowPMAP.wincount; ++s) {
-					if (!muCOSAW32_GlobalWindowPMAP.windows[s]) {
-						// If an empty slot is found, fill it and leave
-						muCOSAW32_GlobalWindowPMAP.windows[s] = win;
-						muCOSAW32_window_pmap_unlock();
-						return MUCOSA_SUCCESS;
-					}
-				}
+							// Title
+							case MU_WINDOW_TITLE: res = muCOSAWL_window_set_title(wl_win, (char*)data); break;
+							// Dimensions
+							case MU_WINDOW_DIMENSIONS: res = muCOSAWL_window_set_dimensions(wl_win, (uint32_m*)data); break;
+							// Position
+							case MU_WINDOW_POSITION: res = muCOSAWL_window_set_position(wl_win, (int32_m*)data); break;
+							// Scroll
+							case MU_WINDOW_SCROLL_LEVEL: muCOSAWL_window_set_scroll(wl_win, (int32_m*)data); return; break;
+							// Cursor
+							case MU_WINDOW_CURSOR: res = muCOSAWL_window_set_cursor_pos(wl_win, (int32_m*)data); break;
+							// Cursor style
+							case MU_WINDOW_CURSOR_STYLE: res = muCOSAWL_window_set_cursor_style(wl_win, (muCursorStyle*)data); break;
+							// Raw motion
+							case MU_WINDOW_RAW_MOTION: res = muCOSAWL_window_set_raw_motion(wl_win, (muBool*)data); break;
+							// Pointer lock
+							case MU_WINDOW_POINTER_LOCK: res = muCOSAWL_window_set_pointer_lock(wl_win, (muBool*)data); break;
+							// Callbacks
+							case MU_WINDOW_DIMENSIONS_CALLBACK: case MU_WINDOW_POSITION_CALLBACK:
+							case MU_WINDOW_KEYBOARD_CALLBACK: case MU_WINDOW_KEYSTATE_CALLBACK:
+							case MU_WINDOW_MOUSE_KEY_CALLBACK: case MU_WINDOW_CURSOR_CALLBACK:
+							case MU_WINDOW_SCROLL_CALLBACK: case MU_WINDOW_FRAME_CALLBACK:
+							case MU_WINDOW_RAW_MOTION_CALLBACK:
+								muCOSAWL_window_set_callback(wl_win, attrib, data); return; break;
+						}
 
-				// Increment window count by 1
-				++muCOSAW32_GlobalWindowPMAP.wincount;
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+						return;
+					} break;)
 
-				// If array is non-existent currently:
-				if (!muCOSAW32_GlobalWindowPMAP.windows) {
-					// Allocate 1 window worth
-					muCOSAW32_GlobalWindowPMAP.winlen = 1;
-					muCOSAW32_GlobalWindowPMAP.windows = (muCOSAW32_Window**)mu_malloc(sizeof(muCOSAW32_Window*));
-					// If unable to allocate:
-					if (!muCOSAW32_GlobalWindowPMAP.windows) {
-						// Set values to 0
-						muCOSAW32_GlobalWindowPMAP.wincount = 0;
-						muCOSAW32_GlobalWindowPMAP.winlen = 0;
-						// Unlock pmap
-						muCOSAW32_window_pmap_unlock();
-						// Return bad value
-						return MUCOSA_FAILED_MALLOC;
-					}
-				}
+					// Headless
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						muCOSAResult res = MUCOSA_SUCCESS;
+						muCOSAHL_Window* hl_win = (muCOSAHL_Window*)win;
 
-				// If an array already exists, but we don't have enough memory allocated
-				else if (muCOSAW32_GlobalWindowPMAP.wincount >= muCOSAW32_GlobalWindowPMAP.winlen) {
-					// Multiply window length by 2
-					muCOSAW32_GlobalWindowPMAP.winlen *= 2;
-					// Reallocate this new length
-					muCOSAW32_Window** new_windows = (muCOSAW32_Window**)mu_realloc(
-						muCOSAW32_GlobalWindowPMAP.windows,
-						sizeof(muCOSAW32_Window*) * muCOSAW32_GlobalWindowPMAP.winlen
-					);
+						// Do things based on attribute
+						switch (attrib) {
+							default: MU_SET_RESULT(result, MUCOSA_FAILED_UNKNOWN_WINDOW_ATTRIB) return; break;
 
-					// If we failed to reallocate:
-					if (!new_windows) {
-						// Deincrement window count
-						--muCOSAW32_GlobalWindowPMAP.wincount;
-						// Undo winlen multiplication
-						muCOSAW32_GlobalWindowPMAP.winlen /= 2;
-						// Unlock pmap
-						muCOSAW32_window_pmap_unlock();
-						// Return bad value
-						return MUCOSA_FAILED_REALLOC;
-					}
+							// Title
+							case MU_WINDOW_TITLE: res = muCOSAHL_window_set_title(hl_win, (char*)data); break;
+							// Dimensions
+							case MU_WINDOW_DIMENSIONS: res = muCOSAHL_window_set_dimensions(hl_win, (uint32_m*)data); break;
+							// Position
+							case MU_WINDOW_POSITION: res = muCOSAHL_window_set_position(hl_win, (int32_m*)data); break;
+							// Scroll
+							case MU_WINDOW_SCROLL_LEVEL: muCOSAHL_window_set_scroll(hl_win, (int32_m*)data); return; break;
+							// Cursor
+							case MU_WINDOW_CURSOR: res = muCOSAHL_window_set_cursor_pos(hl_win, (int32_m*)data); break;
+							// Cursor style
+							case MU_WINDOW_CURSOR_STYLE: res = muCOSAHL_window_set_cursor_style(hl_win, (muCursorStyle*)data); break;
+							// Raw motion
+							case MU_WINDOW_RAW_MOTION: res = muCOSAHL_window_set_raw_motion(hl_win, (muBool*)data); break;
+							// Pointer lock
+							case MU_WINDOW_POINTER_LOCK: res = muCOSAHL_window_set_pointer_lock(hl_win, (muBool*)data); break;
+							// Callbacks
+							case MU_WINDOW_DIMENSIONS_CALLBACK: case MU_WINDOW_POSITION_CALLBACK:
+							case MU_WINDOW_KEYBOARD_CALLBACK: case MU_WINDOW_KEYSTATE_CALLBACK:
+							case MU_WINDOW_MOUSE_KEY_CALLBACK: case MU_WINDOW_CURSOR_CALLBACK:
+							case MU_WINDOW_SCROLL_CALLBACK: case MU_WINDOW_FRAME_CALLBACK:
+							case MU_WINDOW_RAW_MOTION_CALLBACK:
+								muCOSAHL_window_set_callback(hl_win, attrib, data); return; break;
+						}
 
-					// If we didn't fail, we point to the newly allocated memory
-					muCOSAW32_GlobalWindowPMAP.windows = new_windows;
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+						return;
+					} break;)
 				}
 
-				// Set newly allocated window spot to the new window
-				muCOSAW32_GlobalWindowPMAP.windows[muCOSAW32_GlobalWindowPMAP.wincount-1] = win;
-
-				// Unlock pmap
-				muCOSAW32_window_pmap_unlock();
-				// Return success
-				return MUCOSA_SUCCESS;
+				// To avoid unused parameter warnings in some cases
+				if (result) {} if (win) {} if (attrib) {} if (data) {}
 			}
 
-			// Removes a window from the pmap
-			void muCOSAW32_window_pmap_remove(muCOSAW32_Window* win) {
-				// Lock pmap to this thread
-				muCOSAW32_window_pmap_lock();
-
-				// Find window pointer within pmap
-				for (size_m p = 0; p < muCOSAW32_GlobalWindowPMAP.wincount; ++p) {
-					if (muCOSAW32_GlobalWindowPMAP.windows[p] == win) {
-						muCOSAW32_GlobalWindowPMAP.windows[p] = 0;
-						break;
-					}
-				}
+			MUDEF void MUCOSA_UNLOCKED(muCOSA_window_get_batch)(muCOSAContext* context, muCOSAResult* result, muWindow win, size_m count, muWindowAttrib* attribs, void** data) {
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-				// Unlock pmap
-				muCOSAW32_window_pmap_unlock();
-			}
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					// Get each attribute one by one
+					default: {
+						for (size_m i = 0; i < count; ++i) {
+							muCOSA_window_get(context, result, win, attribs[i], data[i]);
+						}
+					} break;
 
-			// Cleans up all of the memory within the pmap
-			// Note that this does NOT lock/unlock; this should only be called with
-			// a thread that already has the global pmap locked
-			void muCOSAW32_window_pmap_cleanup(void) {
-				// Free the memory if it's allocated
-				if (muCOSAW32_GlobalWindowPMAP.windows) {
-					mu_free(muCOSAW32_GlobalWindowPMAP.windows);
+					// X11
+					MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+						// Query attributes from the X server all at once
+						muCOSAX11_window_get_queries(result, (muCOSAX11_Window*)win, count, attribs, data);
+						// Get the rest one by one
+						for (size_m i = 0; i < count; ++i) {
+							if (!muCOSAX11_attrib_is_query(attribs[i])) {
+								muCOSA_window_get(context, result, win, attribs[i], data[i]);
+							}
+						}
+					} break;)
 				}
-				// Zero-out the global pmap struct
-				muCOSAW32_GlobalWindowPMAP = MU_ZERO_STRUCT(muCOSAW32_WindowPMAP);
-			}
-
-			// "Accesses" the pmap, marking a context as currently active
-			void muCOSAW32_window_pmap_access(void) {
-				// Lock the pmap
-				muCOSAW32_window_pmap_lock();
-
-				// Increment access count
-				++muCOSAW32_GlobalWindowPMAP.access_count;
-
-				// Unlock the pmap
-				muCOSAW32_window_pmap_unlock();
 			}
 
-			// "De-accesses" the pmap, marking a context as no longer active
-			void muCOSAW32_window_pmap_deaccess(void) {
-				// Lock the pmap
-				muCOSAW32_window_pmap_lock();
+		/* Text input */
 
-				// Deincrement access count
-				--muCOSAW32_GlobalWindowPMAP.access_count;
+			MUDEF void MUCOSA_UNLOCKED(muCOSA_window_get_text_input)(muCOSAContext* context, muCOSAResult* result, muWindow win, uint32_m text_cursor_x, uint32_m text_cursor_y, void (*callback)(muWindow window, uint8_m* data)) {
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-				// If access count is 0, no more contexts are active, which
-				// means that we should clean everything up
-				if (muCOSAW32_GlobalWindowPMAP.access_count == 0) {
-					muCOSAW32_window_pmap_cleanup();
-				}
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: return; break;
 
-				// Unlock the pmap
-				muCOSAW32_window_pmap_unlock();
-			}
+					// Win32
+					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+						muCOSAW32_window_get_text_input(result, (muCOSAW32_Window*)win, text_cursor_x, text_cursor_y, callback);
+						return;
+					} break;)
 
-			// Finds a pointer to a muCOSA window based on the HWND handle
-			muCOSAW32_Window* muCOSAW32_window_pmap_find(HWND hwnd) {
-				// Lock the pmap
-				muCOSAW32_window_pmap_lock();
+					// X11
+					MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+						muCOSAX11_window_get_text_input(result, (muCOSAX11_Window*)win, text_cursor_x, text_cursor_y, callback);
+						return;
+					} break;)
 
-				// Default pointer
-				muCOSAW32_Window* wp = 0;
+					// Wayland
+					MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+						muCOSAWL_window_get_text_input(result, (muCOSAWL_Window*)win, text_cursor_x, text_cursor_y, callback);
+						return;
+					} break;)
 
-				// Find pointer in array
-				for (size_m p = 0; p < muCOSAW32_GlobalWindowPMAP.wincount; ++p) {
-					if (muCOSAW32_GlobalWindowPMAP.windows[p] != 0 && 
-						muCOSAW32_GlobalWindowPMAP.windows[p]->handles.hwnd == hwnd
-					) {
-						wp = muCOSAW32_GlobalWindowPMAP.windows[p];
-						break;
-					}
+					// Headless
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						muCOSAHL_window_get_text_input(result, (muCOSAHL_Window*)win, text_cursor_x, text_cursor_y, callback);
+						return;
+					} break;)
 				}
 
-				// Unlock the pmap
-				muCOSAW32_window_pmap_unlock();
-				// Return pointer
-				return wp;
+				// To avoid unused parameter warnings in some cases
+				if (result) {} if (win) {} if (text_cursor_x) {} if (text_cursor_y) {} if (callback) {}
 			}
 
-		/* Proc */
+			MUDEF void MUCOSA_UNLOCKED(muCOSA_window_let_text_input)(muCOSAContext* context, muWindow win) {
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-			// Info about a proc message
-			struct muCOSAW32_ProcMsg {
-				// Proc stuff
-				UINT uMsg;
-				WPARAM wParam;
-				LPARAM lParam;
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: return; break;
 
-				// muCOSA window
-				muCOSAW32_Window* win;
-			};
-			typedef struct muCOSAW32_ProcMsg muCOSAW32_ProcMsg;
+					// Win32
+					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+						muCOSAW32_window_let_text_input((muCOSAW32_Window*)win);
+						return;
+					} break;)
 
-			// Handling for WM_DESTROY; when a window is closed
-			LRESULT CALLBACK muCOSAW32_DESTROY(muCOSAW32_ProcMsg msg) {
-				PostQuitMessage(0);
-				msg.win->states.closed = MU_TRUE;
-				return 0;
-			}
+					// X11
+					MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+						muCOSAX11_window_let_text_input((muCOSAX11_Window*)win);
+						return;
+					} break;)
 
-			// Separates left/right keys
-			WPARAM muCOSAW32_map_lr_keys(WPARAM vk, LPARAM lParam) {
-				// Separate scancode and left/right bit
-				UINT scancode = (lParam & 0x00ff0000) >> 16;
-				int  extended = (lParam & 0x01000000) != 0;
+					// Wayland
+					MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+						muCOSAWL_window_let_text_input((muCOSAWL_Window*)win);
+						return;
+					} break;)
 
-				// Separate into left/right virtual key codes if need be
-				switch (vk) {
-					default: return vk; break;
-					case VK_SHIFT:   return MapVirtualKey(scancode, MAPVK_VSC_TO_VK_EX); break;
-					case VK_CONTROL: return extended ? VK_RCONTROL : VK_LCONTROL; break;
-					case VK_MENU:    return extended ? VK_RMENU    : VK_LMENU; break;
+					// Headless
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						muCOSAHL_window_let_text_input((muCOSAHL_Window*)win);
+						return;
+					} break;)
 				}
-			}
 
-			// Handling for WM_KEYDOWN and WM_KEYUP
-			LRESULT CALLBACK muCOSAW32_KEY(muCOSAW32_ProcMsg msg, muBool up) {
-				// Handle separation of keys based on left/right
-				msg.wParam = muCOSAW32_map_lr_keys(msg.wParam, msg.lParam);
-				// Convert Win32 key value to muCOSA key value
-				muKeyboardKey key = muCOSAW32_VK_to_muCOSA(msg.wParam);
-				// Return if key is unknown or out of range
-				if (key == MU_KEYBOARD_UNKNOWN || key >= MU_KEYBOARD_LENGTH) {
-					return 0;
-				}
+				// To avoid unused parameter warnings in some cases
+				if (win) {}
+			}
 
-				// Set key state
-				msg.win->keymaps.keyboard[key] = up;
-				// Call keyboard callback
-				if (msg.win->callbacks.keyboard) {
-					msg.win->callbacks.keyboard(msg.win, key, up);
-				}
+			MUDEF void MUCOSA_UNLOCKED(muCOSA_window_update_text_cursor)(muCOSAContext* context, muCOSAResult* result, muWindow win, uint32_m x, uint32_m y) {
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-				// Exit
-				return 0;
-			}
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: return; break;
 
-			// Handling for WM_LBUTTONDOWN, WM_RBUTTONDOWN, WM_LBUTTONUP, and WM_RBUTTONDOWN
-			LRESULT CALLBACK muCOSAW32_MBUTTON(muCOSAW32_ProcMsg msg, muMouseKey key, muBool up) {
-				// Update keymap
-				msg.win->keymaps.mouse[key] = up;
-				// + Callback
-				if (msg.win->callbacks.mouse_key) {
-					msg.win->callbacks.mouse_key(msg.win, key, up);
-				}
-				return 0;
-			}
+					// Win32
+					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+						muCOSAW32_window_update_text_cursor(result, (muCOSAW32_Window*)win, x, y);
+						return;
+					} break;)
 
-			muCOSAResult muCOSAW32_window_get_dimensions(muCOSAW32_Window* win, uint32_m* data);
-			muCOSAResult muCOSAW32_window_get_cursor_pos(muCOSAW32_Window* win, int32_m* data);
-			// Handling for WM_SETCURSOR
-			LRESULT CALLBACK muCOSAW32_SETCURSOR(muCOSAW32_ProcMsg msg) {
-				// Only allow the cursor to change if it's outside the window surface
-				// This is a hack and a half, but largely works
-				int32_m cur[2]; muCOSAW32_window_get_cursor_pos(msg.win, cur);
-				uint32_m dim[2]; muCOSAW32_window_get_dimensions(msg.win, dim);
-				int32_m idim[2] = { (int32_m)dim[0], (int32_m)dim[1] };
-				if (cur[0] >= 0 && cur[1] >= 0 && cur[0] < idim[0] && cur[1] < idim[1]) {
-					SetCursor(msg.win->handles.hcursor);
-				} else {
-					return DefWindowProcW(msg.win->handles.hwnd, msg.uMsg, msg.wParam, msg.lParam);
-				}
-				return 0;
-			}
+					// X11
+					MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+						muCOSAX11_window_update_text_cursor(result, (muCOSAX11_Window*)win, x, y);
+						return;
+					} break;)
 
-			// Handling for WM_GETMINMAXINFO
-			LRESULT CALLBACK muCOSAW32_GETMINMAXINFO(muCOSAW32_ProcMsg msg) {
-				LPMINMAXINFO lp = (LPMINMAXINFO)msg.lParam;
-				// I have no idea why 16 and 39 need to be added here. Can't be borders
-				// because these numbers don't even nearly match the border values.
-				// If it works, it works :P
-				lp->ptMinTrackSize.x = msg.win->props.min_width + 16;
-				lp->ptMinTrackSize.y = msg.win->props.min_height + 39;
-				lp->ptMaxTrackSize.x = msg.win->props.max_width + 16;
-				lp->ptMaxTrackSize.y = msg.win->props.max_height + 39;
-				return 0;
-			}
+					// Wayland
+					MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+						muCOSAWL_window_update_text_cursor(result, (muCOSAWL_Window*)win, x, y);
+						return;
+					} break;)
 
-			// Handling for WM_MOUSEWHEEL
-			LRESULT CALLBACK muCOSAW32_MOUSEWHEEL(muCOSAW32_ProcMsg msg) {
-				// Add scroll level from wParam
-				int32_m add = GET_WHEEL_DELTA_WPARAM(msg.wParam);
-				msg.win->props.scroll_level += add;
-				// + Callback
-				if (msg.win->callbacks.scroll) {
-					msg.win->callbacks.scroll(msg.win, add);
+					// Headless
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						muCOSAHL_window_update_text_cursor(result, (muCOSAHL_Window*)win, x, y);
+						return;
+					} break;)
 				}
 
-				return 0;
+				// To avoid unused parameter warnings in some cases
+				if (result) {} if (win) {} if (x) {} if (y) {}
 			}
 
-			// Handling for WM_SIZE
-			LRESULT CALLBACK muCOSAW32_SIZE(muCOSAW32_ProcMsg msg) {
-				// Call dimensions callback
-				if (msg.win->callbacks.dimensions) {
-					msg.win->callbacks.dimensions(msg.win,
-						(uint32_m)(LOWORD(msg.lParam)),
-						(uint32_m)(HIWORD(msg.lParam))
-					);
-				}
+		/* Input injection */
 
-				// Not sure why we're calling this
-				// I think I vaguely remember this fixing some issue, but idk
-				PostMessage(msg.win->handles.hwnd, WM_PAINT, 0, 0);
-				return 0;
-			}
+			MUDEF void MUCOSA_UNLOCKED(muCOSA_window_inject_key)(muCOSAContext* context, muCOSAResult* result, muWindow win, muKeyboardKey key, muBool status) {
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-			// Handling for WM_MOVE
-			LRESULT CALLBACK muCOSAW32_MOVE(muCOSAW32_ProcMsg msg) {
-				// Call position callback
-				if (msg.win->callbacks.position) {
-					// https://www.autohotkey.com/boards/viewtopic.php?t=27857
-					// I would KISS Bill on the mouth if I ever met him...
-					msg.win->callbacks.position(
-						msg.win,
-						(int32_m)( msg.lParam      & 0x8000 ? - ((~msg.lParam    ) & 0x7FFF)+1 : msg.lParam       & 0x7FFF),
-						(int32_m)((msg.lParam>>16) & 0x8000 ? - ((~msg.lParam>>16) & 0X7FFF)+1 : (msg.lParam>>16) & 0x7FFF)
-					);
-				}
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_FEATURE) return; break;
 
-				return 0;
-			}
+					// X11
+					MUCOSA_XTEST_CALL(case MU_WINDOW_X11: {
+						muCOSAResult res = muCOSAX11_window_inject_key((muCOSAX11_Context*)inner->context, key, status);
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+						return;
+					} break;)
 
-			uint8_m muCOSAW32_UTF8_codepoint_size(uint32_m codepoint) {
-				// Storable in 7 bits = 1 byte
-				if (codepoint < 128) {
-					return 1;
-				}
-				// Storable in 11 bits = 2 bytes
-				if (codepoint < 2048) {
-					return 2;
-				}
-				// Storable in 16 bits = 3 bytes
-				if (codepoint < 65536) {
-					return 3;
+					// Headless
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						muCOSAResult res = muCOSAHL_window_inject_key((muCOSAHL_Context*)inner->context, (muCOSAHL_Window*)win, key, status);
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+						return;
+					} break;)
 				}
-				return 4;
+
+				// To avoid unused parameter warnings in some cases
+				if (win) {} if (key) {} if (status) {}
 			}
 
-			// Handling for WM_CHAR
-			LRESULT CALLBACK muCOSAW32_CHAR(muCOSAW32_ProcMsg msg) {
-				// Hold onto high surrogate if it is one
-				if (IS_HIGH_SURROGATE(msg.wParam)) {
-					msg.win->temp.high_surrogate = (WCHAR)msg.wParam;
-					return 0;
-				}
+			MUDEF void MUCOSA_UNLOCKED(muCOSA_window_inject_keystate)(muCOSAContext* context, muCOSAResult* result, muWindow win, muKeyboardState state, muBool status) {
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-				// Return if we aren't taking text input
-				if (!msg.win->props.text_input_callback) {
-					return DefWindowProcW(msg.win->handles.hwnd, msg.uMsg, msg.wParam, msg.lParam);
-				}
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_FEATURE) return; break;
 
-				// Convert UTF-16 wParam to wchar_t* UTF-16 string
-				WCHAR wstr[3];
-				// - Surrogate pair
-				if (msg.win->temp.high_surrogate) {
-					wstr[0] = msg.win->temp.high_surrogate;
-					wstr[1] = (WCHAR)msg.wParam;
-					wstr[2] = 0;
-					// (Reset high surrogate)
-					msg.win->temp.high_surrogate = 0;
-				}
-				// - Non-surrogate pair
-				else {
-					wstr[0] = (WCHAR)msg.wParam;
-					wstr[1] = 0;
-				}
+					// X11
+					MUCOSA_XTEST_CALL(case MU_WINDOW_X11: {
+						muCOSAResult res = muCOSAX11_window_inject_keystate((muCOSAX11_Context*)inner->context, state, status);
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+						return;
+					} break;)
 
-				// Convert wchar_t* UTF-16 string to UTF-8 string
-				uint8_m buf[5];
-				if (!WideCharToMultiByte(CP_UTF8, WC_ERR_INVALID_CHARS, wstr, -1, (LPSTR)buf, sizeof(buf), NULL, NULL)) {
-					return 0;
+					// Headless
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						muCOSAResult res = muCOSAHL_window_inject_keystate((muCOSAHL_Context*)inner->context, (muCOSAHL_Window*)win, state, status);
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+						return;
+					} break;)
 				}
 
-				// Callback
-				msg.win->props.text_input_callback(msg.win, buf);
-				return 0;
+				// To avoid unused parameter warnings in some cases
+				if (win) {} if (state) {} if (status) {}
 			}
 
-			// Handling for WM_IME_STARTCOMPOSITION
-			LRESULT CALLBACK muCOSAW32_IME_STARTCOMPOSITION(muCOSAW32_ProcMsg msg) {
-				// Get IMM context handle
-				HIMC imc = ImmGetContext(msg.win->handles.hwnd);
+			MUDEF void MUCOSA_UNLOCKED(muCOSA_window_inject_mouse_key)(muCOSAContext* context, muCOSAResult* result, muWindow win, muMouseKey key, muBool status) {
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-				// Fill out composition form
-				COMPOSITIONFORM cf = MU_ZERO_STRUCT(COMPOSITIONFORM);
-				cf.dwStyle = CFS_FORCE_POSITION;
-				cf.ptCurrentPos.x = msg.win->props.text_cursor_x;
-				cf.ptCurrentPos.y = msg.win->props.text_cursor_y;
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_FEATURE) return; break;
 
-				// Send composition form
-				if (!ImmSetCompositionWindow(imc, &cf)) {
-					return 0;
+					// X11
+					MUCOSA_XTEST_CALL(case MU_WINDOW_X11: {
+						muCOSAResult res = muCOSAX11_window_inject_mouse_key((muCOSAX11_Context*)inner->context, key, status);
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+						return;
+					} break;)
+
+					// Headless
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						muCOSAResult res = muCOSAHL_window_inject_mouse_key((muCOSAHL_Context*)inner->context, (muCOSAHL_Window*)win, key, status);
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+						return;
+					} break;)
 				}
 
-				// Release IMM context handle
-				ImmReleaseContext(msg.win->handles.hwnd, imc);
-				return 0;
+				// To avoid unused parameter warnings in some cases
+				if (win) {} if (key) {} if (status) {}
 			}
 
-			// Handles a proc message
-			LRESULT muCOSAW32_procmsg(muCOSAW32_ProcMsg msg) {
-				// Do things based on the message code
-				switch (msg.uMsg) {
-					// Message code we're not processing; return default handling at end of switch
-					default: break;
-					// Window closing
-					case WM_DESTROY: return muCOSAW32_DESTROY(msg); break;
-					// Key down
-					case WM_KEYDOWN: return muCOSAW32_KEY(msg, MU_TRUE); break;
-					// Key up
-					case WM_KEYUP: return muCOSAW32_KEY(msg, MU_FALSE); break;
-					// Left mouse up
-					case WM_LBUTTONUP: return muCOSAW32_MBUTTON(msg, MU_MOUSE_LEFT, MU_FALSE); break;
-					// Left mouse down
-					case WM_LBUTTONDOWN: return muCOSAW32_MBUTTON(msg, MU_MOUSE_LEFT, MU_TRUE); break;
-					// Right mouse up
-					case WM_RBUTTONUP: return muCOSAW32_MBUTTON(msg, MU_MOUSE_RIGHT, MU_FALSE); break;
-					// Right mouse down
-					case WM_RBUTTONDOWN: return muCOSAW32_MBUTTON(msg, MU_MOUSE_RIGHT, MU_TRUE); break;
-					// Middle mouse up
-					case WM_MBUTTONUP: return muCOSAW32_MBUTTON(msg, MU_MOUSE_MIDDLE, MU_FALSE); break;
-					// Middle mouse down
-					case WM_MBUTTONDOWN: return muCOSAW32_MBUTTON(msg, MU_MOUSE_MIDDLE, MU_TRUE); break;
-					// Cursor style changing
-					case WM_SETCURSOR: return muCOSAW32_SETCURSOR(msg); break;
-					// Windows asking for min/max dimensions
-					case WM_GETMINMAXINFO: return muCOSAW32_GETMINMAXINFO(msg); break;
-					// Scrolling
-					case WM_MOUSEWHEEL: return muCOSAW32_MOUSEWHEEL(msg); break;
-					// Resizing
-					case WM_SIZE: return muCOSAW32_SIZE(msg); break;
-					// Movement
-					case WM_MOVE: return muCOSAW32_MOVE(msg); break;
-					// Character input
-					case WM_CHAR: return muCOSAW32_CHAR(msg); break;
-					// IME composition position
-					case WM_IME_STARTCOMPOSITION: return muCOSAW32_IME_STARTCOMPOSITION(msg); break;
+			MUDEF void MUCOSA_UNLOCKED(muCOSA_window_inject_cursor)(muCOSAContext* context, muCOSAResult* result, muWindow win, int32_m x, int32_m y) {
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_FEATURE) return; break;
+
+					// X11
+					MUCOSA_XTEST_CALL(case MU_WINDOW_X11: {
+						muCOSAResult res = muCOSAX11_window_inject_cursor((muCOSAX11_Context*)inner->context, (muCOSAX11_Window*)win, x, y);
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+						return;
+					} break;)
+
+					// Headless
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						muCOSAResult res = muCOSAHL_window_inject_point((muCOSAHL_Context*)inner->context, (muCOSAHL_Window*)win, MUCOSAHL_INPUT_CURSOR, x, y);
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+						return;
+					} break;)
 				}
 
-				// Default handling
-				return DefWindowProcW(msg.win->handles.hwnd, msg.uMsg, msg.wParam, msg.lParam);
+				// To avoid unused parameter warnings in some cases
+				if (win) {} if (x) {} if (y) {}
 			}
 
-			// Proc function for Win32
-			LRESULT CALLBACK muCOSAW32_winproc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam) {
-				// Return default if hwnd is NULL
-				if (!hwnd) {
-					return DefWindowProcW(hwnd, uMsg, wParam, lParam);
-				}
+			MUDEF void MUCOSA_UNLOCKED(muCOSA_window_inject_raw_motion)(muCOSAContext* context, muCOSAResult* result, muWindow win, double dx, double dy) {
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-				// Start getting info about the proc
-				muCOSAW32_ProcMsg msg;
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_FEATURE) return; break;
 
-				// Find window based on HWND
-				msg.win = muCOSAW32_window_pmap_find(hwnd);
-				if (!msg.win) {
-					return DefWindowProcW(hwnd, uMsg, wParam, lParam);
+					// X11
+					MUCOSA_XTEST_CALL(case MU_WINDOW_X11: {
+						muCOSAResult res = muCOSAX11_window_inject_raw_motion((muCOSAX11_Context*)inner->context, dx, dy);
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+						return;
+					} break;)
+
+					// Headless
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						muCOSAResult res = muCOSAHL_window_inject_raw_motion((muCOSAHL_Context*)inner->context, (muCOSAHL_Window*)win, dx, dy);
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+						return;
+					} break;)
 				}
 
-				// Copy over other info
-				msg.uMsg = uMsg;
-				msg.wParam = wParam;
-				msg.lParam = lParam;
+				// To avoid unused parameter warnings in some cases
+				if (win) {} if (dx) {} if (dy) {}
+			}
 
-				// Return proc message handling
-				return muCOSAW32_procmsg(msg);
+			MUDEF void MUCOSA_UNLOCKED(muCOSA_window_inject_scroll)(muCOSAContext* context, muCOSAResult* result, muWindow win, int32_m add) {
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_FEATURE) return; break;
+
+					// X11
+					MUCOSA_XTEST_CALL(case MU_WINDOW_X11: {
+						muCOSAResult res = muCOSAX11_window_inject_scroll((muCOSAX11_Context*)inner->context, add);
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+						return;
+					} break;)
+
+					// Headless
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						muCOSAResult res = muCOSAHL_window_inject_scroll((muCOSAHL_Context*)inner->context, (muCOSAHL_Window*)win, add);
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+						return;
+					} break;)
+				}
+
+				// To avoid unused parameter warnings in some cases
+				if (win) {} if (add) {}
 			}
 
-		/* Creation / Destruction */
+			MUDEF void MUCOSA_UNLOCKED(muCOSA_window_inject_text)(muCOSAContext* context, muCOSAResult* result, muWindow win, uint8_m* text) {
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-			muCOSAResult muCOSAW32_window_set_position(muCOSAW32_Window* win, int32_m* data);
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_FEATURE) return; break;
 
-			muCOSAResult muCOSAW32_window_create(muWindowInfo* info, muCOSAW32_Window* win) {
-				/* Default attributes */
+					// X11
+					MUCOSA_XTEST_CALL(case MU_WINDOW_X11: {
+						muCOSAResult res = muCOSAX11_window_inject_text((muCOSAX11_Context*)inner->context, text);
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+						return;
+					} break;)
 
-					// Zero-ing-out
-					mu_memset(&win->handles, 0, sizeof(win->handles));
-					mu_memset(&win->keymaps, 0, sizeof(win->keymaps));
+					// Headless
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						muCOSAResult res = muCOSAHL_window_inject_text((muCOSAHL_Context*)inner->context, (muCOSAHL_Window*)win, text);
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+						return;
+					} break;)
+				}
 
-					// Closed
-					win->states.closed = MU_FALSE;
+				// To avoid unused parameter warnings in some cases
+				if (win) {} if (text) {}
+			}
 
-					// Cursor style
-					win->states.cursor_style = MU_CURSOR_ARROW;
+			MUDEF void MUCOSA_UNLOCKED(muCOSA_window_inject_dimensions)(muCOSAContext* context, muCOSAResult* result, muWindow win, uint32_m width, uint32_m height) {
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-					// Pixel format
-					if (info->pixel_format) {
-						win->props.use_format = MU_TRUE;
-						win->props.format = *info->pixel_format;
-					} else {
-						win->props.use_format = MU_FALSE;
-					}
-					win->props.format_set = MU_FALSE;
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_FEATURE) return; break;
 
-					// Min/Max dimensions
-					win->props.min_width = info->min_width;
-					win->props.min_height = info->min_height;
-					win->props.max_width = info->max_width;
-					win->props.max_height = info->max_height;
-					// - (Fix 0 defaults)
-					if (win->props.min_width == 0) {
-						win->props.min_width = 120;
-					}
-					if (win->props.min_height == 0) {
-						win->props.min_height = 1;
-					}
-					if (win->props.max_width == 0) {
-						win->props.max_width = 0x0FFFFFFF;
-					}
-					if (win->props.max_height == 0) {
-						win->props.max_height = 0x0FFFFFFF;
-					}
+					// Headless
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						muCOSAResult res = muCOSAHL_window_inject_point((muCOSAHL_Context*)inner->context, (muCOSAHL_Window*)win, MUCOSAHL_INPUT_DIMENSIONS, (int32_m)width, (int32_m)height);
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+						return;
+					} break;)
+				}
 
-					// Scroll level
-					win->props.scroll_level = 0;
+				// To avoid unused parameter warnings in some cases
+				if (win) {} if (width) {} if (height) {}
+			}
 
-					// Cursor position
-					win->props.cursor_x = win->props.cursor_y = 0;
+			MUDEF void MUCOSA_UNLOCKED(muCOSA_window_inject_position)(muCOSAContext* context, muCOSAResult* result, muWindow win, int32_m x, int32_m y) {
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-					// Callbacks
-					// - Zero-out if no callbacks specified
-					if (!info->callbacks) {
-						mu_memset(&win->callbacks, 0, sizeof(win->callbacks));
-					}
-					// - Set all callbacks if specified
-					else {
-						win->callbacks = *info->callbacks;
-					}
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_FEATURE) return; break;
 
-					// Text focus
-					win->props.text_input_callback = 0;
-					win->props.text_cursor_x = win->props.text_cursor_y = 0;
+					// Headless
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						muCOSAResult res = muCOSAHL_window_inject_point((muCOSAHL_Context*)inner->context, (muCOSAHL_Window*)win, MUCOSAHL_INPUT_POSITION, x, y);
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+						return;
+					} break;)
+				}
 
-					// High surrogate for WM_CHAR messages
-					win->temp.high_surrogate = 0;
+				// To avoid unused parameter warnings in some cases
+				if (win) {} if (x) {} if (y) {}
+			}
 
-				/* Class */
+			MUDEF void MUCOSA_UNLOCKED(muCOSA_window_inject_close)(muCOSAContext* context, muCOSAResult* result, muWindow win) {
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-					// Window title
-					wchar_t* wname = muCOSAW32_utf8_to_wchar(info->title);
-					if (!wname) {
-						return MUCOSA_WIN32_FAILED_CONVERT_UTF8_TO_WCHAR;
-					}
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_FEATURE) return; break;
 
-					// This is some of the jankiest code I've written!
-					// To generate a unique window class, I hamfistedly
-					// attempt to generate one by adding the actual pointer
-					// value of 'win' to a character, creating an often
-					// unreadable class title. This needs to be improved
-					// at some point, but works for me :P
+					// X11
+					MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+						muCOSAResult res = muCOSAX11_window_inject_close((muCOSAX11_Context*)inner->context, (muCOSAX11_Window*)win);
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+						return;
+					} break;)
+
+					// Headless
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						muCOSAResult res = muCOSAHL_window_inject_close((muCOSAHL_Context*)inner->context, (muCOSAHL_Window*)win);
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+						return;
+					} break;)
+				}
 
-					win->handles.wclass_name[0] = (wchar_t)'!';
+				// To avoid unused parameter warnings in some cases
+				if (win) {}
+			}
 
-					wchar_t add; // (Purposely left uninitialized for more randomness)
-					if (sizeof(wchar_t) < sizeof(win)) {
-						mu_memcpy(&add, &win, sizeof(wchar_t));
-					} else {
-						mu_memcpy(&add, &win, sizeof(win));
-					}
+		/* Input recording */
 
-					win->handles.wclass_name[0] += add;
-					win->handles.wclass_name[1] = (wchar_t)'\0';
+			// Gets a window's event queue, which holds its recording
+			muCOSA_EventQueue* muCOSA_window_get_event_queue(muCOSA_Inner* inner, muWindow win) {
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: return 0; break;
 
-					// Hinstance
-					win->handles.hinstance = muCOSAW32_get_hinstance();
-					// Hcursor
-					win->handles.hcursor = LoadCursor(NULL, IDC_ARROW);
+					// Win32
+					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+						return &((muCOSAW32_Window*)win)->events;
+					} break;)
 
-					// Create class struct
-					WNDCLASSEXW wclass = MU_ZERO_STRUCT(WNDCLASSEXW);
-					wclass.cbSize = sizeof(wclass);
-					wclass.style = CS_HREDRAW | CS_VREDRAW | CS_OWNDC;
-					wclass.lpfnWndProc = muCOSAW32_winproc;
-					wclass.hInstance = win->handles.hinstance;
-					wclass.hCursor = win->handles.hcursor;
-					wclass.lpszMenuName = wname;
-					wclass.lpszClassName = win->handles.wclass_name;
+					// X11
+					MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+						return &((muCOSAX11_Window*)win)->events;
+					} break;)
 
-					// Register
-					if(!RegisterClassExW(&wclass)) {
-						mu_free(wname);
-						return MUCOSA_WIN32_FAILED_REGISTER_WINDOW_CLASS;
-					}
+					// Wayland
+					MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+						return &((muCOSAWL_Window*)win)->events;
+					} break;)
 
-				/* Window */
+					// Headless
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						return &((muCOSAHL_Window*)win)->events;
+					} break;)
+				}
 
-					// Style
-					DWORD style = WS_OVERLAPPEDWINDOW;
+				// To avoid unused parameter warnings in some cases
+				if (win) {}
+			}
 
-					// Rect for the window's dimensions
-					RECT r;
-					r.left = r.top = 0;
-					r.right = (LONG)info->width;
-					r.bottom = (LONG)info->height;
-					AdjustWindowRect(&r, style, FALSE);
+			MUDEF void MUCOSA_UNLOCKED(muCOSA_window_record_start)(muCOSAContext* context, muCOSAResult* result, muWindow win, const char* path) {
+				// Get window's event queue
+				muCOSA_EventQueue* queue = muCOSA_window_get_event_queue((muCOSA_Inner*)context->inner, win);
+				if (!queue) {
+					MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_FEATURE)
+					return;
+				}
 
-					// Create window
-					win->handles.hwnd = CreateWindowExW(
-						// dwExStyle
-						0,
-						// lpClassName
-						wclass.lpszClassName,
-						// lpWindowName
-						wclass.lpszMenuName,
-						// dwStyle
-						style,
-						// X, Y,
-						(int)info->x, (int)info->y,
-						// nWidth, nHeight
-						r.right-r.left, r.bottom-r.top,
-						// hWndParent
-						NULL,
-						// hMenu
-						NULL,
-						// hInstance
-						win->handles.hinstance,
-						// lpParam
-						NULL
-					);
+				// Stop previous recording
+				muCOSA_recording_stop(&queue->recording);
+				// Start new one, relative to now
+				muCOSAResult res = muCOSA_recording_start(&queue->recording, path, muCOSA_time_get(context));
+				if (res != MUCOSA_SUCCESS) {
+					MU_SET_RESULT(result, res)
+				}
+			}
 
-					// - Handle fail case
-					mu_free(wname);
-					if (win->handles.hwnd == NULL) {
-						UnregisterClassW(win->handles.wclass_name, win->handles.hinstance);
-						return MUCOSA_WIN32_FAILED_CREATE_WINDOW;
-					}
+			MUDEF void MUCOSA_UNLOCKED(muCOSA_window_record_stop)(muCOSAContext* context, muCOSAResult* result, muWindow win) {
+				// Get window's event queue
+				muCOSA_EventQueue* queue = muCOSA_window_get_event_queue((muCOSA_Inner*)context->inner, win);
+				if (!queue) {
+					MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_FEATURE)
+					return;
+				}
 
-				/* Pixel format */
+				// Stop recording
+				muCOSAResult res = muCOSA_recording_stop(&queue->recording);
+				if (res != MUCOSA_SUCCESS) {
+					MU_SET_RESULT(result, res)
+				}
+			}
 
-					// Get device context
-					win->handles.dc = GetDC(win->handles.hwnd);
+			MUDEF void MUCOSA_UNLOCKED(muCOSA_window_replay_start)(muCOSAContext* context, muCOSAResult* result, muWindow win, const char* path, muBool realtime) {
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-					// Handle default pixel format:
-					if (!info->pixel_format) {
-						// Generic pixel format descriptor
-						// Based on https://www.khronos.org/opengl/wiki/Creating_an_OpenGL_Context_(WGL)
-						PIXELFORMATDESCRIPTOR pfd = {
-							sizeof(PIXELFORMATDESCRIPTOR),
-							1,
-							PFD_DRAW_TO_WINDOW | PFD_SUPPORT_OPENGL | PFD_DOUBLEBUFFER,
-							PFD_TYPE_RGBA,
-							32,
-							0, 0, 0, 0, 0, 0,
-							0, 0, 0,
-							0, 0, 0, 0,
-							24, 8, 8,
-							PFD_MAIN_PLANE,
-							0,
-							0, 0, 0
-						};
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_FEATURE) return; break;
 
-						// Find pixel format; fallback on 1
-						win->props.pixel_format = ChoosePixelFormat(win->handles.dc, &pfd);
-						if (!win->props.pixel_format) {
-							win->props.pixel_format = 1;
+					// Headless
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						muCOSAResult res = muCOSAHL_window_replay_start((muCOSAHL_Context*)inner->context, (muCOSAHL_Window*)win, path, realtime);
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
 						}
-					}
+						return;
+					} break;)
+				}
 
-					// Show window
-					ShowWindow(win->handles.hwnd, SW_NORMAL);
+				// To avoid unused parameter warnings in some cases
+				if (win) {} if (path) {} if (realtime) {}
+			}
 
-				/* Auto-disable IME */
+			MUDEF void MUCOSA_UNLOCKED(muCOSA_window_replay_stop)(muCOSAContext* context, muCOSAResult* result, muWindow win) {
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-					if (ImmAssociateContextEx(win->handles.hwnd, NULL, 0) == FALSE) {
-						// ?
-					}
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_FEATURE) return; break;
 
-				/* Set position manually */
+					// Headless
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						muCOSAHL_window_replay_stop((muCOSAHL_Window*)win);
+						return;
+					} break;)
+				}
 
-					// A bit of a hack considering that it should work on the first try,
-					// but frame extents on Win32 will be frame extents on Win32.
+				// To avoid unused parameter warnings in some cases
+				if (win) {}
+			}
 
-					int32_m pos[2] = { info->x, info->y };
-					muCOSAW32_window_set_position(win, pos);
+			MUDEF muBool MUCOSA_UNLOCKED(muCOSA_window_get_replaying)(muCOSAContext* context, muCOSAResult* result, muWindow win) {
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-				/* Add window to pmap */
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_FEATURE) return MU_FALSE; break;
 
-					muCOSAResult res = muCOSAW32_window_pmap_add(win);
-					if (muCOSA_result_is_fatal(res)) {
-						return res;
-					}
+					// Headless
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						return ((muCOSAHL_Window*)win)->replay.inputs != 0;
+					} break;)
+				}
 
-				return res;
+				// To avoid unused parameter warnings in some cases
+				if (win) {}
 			}
 
-			void muCOSAW32_window_destroy(muCOSAW32_Window* win) {
-				// Release device context
-				ReleaseDC(win->handles.hwnd, win->handles.dc);
-				// Destroy window
-				DestroyWindow(win->handles.hwnd);
-				// Unregister window class
-				UnregisterClassW(win->handles.wclass_name, win->handles.hinstance);
-				// Remove window from pmap
-				muCOSAW32_window_pmap_remove(win);
-			}
+		/* Pixel presentation */
 
-		/* Main loop */
+			MUDEF uint32_m* MUCOSA_UNLOCKED(muCOSA_window_get_pixels)(muCOSAContext* context, muCOSAResult* result, muWindow win, uint32_m width, uint32_m height, uint32_m* stride) {
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-			muBool muCOSAW32_window_get_closed(muCOSAW32_Window* win) {
-				return win->states.closed;
-			}
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_FEATURE) return 0; break;
 
-			void muCOSAW32_window_close(muCOSAW32_Window* win) {
-				// Set closed flag
-				win->states.closed = MU_TRUE;
+					// X11
+					MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+						return muCOSAX11_window_get_pixels((muCOSAX11_Context*)inner->context, result, (muCOSAX11_Window*)win, width, height, stride);
+					} break;)
+
+					// Wayland
+					MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+						return muCOSAWL_window_get_pixels((muCOSAWL_Context*)inner->context, result, (muCOSAWL_Window*)win, width, height, stride);
+					} break;)
+
+					// Headless
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						return muCOSAHL_window_get_pixels(result, (muCOSAHL_Window*)win, width, height, stride);
+					} break;)
+				}
+
+				// To avoid unused parameter warnings in some cases
+				if (win) {} if (width) {} if (height) {} if (stride) {}
 			}
 
-			// Checks all keystates and updates accordingly
-			void muCOSAW32_update_keystate(muCOSAW32_Window* win) {
-				// Loop through each possible keystate
-				for (muKeyboardState s = 1; s < MU_KEYSTATE_LENGTH; ++s) {
-					// Assume not on at first
-					muBool b = MU_FALSE;
-					// Convert keystate to Win32
-					int s_w32 = muCOSAW32_keystate_to_W32(s);
-					// If not recognized, continue:
-					if (s_w32 == VK_NONAME) {
-						continue;
-					}
+			MUDEF muBool MUCOSA_UNLOCKED(muCOSA_window_pixels_busy)(muCOSAContext* context, muCOSAResult* result, muWindow win, uint32_m* pixels) {
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-					// Set boolean to if it's on or off
-					b = (GetKeyState(s_w32) & 0x0001) != 0;
-					// Change value if different
-					if (b != win->keymaps.keystates[s]) {
-						win->keymaps.keystates[s] = b;
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_FEATURE) return MU_FALSE; break;
 
-						// + Callback
-						if (win->callbacks.keystate) {
-							win->callbacks.keystate(win, s, b);
-						}
-					}
+					// X11
+					MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+						return muCOSAX11_window_pixels_busy((muCOSAX11_Context*)inner->context, (muCOSAX11_Window*)win, pixels);
+					} break;)
+
+					// Wayland
+					MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+						return muCOSAWL_window_pixels_busy((muCOSAWL_Context*)inner->context, (muCOSAWL_Window*)win, pixels);
+					} break;)
+
+					// Headless (pixels are never busy)
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						return MU_FALSE;
+					} break;)
 				}
+
+				// To avoid unused parameter warnings in some cases
+				if (result) {} if (win) {} if (pixels) {}
 			}
 
-			// Handles the cursor changing position every frame;
-			// no corresponding Win32 proc for this as far as I'm aware :L
-			muCOSAResult muCOSAW32_window_get_cursor_pos(muCOSAW32_Window* win, int32_m* data);
-			void muCOSAW32_update_cursor(muCOSAW32_Window* win) {
-				// Get cursor position
-				int32_m c[2];
-				if (muCOSA_result_is_fatal(muCOSAW32_window_get_cursor_pos(win, c))) {
-					return;
-				}
+			MUDEF void MUCOSA_UNLOCKED(muCOSA_window_present_pixels)(muCOSAContext* context, muCOSAResult* result, muWindow win, uint32_m* pixels, uint32_m stride, muPixelRect* rect) {
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-				// Update cursor position if changed
-				if (win->props.cursor_x != c[0] || win->props.cursor_y != c[1]) {
-					win->props.cursor_x = c[0];
-					win->props.cursor_y = c[1];
-					// + Callback
-					if (win->callbacks.cursor) {
-						win->callbacks.cursor(win, c[0], c[1]);
-					}
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_FEATURE) return; break;
+
+					// X11
+					MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+						muCOSAX11_window_present_pixels((muCOSAX11_Context*)inner->context, result, (muCOSAX11_Window*)win, pixels, stride, rect);
+						return;
+					} break;)
+
+					// Wayland
+					MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+						muCOSAWL_window_present_pixels((muCOSAWL_Context*)inner->context, result, (muCOSAWL_Window*)win, pixels, stride, rect);
+						return;
+					} break;)
+
+					// Headless (nowhere to present pixels to)
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						return;
+					} break;)
 				}
+
+				// To avoid unused parameter warnings in some cases
+				if (result) {} if (win) {} if (pixels) {} if (stride) {} if (rect) {}
 			}
 
-			void muCOSAW32_window_update(muCOSAW32_Window* win) {
-				// Process messages
-				MSG msg = MU_ZERO_STRUCT(MSG);
-				while (PeekMessageA(&msg, 0, 0, 0, PM_REMOVE)) {
-					TranslateMessage(&msg);
-					DispatchMessage(&msg);
-				}
+		/* OpenGL */
+
+			MUDEF muGLContext MUCOSA_UNLOCKED(muCOSA_gl_context_create)(muCOSAContext* context, muCOSAResult* result, muWindow win, muGraphicsAPI api) {
+				#ifdef MU_SUPPORT_OPENGL
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: return 0; break;
 
-				// Update keystates
-				muCOSAW32_update_keystate(win);
-				// Update cursor position
-				muCOSAW32_update_cursor(win);
-			}
+					// Win32
+					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+						return muCOSAW32_gl_context_create(
+							(muCOSAW32_Context*)inner->context, result,
+							(muCOSAW32_Window*)win, api
+						);
+					} break;)
 
-		/* Title */
+					// X11
+					MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+						return muCOSAX11_gl_context_create(
+							(muCOSAX11_Context*)inner->context, result,
+							(muCOSAX11_Window*)win, api
+						);
+					} break;)
 
-			// Set title
-			muCOSAResult muCOSAW32_window_set_title(muCOSAW32_Window* win, char* data) {
-				// Convert UTF-8 data to wchar_t* data
-				wchar_t* wtitle = muCOSAW32_utf8_to_wchar(data);
-				if (!wtitle) {
-					return MUCOSA_WIN32_FAILED_CONVERT_UTF8_TO_WCHAR;
-				}
+					// Wayland
+					MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+						return muCOSAWL_gl_context_create(
+							(muCOSAWL_Context*)inner->context, result,
+							(muCOSAWL_Window*)win, api
+						);
+					} break;)
 
-				// Set window title
-				if (!SetWindowTextW(win->handles.hwnd, wtitle)) {
-					mu_free(wtitle);
-					return MUCOSA_WIN32_FAILED_SET_WINDOW_ATTRIB;
+					// Headless (OpenGL not supported)
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_GRAPHICS_API)
+						return 0;
+					} break;)
 				}
 
-				mu_free(wtitle);
-				return MUCOSA_SUCCESS;
+				// To avoid parameter warnings in certain circumstances
+				if (result) {} if (win) {} if (api) {}
+
+				// Fallback for non-OpenGL support:
+				#else
+				MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_GRAPHICS_API)
+				return 0;
+				if (context) {} if (result) {} if (win) {} if (api) {}
+				#endif
 			}
 
-		/* Frame extents */
+			MUDEF muGLContext MUCOSA_UNLOCKED(muCOSA_gl_context_create_offscreen)(muCOSAContext* context, muCOSAResult* result, muGraphicsAPI api, muPixelFormat* format) {
+				#ifdef MU_SUPPORT_OPENGL
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-			// Default frame extents
-			// I love you Bill...
-			void muCOSAW32_def_window_frame_extents(uint32_m* data) {
-				data[0] = data[1] = data[3] = (uint32_m)GetSystemMetrics(SM_CXSIZEFRAME);
-				data[2] = (uint32_m)(GetSystemMetrics(SM_CYFRAME) + GetSystemMetrics(SM_CYCAPTION) + GetSystemMetrics(92));
-			}
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_FEATURE) return 0; break;
+
+					// X11
+					MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+						return muCOSAX11_gl_offscreen_create(
+							(muCOSAX11_Context*)inner->context, result,
+							format, api
+						);
+					} break;)
 
-			// Get frame extents for a window
-			// I LOVE YOU BILL GATES!!!!!
-			void muCOSAW32_window_get_frame_extents(muCOSAW32_Window* win, uint32_m* data) {
-				// Fallback
-				muCOSAW32_def_window_frame_extents(data);
+					// Wayland
+					MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+						return muCOSAWL_gl_offscreen_create(
+							(muCOSAWL_Context*)inner->context, result,
+							format, api
+						);
+					} break;)
 
-				// Get window and client rect
-				RECT wr, cr;
-				if (!GetWindowRect(win->handles.hwnd, &wr)) {
-					// (Not returning error since default window frame extents are filled)
-					return;
-				}
-				if (!GetClientRect(win->handles.hwnd, &cr)) {
-					return;
+					// Headless
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						return muCOSAHL_gl_offscreen_create(
+							(muCOSAHL_Context*)inner->context, result,
+							format, api
+						);
+					} break;)
 				}
 
-				// Map client rect to window points
-				if (!MapWindowPoints(win->handles.hwnd, NULL, (LPPOINT)&cr, 2)) {
-					return;
-				}
+				// To avoid parameter warnings in certain circumstances
+				if (api) {} if (format) {}
 
-				// Set values based on window and client rect
-				data[0] = (uint32_m)(cr.left-wr.left);
-				data[1] = (uint32_m)(wr.right-cr.right);
-				data[2] = (uint32_m)(cr.top-wr.top);
-				data[3] = (uint32_m)(wr.bottom-cr.bottom);
+				// Fallback for non-OpenGL support:
+				#else
+				MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_GRAPHICS_API)
+				return 0;
+				if (context) {} if (result) {} if (api) {} if (format) {}
+				#endif
 			}
 
-		/* Dimensions */
+			MUDEF muGLContext MUCOSA_UNLOCKED(muCOSA_gl_context_destroy)(muCOSAContext* context, muWindow win, muGLContext gl_context) {
+				#ifdef MU_SUPPORT_OPENGL
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-			muCOSAResult muCOSAW32_window_get_dimensions(muCOSAW32_Window* win, uint32_m* data) {
-				// Get client rect
-				RECT r;
-				if (!GetClientRect(win->handles.hwnd, &r)) {
-					return MUCOSA_WIN32_FAILED_GET_WINDOW_ATTRIB;
-				}
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: return 0; break;
 
-				// Set values
-				data[0] = (uint32_m)(r.right-r.left);
-				data[1] = (uint32_m)(r.bottom-r.top);
-				return MUCOSA_SUCCESS;
-			}
+					// Win32
+					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+						muCOSAW32_gl_context_destroy((muCOSAW32_GL*)gl_context);
+						return 0;
+					} break;)
 
-			muCOSAResult muCOSAW32_window_set_dimensions(muCOSAW32_Window* win, uint32_m* data) {
-				// Get general window info for style
-				WINDOWINFO wi;
-				if (!GetWindowInfo(win->handles.hwnd, &wi)) {
-					return MUCOSA_WIN32_FAILED_SET_WINDOW_ATTRIB;
-				}
+					// X11
+					MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+						muCOSAX11_gl_context_destroy(gl_context);
+						return 0;
+					} break;)
 
-				// Calculate rect
-				RECT r;
-				r.left = r.top = 0;
-				r.right = data[0];
-				r.bottom = data[1];
+					// Wayland
+					MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+						muCOSAEGL_gl_context_destroy((muCOSAEGL_GL*)gl_context);
+						return 0;
+					} break;)
 
-				// Calculate appropriate window rect for dimensions
-				if (!AdjustWindowRect(&r, wi.dwStyle, FALSE)) {
-					return MUCOSA_WIN32_FAILED_SET_WINDOW_ATTRIB;
+					// Headless
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						muCOSAHL_gl_context_destroy(gl_context);
+						return 0;
+					} break;)
 				}
 
-				// Set window rect based on this
-				if (!SetWindowPos(win->handles.hwnd, HWND_TOP, 0, 0, r.right-r.left, r.bottom-r.top, SWP_NOACTIVATE | SWP_NOZORDER | SWP_NOMOVE)) {
-					return MUCOSA_WIN32_FAILED_SET_WINDOW_ATTRIB;
-				}
-				return MUCOSA_SUCCESS;
+				// To avoid parameter warnings in certain circumstances
+				if (win) {} if (gl_context) {}
+
+				// Fallback for non-OpenGL support:
+				#else
+				return 0;
+				if (context) {} if (win) {} if (gl_context) {}
+				#endif
 			}
 
-		/* Position */
+			MUDEF void MUCOSA_UNLOCKED(muCOSA_gl_bind)(muCOSAContext* context, muCOSAResult* result, muWindow win, muGLContext gl_context) {
+				#ifdef MU_SUPPORT_OPENGL
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-			muCOSAResult muCOSAW32_window_get_position(muCOSAW32_Window* win, int32_m* data) {
-				// Get window rect
-				RECT r;
-				if (!GetWindowRect(win->handles.hwnd, &r)) {
-					return MUCOSA_WIN32_FAILED_GET_WINDOW_ATTRIB;
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: return; break;
+
+					// Win32
+					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+						muCOSAResult res = muCOSAW32_gl_bind((muCOSAW32_GL*)gl_context);
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+						return;
+					} break;)
+
+					// X11
+					MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+						muCOSAResult res = muCOSAX11_gl_bind((muCOSAX11_Context*)inner->context, gl_context);
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+						return;
+					} break;)
+
+					// Wayland
+					MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+						muCOSAResult res = muCOSAEGL_gl_bind(&((muCOSAWL_Context*)inner->context)->egl, (muCOSAEGL_GL*)gl_context);
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+						return;
+					} break;)
+
+					// Headless
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						muCOSAResult res = muCOSAHL_gl_bind((muCOSAHL_Context*)inner->context, gl_context);
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+						return;
+					} break;)
 				}
 
-				// Get frame extents
-				uint32_m fe[4];
-				muCOSAW32_window_get_frame_extents(win, fe);
+				// To avoid parameter warnings in certain circumstances
+				if (result) {} if (win) {} if (gl_context) {}
 
-				// Set position based on rect and relative frame extents
-				data[0] = (int32_m)(r.left) + (int32_m)(fe[0]);
-				data[1] = (int32_m)(r.top) + (int32_m)(fe[2]);
-				return MUCOSA_SUCCESS;
+				// Fallback for non-OpenGL support:
+				#else
+				MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_GRAPHICS_API)
+				return;
+				if (context) {} if (result) {} if (win) {} if (gl_context) {}
+				#endif
 			}
 
-			muCOSAResult muCOSAW32_window_set_position(muCOSAW32_Window* win, int32_m* data) {
-				// Get frame extents
-				uint32_m fe[4];
-				muCOSAW32_window_get_frame_extents(win, fe);
+			MUDEF void MUCOSA_UNLOCKED(muCOSA_gl_swap_buffers)(muCOSAContext* context, muCOSAResult* result, muWindow win) {
+				#ifdef MU_SUPPORT_OPENGL
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-				// Translate x and y based on extents
-				int32_m x = data[0] - (int32_m)(fe[0]);
-				int32_m y = data[1] - (int32_m)(fe[2]);
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: return; break;
 
-				// Set window position
-				if (!SetWindowPos(win->handles.hwnd, HWND_TOP, x, y, 0, 0, SWP_NOACTIVATE | SWP_NOZORDER | SWP_NOSIZE)) {
-					return MUCOSA_WIN32_FAILED_SET_WINDOW_ATTRIB;
-				}
-				return MUCOSA_SUCCESS;
-			}
+					// Win32
+					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+						muCOSAResult res = muCOSAW32_gl_swap_buffers((muCOSAW32_Window*)win);
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+						return;
+					} break;)
 
-		/* Keymaps */
+					// X11
+					MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+						muCOSAResult res = muCOSAX11_gl_swap_buffers((muCOSAX11_Context*)inner->context, (muCOSAX11_Window*)win);
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+						return;
+					} break;)
 
-			muCOSAResult muCOSAW32_window_get_keyboard_map(muCOSAW32_Window* win, muBool** data) {
-				// Point to keyboard keymap
-				*data = win->keymaps.keyboard;
-				return MUCOSA_SUCCESS;
-			}
+					// Wayland
+					MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+						muCOSAResult res = muCOSAEGL_gl_swap_buffers(&((muCOSAWL_Context*)inner->context)->egl, &((muCOSAWL_Window*)win)->handles.egl);
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+						return;
+					} break;)
+				}
 
-			muCOSAResult muCOSAW32_window_get_keystate_map(muCOSAW32_Window* win, muBool** data) {
-				// Point to keystate keymap
-				*data = win->keymaps.keystates;
-				return MUCOSA_SUCCESS;
-			}
+				// To avoid parameter warnings in certain circumstances
+				if (result) {} if (win) {}
 
-			muCOSAResult muCOSAW32_window_get_mouse_map(muCOSAW32_Window* win, muBool** data) {
-				// Point to mouse keymap
-				*data = win->keymaps.mouse;
-				return MUCOSA_SUCCESS;
+				// Fallback for non-OpenGL support:
+				#else
+				MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_GRAPHICS_API)
+				return;
+				if (context) {} if (result) {} if (win) {}
+				#endif
 			}
 
-		/* Cursor */
+			MUDEF void* MUCOSA_UNLOCKED(muCOSA_gl_get_proc_address)(muCOSAContext* context, const char* name) {
+				#ifdef MU_SUPPORT_OPENGL
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-			muCOSAResult muCOSAW32_window_get_cursor_pos(muCOSAW32_Window* win, int32_m* data) {
-				// Get cursor position
-				POINT p;
-				if (!GetCursorPos(&p)) {
-					return MUCOSA_WIN32_FAILED_GET_WINDOW_ATTRIB;
-				}
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: return 0; break;
 
-				// Get window position
-				int32_m wpos[2];
-				muCOSAResult res = muCOSAW32_window_get_position(win, wpos);
-				if (muCOSA_result_is_fatal(res)) {
-					return MUCOSA_WIN32_FAILED_GET_WINDOW_ATTRIB;
-				}
+					// Win32
+					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+						return muCOSAW32_gl_get_proc_address(name);
+					} break;)
 
-				// Retrieve cursor position relative to window
-				data[0] = p.x-wpos[0];
-				data[1] = p.y-wpos[1];
-				return res;
-			}
+					// X11
+					MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+						return muCOSAX11_gl_get_proc_address(name);
+					} break;)
 
-			muCOSAResult muCOSAW32_window_set_cursor_pos(muCOSAW32_Window* win, int32_m* data) {
-				// Get window position
-				int32_m wpos[2];
-				muCOSAResult res = muCOSAW32_window_get_position(win, wpos);
-				if (muCOSA_result_is_fatal(res)) {
-					return MUCOSA_WIN32_FAILED_SET_WINDOW_ATTRIB;
-				}
+					// Wayland
+					MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+						return muCOSAEGL_gl_get_proc_address(name);
+					} break;)
 
-				// Set cursor position relative to window
-				if (!SetCursorPos(wpos[0]+data[0], wpos[1]+data[1])) {
-					return MUCOSA_WIN32_FAILED_SET_WINDOW_ATTRIB;
+					// Headless
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						return muCOSAHL_gl_get_proc_address(name);
+					} break;)
 				}
-				return res;
-			}
 
-			muCOSAResult muCOSAW32_window_get_cursor_style(muCOSAW32_Window* win, muCursorStyle* data) {
-				// Set data to cursor style
-				*data = win->states.cursor_style;
-				return MUCOSA_SUCCESS;
-			}
+				// To avoid parameter warnings in certain circumstances
+				if (name) {}
 
-			muCOSAResult muCOSAW32_window_set_cursor_style(muCOSAW32_Window* win, muCursorStyle* data) {
-				// Set internal storage to cursor style
-				win->states.cursor_style = *data;
-				// Destroy cursor
-				DestroyCursor(win->handles.hcursor);
-				// Load cursor
-				win->handles.hcursor = LoadCursor(0, (LPCSTR)muCOSAW32_muCOSA_cursor_to_W32(*data));
-				// Set cursor
-				SetCursor(win->handles.hcursor);
-				return MUCOSA_SUCCESS;
+				// Fallback for non-OpenGL support:
+				#else
+				return 0;
+				if (context) {} if (name) {}
+				#endif
 			}
 
-		/* Scroll */
+			MUDEF muBool MUCOSA_UNLOCKED(muCOSA_gl_swap_interval)(muCOSAContext* context, muCOSAResult* result, int interval) {
+				#ifdef MU_SUPPORT_OPENGL
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-			void muCOSAW32_window_get_scroll(muCOSAW32_Window* win, int32_m* data) {
-				// Give scroll level
-				*data = win->props.scroll_level;
-			}
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: return 0; break;
 
-			void muCOSAW32_window_set_scroll(muCOSAW32_Window* win, int32_m* data) {
-				// Overwrite scroll level
-				win->props.scroll_level = *data;
-			}
+					// Win32
+					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+						return muCOSAW32_gl_swap_interval((muCOSAW32_Context*)inner->context, result, interval);
+					} break;)
 
-		/* Callbacks */
+					// X11
+					MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+						return muCOSAX11_gl_swap_interval((muCOSAX11_Context*)inner->context, result, interval);
+					} break;)
 
-			void muCOSAW32_window_set_callback(muCOSAW32_Window* win, muWindowAttrib attrib, void* fun) {
-				switch (attrib) {
-					case MU_WINDOW_DIMENSIONS_CALLBACK: {
-						mu_memcpy(&win->callbacks.dimensions, fun, sizeof(win->callbacks.dimensions));
-					} break;
-					case MU_WINDOW_POSITION_CALLBACK: {
-						mu_memcpy(&win->callbacks.position, fun, sizeof(win->callbacks.position));
-					} break;
-					case MU_WINDOW_KEYBOARD_CALLBACK: {
-						mu_memcpy(&win->callbacks.keyboard, fun, sizeof(win->callbacks.keyboard));
-					} break;
-					case MU_WINDOW_KEYSTATE_CALLBACK: {
-						mu_memcpy(&win->callbacks.keystate, fun, sizeof(win->callbacks.keystate));
-					} break;
-					case MU_WINDOW_MOUSE_KEY_CALLBACK: {
-						mu_memcpy(&win->callbacks.mouse_key, fun, sizeof(win->callbacks.mouse_key));
-					} break;
-					case MU_WINDOW_CURSOR_CALLBACK: {
-						mu_memcpy(&win->callbacks.cursor, fun, sizeof(win->callbacks.cursor));
-					} break;
-					case MU_WINDOW_SCROLL_CALLBACK: {
-						mu_memcpy(&win->callbacks.scroll, fun, sizeof(win->callbacks.scroll));
-					} break;
+					// Wayland
+					MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+						return muCOSAEGL_gl_swap_interval(&((muCOSAWL_Context*)inner->context)->egl, result, interval);
+					} break;)
 				}
-			}
-
-		/* Text input */
 
-			void muCOSAW32_window_update_text_cursor(muCOSAResult* result, muCOSAW32_Window* win, uint32_m cx, uint32_m cy);
-			void muCOSAW32_window_get_text_input(muCOSAResult* result, muCOSAW32_Window* win, uint32_m cx, uint32_m cy, void (*callback)(muWindow, uint8_m*)) {
-				// Associate IMM context with this window
-				if (!ImmAssociateContextEx(win->handles.hwnd, NULL, IACE_DEFAULT)) {
-					MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_ASSOCIATE_IMM)
-					return;
-				}
+				// To avoid parameter warnings in certain circumstances
+				if (result) {} if (interval) {}
 
-				// Set callback
-				win->props.text_input_callback = callback;
-				// Update text cursor position
-				muCOSAW32_window_update_text_cursor(0, win, cx, cy);
+				// Fallback for non-OpenGL support
+				#else
+				MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_GRAPHICS_API)
+				return 0;
+				if (context) {} if (result) {} if (interval) {}
+				#endif
 			}
 
-			void muCOSAW32_window_let_text_input(muCOSAW32_Window* win) {
-				// Set callback to nothing
-				win->props.text_input_callback = 0;
-				// Deassociate IMM context
-				ImmAssociateContextEx(win->handles.hwnd, NULL, 0);
-			}
+		/* Vulkan */
 
-			void muCOSAW32_window_update_text_cursor(muCOSAResult* result, muCOSAW32_Window* win, uint32_m cx, uint32_m cy) {
-				// Do nothing if text input isn't being taken
-				if (!win->props.text_input_callback) {
-					return;
-				}
+			MUDEF const char** MUCOSA_UNLOCKED(muCOSA_vk_get_instance_extensions)(muCOSAContext* context, muCOSAResult* result, size_m* count) {
+				#ifdef MU_SUPPORT_VULKAN
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-				// Might not be a good idea to keep grabbing an releasing IMM context,
-				// but the entire IMM is so fragile that the smallest change makes it
-				// not function at all. So, I'm keeping it like this :L
+				// Do things based on window system
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_GRAPHICS_API) return 0; break;
 
-				// Get IMM context handle
-				win->handles.imc = ImmGetContext(win->handles.hwnd);
+					// Win32
+					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+						*count = 2;
+						return muCOSAW32_vk_extensions;
+					} break;)
 
-				// Fill out composition form
-				COMPOSITIONFORM cf = MU_ZERO_STRUCT(COMPOSITIONFORM);
-				cf.dwStyle = CFS_FORCE_POSITION;
-				cf.ptCurrentPos.x = cx;
-				cf.ptCurrentPos.y = cy;
+					// X11
+					MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+						*count = 2;
+						return muCOSAX11_vk_extensions;
+					} break;)
 
-				// Send composition form
-				if (!ImmSetCompositionWindow(win->handles.imc, &cf)) {
-					MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_SET_COMPOSITION_WINDOW_POSITION)
+					// Wayland
+					MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+						*count = 2;
+						return muCOSAWL_vk_extensions;
+					} break;)
 				}
 
-				// Release IMM context handle
-				ImmReleaseContext(win->handles.hwnd, win->handles.imc);
+				// To avoid parameter warnings in certain circumstances
+				if (count) {}
+
+				// Fallback for non-Vulkan support
+				#else
+				MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_GRAPHICS_API)
+				return 0;
+				if (context) {} if (result) {} if (count) {}
+				#endif
 			}
 
-		/* OpenGL */
+			MUDEF void MUCOSA_UNLOCKED(muCOSA_vk_create_surface)(muCOSAContext* context, muCOSAResult* result, muWindow win, void* instance, void* allocator, void* surface) {
+				#ifdef MU_SUPPORT_VULKAN
+				// Get inner from context
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-		#ifdef MU_SUPPORT_OPENGL
+				// Do things based on window system
+				muCOSAResult res = MUCOSA_FAILED_UNSUPPORTED_GRAPHICS_API;
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: break;
 
-			struct muCOSAW32_GL {
-				HDC dc;
-				HGLRC hgl;
-			};
-			typedef struct muCOSAW32_GL muCOSAW32_GL;
+					// Win32
+					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+						res = muCOSAW32_vk_create_surface((muCOSAW32_Window*)win, instance, allocator, surface);
+					} break;)
 
-			void* muCOSAW32_gl_context_create(muCOSAW32_Context* context, muCOSAResult* result, muCOSAW32_Window* win, muGraphicsAPI api) {
-				// Allocate memory for context
-				muCOSAW32_GL* gl = (muCOSAW32_GL*)mu_malloc(sizeof(muCOSAW32_GL));
-				if (!gl) {
-					MU_SET_RESULT(result, MUCOSA_FAILED_MALLOC)
-					return 0;
-				}
-				gl->dc = win->handles.dc;
+					// X11
+					MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+						res = muCOSAX11_vk_create_surface((muCOSAX11_Window*)win, instance, allocator, surface);
+					} break;)
 
-				// Create OpenGL context
-				muPixelFormat* format = 0;
-				if (win->props.use_format) {
-					format = &win->props.format;
+					// Wayland
+					MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+						res = muCOSAWL_vk_create_surface((muCOSAWL_Context*)inner->context, (muCOSAWL_Window*)win, instance, allocator, surface);
+					} break;)
 				}
-				muCOSAResult res = muCOSAW32_create_opengl_context(win->handles.dc, win->props.pixel_format, &context->wgl, format, &gl->hgl, api, &win->props.format_set);
+
 				if (res != MUCOSA_SUCCESS) {
 					MU_SET_RESULT(result, res)
-					if (muCOSA_result_is_fatal(res)) {
-						mu_free(gl);
-						gl = 0;
-					}
 				}
-				return gl;
-			}
-
-			void muCOSAW32_gl_context_destroy(muCOSAW32_GL* gl) {
-				wglDeleteContext(gl->hgl);
-				mu_free(gl);
-			}
 
-			muCOSAResult muCOSAW32_gl_bind(muCOSAW32_GL* gl) {
-				if (!wglMakeCurrent(gl->dc, gl->hgl)) {
-					return MUCOSA_WIN32_FAILED_SET_WGL_CONTEXT;
-				}
-				return MUCOSA_SUCCESS;
-			}
+				// To avoid parameter warnings in certain circumstances
+				if (win) {} if (instance) {} if (allocator) {} if (surface) {}
 
-			muCOSAResult muCOSAW32_gl_swap_buffers(muCOSAW32_Window* win) {
-				if (!SwapBuffers(win->handles.dc)) {
-					return MUCOSA_WIN32_FAILED_SWAP_WGL_BUFFERS;
-				}
-				return MUCOSA_SUCCESS;
+				// Fallback for non-Vulkan support
+				#else
+				MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_GRAPHICS_API)
+				return;
+				if (context) {} if (result) {} if (win) {} if (instance) {} if (allocator) {} if (surface) {}
+				#endif
 			}
 
-			void* muCOSAW32_gl_get_proc_address(const char* name) {
-				// Get proc address based on name
-				PROC p = (PROC)wglGetProcAddress(name);
+	/* Time */
 
-				// If failed:
-				if (p == 0
-					|| (p == (PROC)1)
-					|| (p == (PROC)2)
-					|| (p == (PROC)3)
-					|| (p == (PROC)-1)
-				) {
-					// Try loading from DLL itself
-					HMODULE module = LoadLibraryA("opengl32.dll");
-					p = (PROC)GetProcAddress(module, name);
-				}
+		MUDEF double MUCOSA_UNLOCKED(muCOSA_fixed_time_get)(muCOSAContext* context) {
+			// Get inner from context
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-				// Convert to void* in a way that avoids warnings
-				void* vptr = 0;
-				mu_memcpy(&vptr, &p, sizeof(void*));
-				return vptr;
-			}
+			// Do things based on window system
+			switch (MUCOSA_SYSTEM(inner)) {
+				default: return 0.0; break;
 
-			muBool muCOSAW32_gl_swap_interval(muCOSAW32_Context* context, muCOSAResult* result, int interval) {
-				// If the swap interval function was not found when loading, quit
-				if (!context->wgl.SwapInterval) {
-					MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_FIND_WGL_FUNCTION)
-					return 0;
-				}
+				// Win32
+				MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+					return muCOSAW32_fixed_time_get((muCOSAW32_Context*)inner->context);
+				} break;)
 
-				// Return a call to it if we've found it
-				return context->wgl.SwapInterval(interval);
+				// X11
+				MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+					return muCOSAPOSIX_fixed_time_get(&((muCOSAX11_Context*)inner->context)->time);
+				} break;)
+
+				// Wayland
+				MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+					return muCOSAPOSIX_fixed_time_get(&((muCOSAWL_Context*)inner->context)->time);
+				} break;)
+
+				// Headless
+				MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+					return muCOSAHL_fixed_time_get((muCOSAHL_Context*)inner->context);
+				} break;)
 			}
+		}
 
-		#endif /* MU_SUPPORT_OPENGL */
+		MUDEF double MUCOSA_UNLOCKED(muCOSA_time_get)(muCOSAContext* context) {
+			// Get inner from context
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-	#endif /* MUCOSA_WIN32 */
+			// Do things based on window system
+			switch (MUCOSA_SYSTEM(inner)) {
+				default: return 0.0; break;
 
-	/* Inner */
+				// Win32
+				MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+					return muCOSAW32_time_get((muCOSAW32_Context*)inner->context);
+				} break;)
 
-		// Inner struct
-		struct muCOSA_Inner {
-			muWindowSystem system;
-			void* context;
-		};
-		typedef struct muCOSA_Inner muCOSA_Inner;
+				// X11
+				MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+					return muCOSAPOSIX_time_get(&((muCOSAX11_Context*)inner->context)->time);
+				} break;)
 
-		// Determines the best window system
-		muWindowSystem muCOSA_best_window_system(void) {
-			#ifdef MUCOSA_WIN32
-				return MU_WINDOW_WIN32;
-			#else
-				return 0;
-			#endif
-		}
+				// Wayland
+				MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+					return muCOSAPOSIX_time_get(&((muCOSAWL_Context*)inner->context)->time);
+				} break;)
 
-		// Creates a valid inner struct based on the requested system
-		muCOSAResult muCOSA_inner_create(muCOSA_Inner* inner, muWindowSystem system) {
-			// Find best window system
-			if (system == 0) {
-				system = muCOSA_best_window_system();
+				// Headless
+				MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+					return muCOSAHL_time_get((muCOSAHL_Context*)inner->context);
+				} break;)
 			}
-			inner->system = system;
+		}
 
-			// Create context based on system
-			switch (system) {
-				// Unknown/Unsupported/None supported:
-				default: return MUCOSA_FAILED_NULL_WINDOW_SYSTEM; break;
+		MUDEF void MUCOSA_UNLOCKED(muCOSA_time_set)(muCOSAContext* context, double time) {
+			// Get inner from context
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+
+			// Do things based on window system
+			switch (MUCOSA_SYSTEM(inner)) {
+				default: return; break;
 
 				// Win32
-				MUCOSA_WIN32_CALL(
-					case MU_WINDOW_WIN32: {
-						// Allocate context
-						inner->context = mu_malloc(sizeof(muCOSAW32_Context));
-						if (!inner->context) {
-							return MUCOSA_FAILED_MALLOC;
-						}
+				MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+					muCOSAW32_time_set((muCOSAW32_Context*)inner->context, time);
+					return;
+				} break;)
 
-						// Create context
-						muCOSAResult res = muCOSAW32_context_init((muCOSAW32_Context*)inner->context);
-						if (muCOSA_result_is_fatal(res)) {
-							mu_free(inner->context);
-						}
-						return res;
-					} break;
-				)
+				// X11
+				MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+					muCOSAPOSIX_time_set(&((muCOSAX11_Context*)inner->context)->time, time);
+					return;
+				} break;)
+
+				// Wayland
+				MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+					muCOSAPOSIX_time_set(&((muCOSAWL_Context*)inner->context)->time, time);
+					return;
+				} break;)
+
+				// Headless
+				MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+					muCOSAHL_time_set((muCOSAHL_Context*)inner->context, time);
+					return;
+				} break;)
 			}
+
+			// To avoid parameter warnings in certain cirumstances
+			if (time) {}
 		}
 
-		// Destroys inner struct based on system
-		void muCOSA_inner_destroy(muCOSA_Inner* inner) {
-			switch (inner->system) {
-				default: break;
+	/* Sleep */
+
+		MUDEF void MUCOSA_UNLOCKED(muCOSA_sleep)(muCOSAContext* context, double time) {
+			// Get inner from context
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+
+			// Do things based on window system
+			switch (MUCOSA_SYSTEM(inner)) {
+				default: return; break;
 
 				// Win32
-				MUCOSA_WIN32_CALL(
-					case MU_WINDOW_WIN32: {
-						// Destroy context
-						muCOSAW32_context_term((muCOSAW32_Context*)inner->context);
-					} break;
-				)
+				MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+					muCOSAW32_sleep(time);
+					return;
+				} break;)
+
+				// X11
+				MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+					muCOSAPOSIX_sleep(time);
+					return;
+				} break;)
+
+				// Wayland
+				MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+					muCOSAPOSIX_sleep(time);
+					return;
+				} break;)
+
+				// Headless
+				MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+					muCOSAHL_sleep((muCOSAHL_Context*)inner->context, time);
+					return;
+				} break;)
 			}
+
+			// To avoid parameter warnings in certain circumstances
+			if (time) {}
 		}
 
-	// Name call macro
-	#ifdef MUCOSA_NAMES
-		#define MUCOSA_NAME_CALL(...) __VA_ARGS__
-	#else
-		#define MUCOSA_NAME_CALL(...)
-	#endif
+	/* Clipboard */
 
-	/* Context */
+		MUDEF uint8_m* MUCOSA_UNLOCKED(muCOSA_clipboard_get)(muCOSAContext* context, muCOSAResult* result) {
+			// Get inner from context
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-		MUDEF void muCOSA_context_create(muCOSAContext* context, muWindowSystem system, muBool set_context) {
-			// Allocate context
-			context->inner = mu_malloc(sizeof(muCOSA_Inner));
-			if (!context->inner) {
-				context->result = MUCOSA_FAILED_MALLOC;
-				return;
-			}
+			// Do things based on window system
+			switch (MUCOSA_SYSTEM(inner)) {
+				default: return 0; break;
 
-			// Create context
-			context->result = muCOSA_inner_create((muCOSA_Inner*)context->inner, system);
-			if (muCOSA_result_is_fatal(context->result)) {
-				mu_free(context->inner);
-				return;
-			}
+				// Win32
+				MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+					return muCOSAW32_clipboard_get(result);
+				} break;)
 
-			// Set context if necessary
-			if (set_context) {
-				muCOSA_context_set(context);
-			}
-		}
+				// X11
+				MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+					return muCOSAX11_clipboard_get((muCOSAX11_Context*)inner->context, result);
+				} break;)
 
-		MUDEF void muCOSA_context_destroy(muCOSAContext* context) {
-			// Free and destroy if inner contents exist
-			if (context->inner) {
-				muCOSA_inner_destroy((muCOSA_Inner*)context->inner);
-				mu_free(context->inner);
+				// Wayland
+				MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+					return muCOSAWL_clipboard_get((muCOSAWL_Context*)inner->context, result);
+				} break;)
+
+				// Headless
+				MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+					return muCOSAHL_clipboard_get((muCOSAHL_Context*)inner->context, result);
+				} break;)
 			}
+
+			// To avoid unused parameter warnings in some circumstances
+			if (result) {}
 		}
 
-		// Global context
-		muCOSAContext* muCOSA_global_context = 0;
+		MUDEF void MUCOSA_UNLOCKED(muCOSA_clipboard_set)(muCOSAContext* context, muCOSAResult* result, uint8_m* data, size_m datalen) {
+			// Get inner from context
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-		// Set context
-		MUDEF void muCOSA_context_set(muCOSAContext* context) {
-			muCOSA_global_context = context;
-		}
+			// Do things based on window system
+			switch (MUCOSA_SYSTEM(inner)) {
+				default: return; break;
 
-		// Get window system
-		MUDEF muWindowSystem muCOSA_context_get_window_system(muCOSAContext* context) {
-			return ((muCOSA_Inner*)context->inner)->system;
-		}
+				// Win32
+				MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+					muCOSAW32_clipboard_set(result, data, datalen);
+					return;
+				} break;)
 
-	/* Window */
+				// X11
+				MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+					muCOSAX11_clipboard_set((muCOSAX11_Context*)inner->context, result, data, datalen);
+					return;
+				} break;)
 
-		/* Creation / Destruction */
+				// Wayland
+				MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+					muCOSAWL_clipboard_set((muCOSAWL_Context*)inner->context, result, data, datalen);
+					return;
+				} break;)
 
-			MUDEF muWindow muCOSA_window_create(muCOSAContext* context, muCOSAResult* result, muWindowInfo* info) {
-				// Get inner from context
-				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+				// Headless
+				MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+					muCOSAHL_clipboard_set((muCOSAHL_Context*)inner->context, result, data, datalen);
+					return;
+				} break;)
+			}
 
-				// Do thing based on window system
-				switch (inner->system) {
-					default: return 0; break;
+			// To avoid unused parameter warnings in some circumstances
+			if (result) {} if (data) {} if (datalen) {}
+		}
 
-					// Win32
-					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32 : {
-						// Allocate window memory
-						muCOSAW32_Window* win = (muCOSAW32_Window*)mu_malloc(sizeof(muCOSAW32_Window));
-						if (!win) {
-							MU_SET_RESULT(result, MUCOSA_FAILED_MALLOC)
-							return 0;
-						}
+	/* Thread safety */
 
-						// Create window
-						muCOSAResult res = muCOSAW32_window_create(info, win);
-						if (res != MUCOSA_SUCCESS) {
-							MU_SET_RESULT(result, res)
-							if (muCOSA_result_is_fatal(res)) {
-								mu_free(win);
-								MU_SET_RESULT(result, res)
-								return 0;
-							}
-						}
-						return win;
-					} break;)
-				}
+	// In thread-safe mode, each public function above is defined under its
+	// unlocked name, and is wrapped here by a function that holds the locks it
+	// needs while calling it. The context is always locked before a window, so
+	// that two threads can't each hold a lock that the other is waiting on.
 
-				// To avoid unused parameter warnings in some cases
-				if (result) {} if (info) {}
-			}
+	#ifdef MUCOSA_THREAD_SAFE
 
-			MUDEF muWindow muCOSA_window_destroy(muCOSAContext* context, muWindow win) {
-				// Get inner from context
-				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+		/* Locking */
 
-				// Do things based on window system
-				switch (inner->system) {
-					default: return 0; break;
+			#ifdef MUCOSA_EVENT_THREAD
+			muBool muCOSATS_on_event_thread(muCOSA_Inner* inner);
+			#endif
 
-					// Win32
-					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-						// Destroy window
-						muCOSAW32_window_destroy((muCOSAW32_Window*)win);
-						// Free memory
-						mu_free(win);
-						return 0;
-					} break;)
+			// Unlocks the context. In event-thread mode on X11, events that Xlib
+			// read from the connection while the context was locked (such as while
+			// waiting on a reply) sit in Xlib's queue, where the event thread,
+			// waiting on the connection, can't see them, so it's woken to handle
+			// them.
+			void muCOSATS_unlock_context(muCOSA_Inner* inner) {
+				#if defined(MUCOSA_EVENT_THREAD) && defined(MUCOSA_X11)
+				if (MUCOSA_SYSTEM(inner) == MU_WINDOW_X11 && !muCOSATS_on_event_thread(inner)) {
+					muCOSAX11_Context* x11 = (muCOSAX11_Context*)inner->context;
+					if (XEventsQueued(x11->display, QueuedAlready) > 0) {
+						muCOSAPOSIX_wake(&x11->wake);
+					}
 				}
-
-				// To avoid unused parameter warnings in some cases
-				if (win) {}
+				#endif
+				muCOSA_unlock(&inner->lock);
 			}
 
-		/* Main loop */
-
-			MUDEF muBool muCOSA_window_get_closed(muCOSAContext* context, muCOSAResult* result, muWindow win) {
-				// Get inner from context
-				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
-
-				// Do things based on window system
-				switch (inner->system) {
+			// Gets a window's lock
+			muCOSA_Lock* muCOSATS_window_get_lock(muCOSA_Inner* inner, muWindow win) {
+				switch (MUCOSA_SYSTEM(inner)) {
 					default: return 0; break;
 
 					// Win32
 					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-						return muCOSAW32_window_get_closed((muCOSAW32_Window*)win);
+						return &((muCOSAW32_Window*)win)->lock;
 					} break;)
-				}
-
-				// To avoid unused parameter warnings in some cases
-				if (result) {} if (win) {}
-			}
-
-			MUDEF void muCOSA_window_close(muCOSAContext* context, muWindow win) {
-				// Get inner from context
-				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
 
-				// Do things based on window system
-				switch (inner->system) {
-					default: return; break;
+					// X11
+					MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+						return &((muCOSAX11_Window*)win)->lock;
+					} break;)
 
-					// Win32
-					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-						muCOSAW32_window_close((muCOSAW32_Window*)win);
-						return;
+					// Wayland
+					MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+						return &((muCOSAWL_Window*)win)->lock;
+					} break;)
+
+					// Headless
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						return &((muCOSAHL_Window*)win)->lock;
 					} break;)
 				}
 
@@ -4373,455 +16636,907 @@ Uncommon pixel formats (such as no-alpha pixel formats) are not tested thoroughl
 				if (win) {}
 			}
 
-			MUDEF void muCOSA_window_update(muCOSAContext* context, muCOSAResult* result, muWindow win) {
-				// Get inner from context
-				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
-
-				// Do things based on window system
-				switch (inner->system) {
-					default: return; break;
-
-					// Win32
-					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-						muCOSAW32_window_update((muCOSAW32_Window*)win);
-						return;
-					} break;)
+			// Locks a window (if given) for a function, along with the context if the
+			// function uses anything shared between windows; this is always the case
+			// on window systems besides the headless one, as windows share the
+			// connection to the window system
+			void muCOSATS_lock_window(muCOSA_Inner* inner, muWindow win, muBool shared) {
+				if (shared || MUCOSA_SYSTEM(inner) != MU_WINDOW_HEADLESS) {
+					muCOSA_lock(&inner->lock);
 				}
+				if (win) {
+					muCOSA_lock(muCOSATS_window_get_lock(inner, win));
+				}
+			}
 
-				// To avoid unused parameter warnings in some cases
-				if (result) {} if (win) {}
+			void muCOSATS_unlock_window(muCOSA_Inner* inner, muWindow win, muBool shared) {
+				if (win) {
+					muCOSA_unlock(muCOSATS_window_get_lock(inner, win));
+				}
+				if (shared || MUCOSA_SYSTEM(inner) != MU_WINDOW_HEADLESS) {
+					muCOSATS_unlock_context(inner);
+				}
 			}
 
-		/* Get / Set */
+		#ifdef MUCOSA_EVENT_THREAD
 
-			MUDEF void muCOSA_window_get(muCOSAContext* context, muCOSAResult* result, muWindow win, muWindowAttrib attrib, void* data) {
-				// Get inner from context
-				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+		/* Event thread */
 
-				// Do things based on window system
-				switch (inner->system) {
-					default: return; break;
+			// In event-thread mode, each context has a thread that handles the
+			// events of the window system, locking the context while it does so,
+			// and waits on more without anything locked. Events are handed off to
+			// the threads using windows through their event queues without a lock,
+			// and are applied to keymaps read by those threads as they read the
+			// events, so that a thread's keymaps match the events that it's seen.
+			// On Win32, the event thread also creates every window (see "Event
+			// thread" in the Win32 section).
 
-					// Win32
-					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-						muCOSAResult res = MUCOSA_SUCCESS;
-						muCOSAW32_Window* w32_win = (muCOSAW32_Window*)win;
+			// Checks if the calling thread is the event thread
+			muBool muCOSATS_on_event_thread(muCOSA_Inner* inner) {
+				#ifdef _WIN32
+				return GetCurrentThreadId() == inner->thread.id;
+				#else
+				return pthread_equal(pthread_self(), inner->thread.handle) != 0;
+				#endif
+			}
 
-						// Do things based on attribute
-						switch (attrib) {
-							default: MU_SET_RESULT(result, MUCOSA_FAILED_UNKNOWN_WINDOW_ATTRIB) return; break;
+			// Gets the list of a context's windows
+			muCOSA_WindowList* muCOSATS_inner_get_windows(muCOSA_Inner* inner) {
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: return 0; break;
+					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: return &((muCOSAW32_Context*)inner->context)->windows; break;)
+					MUCOSA_X11_CALL(case MU_WINDOW_X11: return &((muCOSAX11_Context*)inner->context)->windows; break;)
+					MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: return &((muCOSAWL_Context*)inner->context)->windows; break;)
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: return &((muCOSAHL_Context*)inner->context)->windows; break;)
+				}
+			}
 
-							// Dimensions
-							case MU_WINDOW_DIMENSIONS: res = muCOSAW32_window_get_dimensions(w32_win, (uint32_m*)data); break;
-							// Position
-							case MU_WINDOW_POSITION: res = muCOSAW32_window_get_position(w32_win, (int32_m*)data); break;
-							// Keyboard keymap
-							case MU_WINDOW_KEYBOARD_MAP: res = muCOSAW32_window_get_keyboard_map(w32_win, (muBool**)data); break;
-							// Keystate keymap
-							case MU_WINDOW_KEYSTATE_MAP: res = muCOSAW32_window_get_keystate_map(w32_win, (muBool**)data); break;
-							// Mouse keymap
-							case MU_WINDOW_MOUSE_MAP: res = muCOSAW32_window_get_mouse_map(w32_win, (muBool**)data); break;
-							// Scroll
-							case MU_WINDOW_SCROLL_LEVEL: muCOSAW32_window_get_scroll(w32_win, (int32_m*)data); return; break;
-							// Cursor
-							case MU_WINDOW_CURSOR: res = muCOSAW32_window_get_cursor_pos(w32_win, (int32_m*)data); break;
-							// Cursor style
-							case MU_WINDOW_CURSOR_STYLE: res = muCOSAW32_window_get_cursor_style(w32_win, (muCursorStyle*)data); break;
-						}
+			// Gives a new window's queue its keymaps as of its creation
+			void muCOSATS_event_thread_init_keymaps(muCOSAContext* context, muWindow win) {
+				muCOSA_EventQueue* queue = muCOSA_window_get_event_queue((muCOSA_Inner*)context->inner, win);
+				muBool* map = 0;
+				muCOSA_window_get_unlocked(context, 0, win, MU_WINDOW_KEYBOARD_MAP, &map);
+				if (map) {
+					mu_memcpy(queue->keyboard, map, sizeof(queue->keyboard));
+				}
+				map = 0;
+				muCOSA_window_get_unlocked(context, 0, win, MU_WINDOW_KEYSTATE_MAP, &map);
+				if (map) {
+					mu_memcpy(queue->keystates, map, sizeof(queue->keystates));
+				}
+				map = 0;
+				muCOSA_window_get_unlocked(context, 0, win, MU_WINDOW_MOUSE_MAP, &map);
+				if (map) {
+					mu_memcpy(queue->mouse, map, sizeof(queue->mouse));
+				}
+			}
 
-						if (res != MUCOSA_SUCCESS) {
-							MU_SET_RESULT(result, res)
-						}
-						return;
-					} break;)
+			// Gets a keymap of a window as seen by the calling thread; returns if
+			// the attribute was a keymap. The event thread itself (such as from a
+			// callback) sees the keymaps as they're changed instead.
+			muBool muCOSATS_event_thread_get_keymap(muCOSA_Inner* inner, muWindow win, muWindowAttrib attrib, void* data) {
+				if (muCOSATS_on_event_thread(inner)) {
+					return MU_FALSE;
 				}
 
-				// To avoid unused parameter warnings in some cases
-				if (result) {} if (win) {} if (attrib) {} if (data) {}
+				muCOSA_EventQueue* queue = muCOSA_window_get_event_queue(inner, win);
+				switch (attrib) {
+					default: return MU_FALSE; break;
+					case MU_WINDOW_KEYBOARD_MAP: *(muBool**)data = queue->keyboard; break;
+					case MU_WINDOW_KEYSTATE_MAP: *(muBool**)data = queue->keystates; break;
+					case MU_WINDOW_MOUSE_MAP: *(muBool**)data = queue->mouse; break;
+				}
+				return MU_TRUE;
 			}
 
-			MUDEF void muCOSA_window_set(muCOSAContext* context, muCOSAResult* result, muWindow win, muWindowAttrib attrib, void* data) {
-				// Get inner from context
-				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
-
-				// Do things based on window system
-				switch (inner->system) {
-					default: return; break;
+			// Wakes the event thread on the headless window system, where it has
+			// nothing else to wake it up (for when input is injected, or the clock
+			// advances)
+			void muCOSATS_event_thread_wake(muCOSA_Inner* inner) {
+				muCOSA_signal_raise(&inner->thread.wake);
+			}
 
-					// Win32
-					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-						muCOSAResult res = MUCOSA_SUCCESS;
-						muCOSAW32_Window* w32_win = (muCOSAW32_Window*)win;
+			// Waits for the event thread to hand off events to a window
+			void muCOSATS_event_thread_wait(muCOSAContext* context, muCOSAResult* result, muWindow win, double timeout) {
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+				muCOSA_EventQueue* queue = muCOSA_window_get_event_queue(inner, win);
+				muBool waited = MU_FALSE;
 
-						// Do things based on attribute
-						switch (attrib) {
-							default: MU_SET_RESULT(result, MUCOSA_FAILED_UNKNOWN_WINDOW_ATTRIB) return; break;
+				for (;;) {
+					// Don't wait if events have already been handed off
+					size_m seen = muCOSA_signal_count(&inner->thread.handoff);
+					if (muCOSA_event_queue_has_new(queue)) {
+						return;
+					}
 
-							// Title
-							case MU_WINDOW_TITLE: res = muCOSAW32_window_set_title(w32_win, (char*)data); break;
-							// Dimensions
-							case MU_WINDOW_DIMENSIONS: res = muCOSAW32_window_set_dimensions(w32_win, (uint32_m*)data); break;
-							// Position
-							case MU_WINDOW_POSITION: res = muCOSAW32_window_set_position(w32_win, (int32_m*)data); break;
-							// Scroll
-							case MU_WINDOW_SCROLL_LEVEL: muCOSAW32_window_set_scroll(w32_win, (int32_m*)data); return; break;
-							// Cursor
-							case MU_WINDOW_CURSOR: res = muCOSAW32_window_set_cursor_pos(w32_win, (int32_m*)data); break;
-							// Cursor style
-							case MU_WINDOW_CURSOR_STYLE: res = muCOSAW32_window_set_cursor_style(w32_win, (muCursorStyle*)data); break;
-							// Callbacks
-							case MU_WINDOW_DIMENSIONS_CALLBACK: case MU_WINDOW_POSITION_CALLBACK:
-							case MU_WINDOW_KEYBOARD_CALLBACK: case MU_WINDOW_KEYSTATE_CALLBACK:
-							case MU_WINDOW_MOUSE_KEY_CALLBACK: case MU_WINDOW_CURSOR_CALLBACK:
-							case MU_WINDOW_SCROLL_CALLBACK: muCOSAW32_window_set_callback(w32_win, attrib, data); return; break;
+					// On the headless window system, input only comes in by being
+					// injected, so wait for injected input to be handled by the event
+					// thread; once there's none, wait like usual (advancing the clock)
+					#ifdef MUCOSA_HEADLESS
+					if (MUCOSA_SYSTEM(inner) == MU_WINDOW_HEADLESS) {
+						muCOSAHL_Window* hl_win = (muCOSAHL_Window*)win;
+						muCOSATS_lock_window(inner, win, MU_TRUE);
+						muBool pending = hl_win->input_len > 0 && !hl_win->states.closed;
+						if (!pending && !waited) {
+							muCOSA_window_wait_unlocked(context, result, win, timeout);
 						}
-
-						if (res != MUCOSA_SUCCESS) {
-							MU_SET_RESULT(result, res)
+						muCOSATS_unlock_window(inner, win, MU_TRUE);
+						if (!pending) {
+							muCOSATS_event_thread_wake(inner);
+							return;
 						}
-						return;
-					} break;)
+						muCOSA_signal_wait(&inner->thread.handoff, seen, -1.0);
+						waited = MU_TRUE;
+						continue;
+					}
+					#endif
+
+					// Wait for the next handoff
+					muCOSA_signal_wait(&inner->thread.handoff, seen, timeout);
+					return;
 				}
 
 				// To avoid unused parameter warnings in some cases
-				if (result) {} if (win) {} if (attrib) {} if (data) {}
+				if (result) {} if (waited) {}
 			}
 
-		/* Text input */
+			// Handles every event available
+			void muCOSATS_event_thread_pump(muCOSA_Inner* inner) {
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: break;
 
-			MUDEF void muCOSA_window_get_text_input(muCOSAContext* context, muCOSAResult* result, muWindow win, uint32_m text_cursor_x, uint32_m text_cursor_y, void (*callback)(muWindow window, uint8_m* data)) {
-				// Get inner from context
-				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+					// Win32 (messages are dispatched without the context locked, as the
+					// proc function locks it for each message)
+					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+						muCOSAW32_dispatch();
+						muCOSA_lock(&inner->lock);
+						muCOSAW32_context_refresh((muCOSAW32_Context*)inner->context);
+						muCOSA_unlock(&inner->lock);
+					} break;)
 
-				// Do things based on window system
-				switch (inner->system) {
-					default: return; break;
+					// X11
+					MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+						muCOSA_lock(&inner->lock);
+						muCOSAX11_context_update((muCOSAX11_Context*)inner->context);
+						muCOSA_unlock(&inner->lock);
+					} break;)
 
-					// Win32
-					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-						muCOSAW32_window_get_text_input(result, (muCOSAW32_Window*)win, text_cursor_x, text_cursor_y, callback);
-						return;
+					// Wayland
+					MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+						muCOSA_lock(&inner->lock);
+						muCOSAWL_context_update((muCOSAWL_Context*)inner->context);
+						muCOSA_unlock(&inner->lock);
 					} break;)
-				}
 
-				// To avoid unused parameter warnings in some cases
-				if (result) {} if (win) {} if (text_cursor_x) {} if (text_cursor_y) {} if (callback) {}
+					// Headless
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						muCOSA_lock(&inner->lock);
+						muCOSAHL_context_update((muCOSAHL_Context*)inner->context);
+						muCOSA_unlock(&inner->lock);
+					} break;)
+				}
 			}
 
-			MUDEF void muCOSA_window_let_text_input(muCOSAContext* context, muWindow win) {
-				// Get inner from context
-				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
-
-				// Do things based on window system
-				switch (inner->system) {
-					default: return; break;
+			// Waits for more events, or for the thread to be woken, given the
+			// amount of times the thread had been woken before handling events
+			void muCOSATS_event_thread_idle(muCOSA_Inner* inner, size_m wakes) {
+				switch (MUCOSA_SYSTEM(inner)) {
+					default: break;
 
 					// Win32
 					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-						muCOSAW32_window_let_text_input((muCOSAW32_Window*)win);
-						return;
+						muCOSAW32_window_wait((muCOSAW32_Context*)inner->context, -1.0);
 					} break;)
-				}
-
-				// To avoid unused parameter warnings in some cases
-				if (win) {}
-			}
 
-			MUDEF void muCOSA_window_update_text_cursor(muCOSAContext* context, muCOSAResult* result, muWindow win, uint32_m x, uint32_m y) {
-				// Get inner from context
-				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+					// X11
+					MUCOSA_X11_CALL(case MU_WINDOW_X11: {
+						muCOSAX11_window_wait((muCOSAX11_Context*)inner->context, -1.0);
+					} break;)
 
-				// Do things based on window system
-				switch (inner->system) {
-					default: return; break;
+					// Wayland
+					MUCOSA_WAYLAND_CALL(case MU_WINDOW_WAYLAND: {
+						muCOSAWL_window_wait((muCOSAWL_Context*)inner->context, -1.0);
+					} break;)
 
-					// Win32
-					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-						muCOSAW32_window_update_text_cursor(result, (muCOSAW32_Window*)win, x, y);
-						return;
+					// Headless
+					MUCOSA_HEADLESS_CALL(case MU_WINDOW_HEADLESS: {
+						muCOSA_signal_wait(&inner->thread.wake, wakes, -1.0);
 					} break;)
 				}
 
 				// To avoid unused parameter warnings in some cases
-				if (result) {} if (win) {} if (x) {} if (y) {}
+				if (wakes) {}
 			}
 
-		/* OpenGL */
-
-			MUDEF muGLContext muCOSA_gl_context_create(muCOSAContext* context, muCOSAResult* result, muWindow win, muGraphicsAPI api) {
-				#ifdef MU_SUPPORT_OPENGL
-				// Get inner from context
-				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
-
-				// Do things based on window system
-				switch (inner->system) {
-					default: return 0; break;
+			#ifdef _WIN32
+			DWORD WINAPI muCOSATS_event_thread_main(LPVOID data)
+			#else
+			void* muCOSATS_event_thread_main(void* data)
+			#endif
+			{
+				muCOSA_Inner* inner = (muCOSA_Inner*)data;
+				muCOSA_EventThread* thread = &inner->thread;
+
+				// Make the context current on this thread, so that callbacks
+				// can use the mu_* macros
+				#ifdef MUCOSA_THREAD_LOCAL_CONTEXT
+				muCOSA_context_set(thread->context);
+				#endif
 
-					// Win32
-					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-						return muCOSAW32_gl_context_create(
-							(muCOSAW32_Context*)inner->context, result,
-							(muCOSAW32_Window*)win, api
-						);
-					} break;)
+				// Create window for calls on Win32
+				MUCOSA_WIN32_CALL(if (MUCOSA_SYSTEM(inner) == MU_WINDOW_WIN32) {
+					thread->failed = !muCOSAW32_calls_create((muCOSAW32_Context*)inner->context);
+				})
+				// Let the creating thread know that this one is ready
+				muCOSA_signal_raise(&thread->handoff);
+
+				// Handle events until stopped (checking for being woken before
+				// checking if stopped, so that a wake from stopping isn't missed)
+				while (!thread->failed) {
+					size_m wakes = muCOSA_signal_count(&thread->wake);
+					if (muCOSA_atomic_load(&thread->stop)) {
+						break;
+					}
+					muCOSATS_event_thread_pump(inner);
+					// Wake threads waiting on events
+					muCOSA_signal_raise(&thread->handoff);
+					muCOSATS_event_thread_idle(inner, wakes);
 				}
 
-				// To avoid parameter warnings in certain circumstances
-				if (result) {} if (win) {} if (api) {}
+				// Destroy window for calls on Win32
+				MUCOSA_WIN32_CALL(if (MUCOSA_SYSTEM(inner) == MU_WINDOW_WIN32) {
+					muCOSAW32_calls_destroy((muCOSAW32_Context*)inner->context);
+				})
+				return 0;
+			}
 
-				// Fallback for non-OpenGL support:
+			void muCOSATS_event_thread_join(muCOSA_EventThread* thread) {
+				#ifdef _WIN32
+				WaitForSingleObject(thread->handle, INFINITE);
+				CloseHandle(thread->handle);
 				#else
-				MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_GRAPHICS_API)
-				return 0;
-				if (context) {} if (result) {} if (win) {} if (api) {}
+				pthread_join(thread->handle, 0);
 				#endif
 			}
 
-			MUDEF muGLContext muCOSA_gl_context_destroy(muCOSAContext* context, muWindow win, muGLContext gl_context) {
-				#ifdef MU_SUPPORT_OPENGL
-				// Get inner from context
+			muCOSAResult muCOSATS_event_thread_start(muCOSAContext* context) {
 				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+				muCOSA_EventThread* thread = &inner->thread;
+				thread->stop = 0;
+				thread->failed = MU_FALSE;
+				thread->context = context;
+
+				// Create signals
+				if (!muCOSA_signal_init(&thread->handoff)) {
+					return MUCOSA_FAILED_CREATE_LOCK;
+				}
+				if (!muCOSA_signal_init(&thread->wake)) {
+					muCOSA_signal_term(&thread->handoff);
+					return MUCOSA_FAILED_CREATE_LOCK;
+				}
 
-				// Do things based on window system
-				switch (inner->system) {
-					default: return 0; break;
+				// Create thread, keeping the context locked until its handle is
+				// stored, as the thread only checks it while the context is locked
+				muCOSA_lock(&inner->lock);
+				#ifdef _WIN32
+				thread->handle = CreateThread(0, 0, muCOSATS_event_thread_main, inner, 0, &thread->id);
+				muBool created = thread->handle != NULL;
+				#else
+				muBool created = pthread_create(&thread->handle, 0, muCOSATS_event_thread_main, inner) == 0;
+				#endif
+				// Wait for it to be ready
+				if (created) {
+					muCOSA_signal_wait(&thread->handoff, 0, -1.0);
+				}
+				muCOSA_unlock(&inner->lock);
 
-					// Win32
-					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-						muCOSAW32_gl_context_destroy((muCOSAW32_GL*)gl_context);
-						return 0;
-					} break;)
+				// Clean up if it failed
+				if (!created || thread->failed) {
+					if (created) {
+						muCOSATS_event_thread_join(thread);
+					}
+					muCOSA_signal_term(&thread->wake);
+					muCOSA_signal_term(&thread->handoff);
+					return MUCOSA_FAILED_CREATE_THREAD;
 				}
+				return MUCOSA_SUCCESS;
+			}
 
-				// To avoid parameter warnings in certain circumstances
-				if (win) {} if (gl_context) {}
+			void muCOSATS_event_thread_stop(muCOSAContext* context) {
+				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+				// Tell thread to stop + wake it up
+				muCOSA_atomic_store(&inner->thread.stop, 1);
+				muCOSA_context_wake(context);
+				// Wait for it to stop
+				muCOSATS_event_thread_join(&inner->thread);
+				muCOSA_signal_term(&inner->thread.wake);
+				muCOSA_signal_term(&inner->thread.handoff);
+			}
 
-				// Fallback for non-OpenGL support:
-				#else
-				return 0;
-				if (context) {} if (win) {} if (gl_context) {}
+			// Arguments of a public function called on the event thread on behalf
+			// of another thread, along with its return value
+			struct muCOSA_CallArgs {
+				muCOSAContext* context;
+				muCOSAResult* result;
+				muWindow win;
+				muWindowAttrib attrib;
+				void* data;
+				uint32_m x;
+				uint32_m y;
+				void (*callback)(muWindow window, uint8_m* data);
+				muWindow ret;
+			};
+			typedef struct muCOSA_CallArgs muCOSA_CallArgs;
+
+			// Calls a function on the event thread with the given arguments if the
+			// window system needs it (Win32) and the calling thread isn't the
+			// event thread; returns if it was called
+			muBool muCOSATS_event_thread_call(muCOSA_Inner* inner, void (*fn)(void* data), muCOSA_CallArgs* args) {
+				#ifdef MUCOSA_WIN32
+				if (MUCOSA_SYSTEM(inner) == MU_WINDOW_WIN32 && !muCOSATS_on_event_thread(inner)) {
+					muCOSAW32_Call call;
+					call.fn = fn;
+					call.data = args;
+					muCOSAW32_call((muCOSAW32_Context*)inner->context, &call);
+					return MU_TRUE;
+				}
 				#endif
+				return MU_FALSE;
+				// To avoid unused parameter warnings in some cases
+				if (inner) {} if (fn) {} if (args) {}
 			}
 
-			MUDEF void muCOSA_gl_bind(muCOSAContext* context, muCOSAResult* result, muWindow win, muGLContext gl_context) {
-				#ifdef MU_SUPPORT_OPENGL
-				// Get inner from context
-				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			// Functions called on the event thread
+			void muCOSATS_call_window_create(void* data) {
+				muCOSA_CallArgs* args = (muCOSA_CallArgs*)data;
+				args->ret = muCOSA_window_create(args->context, args->result, (muWindowInfo*)args->data);
+			}
+			void muCOSATS_call_window_destroy(void* data) {
+				muCOSA_CallArgs* args = (muCOSA_CallArgs*)data;
+				args->ret = muCOSA_window_destroy(args->context, args->win);
+			}
+			void muCOSATS_call_window_set(void* data) {
+				muCOSA_CallArgs* args = (muCOSA_CallArgs*)data;
+				muCOSA_window_set(args->context, args->result, args->win, args->attrib, args->data);
+			}
+			void muCOSATS_call_window_get_text_input(void* data) {
+				muCOSA_CallArgs* args = (muCOSA_CallArgs*)data;
+				muCOSA_window_get_text_input(args->context, args->result, args->win, args->x, args->y, args->callback);
+			}
+			void muCOSATS_call_window_let_text_input(void* data) {
+				muCOSA_CallArgs* args = (muCOSA_CallArgs*)data;
+				muCOSA_window_let_text_input(args->context, args->win);
+			}
+			void muCOSATS_call_window_update_text_cursor(void* data) {
+				muCOSA_CallArgs* args = (muCOSA_CallArgs*)data;
+				muCOSA_window_update_text_cursor(args->context, args->result, args->win, args->x, args->y);
+			}
 
-				// Do things based on window system
-				switch (inner->system) {
-					default: return; break;
+		#endif /* MUCOSA_EVENT_THREAD */
 
-					// Win32
-					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-						muCOSAResult res = muCOSAW32_gl_bind((muCOSAW32_GL*)gl_context);
-						if (res != MUCOSA_SUCCESS) {
-							MU_SET_RESULT(result, res)
-						}
-						return;
-					} break;)
-				}
+		/* Locked functions */
+
+		MUDEF muWindow muCOSA_window_create(muCOSAContext* context, muCOSAResult* result, muWindowInfo* info) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			#ifdef MUCOSA_EVENT_THREAD
+			muCOSA_CallArgs args = MU_ZERO_STRUCT(muCOSA_CallArgs);
+			args.context = context;
+			args.result = result;
+			args.data = info;
+			if (muCOSATS_event_thread_call(inner, muCOSATS_call_window_create, &args)) {
+				return args.ret;
+			}
+			#endif
+			muCOSA_lock(&inner->lock);
+			muWindow win = muCOSA_window_create_unlocked(context, result, info);
+			// Create the window's lock (before anything else can use the window,
+			// as the context is still locked)
+			if (win && !muCOSA_lock_init(muCOSATS_window_get_lock(inner, win))) {
+				win = muCOSA_window_destroy_unlocked(context, win);
+				MU_SET_RESULT(result, MUCOSA_FAILED_CREATE_LOCK)
+			}
+			#ifdef MUCOSA_EVENT_THREAD
+			if (win) {
+				muCOSATS_event_thread_init_keymaps(context, win);
+			}
+			#endif
+			muCOSATS_unlock_context(inner);
+			return win;
+		}
+
+		MUDEF muWindow muCOSA_window_destroy(muCOSAContext* context, muWindow win) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			#ifdef MUCOSA_EVENT_THREAD
+			muCOSA_CallArgs args = MU_ZERO_STRUCT(muCOSA_CallArgs);
+			args.context = context;
+			args.win = win;
+			if (muCOSATS_event_thread_call(inner, muCOSATS_call_window_destroy, &args)) {
+				return args.ret;
+			}
+			#endif
+			muCOSA_lock(&inner->lock);
+			// Destroy the window's lock along with it (no other thread can be
+			// using the window at this point; see "Thread-safe mode")
+			muCOSA_lock_term(muCOSATS_window_get_lock(inner, win));
+			win = muCOSA_window_destroy_unlocked(context, win);
+			muCOSATS_unlock_context(inner);
+			return win;
+		}
+
+		// (Waiting and sleeping only block on other window systems, so they hold
+		// no lock, letting other threads use the context in the meantime; on the
+		// headless window system, they advance the context's clock instead)
+
+		MUDEF void muCOSA_window_wait(muCOSAContext* context, muCOSAResult* result, muWindow win, double timeout) {
+			// (In event-thread mode, this waits on the event thread instead)
+			#ifdef MUCOSA_EVENT_THREAD
+			muCOSATS_event_thread_wait(context, result, win, timeout);
+			#else
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muBool headless = MUCOSA_SYSTEM(inner) == MU_WINDOW_HEADLESS;
+			if (headless) {
+				muCOSATS_lock_window(inner, win, MU_TRUE);
+			}
+			muCOSA_window_wait_unlocked(context, result, win, timeout);
+			if (headless) {
+				muCOSATS_unlock_window(inner, win, MU_TRUE);
+			}
+			#endif
+		}
+
+		MUDEF void muCOSA_sleep(muCOSAContext* context, double time) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muBool headless = MUCOSA_SYSTEM(inner) == MU_WINDOW_HEADLESS;
+			if (headless) {
+				muCOSA_lock(&inner->lock);
+			}
+			muCOSA_sleep_unlocked(context, time);
+			if (headless) {
+				muCOSATS_unlock_context(inner);
+				#ifdef MUCOSA_EVENT_THREAD
+				muCOSATS_event_thread_wake(inner);
+				#endif
+			}
+		}
 
-				// To avoid parameter warnings in certain circumstances
-				if (result) {} if (win) {} if (gl_context) {}
+		MUDEF void muCOSA_context_dispatch_pending(muCOSAContext* context, muCOSAResult* result) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSA_lock(&inner->lock);
+			muCOSA_context_dispatch_pending_unlocked(context, result);
+			muCOSATS_unlock_context(inner);
+		}
 
-				// Fallback for non-OpenGL support:
-				#else
-				MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_GRAPHICS_API)
-				return;
-				if (context) {} if (result) {} if (win) {} if (gl_context) {}
-				#endif
+		MUDEF void muCOSA_context_update(muCOSAContext* context, muCOSAResult* result) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSA_lock(&inner->lock);
+			// (In event-thread mode, this catches up with the events handed off to
+			// every window instead, waking the event thread on the headless window
+			// system like updating a window does)
+			#ifdef MUCOSA_EVENT_THREAD
+			muCOSA_WindowList* windows = muCOSATS_inner_get_windows(inner);
+			for (size_m i = 0; i < windows->wincount; ++i) {
+				if (windows->windows[i]) {
+					muCOSA_event_queue_catch_up(muCOSA_window_get_event_queue(inner, windows->windows[i]));
+				}
 			}
+			if (MUCOSA_SYSTEM(inner) == MU_WINDOW_HEADLESS) {
+				muCOSATS_event_thread_wake(inner);
+			}
+			if (result) {}
+			#else
+			muCOSA_context_update_unlocked(context, result);
+			#endif
+			muCOSATS_unlock_context(inner);
+		}
 
-			MUDEF void muCOSA_gl_swap_buffers(muCOSAContext* context, muCOSAResult* result, muWindow win) {
-				#ifdef MU_SUPPORT_OPENGL
-				// Get inner from context
-				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+		MUDEF muBool muCOSA_window_get_closed(muCOSAContext* context, muCOSAResult* result, muWindow win) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSATS_lock_window(inner, win, MU_FALSE);
+			muBool res = muCOSA_window_get_closed_unlocked(context, result, win);
+			muCOSATS_unlock_window(inner, win, MU_FALSE);
+			return res;
+		}
 
-				// Do things based on window system
-				switch (inner->system) {
-					default: return; break;
+		MUDEF void muCOSA_window_close(muCOSAContext* context, muWindow win) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSATS_lock_window(inner, win, MU_FALSE);
+			muCOSA_window_close_unlocked(context, win);
+			muCOSATS_unlock_window(inner, win, MU_FALSE);
+		}
 
-					// Win32
-					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-						muCOSAResult res = muCOSAW32_gl_swap_buffers((muCOSAW32_Window*)win);
-						if (res != MUCOSA_SUCCESS) {
-							MU_SET_RESULT(result, res)
-						}
-						return;
-					} break;)
-				}
+		MUDEF void muCOSA_window_update(muCOSAContext* context, muCOSAResult* result, muWindow win) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			// (In event-thread mode, this catches up with the events handed off to
+			// the window instead, without locking anything; on the headless window
+			// system, it also wakes the event thread to inject the next part of
+			// any replay)
+			#ifdef MUCOSA_EVENT_THREAD
+			muCOSA_event_queue_catch_up(muCOSA_window_get_event_queue(inner, win));
+			if (MUCOSA_SYSTEM(inner) == MU_WINDOW_HEADLESS) {
+				muCOSATS_event_thread_wake(inner);
+			}
+			if (result) {}
+			#else
+			muCOSATS_lock_window(inner, win, MU_TRUE);
+			muCOSA_window_update_unlocked(context, result, win);
+			muCOSATS_unlock_window(inner, win, MU_TRUE);
+			#endif
+		}
 
-				// To avoid parameter warnings in certain circumstances
-				if (result) {} if (win) {}
+		MUDEF size_m muCOSA_window_poll_events(muCOSAContext* context, muWindow win, muEvent* events, size_m max) {
+			// (Events are handed off without a lock in event-thread mode)
+			#ifdef MUCOSA_EVENT_THREAD
+			return muCOSA_window_poll_events_unlocked(context, win, events, max);
+			#else
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSATS_lock_window(inner, win, MU_FALSE);
+			size_m res = muCOSA_window_poll_events_unlocked(context, win, events, max);
+			muCOSATS_unlock_window(inner, win, MU_FALSE);
+			return res;
+			#endif
+		}
 
-				// Fallback for non-OpenGL support:
-				#else
-				MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_GRAPHICS_API)
+		MUDEF void muCOSA_window_get(muCOSAContext* context, muCOSAResult* result, muWindow win, muWindowAttrib attrib, void* data) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			// (Keymaps are retrieved without a lock in event-thread mode)
+			#ifdef MUCOSA_EVENT_THREAD
+			if (muCOSATS_event_thread_get_keymap(inner, win, attrib, data)) {
 				return;
-				if (context) {} if (result) {} if (win) {}
-				#endif
 			}
+			#endif
+			muCOSATS_lock_window(inner, win, MU_FALSE);
+			muCOSA_window_get_unlocked(context, result, win, attrib, data);
+			muCOSATS_unlock_window(inner, win, MU_FALSE);
+		}
 
-			MUDEF void* muCOSA_gl_get_proc_address(muCOSAContext* context, const char* name) {
-				#ifdef MU_SUPPORT_OPENGL
-				// Get inner from context
-				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+		MUDEF void muCOSA_window_set(muCOSAContext* context, muCOSAResult* result, muWindow win, muWindowAttrib attrib, void* data) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			#ifdef MUCOSA_EVENT_THREAD
+			muCOSA_CallArgs args = MU_ZERO_STRUCT(muCOSA_CallArgs);
+			args.context = context;
+			args.result = result;
+			args.win = win;
+			args.attrib = attrib;
+			args.data = data;
+			if (muCOSATS_event_thread_call(inner, muCOSATS_call_window_set, &args)) {
+				return;
+			}
+			#endif
+			muCOSATS_lock_window(inner, win, MU_TRUE);
+			muCOSA_window_set_unlocked(context, result, win, attrib, data);
+			muCOSATS_unlock_window(inner, win, MU_TRUE);
+		}
 
-				// Do things based on window system
-				switch (inner->system) {
-					default: return 0; break;
+		MUDEF void muCOSA_window_get_batch(muCOSAContext* context, muCOSAResult* result, muWindow win, size_m count, muWindowAttrib* attribs, void** data) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSATS_lock_window(inner, win, MU_FALSE);
+			muCOSA_window_get_batch_unlocked(context, result, win, count, attribs, data);
+			muCOSATS_unlock_window(inner, win, MU_FALSE);
+		}
 
-					// Win32
-					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-						return muCOSAW32_gl_get_proc_address(name);
-					} break;)
-				}
+		MUDEF void muCOSA_window_get_text_input(muCOSAContext* context, muCOSAResult* result, muWindow win, uint32_m text_cursor_x, uint32_m text_cursor_y, void (*callback)(muWindow window, uint8_m* data)) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			#ifdef MUCOSA_EVENT_THREAD
+			muCOSA_CallArgs args = MU_ZERO_STRUCT(muCOSA_CallArgs);
+			args.context = context;
+			args.result = result;
+			args.win = win;
+			args.x = text_cursor_x;
+			args.y = text_cursor_y;
+			args.callback = callback;
+			if (muCOSATS_event_thread_call(inner, muCOSATS_call_window_get_text_input, &args)) {
+				return;
+			}
+			#endif
+			muCOSATS_lock_window(inner, win, MU_FALSE);
+			muCOSA_window_get_text_input_unlocked(context, result, win, text_cursor_x, text_cursor_y, callback);
+			muCOSATS_unlock_window(inner, win, MU_FALSE);
+		}
 
-				// To avoid parameter warnings in certain circumstances
-				if (name) {}
+		MUDEF void muCOSA_window_let_text_input(muCOSAContext* context, muWindow win) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			#ifdef MUCOSA_EVENT_THREAD
+			muCOSA_CallArgs args = MU_ZERO_STRUCT(muCOSA_CallArgs);
+			args.context = context;
+			args.win = win;
+			if (muCOSATS_event_thread_call(inner, muCOSATS_call_window_let_text_input, &args)) {
+				return;
+			}
+			#endif
+			muCOSATS_lock_window(inner, win, MU_TRUE);
+			muCOSA_window_let_text_input_unlocked(context, win);
+			muCOSATS_unlock_window(inner, win, MU_TRUE);
+		}
 
-				// Fallback for non-OpenGL support:
-				#else
-				return 0;
-				if (context) {} if (name) {}
-				#endif
+		MUDEF void muCOSA_window_update_text_cursor(muCOSAContext* context, muCOSAResult* result, muWindow win, uint32_m x, uint32_m y) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			#ifdef MUCOSA_EVENT_THREAD
+			muCOSA_CallArgs args = MU_ZERO_STRUCT(muCOSA_CallArgs);
+			args.context = context;
+			args.result = result;
+			args.win = win;
+			args.x = x;
+			args.y = y;
+			if (muCOSATS_event_thread_call(inner, muCOSATS_call_window_update_text_cursor, &args)) {
+				return;
 			}
+			#endif
+			muCOSATS_lock_window(inner, win, MU_TRUE);
+			muCOSA_window_update_text_cursor_unlocked(context, result, win, x, y);
+			muCOSATS_unlock_window(inner, win, MU_TRUE);
+		}
 
-			MUDEF muBool muCOSA_gl_swap_interval(muCOSAContext* context, muCOSAResult* result, int interval) {
-				#ifdef MU_SUPPORT_OPENGL
-				// Get inner from context
-				muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+		MUDEF void muCOSA_window_inject_key(muCOSAContext* context, muCOSAResult* result, muWindow win, muKeyboardKey key, muBool status) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSATS_lock_window(inner, win, MU_TRUE);
+			muCOSA_window_inject_key_unlocked(context, result, win, key, status);
+			muCOSATS_unlock_window(inner, win, MU_TRUE);
+			#ifdef MUCOSA_EVENT_THREAD
+			muCOSATS_event_thread_wake(inner);
+			#endif
+		}
 
-				// Do things based on window system
-				switch (inner->system) {
-					default: return 0; break;
+		MUDEF void muCOSA_window_inject_keystate(muCOSAContext* context, muCOSAResult* result, muWindow win, muKeyboardState state, muBool status) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSATS_lock_window(inner, win, MU_TRUE);
+			muCOSA_window_inject_keystate_unlocked(context, result, win, state, status);
+			muCOSATS_unlock_window(inner, win, MU_TRUE);
+			#ifdef MUCOSA_EVENT_THREAD
+			muCOSATS_event_thread_wake(inner);
+			#endif
+		}
 
-					// Win32
-					MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-						return muCOSAW32_gl_swap_interval((muCOSAW32_Context*)inner->context, result, interval);
-					} break;)
-				}
+		MUDEF void muCOSA_window_inject_mouse_key(muCOSAContext* context, muCOSAResult* result, muWindow win, muMouseKey key, muBool status) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSATS_lock_window(inner, win, MU_TRUE);
+			muCOSA_window_inject_mouse_key_unlocked(context, result, win, key, status);
+			muCOSATS_unlock_window(inner, win, MU_TRUE);
+			#ifdef MUCOSA_EVENT_THREAD
+			muCOSATS_event_thread_wake(inner);
+			#endif
+		}
 
-				// Fallback for non-OpenGL support
-				#else
-				MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_GRAPHICS_API)
-				return 0;
-				if (context) {} if (result) {} if (interval) {}
-				#endif
-			}
+		MUDEF void muCOSA_window_inject_cursor(muCOSAContext* context, muCOSAResult* result, muWindow win, int32_m x, int32_m y) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSATS_lock_window(inner, win, MU_TRUE);
+			muCOSA_window_inject_cursor_unlocked(context, result, win, x, y);
+			muCOSATS_unlock_window(inner, win, MU_TRUE);
+			#ifdef MUCOSA_EVENT_THREAD
+			muCOSATS_event_thread_wake(inner);
+			#endif
+		}
 
-	/* Time */
+		MUDEF void muCOSA_window_inject_raw_motion(muCOSAContext* context, muCOSAResult* result, muWindow win, double dx, double dy) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSATS_lock_window(inner, win, MU_TRUE);
+			muCOSA_window_inject_raw_motion_unlocked(context, result, win, dx, dy);
+			muCOSATS_unlock_window(inner, win, MU_TRUE);
+			#ifdef MUCOSA_EVENT_THREAD
+			muCOSATS_event_thread_wake(inner);
+			#endif
+		}
 
-		MUDEF double muCOSA_fixed_time_get(muCOSAContext* context) {
-			// Get inner from context
+		MUDEF void muCOSA_window_inject_scroll(muCOSAContext* context, muCOSAResult* result, muWindow win, int32_m add) {
 			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSATS_lock_window(inner, win, MU_TRUE);
+			muCOSA_window_inject_scroll_unlocked(context, result, win, add);
+			muCOSATS_unlock_window(inner, win, MU_TRUE);
+			#ifdef MUCOSA_EVENT_THREAD
+			muCOSATS_event_thread_wake(inner);
+			#endif
+		}
 
-			// Do things based on window system
-			switch (inner->system) {
-				default: return 0.0; break;
+		MUDEF void muCOSA_window_inject_text(muCOSAContext* context, muCOSAResult* result, muWindow win, uint8_m* text) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSATS_lock_window(inner, win, MU_TRUE);
+			muCOSA_window_inject_text_unlocked(context, result, win, text);
+			muCOSATS_unlock_window(inner, win, MU_TRUE);
+			#ifdef MUCOSA_EVENT_THREAD
+			muCOSATS_event_thread_wake(inner);
+			#endif
+		}
 
-				// Win32
-				MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-					return muCOSAW32_fixed_time_get((muCOSAW32_Context*)inner->context);
-				} break;)
-			}
+		MUDEF void muCOSA_window_inject_dimensions(muCOSAContext* context, muCOSAResult* result, muWindow win, uint32_m width, uint32_m height) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSATS_lock_window(inner, win, MU_TRUE);
+			muCOSA_window_inject_dimensions_unlocked(context, result, win, width, height);
+			muCOSATS_unlock_window(inner, win, MU_TRUE);
+			#ifdef MUCOSA_EVENT_THREAD
+			muCOSATS_event_thread_wake(inner);
+			#endif
 		}
 
-		MUDEF double muCOSA_time_get(muCOSAContext* context) {
-			// Get inner from context
+		MUDEF void muCOSA_window_inject_position(muCOSAContext* context, muCOSAResult* result, muWindow win, int32_m x, int32_m y) {
 			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSATS_lock_window(inner, win, MU_TRUE);
+			muCOSA_window_inject_position_unlocked(context, result, win, x, y);
+			muCOSATS_unlock_window(inner, win, MU_TRUE);
+			#ifdef MUCOSA_EVENT_THREAD
+			muCOSATS_event_thread_wake(inner);
+			#endif
+		}
 
-			// Do things based on window system
-			switch (inner->system) {
-				default: return 0.0; break;
+		MUDEF void muCOSA_window_inject_close(muCOSAContext* context, muCOSAResult* result, muWindow win) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSATS_lock_window(inner, win, MU_TRUE);
+			muCOSA_window_inject_close_unlocked(context, result, win);
+			muCOSATS_unlock_window(inner, win, MU_TRUE);
+			#ifdef MUCOSA_EVENT_THREAD
+			muCOSATS_event_thread_wake(inner);
+			#endif
+		}
 
-				// Win32
-				MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-					return muCOSAW32_time_get((muCOSAW32_Context*)inner->context);
-				} break;)
-			}
+		MUDEF void muCOSA_window_record_start(muCOSAContext* context, muCOSAResult* result, muWindow win, const char* path) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSATS_lock_window(inner, win, MU_TRUE);
+			muCOSA_window_record_start_unlocked(context, result, win, path);
+			muCOSATS_unlock_window(inner, win, MU_TRUE);
 		}
 
-		MUDEF void muCOSA_time_set(muCOSAContext* context, double time) {
-			// Get inner from context
+		MUDEF void muCOSA_window_record_stop(muCOSAContext* context, muCOSAResult* result, muWindow win) {
 			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSATS_lock_window(inner, win, MU_FALSE);
+			muCOSA_window_record_stop_unlocked(context, result, win);
+			muCOSATS_unlock_window(inner, win, MU_FALSE);
+		}
 
-			// Do things based on window system
-			switch (inner->system) {
-				default: return; break;
+		MUDEF void muCOSA_window_replay_start(muCOSAContext* context, muCOSAResult* result, muWindow win, const char* path, muBool realtime) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSATS_lock_window(inner, win, MU_TRUE);
+			muCOSA_window_replay_start_unlocked(context, result, win, path, realtime);
+			muCOSATS_unlock_window(inner, win, MU_TRUE);
+			#ifdef MUCOSA_EVENT_THREAD
+			muCOSATS_event_thread_wake(inner);
+			#endif
+		}
 
-				// Win32
-				MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-					muCOSAW32_time_set((muCOSAW32_Context*)inner->context, time);
-					return;
-				} break;)
-			}
+		MUDEF void muCOSA_window_replay_stop(muCOSAContext* context, muCOSAResult* result, muWindow win) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSATS_lock_window(inner, win, MU_FALSE);
+			muCOSA_window_replay_stop_unlocked(context, result, win);
+			muCOSATS_unlock_window(inner, win, MU_FALSE);
+		}
 
-			// To avoid parameter warnings in certain cirumstances
-			if (time) {}
+		MUDEF muBool muCOSA_window_get_replaying(muCOSAContext* context, muCOSAResult* result, muWindow win) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSATS_lock_window(inner, win, MU_FALSE);
+			muBool res = muCOSA_window_get_replaying_unlocked(context, result, win);
+			muCOSATS_unlock_window(inner, win, MU_FALSE);
+			return res;
 		}
 
-	/* Sleep */
+		MUDEF uint32_m*muCOSA_window_get_pixels(muCOSAContext* context, muCOSAResult* result, muWindow win, uint32_m width, uint32_m height, uint32_m* stride) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSATS_lock_window(inner, win, MU_FALSE);
+			uint32_m*res = muCOSA_window_get_pixels_unlocked(context, result, win, width, height, stride);
+			muCOSATS_unlock_window(inner, win, MU_FALSE);
+			return res;
+		}
 
-		MUDEF void muCOSA_sleep(muCOSAContext* context, double time) {
-			// Get inner from context
+		MUDEF muBool muCOSA_window_pixels_busy(muCOSAContext* context, muCOSAResult* result, muWindow win, uint32_m* pixels) {
 			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSATS_lock_window(inner, win, MU_FALSE);
+			muBool res = muCOSA_window_pixels_busy_unlocked(context, result, win, pixels);
+			muCOSATS_unlock_window(inner, win, MU_FALSE);
+			return res;
+		}
 
-			// Do things based on window system
-			switch (inner->system) {
-				default: return; break;
+		MUDEF void muCOSA_window_present_pixels(muCOSAContext* context, muCOSAResult* result, muWindow win, uint32_m* pixels, uint32_m stride, muPixelRect* rect) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSATS_lock_window(inner, win, MU_FALSE);
+			muCOSA_window_present_pixels_unlocked(context, result, win, pixels, stride, rect);
+			muCOSATS_unlock_window(inner, win, MU_FALSE);
+		}
 
-				// Win32
-				MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-					muCOSAW32_sleep(time);
-					return;
-				} break;)
-			}
+		MUDEF muGLContext muCOSA_gl_context_create(muCOSAContext* context, muCOSAResult* result, muWindow win, muGraphicsAPI api) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSATS_lock_window(inner, win, MU_TRUE);
+			muGLContext res = muCOSA_gl_context_create_unlocked(context, result, win, api);
+			muCOSATS_unlock_window(inner, win, MU_TRUE);
+			return res;
+		}
 
-			// To avoid parameter warnings in certain circumstances
-			if (time) {}
+		MUDEF muGLContext muCOSA_gl_context_create_offscreen(muCOSAContext* context, muCOSAResult* result, muGraphicsAPI api, muPixelFormat* format) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSA_lock(&inner->lock);
+			muGLContext res = muCOSA_gl_context_create_offscreen_unlocked(context, result, api, format);
+			muCOSATS_unlock_context(inner);
+			return res;
 		}
 
-	/* Clipboard */
+		MUDEF muGLContext muCOSA_gl_context_destroy(muCOSAContext* context, muWindow win, muGLContext gl_context) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSATS_lock_window(inner, win, MU_TRUE);
+			muGLContext res = muCOSA_gl_context_destroy_unlocked(context, win, gl_context);
+			muCOSATS_unlock_window(inner, win, MU_TRUE);
+			return res;
+		}
 
-		MUDEF uint8_m* muCOSA_clipboard_get(muCOSAContext* context, muCOSAResult* result) {
-			// Get inner from context
+		MUDEF void muCOSA_gl_bind(muCOSAContext* context, muCOSAResult* result, muWindow win, muGLContext gl_context) {
 			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSATS_lock_window(inner, win, MU_TRUE);
+			muCOSA_gl_bind_unlocked(context, result, win, gl_context);
+			muCOSATS_unlock_window(inner, win, MU_TRUE);
+		}
 
-			// Do things based on window system
-			switch (inner->system) {
-				default: return 0; break;
+		MUDEF void muCOSA_gl_swap_buffers(muCOSAContext* context, muCOSAResult* result, muWindow win) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSATS_lock_window(inner, win, MU_TRUE);
+			muCOSA_gl_swap_buffers_unlocked(context, result, win);
+			muCOSATS_unlock_window(inner, win, MU_TRUE);
+		}
 
-				// Win32
-				MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-					return muCOSAW32_clipboard_get(result);
-				} break;)
-			}
+		MUDEF void*muCOSA_gl_get_proc_address(muCOSAContext* context, const char* name) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSA_lock(&inner->lock);
+			void*res = muCOSA_gl_get_proc_address_unlocked(context, name);
+			muCOSATS_unlock_context(inner);
+			return res;
+		}
 
-			// To avoid unused parameter warnings in some circumstances
-			if (result) {}
+		MUDEF muBool muCOSA_gl_swap_interval(muCOSAContext* context, muCOSAResult* result, int interval) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSA_lock(&inner->lock);
+			muBool res = muCOSA_gl_swap_interval_unlocked(context, result, interval);
+			muCOSATS_unlock_context(inner);
+			return res;
 		}
 
-		MUDEF void muCOSA_clipboard_set(muCOSAContext* context, muCOSAResult* result, uint8_m* data, size_m datalen) {
-			// Get inner from context
+		MUDEF const char**muCOSA_vk_get_instance_extensions(muCOSAContext* context, muCOSAResult* result, size_m* count) {
 			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSA_lock(&inner->lock);
+			const char**res = muCOSA_vk_get_instance_extensions_unlocked(context, result, count);
+			muCOSATS_unlock_context(inner);
+			return res;
+		}
 
-			// Do things based on window system
-			switch (inner->system) {
-				default: return; break;
+		MUDEF void muCOSA_vk_create_surface(muCOSAContext* context, muCOSAResult* result, muWindow win, void* instance, void* allocator, void* surface) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSATS_lock_window(inner, win, MU_TRUE);
+			muCOSA_vk_create_surface_unlocked(context, result, win, instance, allocator, surface);
+			muCOSATS_unlock_window(inner, win, MU_TRUE);
+		}
 
-				// Win32
-				MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-					muCOSAW32_clipboard_set(result, data, datalen);
-					return;
-				} break;)
-			}
+		MUDEF double muCOSA_fixed_time_get(muCOSAContext* context) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSA_lock(&inner->lock);
+			double res = muCOSA_fixed_time_get_unlocked(context);
+			muCOSATS_unlock_context(inner);
+			return res;
+		}
 
-			// To avoid unused parameter warnings in some circumstances
-			if (result) {} if (data) {} if (datalen) {}
+		MUDEF double muCOSA_time_get(muCOSAContext* context) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSA_lock(&inner->lock);
+			double res = muCOSA_time_get_unlocked(context);
+			muCOSATS_unlock_context(inner);
+			return res;
+		}
+
+		MUDEF void muCOSA_time_set(muCOSAContext* context, double time) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSA_lock(&inner->lock);
+			muCOSA_time_set_unlocked(context, time);
+			muCOSATS_unlock_context(inner);
 		}
 
+		MUDEF uint8_m*muCOSA_clipboard_get(muCOSAContext* context, muCOSAResult* result) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSA_lock(&inner->lock);
+			uint8_m*res = muCOSA_clipboard_get_unlocked(context, result);
+			muCOSATS_unlock_context(inner);
+			return res;
+		}
+
+		MUDEF void muCOSA_clipboard_set(muCOSAContext* context, muCOSAResult* result, uint8_m* data, size_m datalen) {
+			muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			muCOSA_lock(&inner->lock);
+			muCOSA_clipboard_set_unlocked(context, result, data, datalen);
+			muCOSATS_unlock_context(inner);
+		}
+
+	#endif /* MUCOSA_THREAD_SAFE */
+
 	/* Result */
 
 		MUDEF muBool muCOSA_result_is_fatal(muCOSAResult result) {
@@ -4841,6 +17556,8 @@ Uncommon pixel formats (such as no-alpha pixel formats) are not tested thoroughl
 				case MUCOSA_WIN32_FAILED_FIND_WGL_CREATE_CONTEXT_ATTRIBS:
 				case MUCOSA_WIN32_FAILED_FIND_WGL_CHOOSE_PIXEL_FORMAT:
 				case MUCOSA_WIN32_FAILED_CHOOSE_WGL_PIXEL_FORMAT:
+				case MUCOSA_X11_FAILED_CHOOSE_GLX_CONFIG:
+				case MUCOSA_EGL_FAILED_CHOOSE_CONFIG:
 					return MU_FALSE;
 				break;
 			}
@@ -4860,6 +17577,16 @@ Uncommon pixel formats (such as no-alpha pixel formats) are not tested thoroughl
 				case MUCOSA_FAILED_REALLOC: return "MUCOSA_FAILED_REALLOC"; break;
 				case MUCOSA_FAILED_UNKNOWN_GRAPHICS_API: return "MUCOSA_FAILED_UNKNOWN_GRAPHICS_API"; break;
 				case MUCOSA_FAILED_UNSUPPORTED_GRAPHICS_API: return "MUCOSA_FAILED_UNSUPPORTED_GRAPHICS_API"; break;
+				case MUCOSA_FAILED_UNSUPPORTED_FEATURE: return "MUCOSA_FAILED_UNSUPPORTED_FEATURE"; break;
+				case MUCOSA_FAILED_UNKNOWN_INPUT: return "MUCOSA_FAILED_UNKNOWN_INPUT"; break;
+				case MUCOSA_FAILED_PIXELS_BUSY: return "MUCOSA_FAILED_PIXELS_BUSY"; break;
+				case MUCOSA_FAILED_FIND_VULKAN_FUNCTION: return "MUCOSA_FAILED_FIND_VULKAN_FUNCTION"; break;
+				case MUCOSA_FAILED_CREATE_VULKAN_SURFACE: return "MUCOSA_FAILED_CREATE_VULKAN_SURFACE"; break;
+				case MUCOSA_FAILED_OPEN_FILE: return "MUCOSA_FAILED_OPEN_FILE"; break;
+				case MUCOSA_FAILED_WRITE_FILE: return "MUCOSA_FAILED_WRITE_FILE"; break;
+				case MUCOSA_FAILED_INVALID_RECORDING: return "MUCOSA_FAILED_INVALID_RECORDING"; break;
+				case MUCOSA_FAILED_CREATE_LOCK: return "MUCOSA_FAILED_CREATE_LOCK"; break;
+				case MUCOSA_FAILED_CREATE_THREAD: return "MUCOSA_FAILED_CREATE_THREAD"; break;
 
 				case MUCOSA_WIN32_FAILED_CONVERT_UTF8_TO_WCHAR: return "MUCOSA_WIN32_FAILED_CONVERT_UTF8_TO_WCHAR"; break;
 				case MUCOSA_WIN32_FAILED_REGISTER_WINDOW_CLASS: return "MUCOSA_WIN32_FAILED_REGISTER_WINDOW_CLASS"; break;
@@ -4890,6 +17617,41 @@ Uncommon pixel formats (such as no-alpha pixel formats) are not tested thoroughl
 				case MUCOSA_WIN32_FAILED_CONVERT_CLIPBOARD_DATA_FORMAT: return "MUCOSA_WIN32_FAILED_CONVERT_CLIPBOARD_DATA_FORMAT"; break;
 				case MUCOSA_WIN32_FAILED_ALLOCATE_CLIPBOARD_DATA: return "MUCOSA_WIN32_FAILED_ALLOCATE_CLIPBOARD_DATA"; break;
 				case MUCOSA_WIN32_FAILED_SET_CLIPBOARD_DATA: return "MUCOSA_WIN32_FAILED_SET_CLIPBOARD_DATA"; break;
+				case MUCOSA_WIN32_FAILED_REGISTER_RAW_INPUT: return "MUCOSA_WIN32_FAILED_REGISTER_RAW_INPUT"; break;
+
+				case MUCOSA_X11_FAILED_CONNECT_DISPLAY: return "MUCOSA_X11_FAILED_CONNECT_DISPLAY"; break;
+				case MUCOSA_X11_FAILED_CREATE_WINDOW: return "MUCOSA_X11_FAILED_CREATE_WINDOW"; break;
+				case MUCOSA_X11_FAILED_GET_WINDOW_ATTRIB: return "MUCOSA_X11_FAILED_GET_WINDOW_ATTRIB"; break;
+				case MUCOSA_X11_FAILED_SET_WINDOW_ATTRIB: return "MUCOSA_X11_FAILED_SET_WINDOW_ATTRIB"; break;
+				case MUCOSA_X11_FAILED_SET_TEXT_CURSOR: return "MUCOSA_X11_FAILED_SET_TEXT_CURSOR"; break;
+				case MUCOSA_X11_FAILED_GET_CLIPBOARD_DATA: return "MUCOSA_X11_FAILED_GET_CLIPBOARD_DATA"; break;
+				case MUCOSA_X11_FAILED_SET_CLIPBOARD_DATA: return "MUCOSA_X11_FAILED_SET_CLIPBOARD_DATA"; break;
+				case MUCOSA_X11_FAILED_LOAD_GLX: return "MUCOSA_X11_FAILED_LOAD_GLX"; break;
+				case MUCOSA_X11_FAILED_FIND_GLX_CONFIG: return "MUCOSA_X11_FAILED_FIND_GLX_CONFIG"; break;
+				case MUCOSA_X11_FAILED_CHOOSE_GLX_CONFIG: return "MUCOSA_X11_FAILED_CHOOSE_GLX_CONFIG"; break;
+				case MUCOSA_X11_FAILED_CREATE_GLX_CONTEXT: return "MUCOSA_X11_FAILED_CREATE_GLX_CONTEXT"; break;
+				case MUCOSA_X11_FAILED_MAKE_GLX_CURRENT: return "MUCOSA_X11_FAILED_MAKE_GLX_CURRENT"; break;
+				case MUCOSA_X11_FAILED_FIND_GLX_FUNCTION: return "MUCOSA_X11_FAILED_FIND_GLX_FUNCTION"; break;
+				case MUCOSA_X11_FAILED_CREATE_IMAGE: return "MUCOSA_X11_FAILED_CREATE_IMAGE"; break;
+				case MUCOSA_X11_FAILED_CREATE_GLX_PBUFFER: return "MUCOSA_X11_FAILED_CREATE_GLX_PBUFFER"; break;
+				case MUCOSA_X11_FAILED_GRAB_POINTER: return "MUCOSA_X11_FAILED_GRAB_POINTER"; break;
+
+				case MUCOSA_WAYLAND_FAILED_CONNECT_DISPLAY: return "MUCOSA_WAYLAND_FAILED_CONNECT_DISPLAY"; break;
+				case MUCOSA_WAYLAND_FAILED_FIND_GLOBALS: return "MUCOSA_WAYLAND_FAILED_FIND_GLOBALS"; break;
+				case MUCOSA_WAYLAND_FAILED_CREATE_XKB_CONTEXT: return "MUCOSA_WAYLAND_FAILED_CREATE_XKB_CONTEXT"; break;
+				case MUCOSA_WAYLAND_FAILED_CREATE_WINDOW: return "MUCOSA_WAYLAND_FAILED_CREATE_WINDOW"; break;
+				case MUCOSA_WAYLAND_UNSUPPORTED_WINDOW_ATTRIB: return "MUCOSA_WAYLAND_UNSUPPORTED_WINDOW_ATTRIB"; break;
+				case MUCOSA_WAYLAND_FAILED_GET_CLIPBOARD_DATA: return "MUCOSA_WAYLAND_FAILED_GET_CLIPBOARD_DATA"; break;
+				case MUCOSA_WAYLAND_FAILED_SET_CLIPBOARD_DATA: return "MUCOSA_WAYLAND_FAILED_SET_CLIPBOARD_DATA"; break;
+				case MUCOSA_WAYLAND_FAILED_CREATE_BUFFER: return "MUCOSA_WAYLAND_FAILED_CREATE_BUFFER"; break;
+				case MUCOSA_EGL_FAILED_INITIALIZE: return "MUCOSA_EGL_FAILED_INITIALIZE"; break;
+				case MUCOSA_EGL_FAILED_FIND_CONFIG: return "MUCOSA_EGL_FAILED_FIND_CONFIG"; break;
+				case MUCOSA_EGL_FAILED_CHOOSE_CONFIG: return "MUCOSA_EGL_FAILED_CHOOSE_CONFIG"; break;
+				case MUCOSA_EGL_FAILED_CREATE_SURFACE: return "MUCOSA_EGL_FAILED_CREATE_SURFACE"; break;
+				case MUCOSA_EGL_FAILED_CREATE_CONTEXT: return "MUCOSA_EGL_FAILED_CREATE_CONTEXT"; break;
+				case MUCOSA_EGL_FAILED_MAKE_CURRENT: return "MUCOSA_EGL_FAILED_MAKE_CURRENT"; break;
+				case MUCOSA_EGL_FAILED_SWAP_BUFFERS: return "MUCOSA_EGL_FAILED_SWAP_BUFFERS"; break;
+				case MUCOSA_EGL_FAILED_SWAP_INTERVAL: return "MUCOSA_EGL_FAILED_SWAP_INTERVAL"; break;
 			}
 		}
 
@@ -4899,6 +17661,9 @@ Uncommon pixel formats (such as no-alpha pixel formats) are not tested thoroughl
 
 				case MU_WINDOW_NULL: return "MU_WINDOW_NULL"; break;
 				case MU_WINDOW_WIN32: return "MU_WINDOW_WIN32"; break;
+				case MU_WINDOW_X11: return "MU_WINDOW_X11"; break;
+				case MU_WINDOW_WAYLAND: return "MU_WINDOW_WAYLAND"; break;
+				case MU_WINDOW_HEADLESS: return "MU_WINDOW_HEADLESS"; break;
 			}
 		}
 
@@ -4908,6 +17673,9 @@ Uncommon pixel formats (such as no-alpha pixel formats) are not tested thoroughl
 
 				case MU_WINDOW_NULL: return "Unknown/Auto"; break;
 				case MU_WINDOW_WIN32: return "Win32"; break;
+				case MU_WINDOW_X11: return "X11"; break;
+				case MU_WINDOW_WAYLAND: return "Wayland"; break;
+				case MU_WINDOW_HEADLESS: return "Headless"; break;
 			}
 		}
 
@@ -4930,6 +17698,11 @@ Uncommon pixel formats (such as no-alpha pixel formats) are not tested thoroughl
 				case MU_WINDOW_MOUSE_KEY_CALLBACK: return "MU_WINDOW_MOUSE_KEY_CALLBACK"; break;
 				case MU_WINDOW_CURSOR_CALLBACK: return "MU_WINDOW_CURSOR_CALLBACK"; break;
 				case MU_WINDOW_SCROLL_CALLBACK: return "MU_WINDOW_SCROLL_CALLBACK"; break;
+				case MU_WINDOW_FRAME_CALLBACK: return "MU_WINDOW_FRAME_CALLBACK"; break;
+				case MU_WINDOW_EVENT_TIME: return "MU_WINDOW_EVENT_TIME"; break;
+				case MU_WINDOW_RAW_MOTION_CALLBACK: return "MU_WINDOW_RAW_MOTION_CALLBACK"; break;
+				case MU_WINDOW_RAW_MOTION: return "MU_WINDOW_RAW_MOTION"; break;
+				case MU_WINDOW_POINTER_LOCK: return "MU_WINDOW_POINTER_LOCK"; break;
 			}
 		}
 
@@ -4952,6 +17725,43 @@ Uncommon pixel formats (such as no-alpha pixel formats) are not tested thoroughl
 				case MU_WINDOW_MOUSE_KEY_CALLBACK: return "Mouse key callback"; break;
 				case MU_WINDOW_CURSOR_CALLBACK: return "Cursor callback"; break;
 				case MU_WINDOW_SCROLL_CALLBACK: return "Scroll callback"; break;
+				case MU_WINDOW_FRAME_CALLBACK: return "Frame callback"; break;
+				case MU_WINDOW_EVENT_TIME: return "Event time"; break;
+				case MU_WINDOW_RAW_MOTION_CALLBACK: return "Raw motion callback"; break;
+				case MU_WINDOW_RAW_MOTION: return "Raw motion"; break;
+				case MU_WINDOW_POINTER_LOCK: return "Pointer lock"; break;
+			}
+		}
+
+		MUDEF const char* mu_event_type_get_name(muEventType type) {
+			switch (type) {
+				default: return "MU_UNKNOWN"; break;
+				case MU_EVENT_DIMENSIONS: return "MU_EVENT_DIMENSIONS"; break;
+				case MU_EVENT_POSITION: return "MU_EVENT_POSITION"; break;
+				case MU_EVENT_KEYBOARD: return "MU_EVENT_KEYBOARD"; break;
+				case MU_EVENT_KEYSTATE: return "MU_EVENT_KEYSTATE"; break;
+				case MU_EVENT_MOUSE_KEY: return "MU_EVENT_MOUSE_KEY"; break;
+				case MU_EVENT_CURSOR: return "MU_EVENT_CURSOR"; break;
+				case MU_EVENT_SCROLL: return "MU_EVENT_SCROLL"; break;
+				case MU_EVENT_TEXT: return "MU_EVENT_TEXT"; break;
+				case MU_EVENT_CLOSE: return "MU_EVENT_CLOSE"; break;
+				case MU_EVENT_RAW_MOTION: return "MU_EVENT_RAW_MOTION"; break;
+			}
+		}
+
+		MUDEF const char* mu_event_type_get_nice_name(muEventType type) {
+			switch (type) {
+				default: return "Unknown"; break;
+				case MU_EVENT_DIMENSIONS: return "Dimensions"; break;
+				case MU_EVENT_POSITION: return "Position"; break;
+				case MU_EVENT_KEYBOARD: return "Keyboard"; break;
+				case MU_EVENT_KEYSTATE: return "Keystate"; break;
+				case MU_EVENT_MOUSE_KEY: return "Mouse key"; break;
+				case MU_EVENT_CURSOR: return "Cursor"; break;
+				case MU_EVENT_SCROLL: return "Scroll"; break;
+				case MU_EVENT_TEXT: return "Text"; break;
+				case MU_EVENT_CLOSE: return "Close"; break;
+				case MU_EVENT_RAW_MOTION: return "Raw motion"; break;
 			}
 		}
 
@@ -5308,6 +18118,7 @@ Uncommon pixel formats (such as no-alpha pixel formats) are not tested thoroughl
 				case MU_OPENGL_4_5_COMPATIBILITY: return "MU_OPENGL_4_5_COMPATIBILITY"; break;
 				case MU_OPENGL_4_6_CORE: return "MU_OPENGL_4_6_CORE"; break;
 				case MU_OPENGL_4_6_COMPATIBILITY: return "MU_OPENGL_4_6_COMPATIBILITY"; break;
+				case MU_VULKAN: return "MU_VULKAN"; break;
 			}
 		}
 
@@ -5344,6 +18155,7 @@ Uncommon pixel formats (such as no-alpha pixel formats) are not tested thoroughl
 				case MU_OPENGL_4_5_COMPATIBILITY: return "OpenGL 4.5 (Compatibility Profile)"; break;
 				case MU_OPENGL_4_6_CORE: return "OpenGL 4.6 (Core Profile)"; break;
 				case MU_OPENGL_4_6_COMPATIBILITY: return "OpenGL 4.6 (Compatibility Profile)"; break;
+				case MU_VULKAN: return "Vulkan"; break;
 			}
 		}
 	)